@@ -0,0 +1 @@
+#include "/root/repo/src/csma/model/backoff.h"
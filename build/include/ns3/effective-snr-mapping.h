@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/effective-snr-mapping.h"
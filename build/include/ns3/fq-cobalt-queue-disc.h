@@ -0,0 +1 @@
+#include "/root/repo/src/traffic-control/model/fq-cobalt-queue-disc.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/frame-capture-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/model/half-duplex-ideal-phy-signal-parameters.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/internet/model/icmpv6-l4-protocol.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/core/model/int64x64-128.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/internet/model/ip-fragment-buffer.h"
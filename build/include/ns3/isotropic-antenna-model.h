@@ -0,0 +1 @@
+#include "/root/repo/src/antenna/model/isotropic-antenna-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/propagation/model/jakes-propagation-loss-model.h"
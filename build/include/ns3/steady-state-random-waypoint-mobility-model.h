@@ -0,0 +1 @@
+#include "/root/repo/src/mobility/model/steady-state-random-waypoint-mobility-model.h"
@@ -0,0 +1,135 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This example compares the exact and the tabulated (LookupTables attribute)
+// chunk success rates of the Nist and Yans error rate models.
+//
+// For each model, it outputs the time taken to build the tables, the time
+// taken to compute the success rates of all the HE MCSs over a range of SNRs
+// with and without the tables, and the largest difference between the two.
+
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/double.h"
+#include "ns3/error-rate-model.h"
+#include "ns3/he-phy.h"
+#include "ns3/object-factory.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/wifi-tx-vector.h"
+#include "ns3/wifi-utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * Compute the success rates of all the given modes over a range of SNRs.
+ *
+ * \param model the error rate model
+ * \param modes the modes
+ * \param minSnr the smallest SNR (in dB)
+ * \param maxSnr the largest SNR (in dB)
+ * \param stepSnr the step between two SNRs (in dB)
+ * \param nbits the number of bits of the chunks
+ * \return the success rates
+ */
+static std::vector<double>
+ComputeSuccessRates(Ptr<ErrorRateModel> model,
+                    const std::vector<WifiMode>& modes,
+                    double minSnr,
+                    double maxSnr,
+                    double stepSnr,
+                    uint64_t nbits)
+{
+    std::vector<double> successRates;
+    for (const auto& mode : modes)
+    {
+        WifiTxVector txVector;
+        txVector.SetMode(mode);
+        for (double snr = minSnr; snr <= maxSnr; snr += stepSnr)
+        {
+            successRates.push_back(
+                model->GetChunkSuccessRate(mode, txVector, DbToRatio(snr), nbits));
+        }
+    }
+    return successRates;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint64_t nbits = 1500 * 8;
+    double minSnr = -5;
+    double maxSnr = 45;
+    double stepSnr = 0.001;
+    double maxError = 1e-3;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("size", "The size of the chunks in bits", nbits);
+    cmd.AddValue("minSnr", "The smallest SNR in dB", minSnr);
+    cmd.AddValue("maxSnr", "The largest SNR in dB", maxSnr);
+    cmd.AddValue("stepSnr", "The step between two SNRs in dB", stepSnr);
+    cmd.AddValue("maxError", "The maximum relative error of the tables", maxError);
+    cmd.Parse(argc, argv);
+
+    std::vector<WifiMode> modes;
+    for (uint8_t mcs = 0; mcs <= 11; mcs++)
+    {
+        modes.push_back(HePhy::GetHeMcs(mcs));
+    }
+
+    for (const auto& typeId : {"ns3::NistErrorRateModel", "ns3::YansErrorRateModel"})
+    {
+        ObjectFactory factory;
+        factory.SetTypeId(typeId);
+        Ptr<ErrorRateModel> exact = factory.Create<ErrorRateModel>();
+        factory.Set("LookupTables", BooleanValue(true));
+        factory.Set("LookupTableMaxError", DoubleValue(maxError));
+        Ptr<ErrorRateModel> tabulated = factory.Create<ErrorRateModel>();
+
+        SystemWallClockMs timer;
+        timer.Start();
+        // one success rate per mode builds all the tables
+        ComputeSuccessRates(tabulated, modes, minSnr, minSnr, stepSnr, nbits);
+        int64_t setupMs = timer.End();
+
+        timer.Start();
+        std::vector<double> exactRates =
+            ComputeSuccessRates(exact, modes, minSnr, maxSnr, stepSnr, nbits);
+        int64_t exactMs = timer.End();
+
+        timer.Start();
+        std::vector<double> tabulatedRates =
+            ComputeSuccessRates(tabulated, modes, minSnr, maxSnr, stepSnr, nbits);
+        int64_t tabulatedMs = timer.End();
+
+        double maxDifference = 0;
+        for (std::size_t i = 0; i < exactRates.size(); i++)
+        {
+            maxDifference = std::max(maxDifference, std::abs(exactRates[i] - tabulatedRates[i]));
+        }
+
+        std::cout << typeId << ": " << exactRates.size() << " success rates" << std::endl
+                  << "  tables built in " << setupMs << " ms" << std::endl
+                  << "  exact:     " << exactMs << " ms" << std::endl
+                  << "  tabulated: " << tabulatedMs << " ms" << std::endl
+                  << "  largest difference: " << maxDifference << std::endl;
+    }
+
+    return 0;
+}
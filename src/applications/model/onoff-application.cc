@@ -43,6 +43,9 @@
 #include "ns3/udp-socket-factory.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace ns3
 {
 
@@ -68,6 +71,12 @@ OnOffApplication::GetTypeId()
                           UintegerValue(512),
                           MakeUintegerAccessor(&OnOffApplication::m_pktSize),
                           MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("BurstSize",
+                          "The number of packets sent at once, in a single batch. The bursts "
+                          "are spaced so that the average rate is the data rate.",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&OnOffApplication::m_burstSize),
+                          MakeUintegerChecker<uint32_t>(1))
             .AddAttribute("Remote",
                           "The address of the destination",
                           AddressValue(),
@@ -302,9 +311,9 @@ OnOffApplication::ScheduleNextTx()
 
     if (m_maxBytes == 0 || m_totBytes < m_maxBytes)
     {
-        NS_ABORT_MSG_IF(m_residualBits > m_pktSize * 8,
+        NS_ABORT_MSG_IF(m_residualBits > m_pktSize * 8 * m_burstSize,
                         "Calculation to compute next send time will overflow");
-        uint32_t bits = m_pktSize * 8 - m_residualBits;
+        uint32_t bits = m_pktSize * 8 * m_burstSize - m_residualBits;
         NS_LOG_LOGIC("bits = " << bits);
         Time nextTime(
             Seconds(bits / static_cast<double>(m_cbrRate.GetBitRate()))); // Time till next packet
@@ -344,12 +353,81 @@ OnOffApplication::SendPacket()
 
     NS_ASSERT(m_sendEvent.IsExpired());
 
-    Ptr<Packet> packet;
+    if (m_burstSize > 1)
+    {
+        SendBurst();
+    }
+    else
+    {
+        Ptr<Packet> packet;
+        if (m_unsentPacket)
+        {
+            packet = m_unsentPacket;
+        }
+        else
+        {
+            packet = CreatePacket();
+        }
+
+        int actual = m_socket->Send(packet);
+        if ((unsigned)actual == m_pktSize)
+        {
+            PacketSent(packet);
+            m_unsentPacket = nullptr;
+        }
+        else
+        {
+            NS_LOG_DEBUG("Unable to send packet; actual " << actual << " size " << m_pktSize
+                                                          << "; caching for later attempt");
+            m_unsentPacket = packet;
+        }
+    }
+    m_residualBits = 0;
+    m_lastStartTime = Simulator::Now();
+    ScheduleNextTx();
+}
+
+void
+OnOffApplication::SendBurst()
+{
+    NS_LOG_FUNCTION(this);
+
+    std::vector<Ptr<Packet>> packets;
+    packets.reserve(m_burstSize);
     if (m_unsentPacket)
     {
-        packet = m_unsentPacket;
+        packets.push_back(m_unsentPacket);
+    }
+    uint64_t totBytes = m_totBytes + packets.size() * m_pktSize;
+    while (packets.size() < m_burstSize && (m_maxBytes == 0 || totBytes < m_maxBytes))
+    {
+        packets.push_back(CreatePacket());
+        totBytes += m_pktSize;
     }
-    else if (m_enableSeqTsSizeHeader)
+
+    int sent = std::max(m_socket->SendBatch(packets, 0), 0);
+    for (int i = 0; i < sent; i++)
+    {
+        PacketSent(packets[i]);
+    }
+    m_unsentPacket = nullptr;
+    if (static_cast<std::size_t>(sent) < packets.size())
+    {
+        // Only the first packet that could not be sent is kept; this may cause
+        // a discontinuity in sequence number if the SeqTsSizeHeader is used
+        NS_LOG_DEBUG("Unable to send " << packets.size() - sent << " packets of size " << m_pktSize
+                                       << "; caching one for later attempt");
+        m_unsentPacket = packets[sent];
+    }
+}
+
+Ptr<Packet>
+OnOffApplication::CreatePacket()
+{
+    NS_LOG_FUNCTION(this);
+
+    Ptr<Packet> packet;
+    if (m_enableSeqTsSizeHeader)
     {
         Address from;
         Address to;
@@ -368,43 +446,36 @@ OnOffApplication::SendPacket()
     {
         packet = Create<Packet>(m_pktSize);
     }
+    return packet;
+}
 
-    int actual = m_socket->Send(packet);
-    if ((unsigned)actual == m_pktSize)
+void
+OnOffApplication::PacketSent(Ptr<Packet> packet)
+{
+    NS_LOG_FUNCTION(this << packet);
+
+    m_txTrace(packet);
+    m_totBytes += m_pktSize;
+    Address localAddress;
+    m_socket->GetSockName(localAddress);
+    if (InetSocketAddress::IsMatchingType(m_peer))
     {
-        m_txTrace(packet);
-        m_totBytes += m_pktSize;
-        m_unsentPacket = nullptr;
-        Address localAddress;
-        m_socket->GetSockName(localAddress);
-        if (InetSocketAddress::IsMatchingType(m_peer))
-        {
-            NS_LOG_INFO("At time " << Simulator::Now().As(Time::S) << " on-off application sent "
-                                   << packet->GetSize() << " bytes to "
-                                   << InetSocketAddress::ConvertFrom(m_peer).GetIpv4() << " port "
-                                   << InetSocketAddress::ConvertFrom(m_peer).GetPort()
-                                   << " total Tx " << m_totBytes << " bytes");
-            m_txTraceWithAddresses(packet, localAddress, InetSocketAddress::ConvertFrom(m_peer));
-        }
-        else if (Inet6SocketAddress::IsMatchingType(m_peer))
-        {
-            NS_LOG_INFO("At time " << Simulator::Now().As(Time::S) << " on-off application sent "
-                                   << packet->GetSize() << " bytes to "
-                                   << Inet6SocketAddress::ConvertFrom(m_peer).GetIpv6() << " port "
-                                   << Inet6SocketAddress::ConvertFrom(m_peer).GetPort()
-                                   << " total Tx " << m_totBytes << " bytes");
-            m_txTraceWithAddresses(packet, localAddress, Inet6SocketAddress::ConvertFrom(m_peer));
-        }
+        NS_LOG_INFO("At time " << Simulator::Now().As(Time::S) << " on-off application sent "
+                               << packet->GetSize() << " bytes to "
+                               << InetSocketAddress::ConvertFrom(m_peer).GetIpv4() << " port "
+                               << InetSocketAddress::ConvertFrom(m_peer).GetPort() << " total Tx "
+                               << m_totBytes << " bytes");
+        m_txTraceWithAddresses(packet, localAddress, InetSocketAddress::ConvertFrom(m_peer));
     }
-    else
+    else if (Inet6SocketAddress::IsMatchingType(m_peer))
     {
-        NS_LOG_DEBUG("Unable to send packet; actual " << actual << " size " << m_pktSize
-                                                      << "; caching for later attempt");
-        m_unsentPacket = packet;
+        NS_LOG_INFO("At time " << Simulator::Now().As(Time::S) << " on-off application sent "
+                               << packet->GetSize() << " bytes to "
+                               << Inet6SocketAddress::ConvertFrom(m_peer).GetIpv6() << " port "
+                               << Inet6SocketAddress::ConvertFrom(m_peer).GetPort() << " total Tx "
+                               << m_totBytes << " bytes");
+        m_txTraceWithAddresses(packet, localAddress, Inet6SocketAddress::ConvertFrom(m_peer));
     }
-    m_residualBits = 0;
-    m_lastStartTime = Simulator::Now();
-    ScheduleNextTx();
 }
 
 void
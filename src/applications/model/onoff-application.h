@@ -81,6 +81,11 @@ class Socket;
  * information is cached and used to schedule the next transmission
  * upon restarting.
  *
+ * If the "BurstSize" attribute is larger than one, the packets are sent
+ * in bursts of that size, with a single send event and a single
+ * Socket::SendBatch call per burst.  The bursts are spaced so that the
+ * average rate is still the specified "data rate".
+ *
  * If the underlying socket type supports broadcast, this application
  * will automatically enable the SetAllowBroadcast(true) socket option.
  *
@@ -157,6 +162,20 @@ class OnOffApplication : public Application
      * \brief Send a packet
      */
     void SendPacket();
+    /**
+     * \brief Send a burst of packets with a single Socket::SendBatch call
+     */
+    void SendBurst();
+    /**
+     * \brief Create a new packet, with a SeqTsSizeHeader if enabled
+     * \return the packet
+     */
+    Ptr<Packet> CreatePacket();
+    /**
+     * \brief Update the counters and fire the traces for a packet that was sent
+     * \param packet the packet
+     */
+    void PacketSent(Ptr<Packet> packet);
 
     Ptr<Socket> m_socket;                //!< Associated socket
     Address m_peer;                      //!< Peer address
@@ -167,6 +186,7 @@ class OnOffApplication : public Application
     DataRate m_cbrRate;                  //!< Rate that data is generated
     DataRate m_cbrRateFailSafe;          //!< Rate that data is generated (check copy)
     uint32_t m_pktSize;                  //!< Size of packets
+    uint32_t m_burstSize;                //!< Number of packets sent at once
     uint32_t m_residualBits;             //!< Number of generated, but not sent, bits
     Time m_lastStartTime;                //!< Time last packet sent
     uint64_t m_maxBytes;                 //!< Limit total number of bytes sent
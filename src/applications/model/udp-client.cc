@@ -32,8 +32,10 @@
 #include "ns3/socket.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <vector>
 
 namespace ns3
 {
@@ -76,7 +78,14 @@ UdpClient::GetTypeId()
                           "the size of the header carrying the sequence number and the time stamp.",
                           UintegerValue(1024),
                           MakeUintegerAccessor(&UdpClient::m_size),
-                          MakeUintegerChecker<uint32_t>(12, 65507));
+                          MakeUintegerChecker<uint32_t>(12, 65507))
+            .AddAttribute("BurstSize",
+                          "The number of packets sent at once, in a single batch. The time "
+                          "between two bursts is the packet interval multiplied by the burst "
+                          "size, so that the average rate does not depend on the burst size.",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&UdpClient::m_burstSize),
+                          MakeUintegerChecker<uint32_t>(1));
     return tid;
 }
 
@@ -203,6 +212,13 @@ UdpClient::Send()
 {
     NS_LOG_FUNCTION(this);
     NS_ASSERT(m_sendEvent.IsExpired());
+
+    if (m_burstSize > 1)
+    {
+        SendBurst();
+        return;
+    }
+
     SeqTsHeader seqTs;
     seqTs.SetSeq(m_sent);
     Ptr<Packet> p = Create<Packet>(m_size - (8 + 4)); // 8+4 : the size of the seqTs header
@@ -230,6 +246,54 @@ UdpClient::Send()
     }
 }
 
+void
+UdpClient::SendBurst()
+{
+    NS_LOG_FUNCTION(this);
+
+    uint32_t burst = m_burstSize;
+    if (m_count != 0)
+    {
+        burst = std::min(burst, m_count - m_sent);
+    }
+
+    std::vector<Ptr<Packet>> packets;
+    packets.reserve(burst);
+    for (uint32_t i = 0; i < burst; i++)
+    {
+        SeqTsHeader seqTs;
+        seqTs.SetSeq(m_sent + i);
+        Ptr<Packet> p = Create<Packet>(m_size - (8 + 4)); // 8+4 : the size of the seqTs header
+        p->AddHeader(seqTs);
+        packets.push_back(p);
+    }
+
+    int sent = m_socket->SendBatch(packets, 0);
+    for (int i = 0; i < sent; i++)
+    {
+        ++m_sent;
+        m_totalTx += packets[i]->GetSize();
+#ifdef NS3_LOG_ENABLE
+        NS_LOG_INFO("TraceDelay TX " << m_size << " bytes to " << m_peerAddressString << " Uid: "
+                                     << packets[i]->GetUid()
+                                     << " Time: " << (Simulator::Now()).As(Time::S));
+#endif // NS3_LOG_ENABLE
+    }
+    // The sequence numbers of the packets that could not be sent are reused
+#ifdef NS3_LOG_ENABLE
+    if (sent < static_cast<int>(burst))
+    {
+        NS_LOG_INFO("Error while sending " << burst - std::max(sent, 0) << " packets of " << m_size
+                                           << " bytes to " << m_peerAddressString);
+    }
+#endif // NS3_LOG_ENABLE
+
+    if (m_sent < m_count || m_count == 0)
+    {
+        m_sendEvent = Simulator::Schedule(m_interval * burst, &UdpClient::Send, this);
+    }
+}
+
 uint64_t
 UdpClient::GetTotalTx() const
 {
@@ -82,9 +82,15 @@ class UdpClient : public Application
      */
     void Send();
 
-    uint32_t m_count; //!< Maximum number of packets the application will send
-    Time m_interval;  //!< Packet inter-send time
-    uint32_t m_size;  //!< Size of the sent packet (including the SeqTsHeader)
+    /**
+     * \brief Send a burst of packets with a single Socket::SendBatch call
+     */
+    void SendBurst();
+
+    uint32_t m_count;     //!< Maximum number of packets the application will send
+    Time m_interval;      //!< Packet inter-send time
+    uint32_t m_size;      //!< Size of the sent packet (including the SeqTsHeader)
+    uint32_t m_burstSize; //!< Number of packets sent at once
 
     uint32_t m_sent;       //!< Counter for sent packets
     uint64_t m_totalTx;    //!< Total bytes sent
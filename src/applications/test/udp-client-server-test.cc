@@ -34,6 +34,7 @@
 #include "ns3/uinteger.h"
 
 #include <fstream>
+#include <sstream>
 
 using namespace ns3;
 
@@ -121,6 +122,86 @@ UdpClientServerTestCase::DoRun()
                           "Did not receive expected number of packets !");
 }
 
+/**
+ * \ingroup applications-test
+ * \ingroup tests
+ *
+ * Test that all the UDP packets generated by an UdpClient application in
+ * burst mode are correctly received by an UdpServer application
+ */
+class UdpClientBurstTestCase : public TestCase
+{
+  public:
+    UdpClientBurstTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+UdpClientBurstTestCase::UdpClientBurstTestCase()
+    : TestCase("Test that all the udp packets generated by an udpClient application in burst mode "
+               "are correctly received by an udpServer application")
+{
+}
+
+void
+UdpClientBurstTestCase::DoRun()
+{
+    NodeContainer n;
+    n.Create(2);
+
+    InternetStackHelper internet;
+    internet.Install(n);
+
+    // link the two nodes
+    Ptr<SimpleNetDevice> txDev = CreateObject<SimpleNetDevice>();
+    Ptr<SimpleNetDevice> rxDev = CreateObject<SimpleNetDevice>();
+    n.Get(0)->AddDevice(txDev);
+    n.Get(1)->AddDevice(rxDev);
+    Ptr<SimpleChannel> channel1 = CreateObject<SimpleChannel>();
+    rxDev->SetChannel(channel1);
+    txDev->SetChannel(channel1);
+    NetDeviceContainer d;
+    d.Add(txDev);
+    d.Add(rxDev);
+
+    Ipv4AddressHelper ipv4;
+
+    ipv4.SetBase("10.1.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer i = ipv4.Assign(d);
+
+    // the first burst is queued while the address is being resolved
+    std::ostringstream oss;
+    oss << "/NodeList/" << n.Get(0)->GetId()
+        << "/$ns3::Ipv4L3Protocol/InterfaceList/1/ArpCache/PendingQueueSize";
+    Config::Set(oss.str(), UintegerValue(8));
+
+    uint16_t port = 4000;
+    UdpServerHelper server(port);
+    ApplicationContainer apps = server.Install(n.Get(1));
+    apps.Start(Seconds(1.0));
+    apps.Stop(Seconds(10.0));
+
+    // Bursts of 8 packets every 80 ms: 12 bursts are sent before the
+    // application is stopped, and the last (short) burst is never sent
+    UdpClientHelper client(i.GetAddress(1), port);
+    client.SetAttribute("MaxPackets", UintegerValue(100));
+    client.SetAttribute("Interval", TimeValue(MilliSeconds(10)));
+    client.SetAttribute("PacketSize", UintegerValue(1024));
+    client.SetAttribute("BurstSize", UintegerValue(8));
+    apps = client.Install(n.Get(0));
+    apps.Start(Seconds(2.0));
+    apps.Stop(Seconds(2.95));
+
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(server.GetServer()->GetLost(), 0, "Packets were lost !");
+    NS_TEST_ASSERT_MSG_EQ(server.GetServer()->GetReceived(),
+                          96,
+                          "Did not receive expected number of packets !");
+}
+
 /**
  * Test that all the udp packets generated by an udpTraceClient application are
  * correctly received by an udpServer application
@@ -362,6 +443,7 @@ UdpClientServerTestSuite::UdpClientServerTestSuite()
 {
     AddTestCase(new UdpTraceClientServerTestCase, TestCase::QUICK);
     AddTestCase(new UdpClientServerTestCase, TestCase::QUICK);
+    AddTestCase(new UdpClientBurstTestCase, TestCase::QUICK);
     AddTestCase(new PacketLossCounterTestCase, TestCase::QUICK);
     AddTestCase(new UdpEchoClientSetFillTestCase, TestCase::QUICK);
 }
@@ -28,7 +28,9 @@
 #include "ns3/ethernet-trailer.h"
 #include "ns3/llc-snap-header.h"
 #include "ns3/log.h"
+#include "ns3/net-device-queue-interface.h"
 #include "ns3/pointer.h"
+#include "ns3/queue-item.h"
 #include "ns3/queue.h"
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
@@ -1017,6 +1019,72 @@ CsmaNetDevice::SendFrom(Ptr<Packet> packet,
     return true;
 }
 
+uint32_t
+CsmaNetDevice::SendBatch(const std::vector<Ptr<QueueDiscItem>>& items)
+{
+    NS_LOG_FUNCTION(this << items.size());
+
+    NS_ASSERT(IsLinkUp());
+
+    //
+    // Only transmit if send side of net device is enabled
+    //
+    if (IsSendEnabled() == false)
+    {
+        for (const auto& item : items)
+        {
+            m_macTxDropTrace(item->GetPacket());
+        }
+        return 0;
+    }
+
+    //
+    // Check the queue limits once, at the end of the batch
+    //
+    Ptr<NetDeviceQueue> txq;
+    Ptr<NetDeviceQueueInterface> ndqi = GetObject<NetDeviceQueueInterface>();
+    if (ndqi && ndqi->GetNTxQueues() > 0)
+    {
+        txq = ndqi->GetTxQueue(0);
+        txq->BeginBatch();
+    }
+
+    uint32_t sent = 0;
+    for (const auto& item : items)
+    {
+        Ptr<Packet> packet = item->GetPacket();
+        Mac48Address destination = Mac48Address::ConvertFrom(item->GetAddress());
+        AddHeader(packet, m_address, destination, item->GetProtocol());
+
+        m_macTxTrace(packet);
+
+        if (m_queue->Enqueue(packet) == false)
+        {
+            m_macTxDropTrace(packet);
+            continue;
+        }
+        sent++;
+    }
+
+    if (txq)
+    {
+        txq->EndBatch();
+    }
+
+    //
+    // If the device is idle, start the transmission of the first packet. The
+    // following ones are sent by TransmitReadyEvent, as usual.
+    //
+    if (m_txMachineState == READY && m_queue->IsEmpty() == false)
+    {
+        m_currentPkt = m_queue->Dequeue();
+        m_promiscSnifferTrace(m_currentPkt);
+        m_snifferTrace(m_currentPkt);
+        TransmitStart();
+    }
+    return sent;
+}
+
 Ptr<Node>
 CsmaNetDevice::GetNode() const
 {
@@ -290,6 +290,17 @@ class CsmaNetDevice : public NetDevice
                   const Address& dest,
                   uint16_t protocolNumber) override;
 
+    /**
+     * Start transmitting a batch of packets
+     *
+     * The packets are all placed in the transmit queue before the transmission
+     * of the first one is started, if the device is idle.
+     *
+     * \param items the packets, along with their destination address and protocol number
+     * \return the number of packets that have been placed in the transmit queue
+     */
+    uint32_t SendBatch(const std::vector<Ptr<QueueDiscItem>>& items) override;
+
     /**
      * Get the node to which this device is attached.
      *
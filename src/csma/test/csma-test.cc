@@ -0,0 +1,238 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/csma-channel.h"
+#include "ns3/csma-net-device.h"
+#include "ns3/drop-tail-queue.h"
+#include "ns3/dynamic-queue-limits.h"
+#include "ns3/net-device-queue-interface.h"
+#include "ns3/node.h"
+#include "ns3/queue-item.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \brief Queue disc item passed to SendBatch
+ */
+class CsmaTestItem : public QueueDiscItem
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param p the packet
+     * \param addr the address
+     * \param protocol the protocol number
+     */
+    CsmaTestItem(Ptr<Packet> p, const Address& addr, uint16_t protocol);
+
+    // Delete default constructor, copy constructor and assignment operator to avoid misuse
+    CsmaTestItem() = delete;
+    CsmaTestItem(const CsmaTestItem&) = delete;
+    CsmaTestItem& operator=(const CsmaTestItem&) = delete;
+
+    void AddHeader() override;
+    bool Mark() override;
+};
+
+CsmaTestItem::CsmaTestItem(Ptr<Packet> p, const Address& addr, uint16_t protocol)
+    : QueueDiscItem(p, addr, protocol)
+{
+}
+
+void
+CsmaTestItem::AddHeader()
+{
+}
+
+bool
+CsmaTestItem::Mark()
+{
+    return false;
+}
+
+/**
+ * \brief Test the transmission of a batch of packets by a CsmaNetDevice
+ *
+ * A batch of packets is passed to SendBatch on a device with flow control and
+ * dynamic queue limits. The test checks that the packets are stored in the
+ * device queue, that their bytes are reported to the queue limits and that
+ * the transmission queue is stopped by the queue limits only at the end of
+ * the batch, before the first packet is dequeued for transmission.
+ */
+class CsmaSendBatchTest : public TestCase
+{
+  public:
+    /**
+     * \brief Create the test
+     */
+    CsmaSendBatchTest();
+
+    /**
+     * \brief Run the test
+     */
+    void DoRun() override;
+
+  private:
+    /**
+     * \brief Record the state of the transmission queue after a packet is enqueued
+     *
+     * \param packet The enqueued packet.
+     */
+    void PacketEnqueued(Ptr<const Packet> packet);
+    /**
+     * \brief Record the state of the transmission queue before the first packet is dequeued
+     *
+     * \param packet The dequeued packet.
+     */
+    void PacketDequeued(Ptr<const Packet> packet);
+
+    Ptr<NetDeviceQueue> m_txq;    //!< the transmission queue of the device
+    uint32_t m_enqueued;          //!< number of packets enqueued
+    uint32_t m_enqueuedBytes;     //!< number of bytes enqueued
+    uint32_t m_stoppedOnEnqueue;  //!< number of packets enqueued while the queue was stopped
+    uint32_t m_dequeued;          //!< number of packets dequeued
+    bool m_stoppedOnDequeue;      //!< whether the queue was stopped before the first dequeue
+    int32_t m_availableOnDequeue; //!< bytes available to BQL before the first dequeue
+};
+
+CsmaSendBatchTest::CsmaSendBatchTest()
+    : TestCase("Csma SendBatch"),
+      m_enqueued(0),
+      m_enqueuedBytes(0),
+      m_stoppedOnEnqueue(0),
+      m_dequeued(0),
+      m_stoppedOnDequeue(false),
+      m_availableOnDequeue(0)
+{
+}
+
+void
+CsmaSendBatchTest::PacketEnqueued(Ptr<const Packet> packet)
+{
+    m_enqueued++;
+    m_enqueuedBytes += packet->GetSize();
+    if (m_txq->IsStopped())
+    {
+        m_stoppedOnEnqueue++;
+    }
+}
+
+void
+CsmaSendBatchTest::PacketDequeued(Ptr<const Packet> packet)
+{
+    if (m_dequeued++ == 0)
+    {
+        m_stoppedOnDequeue = m_txq->IsStopped();
+        m_availableOnDequeue = m_txq->GetQueueLimits()->Available();
+    }
+}
+
+void
+CsmaSendBatchTest::DoRun()
+{
+    Ptr<Node> a = CreateObject<Node>();
+    Ptr<Node> b = CreateObject<Node>();
+    Ptr<CsmaNetDevice> devA = CreateObject<CsmaNetDevice>();
+    Ptr<CsmaNetDevice> devB = CreateObject<CsmaNetDevice>();
+    Ptr<CsmaChannel> channel = CreateObject<CsmaChannel>();
+    Ptr<DropTailQueue<Packet>> queue = CreateObject<DropTailQueue<Packet>>();
+
+    devA->Attach(channel);
+    devA->SetAddress(Mac48Address::Allocate());
+    devA->SetQueue(queue);
+    devB->Attach(channel);
+    devB->SetAddress(Mac48Address::Allocate());
+    devB->SetQueue(CreateObject<DropTailQueue<Packet>>());
+
+    a->AddDevice(devA);
+    b->AddDevice(devB);
+
+    // The dequeue trace is connected before the traces of the transmission
+    // queue, so that it observes the state of the queue limits at the end of
+    // the batch, before the first dequeued packet is reported to them
+    queue->TraceConnectWithoutContext(
+        "Dequeue",
+        MakeCallback(&CsmaSendBatchTest::PacketDequeued, this));
+    Ptr<NetDeviceQueueInterface> ndqi = CreateObject<NetDeviceQueueInterface>();
+    m_txq = ndqi->GetTxQueue(0);
+    m_txq->ConnectQueueTraces(queue);
+    m_txq->SetQueueLimits(CreateObject<DynamicQueueLimits>());
+    devA->AggregateObject(ndqi);
+    queue->TraceConnectWithoutContext(
+        "Enqueue",
+        MakeCallback(&CsmaSendBatchTest::PacketEnqueued, this));
+
+    const uint32_t nPackets = 5;
+    const uint32_t payloadSize = 100;
+    std::vector<Ptr<QueueDiscItem>> items;
+    for (uint32_t i = 0; i < nPackets; i++)
+    {
+        items.push_back(
+            Create<CsmaTestItem>(Create<Packet>(payloadSize), devB->GetAddress(), 0x800));
+    }
+
+    // The limit computed by the queue limits is initially zero, hence the
+    // transmission queue must be stopped at the end of the batch
+    uint32_t sent = devA->SendBatch(items);
+    NS_TEST_EXPECT_MSG_EQ(sent, nPackets, "All the packets of the batch should be sent");
+
+    // Each packet carries an Ethernet header (14 bytes) and trailer (4 bytes)
+    uint32_t packetSize = payloadSize + 18;
+    NS_TEST_EXPECT_MSG_EQ(m_enqueued, nPackets, "All the packets should be enqueued");
+    NS_TEST_EXPECT_MSG_EQ(m_enqueuedBytes, nPackets * packetSize, "Wrong number of bytes enqueued");
+    NS_TEST_EXPECT_MSG_EQ(m_dequeued, 1, "Only the first packet should be dequeued");
+    NS_TEST_EXPECT_MSG_EQ(queue->GetNPackets(),
+                          nPackets - 1,
+                          "The other packets should be in the device queue");
+    NS_TEST_EXPECT_MSG_EQ(queue->GetNBytes(),
+                          (nPackets - 1) * packetSize,
+                          "Wrong number of bytes in the device queue");
+    NS_TEST_EXPECT_MSG_EQ(m_stoppedOnEnqueue,
+                          0,
+                          "The queue should not be stopped in the middle of the batch");
+    NS_TEST_EXPECT_MSG_EQ(m_stoppedOnDequeue,
+                          true,
+                          "The queue should be stopped at the end of the batch");
+    NS_TEST_EXPECT_MSG_EQ(m_availableOnDequeue,
+                          -static_cast<int32_t>(nPackets * packetSize),
+                          "All the bytes of the batch should be reported as queued");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \brief TestSuite for Csma module
+ */
+class CsmaTestSuite : public TestSuite
+{
+  public:
+    /**
+     * \brief Constructor
+     */
+    CsmaTestSuite();
+};
+
+CsmaTestSuite::CsmaTestSuite()
+    : TestSuite("devices-csma", UNIT)
+{
+    AddTestCase(new CsmaSendBatchTest, TestCase::QUICK);
+}
+
+static CsmaTestSuite g_csmaTestSuite; //!< The testsuite
@@ -29,6 +29,8 @@
 #include "ns3/ptr.h"
 #include "ns3/simulator.h"
 
+#include <map>
+
 namespace ns3
 {
 
@@ -60,68 +62,10 @@ void
 NeighborCacheHelper::PopulateNeighborCache(Ptr<Channel> channel) const
 {
     NS_LOG_FUNCTION(this << channel);
-    for (std::size_t i = 0; i < channel->GetNDevices(); ++i)
+    std::vector<DeviceInterfaces> interfaces = GetChannelInterfaces(channel);
+    for (const auto& device : interfaces)
     {
-        Ptr<NetDevice> netDevice = channel->GetDevice(i);
-        Ptr<Node> node = netDevice->GetNode();
-
-        int32_t ipv4InterfaceIndex = -1;
-        if (node->GetObject<Ipv4>())
-        {
-            ipv4InterfaceIndex = node->GetObject<Ipv4>()->GetInterfaceForDevice(netDevice);
-        }
-        int32_t ipv6InterfaceIndex = -1;
-        if (node->GetObject<Ipv6>())
-        {
-            ipv6InterfaceIndex = node->GetObject<Ipv6>()->GetInterfaceForDevice(netDevice);
-        }
-
-        for (std::size_t j = 0; j < channel->GetNDevices(); ++j)
-        {
-            Ptr<NetDevice> neighborDevice = channel->GetDevice(j);
-            Ptr<Node> neighborNode = neighborDevice->GetNode();
-
-            int32_t ipv4NeighborInterfaceIndex = -1;
-            if (neighborNode->GetObject<Ipv4>())
-            {
-                ipv4NeighborInterfaceIndex =
-                    neighborNode->GetObject<Ipv4>()->GetInterfaceForDevice(neighborDevice);
-            }
-            int32_t ipv6NeighborInterfaceIndex = -1;
-            if (neighborNode->GetObject<Ipv6>())
-            {
-                ipv6NeighborInterfaceIndex =
-                    neighborNode->GetObject<Ipv6>()->GetInterfaceForDevice(neighborDevice);
-            }
-
-            if (neighborDevice != netDevice)
-            {
-                if (ipv4InterfaceIndex != -1)
-                {
-                    Ptr<Ipv4Interface> ipv4Interface =
-                        node->GetObject<Ipv4L3Protocol>()->GetInterface(ipv4InterfaceIndex);
-                    if (ipv4NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv4Interface> ipv4NeighborInterface =
-                            neighborNode->GetObject<Ipv4L3Protocol>()->GetInterface(
-                                ipv4NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv4(ipv4Interface, ipv4NeighborInterface);
-                    }
-                }
-                if (ipv6InterfaceIndex != -1)
-                {
-                    Ptr<Ipv6Interface> ipv6Interface =
-                        node->GetObject<Ipv6L3Protocol>()->GetInterface(ipv6InterfaceIndex);
-                    if (ipv6NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv6Interface> ipv6NeighborInterface =
-                            neighborNode->GetObject<Ipv6L3Protocol>()->GetInterface(
-                                ipv6NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv6(ipv6Interface, ipv6NeighborInterface);
-                    }
-                }
-            }
-        }
+        PopulateNeighborEntries(device, interfaces, true, true);
     }
 }
 
@@ -129,69 +73,17 @@ void
 NeighborCacheHelper::PopulateNeighborCache(const NetDeviceContainer& c) const
 {
     NS_LOG_FUNCTION(this);
+    std::map<Ptr<Channel>, std::vector<DeviceInterfaces>> channels;
     for (uint32_t i = 0; i < c.GetN(); ++i)
     {
         Ptr<NetDevice> netDevice = c.Get(i);
         Ptr<Channel> channel = netDevice->GetChannel();
-        Ptr<Node> node = netDevice->GetNode();
-
-        int32_t ipv4InterfaceIndex = -1;
-        if (node->GetObject<Ipv4>())
+        auto it = channels.find(channel);
+        if (it == channels.end())
         {
-            ipv4InterfaceIndex = node->GetObject<Ipv4>()->GetInterfaceForDevice(netDevice);
-        }
-        int32_t ipv6InterfaceIndex = -1;
-        if (node->GetObject<Ipv6>())
-        {
-            ipv6InterfaceIndex = node->GetObject<Ipv6>()->GetInterfaceForDevice(netDevice);
-        }
-
-        for (std::size_t j = 0; j < channel->GetNDevices(); ++j)
-        {
-            Ptr<NetDevice> neighborDevice = channel->GetDevice(j);
-            Ptr<Node> neighborNode = neighborDevice->GetNode();
-
-            int32_t ipv4NeighborInterfaceIndex = -1;
-            if (neighborNode->GetObject<Ipv4>())
-            {
-                ipv4NeighborInterfaceIndex =
-                    neighborNode->GetObject<Ipv4>()->GetInterfaceForDevice(neighborDevice);
-            }
-            int32_t ipv6NeighborInterfaceIndex = -1;
-            if (neighborNode->GetObject<Ipv6>())
-            {
-                ipv6NeighborInterfaceIndex =
-                    neighborNode->GetObject<Ipv6>()->GetInterfaceForDevice(neighborDevice);
-            }
-
-            if (neighborDevice != netDevice)
-            {
-                if (ipv4InterfaceIndex != -1)
-                {
-                    Ptr<Ipv4Interface> ipv4Interface =
-                        node->GetObject<Ipv4L3Protocol>()->GetInterface(ipv4InterfaceIndex);
-                    if (ipv4NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv4Interface> ipv4NeighborInterface =
-                            neighborNode->GetObject<Ipv4L3Protocol>()->GetInterface(
-                                ipv4NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv4(ipv4Interface, ipv4NeighborInterface);
-                    }
-                }
-                if (ipv6InterfaceIndex != -1)
-                {
-                    Ptr<Ipv6Interface> ipv6Interface =
-                        node->GetObject<Ipv6L3Protocol>()->GetInterface(ipv6InterfaceIndex);
-                    if (ipv6NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv6Interface> ipv6NeighborInterface =
-                            neighborNode->GetObject<Ipv6L3Protocol>()->GetInterface(
-                                ipv6NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv6(ipv6Interface, ipv6NeighborInterface);
-                    }
-                }
-            }
+            it = channels.emplace(channel, GetChannelInterfaces(channel)).first;
         }
+        PopulateNeighborEntries(GetDeviceInterfaces(netDevice), it->second, true, true);
     }
 }
 
@@ -199,6 +91,7 @@ void
 NeighborCacheHelper::PopulateNeighborCache(const Ipv4InterfaceContainer& c) const
 {
     NS_LOG_FUNCTION(this);
+    std::map<Ptr<Channel>, std::vector<DeviceInterfaces>> channels;
     for (uint32_t i = 0; i < c.GetN(); ++i)
     {
         std::pair<Ptr<Ipv4>, uint32_t> returnValue = c.Get(i);
@@ -209,23 +102,12 @@ NeighborCacheHelper::PopulateNeighborCache(const Ipv4InterfaceContainer& c) cons
         {
             Ptr<NetDevice> netDevice = ipv4Interface->GetDevice();
             Ptr<Channel> channel = netDevice->GetChannel();
-            for (std::size_t j = 0; j < channel->GetNDevices(); ++j)
+            auto it = channels.find(channel);
+            if (it == channels.end())
             {
-                Ptr<NetDevice> neighborDevice = channel->GetDevice(j);
-                if (neighborDevice != netDevice)
-                {
-                    Ptr<Node> neighborNode = neighborDevice->GetNode();
-                    int32_t ipv4NeighborInterfaceIndex =
-                        neighborNode->GetObject<Ipv4>()->GetInterfaceForDevice(neighborDevice);
-                    if (ipv4NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv4Interface> ipv4NeighborInterface =
-                            neighborNode->GetObject<Ipv4L3Protocol>()->GetInterface(
-                                ipv4NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv4(ipv4Interface, ipv4NeighborInterface);
-                    }
-                }
+                it = channels.emplace(channel, GetChannelInterfaces(channel)).first;
             }
+            PopulateNeighborEntries({netDevice, ipv4Interface, nullptr}, it->second, true, false);
         }
     }
 }
@@ -234,6 +116,7 @@ void
 NeighborCacheHelper::PopulateNeighborCache(const Ipv6InterfaceContainer& c) const
 {
     NS_LOG_FUNCTION(this);
+    std::map<Ptr<Channel>, std::vector<DeviceInterfaces>> channels;
     for (uint32_t i = 0; i < c.GetN(); ++i)
     {
         std::pair<Ptr<Ipv6>, uint32_t> returnValue = c.Get(i);
@@ -244,43 +127,111 @@ NeighborCacheHelper::PopulateNeighborCache(const Ipv6InterfaceContainer& c) cons
         {
             Ptr<NetDevice> netDevice = ipv6Interface->GetDevice();
             Ptr<Channel> channel = netDevice->GetChannel();
-            for (std::size_t j = 0; j < channel->GetNDevices(); ++j)
+            auto it = channels.find(channel);
+            if (it == channels.end())
             {
-                Ptr<NetDevice> neighborDevice = channel->GetDevice(j);
-                if (neighborDevice != netDevice)
-                {
-                    Ptr<Node> neighborNode = neighborDevice->GetNode();
-                    int32_t ipv6NeighborInterfaceIndex =
-                        neighborNode->GetObject<Ipv6>()->GetInterfaceForDevice(neighborDevice);
-                    if (ipv6NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv6Interface> ipv6NeighborInterface =
-                            neighborNode->GetObject<Ipv6L3Protocol>()->GetInterface(
-                                ipv6NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv6(ipv6Interface, ipv6NeighborInterface);
-                    }
-                }
+                it = channels.emplace(channel, GetChannelInterfaces(channel)).first;
             }
+            PopulateNeighborEntries({netDevice, nullptr, ipv6Interface}, it->second, false, true);
+        }
+    }
+}
+
+NeighborCacheHelper::DeviceInterfaces
+NeighborCacheHelper::GetDeviceInterfaces(Ptr<NetDevice> netDevice)
+{
+    DeviceInterfaces interfaces{netDevice, nullptr, nullptr};
+    Ptr<Node> node = netDevice->GetNode();
+    Ptr<Ipv4L3Protocol> ipv4 = node->GetObject<Ipv4L3Protocol>();
+    if (ipv4)
+    {
+        int32_t ipv4InterfaceIndex = ipv4->GetInterfaceForDevice(netDevice);
+        if (ipv4InterfaceIndex != -1)
+        {
+            interfaces.ipv4 = ipv4->GetInterface(ipv4InterfaceIndex);
         }
     }
+    Ptr<Ipv6L3Protocol> ipv6 = node->GetObject<Ipv6L3Protocol>();
+    if (ipv6)
+    {
+        int32_t ipv6InterfaceIndex = ipv6->GetInterfaceForDevice(netDevice);
+        if (ipv6InterfaceIndex != -1)
+        {
+            interfaces.ipv6 = ipv6->GetInterface(ipv6InterfaceIndex);
+        }
+    }
+    return interfaces;
+}
+
+std::vector<NeighborCacheHelper::DeviceInterfaces>
+NeighborCacheHelper::GetChannelInterfaces(Ptr<Channel> channel)
+{
+    std::vector<DeviceInterfaces> interfaces;
+    interfaces.reserve(channel->GetNDevices());
+    for (std::size_t i = 0; i < channel->GetNDevices(); ++i)
+    {
+        interfaces.push_back(GetDeviceInterfaces(channel->GetDevice(i)));
+    }
+    return interfaces;
 }
 
 void
-NeighborCacheHelper::PopulateNeighborEntriesIpv4(Ptr<Ipv4Interface> ipv4Interface,
-                                                 Ptr<Ipv4Interface> neighborDeviceInterface) const
+NeighborCacheHelper::PopulateNeighborEntries(const DeviceInterfaces& device,
+                                             const std::vector<DeviceInterfaces>& neighbors,
+                                             bool ipv4,
+                                             bool ipv6) const
 {
-    uint32_t netDeviceAddresses = ipv4Interface->GetNAddresses();
-    uint32_t neighborDeviceAddresses = neighborDeviceInterface->GetNAddresses();
-    if (m_dynamicNeighborCache)
+    bool ipv4Populated = false;
+    bool ipv6Populated = false;
+    for (const auto& neighbor : neighbors)
+    {
+        if (neighbor.device == device.device)
+        {
+            continue;
+        }
+        if (ipv4 && device.ipv4 && neighbor.ipv4)
+        {
+            PopulateNeighborEntriesIpv4(device.ipv4, neighbor.ipv4);
+            ipv4Populated = true;
+        }
+        if (ipv6 && device.ipv6 && neighbor.ipv6)
+        {
+            PopulateNeighborEntriesIpv6(device.ipv6, neighbor.ipv6);
+            ipv6Populated = true;
+        }
+    }
+    if (!m_dynamicNeighborCache)
     {
-        ipv4Interface->RemoveAddressCallback(
+        return;
+    }
+    if (ipv4Populated)
+    {
+        device.ipv4->RemoveAddressCallback(
             MakeCallback(&NeighborCacheHelper::UpdateCacheByIpv4AddressRemoved, this));
         if (m_globalNeighborCache)
         {
-            ipv4Interface->AddAddressCallback(
+            device.ipv4->AddAddressCallback(
                 MakeCallback(&NeighborCacheHelper::UpdateCacheByIpv4AddressAdded, this));
         }
     }
+    if (ipv6Populated)
+    {
+        device.ipv6->RemoveAddressCallback(
+            MakeCallback(&NeighborCacheHelper::UpdateCacheByIpv6AddressRemoved, this));
+        if (m_globalNeighborCache)
+        {
+            device.ipv6->AddAddressCallback(
+                MakeCallback(&NeighborCacheHelper::UpdateCacheByIpv6AddressAdded, this));
+        }
+    }
+}
+
+void
+NeighborCacheHelper::PopulateNeighborEntriesIpv4(Ptr<Ipv4Interface> ipv4Interface,
+                                                 Ptr<Ipv4Interface> neighborDeviceInterface) const
+{
+    uint32_t netDeviceAddresses = ipv4Interface->GetNAddresses();
+    uint32_t neighborDeviceAddresses = neighborDeviceInterface->GetNAddresses();
     for (uint32_t n = 0; n < netDeviceAddresses; ++n)
     {
         Ipv4InterfaceAddress netDeviceIfAddr = ipv4Interface->GetAddress(n);
@@ -305,16 +256,6 @@ NeighborCacheHelper::PopulateNeighborEntriesIpv6(Ptr<Ipv6Interface> ipv6Interfac
 {
     uint32_t netDeviceAddresses = ipv6Interface->GetNAddresses();
     uint32_t neighborDeviceAddresses = neighborDeviceInterface->GetNAddresses();
-    if (m_dynamicNeighborCache)
-    {
-        ipv6Interface->RemoveAddressCallback(
-            MakeCallback(&NeighborCacheHelper::UpdateCacheByIpv6AddressRemoved, this));
-        if (m_globalNeighborCache)
-        {
-            ipv6Interface->AddAddressCallback(
-                MakeCallback(&NeighborCacheHelper::UpdateCacheByIpv6AddressAdded, this));
-        }
-    }
     for (uint32_t n = 0; n < netDeviceAddresses; ++n)
     {
         Ipv6InterfaceAddress netDeviceIfAddr = ipv6Interface->GetAddress(n);
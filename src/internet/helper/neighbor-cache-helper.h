@@ -35,6 +35,8 @@
 #include "ns3/net-device-container.h"
 #include "ns3/node-list.h"
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -104,6 +106,46 @@ class NeighborCacheHelper
     void SetDynamicNeighborCache(bool enable);
 
   private:
+    /// The IPv4 and IPv6 interfaces bound to a NetDevice
+    struct DeviceInterfaces
+    {
+        Ptr<NetDevice> device;   //!< the NetDevice
+        Ptr<Ipv4Interface> ipv4; //!< the Ipv4Interface of the device, if any
+        Ptr<Ipv6Interface> ipv6; //!< the Ipv6Interface of the device, if any
+    };
+
+    /**
+     * \brief Get the IPv4 and IPv6 interfaces bound to a NetDevice.
+     * \param netDevice the NetDevice
+     * \return the interfaces of the NetDevice
+     */
+    static DeviceInterfaces GetDeviceInterfaces(Ptr<NetDevice> netDevice);
+
+    /**
+     * \brief Get the IPv4 and IPv6 interfaces bound to the NetDevices of a channel.
+     *
+     * The interfaces are resolved once per channel, rather than once per pair of
+     * neighbors, as the number of pairs grows quadratically with the number of
+     * devices.
+     *
+     * \param channel the channel
+     * \return the interfaces of the NetDevices attached to the channel
+     */
+    static std::vector<DeviceInterfaces> GetChannelInterfaces(Ptr<Channel> channel);
+
+    /**
+     * \brief Populate the neighbor caches of a NetDevice with the entries of its
+     * neighbors.
+     * \param device the interfaces of the NetDevice to process
+     * \param neighbors the interfaces of the NetDevices attached to the same channel
+     * \param ipv4 whether to populate the ARP cache
+     * \param ipv6 whether to populate the NDISC cache
+     */
+    void PopulateNeighborEntries(const DeviceInterfaces& device,
+                                 const std::vector<DeviceInterfaces>& neighbors,
+                                 bool ipv4,
+                                 bool ipv6) const;
+
     /**
      * \brief Populate neighbor ARP entries for given IPv4 interface.
      * \param ipv4Interface the Ipv4Interface to process
@@ -31,6 +31,8 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 
+#include <map>
+
 namespace ns3
 {
 
@@ -200,37 +202,38 @@ ArpCache::HandleWaitReplyTimeout()
     NS_LOG_FUNCTION(this);
     ArpCache::Entry* entry;
     bool restartWaitReplyTimer = false;
-    for (CacheI i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    // only the entries waiting for a reply are visited; marking an entry as
+    // dead removes it from m_waitReplyEntries, hence the iterator is advanced
+    // before handling the entry.
+    for (auto i = m_waitReplyEntries.begin(); i != m_waitReplyEntries.end();)
     {
-        entry = (*i).second;
-        if (entry != nullptr && entry->IsWaitReply())
+        entry = m_arpCache[*i++];
+        NS_ASSERT(entry != nullptr && entry->IsWaitReply());
+        if (entry->GetRetries() < m_maxRetries)
         {
-            if (entry->GetRetries() < m_maxRetries)
-            {
-                NS_LOG_LOGIC("node=" << m_device->GetNode()->GetId() << ", ArpWaitTimeout for "
-                                     << entry->GetIpv4Address()
-                                     << " expired -- retransmitting arp request since retries = "
-                                     << entry->GetRetries());
-                m_arpRequestCallback(this, entry->GetIpv4Address());
-                restartWaitReplyTimer = true;
-                entry->IncrementRetries();
-            }
-            else
+            NS_LOG_LOGIC("node=" << m_device->GetNode()->GetId() << ", ArpWaitTimeout for "
+                                 << entry->GetIpv4Address()
+                                 << " expired -- retransmitting arp request since retries = "
+                                 << entry->GetRetries());
+            m_arpRequestCallback(this, entry->GetIpv4Address());
+            restartWaitReplyTimer = true;
+            entry->IncrementRetries();
+        }
+        else
+        {
+            NS_LOG_LOGIC("node=" << m_device->GetNode()->GetId() << ", wait reply for "
+                                 << entry->GetIpv4Address()
+                                 << " expired -- drop since max retries exceeded: "
+                                 << entry->GetRetries());
+            entry->MarkDead();
+            entry->ClearRetries();
+            Ipv4PayloadHeaderPair pending = entry->DequeuePending();
+            while (pending.first)
             {
-                NS_LOG_LOGIC("node=" << m_device->GetNode()->GetId() << ", wait reply for "
-                                     << entry->GetIpv4Address()
-                                     << " expired -- drop since max retries exceeded: "
-                                     << entry->GetRetries());
-                entry->MarkDead();
-                entry->ClearRetries();
-                Ipv4PayloadHeaderPair pending = entry->DequeuePending();
-                while (pending.first)
-                {
-                    // add the Ipv4 header for tracing purposes
-                    pending.first->AddHeader(pending.second);
-                    m_dropTrace(pending.first);
-                    pending = entry->DequeuePending();
-                }
+                // add the Ipv4 header for tracing purposes
+                pending.first->AddHeader(pending.second);
+                m_dropTrace(pending.first);
+                pending = entry->DequeuePending();
             }
         }
     }
@@ -251,6 +254,7 @@ ArpCache::Flush()
         delete (*i).second;
     }
     m_arpCache.erase(m_arpCache.begin(), m_arpCache.end());
+    m_waitReplyEntries.clear();
     if (m_waitReplyTimer.IsRunning())
     {
         NS_LOG_LOGIC("Stopping WaitReplyTimer at " << Simulator::Now().GetSeconds()
@@ -265,7 +269,9 @@ ArpCache::PrintArpCache(Ptr<OutputStreamWrapper> stream)
     NS_LOG_FUNCTION(this << stream);
     std::ostream* os = stream->GetStream();
 
-    for (CacheI i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    // print the entries sorted by address
+    std::map<Ipv4Address, ArpCache::Entry*> sorted(m_arpCache.begin(), m_arpCache.end());
+    for (auto i = sorted.begin(); i != sorted.end(); i++)
     {
         *os << i->first << " dev ";
         std::string found = Names::FindName(m_device);
@@ -366,15 +372,14 @@ ArpCache::Remove(ArpCache::Entry* entry)
 {
     NS_LOG_FUNCTION(this << entry);
 
-    for (CacheI i = m_arpCache.begin(); i != m_arpCache.end(); i++)
+    CacheI i = m_arpCache.find(entry->GetIpv4Address());
+    if (i != m_arpCache.end() && i->second == entry)
     {
-        if ((*i).second == entry)
-        {
-            m_arpCache.erase(i);
-            entry->ClearPendingPacket(); // clear the pending packets for entry's ipaddress
-            delete entry;
-            return;
-        }
+        m_arpCache.erase(i);
+        m_waitReplyEntries.erase(entry->GetIpv4Address());
+        entry->ClearPendingPacket(); // clear the pending packets for entry's ipaddress
+        delete entry;
+        return;
     }
     NS_LOG_WARN("Entry not found in this ARP Cache");
 }
@@ -427,7 +432,7 @@ ArpCache::Entry::MarkDead()
 {
     NS_LOG_FUNCTION(this);
     NS_ASSERT(m_state == ALIVE || m_state == WAIT_REPLY || m_state == DEAD);
-    m_state = DEAD;
+    SetState(DEAD);
     ClearRetries();
     UpdateSeen();
 }
@@ -438,7 +443,7 @@ ArpCache::Entry::MarkAlive(Address macAddress)
     NS_LOG_FUNCTION(this << macAddress);
     NS_ASSERT(m_state == WAIT_REPLY);
     m_macAddress = macAddress;
-    m_state = ALIVE;
+    SetState(ALIVE);
     ClearRetries();
     UpdateSeen();
 }
@@ -449,7 +454,7 @@ ArpCache::Entry::MarkPermanent()
     NS_LOG_FUNCTION(this << m_macAddress);
     NS_ASSERT(!m_macAddress.IsInvalid());
 
-    m_state = PERMANENT;
+    SetState(PERMANENT);
     ClearRetries();
     UpdateSeen();
 }
@@ -460,7 +465,7 @@ ArpCache::Entry::MarkAutoGenerated()
     NS_LOG_FUNCTION(this << m_macAddress);
     NS_ASSERT(!m_macAddress.IsInvalid());
 
-    m_state = STATIC_AUTOGENERATED;
+    SetState(STATIC_AUTOGENERATED);
     ClearRetries();
     UpdateSeen();
 }
@@ -490,12 +495,27 @@ ArpCache::Entry::MarkWaitReply(Ipv4PayloadHeaderPair waiting)
     NS_ASSERT(m_pending.empty());
     NS_ASSERT_MSG(waiting.first, "Can not add a null packet to the ARP queue");
 
-    m_state = WAIT_REPLY;
+    SetState(WAIT_REPLY);
     m_pending.push_back(waiting);
     UpdateSeen();
     m_arp->StartWaitReplyTimer();
 }
 
+void
+ArpCache::Entry::SetState(ArpCacheEntryState_e state)
+{
+    NS_LOG_FUNCTION(this << state);
+    if (m_state == WAIT_REPLY && state != WAIT_REPLY)
+    {
+        m_arp->m_waitReplyEntries.erase(m_ipv4Address);
+    }
+    else if (m_state != WAIT_REPLY && state == WAIT_REPLY)
+    {
+        m_arp->m_waitReplyEntries.insert(m_ipv4Address);
+    }
+    m_state = state;
+}
+
 Address
 ArpCache::Entry::GetMacAddress() const
 {
@@ -32,8 +32,9 @@
 #include "ns3/traced-callback.h"
 
 #include <list>
-#include <map>
+#include <set>
 #include <stdint.h>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -308,6 +309,13 @@ class ArpCache : public Object
          */
         Time GetTimeout() const;
 
+        /**
+         * \brief Change the state of the entry, keeping track of the entries
+         * waiting for a reply in the owning ARP cache.
+         * \param state the new state
+         */
+        void SetState(ArpCacheEntryState_e state);
+
         ArpCache* m_arp;              //!< pointer to the ARP cache owning the entry
         ArpCacheEntryState_e m_state; //!< state of the entry
         Time m_lastSeen;              //!< last moment a packet from that address has been seen
@@ -321,11 +329,11 @@ class ArpCache : public Object
     /**
      * \brief ARP Cache container
      */
-    typedef std::map<Ipv4Address, ArpCache::Entry*> Cache;
+    typedef std::unordered_map<Ipv4Address, ArpCache::Entry*, Ipv4AddressHash> Cache;
     /**
      * \brief ARP Cache container iterator
      */
-    typedef std::map<Ipv4Address, ArpCache::Entry*>::iterator CacheI;
+    typedef std::unordered_map<Ipv4Address, ArpCache::Entry*, Ipv4AddressHash>::iterator CacheI;
 
     void DoDispose() override;
 
@@ -347,6 +355,12 @@ class ArpCache : public Object
     void HandleWaitReplyTimeout();
     uint32_t m_pendingQueueSize; //!< number of packets waiting for a resolution
     Cache m_arpCache;            //!< the ARP cache
+    /**
+     * Addresses of the entries in WAIT_REPLY state, i.e., the only entries
+     * visited by HandleWaitReplyTimeout.  The set is ordered so that the
+     * retransmissions are sent in address order.
+     */
+    std::set<Ipv4Address> m_waitReplyEntries;
     TracedCallback<Ptr<const Packet>>
         m_dropTrace; //!< trace for packets dropped by the ARP cache queue
 };
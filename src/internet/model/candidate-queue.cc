@@ -58,22 +58,24 @@ operator<<(std::ostream& os, const SPFVertex::VertexType& t)
 std::ostream&
 operator<<(std::ostream& os, const CandidateQueue& q)
 {
-    typedef CandidateQueue::CandidateList_t List_t;
-    typedef List_t::const_iterator CIter_t;
-    const CandidateQueue::CandidateList_t& list = q.m_candidates;
+    // the heap is only partially ordered: print a sorted copy
+    CandidateQueue::CandidateList_t list = q.m_candidates;
+    std::sort(list.begin(), list.end(), &CandidateQueue::CompareCandidate);
 
     os << "*** CandidateQueue Begin (<id, distance, LSA-type>) ***" << std::endl;
-    for (CIter_t iter = list.begin(); iter != list.end(); iter++)
+    for (const auto& candidate : list)
     {
-        os << "<" << (*iter)->GetVertexId() << ", " << (*iter)->GetDistanceFromRoot() << ", "
-           << (*iter)->GetVertexType() << ">" << std::endl;
+        os << "<" << candidate.vertex->GetVertexId() << ", "
+           << candidate.vertex->GetDistanceFromRoot() << ", "
+           << candidate.vertex->GetVertexType() << ">" << std::endl;
     }
     os << "*** CandidateQueue End ***";
     return os;
 }
 
 CandidateQueue::CandidateQueue()
-    : m_candidates()
+    : m_candidates(),
+      m_counter(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -101,11 +103,10 @@ CandidateQueue::Push(SPFVertex* vNew)
 {
     NS_LOG_FUNCTION(this << vNew);
 
-    CandidateList_t::iterator i = std::upper_bound(m_candidates.begin(),
-                                                   m_candidates.end(),
-                                                   vNew,
-                                                   &CandidateQueue::CompareSPFVertex);
-    m_candidates.insert(i, vNew);
+    m_candidates.push_back({vNew, m_counter++});
+    m_positions[vNew] = m_candidates.size() - 1;
+    m_vertexIds[vNew->GetVertexId()] = vNew;
+    SiftUp(m_candidates.size() - 1);
 }
 
 SPFVertex*
@@ -117,8 +118,20 @@ CandidateQueue::Pop()
         return nullptr;
     }
 
-    SPFVertex* v = m_candidates.front();
-    m_candidates.pop_front();
+    SPFVertex* v = m_candidates.front().vertex;
+    m_positions.erase(v);
+    auto it = m_vertexIds.find(v->GetVertexId());
+    if (it != m_vertexIds.end() && it->second == v)
+    {
+        m_vertexIds.erase(it);
+    }
+    Candidate last = m_candidates.back();
+    m_candidates.pop_back();
+    if (!m_candidates.empty())
+    {
+        Place(0, last);
+        SiftDown(0);
+    }
     return v;
 }
 
@@ -131,7 +144,7 @@ CandidateQueue::Top() const
         return nullptr;
     }
 
-    return m_candidates.front();
+    return m_candidates.front().vertex;
 }
 
 bool
@@ -152,18 +165,12 @@ SPFVertex*
 CandidateQueue::Find(const Ipv4Address addr) const
 {
     NS_LOG_FUNCTION(this);
-    CandidateList_t::const_iterator i = m_candidates.begin();
-
-    for (; i != m_candidates.end(); i++)
+    auto it = m_vertexIds.find(addr);
+    if (it == m_vertexIds.end())
     {
-        SPFVertex* v = *i;
-        if (v->GetVertexId() == addr)
-        {
-            return v;
-        }
+        return nullptr;
     }
-
-    return nullptr;
+    return it->second;
 }
 
 void
@@ -171,11 +178,97 @@ CandidateQueue::Reorder()
 {
     NS_LOG_FUNCTION(this);
 
-    m_candidates.sort(&CandidateQueue::CompareSPFVertex);
+    std::make_heap(m_candidates.begin(),
+                   m_candidates.end(),
+                   [](const Candidate& c1, const Candidate& c2) {
+                       return CompareCandidate(c2, c1);
+                   });
+    for (uint32_t i = 0; i < m_candidates.size(); i++)
+    {
+        m_positions[m_candidates[i].vertex] = i;
+    }
     NS_LOG_LOGIC("After reordering the CandidateQueue");
     NS_LOG_LOGIC(*this);
 }
 
+void
+CandidateQueue::Update(SPFVertex* v)
+{
+    NS_LOG_FUNCTION(this << v);
+
+    auto it = m_positions.find(v);
+    NS_ASSERT_MSG(it != m_positions.end(), "Vertex " << v->GetVertexId() << " not in the queue");
+    uint32_t pos = it->second;
+    // the vertex is ranked after the vertices already at its new distance,
+    // as the stable sort of the sorted list used to do
+    m_candidates[pos].order = m_counter++;
+    SiftUp(pos);
+}
+
+void
+CandidateQueue::Place(uint32_t pos, const Candidate& c)
+{
+    m_candidates[pos] = c;
+    m_positions[c.vertex] = pos;
+}
+
+void
+CandidateQueue::SiftUp(uint32_t pos)
+{
+    Candidate c = m_candidates[pos];
+    while (pos > 0)
+    {
+        uint32_t parent = (pos - 1) / 2;
+        if (!CompareCandidate(c, m_candidates[parent]))
+        {
+            break;
+        }
+        Place(pos, m_candidates[parent]);
+        pos = parent;
+    }
+    Place(pos, c);
+}
+
+void
+CandidateQueue::SiftDown(uint32_t pos)
+{
+    Candidate c = m_candidates[pos];
+    uint32_t size = m_candidates.size();
+    for (;;)
+    {
+        uint32_t child = 2 * pos + 1;
+        if (child >= size)
+        {
+            break;
+        }
+        if (child + 1 < size && CompareCandidate(m_candidates[child + 1], m_candidates[child]))
+        {
+            child++;
+        }
+        if (!CompareCandidate(m_candidates[child], c))
+        {
+            break;
+        }
+        Place(pos, m_candidates[child]);
+        pos = child;
+    }
+    Place(pos, c);
+}
+
+bool
+CandidateQueue::CompareCandidate(const Candidate& c1, const Candidate& c2)
+{
+    if (CompareSPFVertex(c1.vertex, c2.vertex))
+    {
+        return true;
+    }
+    if (CompareSPFVertex(c2.vertex, c1.vertex))
+    {
+        return false;
+    }
+    return c1.order < c2.order;
+}
+
 /*
  * In this implementation, SPFVertex follows the ordering where
  * a vertex is ranked first if its GetDistanceFromRoot () is smaller;
@@ -22,8 +22,9 @@
 
 #include "ns3/ipv4-address.h"
 
-#include <list>
 #include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -46,8 +47,13 @@ class SPFVertex;
  *
  * Although a STL priority_queue almost does what we want, the requirement
  * for a Find () operation, the dynamic nature of the data and the derived
- * requirement for a Reorder () operation led us to implement this simple
+ * requirement for a Reorder () operation led us to implement this
  * enhanced priority queue.
+ *
+ * The queue is an indexed binary heap: Push (), Pop () and Update () take
+ * O(log n) time and Find () takes constant time.  Vertices having the same
+ * priority are popped in the order they were pushed (or last updated), so
+ * that the SPF computation is deterministic.
  */
 class CandidateQueue
 {
@@ -159,6 +165,19 @@ class CandidateQueue
      */
     void Reorder();
 
+    /**
+     * @brief Restore the priority order after the distance of a single vertex
+     * in the queue has been decreased.
+     *
+     * This is the O(log n) alternative to Reorder () when only one vertex has
+     * changed.  The vertex is ranked after the vertices having the same
+     * priority, as if it was pushed again.
+     *
+     * @see SPFVertex
+     * @param v The Shortest Path First Vertex whose distance has decreased.
+     */
+    void Update(SPFVertex* v);
+
   private:
     /**
      * \brief return true if v1 < v2
@@ -173,8 +192,47 @@ class CandidateQueue
      */
     static bool CompareSPFVertex(const SPFVertex* v1, const SPFVertex* v2);
 
-    typedef std::list<SPFVertex*> CandidateList_t; //!< container of SPFVertex pointers
-    CandidateList_t m_candidates;                  //!< SPFVertex candidates
+    /// An element of the heap
+    struct Candidate
+    {
+        SPFVertex* vertex; //!< the vertex
+        uint64_t order;    //!< insertion order, used to break ties
+    };
+
+    /**
+     * \brief return true if c1 should be popped before c2
+     * \param c1 first operand
+     * \param c2 second operand
+     * \return True if c1 should be popped before c2; false otherwise
+     */
+    static bool CompareCandidate(const Candidate& c1, const Candidate& c2);
+
+    /**
+     * \brief Store a candidate at a given position of the heap.
+     * \param pos the position
+     * \param c the candidate
+     */
+    void Place(uint32_t pos, const Candidate& c);
+
+    /**
+     * \brief Move the candidate at the given position towards the top of the heap.
+     * \param pos the position
+     */
+    void SiftUp(uint32_t pos);
+
+    /**
+     * \brief Move the candidate at the given position towards the bottom of the heap.
+     * \param pos the position
+     */
+    void SiftDown(uint32_t pos);
+
+    typedef std::vector<Candidate> CandidateList_t; //!< heap of SPFVertex candidates
+    CandidateList_t m_candidates;                   //!< SPFVertex candidates
+    std::unordered_map<const SPFVertex*, uint32_t>
+        m_positions; //!< position of each vertex in the heap
+    std::unordered_map<Ipv4Address, SPFVertex*, Ipv4AddressHash>
+        m_vertexIds;    //!< index of the vertices by vertex ID
+    uint64_t m_counter; //!< counter used to order the candidates
 
     /**
      * \brief Stream insertion operator.
@@ -429,6 +429,7 @@ SPFVertex::ClearVertexProcessed()
 
 GlobalRouteManagerLSDB::GlobalRouteManagerLSDB()
     : m_database(),
+      m_linkDataIndex(),
       m_extdatabase()
 {
     NS_LOG_FUNCTION(this);
@@ -452,6 +453,7 @@ GlobalRouteManagerLSDB::~GlobalRouteManagerLSDB()
     }
     NS_LOG_LOGIC("clear map");
     m_database.clear();
+    m_linkDataIndex.clear();
 }
 
 void
@@ -476,7 +478,32 @@ GlobalRouteManagerLSDB::Insert(Ipv4Address addr, GlobalRoutingLSA* lsa)
     }
     else
     {
-        m_database.insert(LSDBPair_t(addr, lsa));
+        if (!m_database.insert(LSDBPair_t(addr, lsa)).second)
+        {
+            //
+            // An LSA with the same address is already in the database, which
+            // keeps it. The index must keep referring to the LSAs in the database.
+            //
+            NS_LOG_LOGIC("LSA already in the database for " << addr);
+            return;
+        }
+        //
+        // Index the LSA by the link data of its transit network link records, keeping
+        // the LSA with the lowest address if several of them share the same link data.
+        //
+        for (uint32_t j = 0; j < lsa->GetNLinkRecords(); j++)
+        {
+            GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
+            if (lr->GetLinkType() != GlobalRoutingLinkRecord::TransitNetwork)
+            {
+                continue;
+            }
+            auto result = m_linkDataIndex.insert(LSDBPair_t(lr->GetLinkData(), lsa));
+            if (!result.second && addr < result.first->second->GetLinkStateId())
+            {
+                result.first->second = lsa;
+            }
+        }
     }
 }
 
@@ -501,13 +528,10 @@ GlobalRouteManagerLSDB::GetLSA(Ipv4Address addr) const
     //
     // Look up an LSA by its address.
     //
-    LSDBMap_t::const_iterator i;
-    for (i = m_database.begin(); i != m_database.end(); i++)
+    LSDBMap_t::const_iterator i = m_database.find(addr);
+    if (i != m_database.end())
     {
-        if (i->first == addr)
-        {
-            return i->second;
-        }
+        return i->second;
     }
     return nullptr;
 }
@@ -517,22 +541,12 @@ GlobalRouteManagerLSDB::GetLSAByLinkData(Ipv4Address addr) const
 {
     NS_LOG_FUNCTION(this << addr);
     //
-    // Look up an LSA by its address.
+    // Look up an LSA by the link data of its transit network link records.
     //
-    LSDBMap_t::const_iterator i;
-    for (i = m_database.begin(); i != m_database.end(); i++)
+    LSDBMap_t::const_iterator i = m_linkDataIndex.find(addr);
+    if (i != m_linkDataIndex.end())
     {
-        GlobalRoutingLSA* temp = i->second;
-        // Iterate among temp's Link Records
-        for (uint32_t j = 0; j < temp->GetNLinkRecords(); j++)
-        {
-            GlobalRoutingLinkRecord* lr = temp->GetLinkRecord(j);
-            if (lr->GetLinkType() == GlobalRoutingLinkRecord::TransitNetwork &&
-                lr->GetLinkData() == addr)
-            {
-                return temp;
-            }
-        }
+        return i->second;
     }
     return nullptr;
 }
@@ -544,7 +558,8 @@ GlobalRouteManagerLSDB::GetLSAByLinkData(Ipv4Address addr) const
 // ---------------------------------------------------------------------------
 
 GlobalRouteManagerImpl::GlobalRouteManagerImpl()
-    : m_spfroot(nullptr)
+    : m_spfroot(nullptr),
+      m_spfrootNode(nullptr)
 {
     NS_LOG_FUNCTION(this);
     m_lsdb = new GlobalRouteManagerLSDB();
@@ -962,7 +977,7 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
                     // If we've changed the cost to get to the vertex represented by <w>, we
                     // must reorder the priority queue keyed to that cost.
                     //
-                    candidate.Reorder();
+                    candidate.Update(cw);
                 }
             } // new lower cost path found
         }     // end W is already on the candidate list
@@ -1366,6 +1381,8 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     // We also mark this vertex as being in the SPF tree.
     //
     m_spfroot = v;
+    m_spfrootNode =
+        FindRouterNode(root, NodeList::GetNNodes() > 0 ? v->GetLSA()->GetNode() : nullptr);
     v->SetDistanceFromRoot(0);
     v->GetLSA()->SetStatus(GlobalRoutingLSA::LSA_SPF_IN_SPFTREE);
     NS_LOG_LOGIC("Starting SPFCalculate for node " << root);
@@ -1381,6 +1398,8 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     {
         NS_LOG_LOGIC("SPFCalculate truncated for stub node " << root);
         delete m_spfroot;
+        m_spfroot = nullptr;
+        m_spfrootNode = nullptr;
         return;
     }
 
@@ -1502,6 +1521,37 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     //
     delete m_spfroot;
     m_spfroot = nullptr;
+    m_spfrootNode = nullptr;
+}
+
+Ptr<Node>
+GlobalRouteManagerImpl::FindRouterNode(Ipv4Address routerId, Ptr<Node> hint) const
+{
+    NS_LOG_FUNCTION(this << routerId << hint);
+    //
+    // The node that originated the router LSA is normally the one we are looking
+    // for, but we fall back to walking the list of nodes in the system looking
+    // for the one that has the given router ID.
+    //
+    if (hint)
+    {
+        Ptr<GlobalRouter> rtr = hint->GetObject<GlobalRouter>();
+        if (rtr && rtr->GetRouterId() == routerId)
+        {
+            return hint;
+        }
+    }
+    NodeList::Iterator listEnd = NodeList::End();
+    for (NodeList::Iterator i = NodeList::Begin(); i != listEnd; i++)
+    {
+        Ptr<Node> node = *i;
+        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        if (rtr && rtr->GetRouterId() == routerId)
+        {
+            return node;
+        }
+    }
+    return nullptr;
 }
 
 void
@@ -1558,105 +1608,82 @@ GlobalRouteManagerImpl::SPFAddASExternal(GlobalRoutingLSA* extlsa, SPFVertex* v)
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
+    // The node that has the router ID corresponding to the root vertex has been
+    // looked up once in SPFCalculate ().  This is the one we're going to write
     // the routing information to.
     //
-    NodeList::Iterator i = NodeList::Begin();
-    NodeList::Iterator listEnd = NodeList::End();
-    for (; i != listEnd; i++)
+    Ptr<Node> node = m_spfrootNode;
+    if (!node)
     {
-        Ptr<Node> node = *i;
-        //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to QI for that interface.  If there's no GlobalRouter interface, the node
-        // in question cannot be the router we want, so we continue.
-        //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        NS_LOG_LOGIC("Can't find root node " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("Setting routes for node " << node->GetId());
+    //
+    // Routing information is updated using the Ipv4 interface.  We need to QI
+    // for that interface.  If the node is acting as an IP version 4 router, it
+    // should absolutely have an Ipv4 interface.
+    //
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "QI for <Ipv4> interface failed");
+    //
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
+    //
+    NS_ASSERT_MSG(v->GetLSA(),
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "Expected valid LSA in SPFVertex* v");
+    Ipv4Mask tempmask = extlsa->GetNetworkLSANetworkMask();
+    Ipv4Address tempip = extlsa->GetLinkStateId();
+    tempip = tempip.CombineMask(tempmask);
 
-        if (!rtr)
+    //
+    // Here's why we did all of that work.  We're going to add a host route to the
+    // host address found in the m_linkData field of the point-to-point link
+    // record.  In the case of a point-to-point link, this is the local IP address
+    // of the node connected to the link.  Each of these point-to-point links
+    // will correspond to a local interface that has an IP address to which
+    // the node at the root of the SPF tree can send packets.  The vertex <v>
+    // (corresponding to the node that has these links and interfaces) has
+    // an m_nextHop address precalculated for us that is the address to which the
+    // root node should send packets to be forwarded to these IP addresses.
+    // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
+    // which the packets should be send for forwarding.
+    //
+    Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
+    if (!router)
+    {
+        return;
+    }
+    Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
+    NS_ASSERT(gr);
+    // walk through all next-hop-IPs and out-going-interfaces for reaching
+    // the stub network gateway 'v' from the root node
+    for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
+    {
+        SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+        Ipv4Address nextHop = exit.first;
+        int32_t outIf = exit.second;
+        if (outIf >= 0)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
-            continue;
+            gr->AddASExternalRouteTo(tempip, tempmask, nextHop, outIf);
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " add external network route to " << tempip
+                                   << " using next hop " << nextHop << " via interface "
+                                   << outIf);
         }
-        //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
-        //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        else
         {
-            NS_LOG_LOGIC("Setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to QI
-            // for that interface.  If the node is acting as an IP version 4 router, it
-            // should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "QI for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            NS_ASSERT_MSG(v->GetLSA(),
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "Expected valid LSA in SPFVertex* v");
-            Ipv4Mask tempmask = extlsa->GetNetworkLSANetworkMask();
-            Ipv4Address tempip = extlsa->GetLinkStateId();
-            tempip = tempip.CombineMask(tempmask);
-
-            //
-            // Here's why we did all of that work.  We're going to add a host route to the
-            // host address found in the m_linkData field of the point-to-point link
-            // record.  In the case of a point-to-point link, this is the local IP address
-            // of the node connected to the link.  Each of these point-to-point links
-            // will correspond to a local interface that has an IP address to which
-            // the node at the root of the SPF tree can send packets.  The vertex <v>
-            // (corresponding to the node that has these links and interfaces) has
-            // an m_nextHop address precalculated for us that is the address to which the
-            // root node should send packets to be forwarded to these IP addresses.
-            // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-            // which the packets should be send for forwarding.
-            //
-            Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-            if (!router)
-            {
-                continue;
-            }
-            Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-            NS_ASSERT(gr);
-            // walk through all next-hop-IPs and out-going-interfaces for reaching
-            // the stub network gateway 'v' from the root node
-            for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-            {
-                SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                Ipv4Address nextHop = exit.first;
-                int32_t outIf = exit.second;
-                if (outIf >= 0)
-                {
-                    gr->AddASExternalRouteTo(tempip, tempmask, nextHop, outIf);
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " add external network route to " << tempip
-                                           << " using next hop " << nextHop << " via interface "
-                                           << outIf);
-                }
-                else
-                {
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " NOT able to add network route to " << tempip
-                                           << " using next hop " << nextHop
-                                           << " since outgoing interface id is negative");
-                }
-            }
-            return;
-        } // if
-    }     // for
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " NOT able to add network route to " << tempip
+                                   << " using next hop " << nextHop
+                                   << " since outgoing interface id is negative");
+        }
+    }
 }
 
 // Processing logic from RFC 2328, page 166 and quagga ospf_spf_process_stubs ()
@@ -1724,105 +1751,82 @@ GlobalRouteManagerImpl::SPFIntraAddStub(GlobalRoutingLinkRecord* l, SPFVertex* v
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
+    // The node that has the router ID corresponding to the root vertex has been
+    // looked up once in SPFCalculate ().  This is the one we're going to write
     // the routing information to.
     //
-    NodeList::Iterator i = NodeList::Begin();
-    NodeList::Iterator listEnd = NodeList::End();
-    for (; i != listEnd; i++)
+    Ptr<Node> node = m_spfrootNode;
+    if (!node)
     {
-        Ptr<Node> node = *i;
-        //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to QI for that interface.  If there's no GlobalRouter interface, the node
-        // in question cannot be the router we want, so we continue.
-        //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        NS_LOG_LOGIC("Can't find root node " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("Setting routes for node " << node->GetId());
+    //
+    // Routing information is updated using the Ipv4 interface.  We need to QI
+    // for that interface.  If the node is acting as an IP version 4 router, it
+    // should absolutely have an Ipv4 interface.
+    //
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "QI for <Ipv4> interface failed");
+    //
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
+    //
+    NS_ASSERT_MSG(v->GetLSA(),
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "Expected valid LSA in SPFVertex* v");
+    Ipv4Mask tempmask(l->GetLinkData().Get());
+    Ipv4Address tempip = l->GetLinkId();
+    tempip = tempip.CombineMask(tempmask);
+    //
+    // Here's why we did all of that work.  We're going to add a host route to the
+    // host address found in the m_linkData field of the point-to-point link
+    // record.  In the case of a point-to-point link, this is the local IP address
+    // of the node connected to the link.  Each of these point-to-point links
+    // will correspond to a local interface that has an IP address to which
+    // the node at the root of the SPF tree can send packets.  The vertex <v>
+    // (corresponding to the node that has these links and interfaces) has
+    // an m_nextHop address precalculated for us that is the address to which the
+    // root node should send packets to be forwarded to these IP addresses.
+    // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
+    // which the packets should be send for forwarding.
+    //
 
-        if (!rtr)
+    Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
+    if (!router)
+    {
+        return;
+    }
+    Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
+    NS_ASSERT(gr);
+    // walk through all next-hop-IPs and out-going-interfaces for reaching
+    // the stub network gateway 'v' from the root node
+    for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
+    {
+        SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+        Ipv4Address nextHop = exit.first;
+        int32_t outIf = exit.second;
+        if (outIf >= 0)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
-            continue;
+            gr->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " add network route to " << tempip
+                                   << " using next hop " << nextHop << " via interface "
+                                   << outIf);
         }
-        //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
-        //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        else
         {
-            NS_LOG_LOGIC("Setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to QI
-            // for that interface.  If the node is acting as an IP version 4 router, it
-            // should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "QI for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            NS_ASSERT_MSG(v->GetLSA(),
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "Expected valid LSA in SPFVertex* v");
-            Ipv4Mask tempmask(l->GetLinkData().Get());
-            Ipv4Address tempip = l->GetLinkId();
-            tempip = tempip.CombineMask(tempmask);
-            //
-            // Here's why we did all of that work.  We're going to add a host route to the
-            // host address found in the m_linkData field of the point-to-point link
-            // record.  In the case of a point-to-point link, this is the local IP address
-            // of the node connected to the link.  Each of these point-to-point links
-            // will correspond to a local interface that has an IP address to which
-            // the node at the root of the SPF tree can send packets.  The vertex <v>
-            // (corresponding to the node that has these links and interfaces) has
-            // an m_nextHop address precalculated for us that is the address to which the
-            // root node should send packets to be forwarded to these IP addresses.
-            // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-            // which the packets should be send for forwarding.
-            //
-
-            Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-            if (!router)
-            {
-                continue;
-            }
-            Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-            NS_ASSERT(gr);
-            // walk through all next-hop-IPs and out-going-interfaces for reaching
-            // the stub network gateway 'v' from the root node
-            for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-            {
-                SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                Ipv4Address nextHop = exit.first;
-                int32_t outIf = exit.second;
-                if (outIf >= 0)
-                {
-                    gr->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " add network route to " << tempip
-                                           << " using next hop " << nextHop << " via interface "
-                                           << outIf);
-                }
-                else
-                {
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " NOT able to add network route to " << tempip
-                                           << " using next hop " << nextHop
-                                           << " since outgoing interface id is negative");
-                }
-            }
-            return;
-        } // if
-    }     // for
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " NOT able to add network route to " << tempip
+                                   << " using next hop " << nextHop
+                                   << " since outgoing interface id is negative");
+        }
+    }
 }
 
 //
@@ -1846,54 +1850,28 @@ GlobalRouteManagerImpl::FindOutgoingInterfaceId(Ipv4Address a, Ipv4Mask amask)
     //
     Ipv4Address routerId = m_spfroot->GetVertexId();
     //
-    // Walk the list of nodes in the system looking for the one corresponding to
-    // the node at the root of the SPF tree.  This is the node for which we are
-    // building the routing table.
+    // The node corresponding to the root of the SPF tree, i.e., the node for
+    // which we are building the routing table, has been looked up once in
+    // SPFCalculate ().
     //
-    NodeList::Iterator i = NodeList::Begin();
-    NodeList::Iterator listEnd = NodeList::End();
-    for (; i != listEnd; i++)
+    Ptr<Node> node = m_spfrootNode;
+    if (node)
     {
-        Ptr<Node> node = *i;
-
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
         //
-        // If the node doesn't have a GlobalRouter interface it can't be the one
-        // we're interested in.
+        // We're going to need the Ipv4 interface to look for the ipv4 interface
+        // index.  Since this node is participating in routing IP version 4 packets,
+        // it certainly must have an Ipv4 interface.
         //
-        if (!rtr)
-        {
-            continue;
-        }
-
-        if (rtr->GetRouterId() == routerId)
-        {
-            //
-            // This is the node we're building the routing table for.  We're going to need
-            // the Ipv4 interface to look for the ipv4 interface index.  Since this node
-            // is participating in routing IP version 4 packets, it certainly must have
-            // an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::FindOutgoingInterfaceId (): "
-                          "GetObject for <Ipv4> interface failed");
-            //
-            // Look through the interfaces on this node for one that has the IP address
-            // we're looking for.  If we find one, return the corresponding interface
-            // index, or -1 if not found.
-            //
-            int32_t interface = ipv4->GetInterfaceForPrefix(a, amask);
-
-#if 0
-          if (interface < 0)
-            {
-              NS_FATAL_ERROR ("GlobalRouteManagerImpl::FindOutgoingInterfaceId(): "
-                              "Expected an interface associated with address a:" << a);
-            }
-#endif
-            return interface;
-        }
+        Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+        NS_ASSERT_MSG(ipv4,
+                      "GlobalRouteManagerImpl::FindOutgoingInterfaceId (): "
+                      "GetObject for <Ipv4> interface failed");
+        //
+        // Look through the interfaces on this node for one that has the IP address
+        // we're looking for.  If we find one, return the corresponding interface
+        // index, or -1 if not found.
+        //
+        return ipv4->GetInterfaceForPrefix(a, amask);
     }
     //
     // Couldn't find it.
@@ -1935,130 +1913,104 @@ GlobalRouteManagerImpl::SPFIntraAddRouter(SPFVertex* v)
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
+    // The node that has the router ID corresponding to the root vertex has been
+    // looked up once in SPFCalculate ().  This is the one we're going to write
     // the routing information to.
     //
-    NodeList::Iterator i = NodeList::Begin();
-    NodeList::Iterator listEnd = NodeList::End();
-    for (; i != listEnd; i++)
+    Ptr<Node> node = m_spfrootNode;
+    if (!node)
+    {
+        NS_LOG_LOGIC("Can't find root node " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("Setting routes for node " << node->GetId());
+    //
+    // Routing information is updated using the Ipv4 interface.  We need to
+    // GetObject for that interface.  If the node is acting as an IP version 4
+    // router, it should absolutely have an Ipv4 interface.
+    //
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "GetObject for <Ipv4> interface failed");
+    //
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
+    //
+    GlobalRoutingLSA* lsa = v->GetLSA();
+    NS_ASSERT_MSG(lsa,
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "Expected valid LSA in SPFVertex* v");
+
+    uint32_t nLinkRecords = lsa->GetNLinkRecords();
+    //
+    // Iterate through the link records on the vertex to which we're going to add
+    // routes.  To make sure we're being clear, we're going to add routing table
+    // entries to the tables on the node corresping to the root of the SPF tree.
+    // These entries will have routes to the IP addresses we find from looking at
+    // the local side of the point-to-point links found on the node described by
+    // the vertex <v>.
+    //
+    NS_LOG_LOGIC(" Node " << node->GetId() << " found " << nLinkRecords
+                          << " link records in LSA " << lsa << "with LinkStateId "
+                          << lsa->GetLinkStateId());
+    for (uint32_t j = 0; j < nLinkRecords; ++j)
     {
-        Ptr<Node> node = *i;
         //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to GetObject for that interface.  If there's no GlobalRouter interface,
-        // the node in question cannot be the router we want, so we continue.
+        // We are only concerned about point-to-point links
         //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
-
-        if (!rtr)
+        GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
+        if (lr->GetLinkType() != GlobalRoutingLinkRecord::PointToPoint)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
             continue;
         }
         //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
+        // Here's why we did all of that work.  We're going to add a host route to the
+        // host address found in the m_linkData field of the point-to-point link
+        // record.  In the case of a point-to-point link, this is the local IP address
+        // of the node connected to the link.  Each of these point-to-point links
+        // will correspond to a local interface that has an IP address to which
+        // the node at the root of the SPF tree can send packets.  The vertex <v>
+        // (corresponding to the node that has these links and interfaces) has
+        // an m_nextHop address precalculated for us that is the address to which the
+        // root node should send packets to be forwarded to these IP addresses.
+        // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
+        // which the packets should be send for forwarding.
         //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
+        if (!router)
         {
-            NS_LOG_LOGIC("Setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to
-            // GetObject for that interface.  If the node is acting as an IP version 4
-            // router, it should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "GetObject for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            GlobalRoutingLSA* lsa = v->GetLSA();
-            NS_ASSERT_MSG(lsa,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "Expected valid LSA in SPFVertex* v");
-
-            uint32_t nLinkRecords = lsa->GetNLinkRecords();
-            //
-            // Iterate through the link records on the vertex to which we're going to add
-            // routes.  To make sure we're being clear, we're going to add routing table
-            // entries to the tables on the node corresping to the root of the SPF tree.
-            // These entries will have routes to the IP addresses we find from looking at
-            // the local side of the point-to-point links found on the node described by
-            // the vertex <v>.
-            //
-            NS_LOG_LOGIC(" Node " << node->GetId() << " found " << nLinkRecords
-                                  << " link records in LSA " << lsa << "with LinkStateId "
-                                  << lsa->GetLinkStateId());
-            for (uint32_t j = 0; j < nLinkRecords; ++j)
+            continue;
+        }
+        Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
+        NS_ASSERT(gr);
+        // walk through all available exit directions due to ECMP,
+        // and add host route for each of the exit direction toward
+        // the vertex 'v'
+        for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
+        {
+            SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+            Ipv4Address nextHop = exit.first;
+            int32_t outIf = exit.second;
+            if (outIf >= 0)
             {
-                //
-                // We are only concerned about point-to-point links
-                //
-                GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
-                if (lr->GetLinkType() != GlobalRoutingLinkRecord::PointToPoint)
-                {
-                    continue;
-                }
-                //
-                // Here's why we did all of that work.  We're going to add a host route to the
-                // host address found in the m_linkData field of the point-to-point link
-                // record.  In the case of a point-to-point link, this is the local IP address
-                // of the node connected to the link.  Each of these point-to-point links
-                // will correspond to a local interface that has an IP address to which
-                // the node at the root of the SPF tree can send packets.  The vertex <v>
-                // (corresponding to the node that has these links and interfaces) has
-                // an m_nextHop address precalculated for us that is the address to which the
-                // root node should send packets to be forwarded to these IP addresses.
-                // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-                // which the packets should be send for forwarding.
-                //
-                Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-                if (!router)
-                {
-                    continue;
-                }
-                Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-                NS_ASSERT(gr);
-                // walk through all available exit directions due to ECMP,
-                // and add host route for each of the exit direction toward
-                // the vertex 'v'
-                for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-                {
-                    SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                    Ipv4Address nextHop = exit.first;
-                    int32_t outIf = exit.second;
-                    if (outIf >= 0)
-                    {
-                        gr->AddHostRouteTo(lr->GetLinkData(), nextHop, outIf);
-                        NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                               << " adding host route to " << lr->GetLinkData()
-                                               << " using next hop " << nextHop
-                                               << " and outgoing interface " << outIf);
-                    }
-                    else
-                    {
-                        NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                               << " NOT able to add host route to "
-                                               << lr->GetLinkData() << " using next hop " << nextHop
-                                               << " since outgoing interface id is negative "
-                                               << outIf);
-                    }
-                } // for all routes from the root the vertex 'v'
+                gr->AddHostRouteTo(lr->GetLinkData(), nextHop, outIf);
+                NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                       << " adding host route to " << lr->GetLinkData()
+                                       << " using next hop " << nextHop
+                                       << " and outgoing interface " << outIf);
             }
-            //
-            // Done adding the routes for the selected node.
-            //
-            return;
-        }
+            else
+            {
+                NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                       << " NOT able to add host route to "
+                                       << lr->GetLinkData() << " using next hop " << nextHop
+                                       << " since outgoing interface id is negative "
+                                       << outIf);
+            }
+        } // for all routes from the root the vertex 'v'
     }
 }
 
@@ -2079,91 +2031,69 @@ GlobalRouteManagerImpl::SPFIntraAddTransit(SPFVertex* v)
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
+    // The node that has the router ID corresponding to the root vertex has been
+    // looked up once in SPFCalculate ().  This is the one we're going to write
     // the routing information to.
     //
-    NodeList::Iterator i = NodeList::Begin();
-    NodeList::Iterator listEnd = NodeList::End();
-    for (; i != listEnd; i++)
+    Ptr<Node> node = m_spfrootNode;
+    if (!node)
     {
-        Ptr<Node> node = *i;
-        //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to GetObject for that interface.  If there's no GlobalRouter interface,
-        // the node in question cannot be the router we want, so we continue.
-        //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        NS_LOG_LOGIC("Can't find root node " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("setting routes for node " << node->GetId());
+    //
+    // Routing information is updated using the Ipv4 interface.  We need to
+    // GetObject for that interface.  If the node is acting as an IP version 4
+    // router, it should absolutely have an Ipv4 interface.
+    //
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    NS_ASSERT_MSG(ipv4,
+                  "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
+                  "GetObject for <Ipv4> interface failed");
+    //
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
+    //
+    GlobalRoutingLSA* lsa = v->GetLSA();
+    NS_ASSERT_MSG(lsa,
+                  "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
+                  "Expected valid LSA in SPFVertex* v");
+    Ipv4Mask tempmask = lsa->GetNetworkLSANetworkMask();
+    Ipv4Address tempip = lsa->GetLinkStateId();
+    tempip = tempip.CombineMask(tempmask);
+    Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
+    if (!router)
+    {
+        return;
+    }
+    Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
+    NS_ASSERT(gr);
+    // walk through all available exit directions due to ECMP,
+    // and add host route for each of the exit direction toward
+    // the vertex 'v'
+    for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
+    {
+        SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+        Ipv4Address nextHop = exit.first;
+        int32_t outIf = exit.second;
 
-        if (!rtr)
+        if (outIf >= 0)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
-            continue;
+            gr->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " add network route to " << tempip
+                                   << " using next hop " << nextHop << " via interface "
+                                   << outIf);
         }
-        //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
-        //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        else
         {
-            NS_LOG_LOGIC("setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to
-            // GetObject for that interface.  If the node is acting as an IP version 4
-            // router, it should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
-                          "GetObject for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            GlobalRoutingLSA* lsa = v->GetLSA();
-            NS_ASSERT_MSG(lsa,
-                          "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
-                          "Expected valid LSA in SPFVertex* v");
-            Ipv4Mask tempmask = lsa->GetNetworkLSANetworkMask();
-            Ipv4Address tempip = lsa->GetLinkStateId();
-            tempip = tempip.CombineMask(tempmask);
-            Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-            if (!router)
-            {
-                continue;
-            }
-            Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-            NS_ASSERT(gr);
-            // walk through all available exit directions due to ECMP,
-            // and add host route for each of the exit direction toward
-            // the vertex 'v'
-            for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-            {
-                SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                Ipv4Address nextHop = exit.first;
-                int32_t outIf = exit.second;
-
-                if (outIf >= 0)
-                {
-                    gr->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " add network route to " << tempip
-                                           << " using next hop " << nextHop << " via interface "
-                                           << outIf);
-                }
-                else
-                {
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " NOT able to add network route to " << tempip
-                                           << " using next hop " << nextHop
-                                           << " since outgoing interface id is negative " << outIf);
-                }
-            }
+            NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
+                                   << " NOT able to add network route to " << tempip
+                                   << " using next hop " << nextHop
+                                   << " since outgoing interface id is negative " << outIf);
         }
     }
 }
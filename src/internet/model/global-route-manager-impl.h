@@ -678,7 +678,8 @@ class GlobalRouteManagerLSDB
     typedef std::pair<Ipv4Address, GlobalRoutingLSA*>
         LSDBPair_t; //!< pair of IPv4 addresses / Link State Advertisements
 
-    LSDBMap_t m_database; //!< database of IPv4 addresses / Link State Advertisements
+    LSDBMap_t m_database;      //!< database of IPv4 addresses / Link State Advertisements
+    LSDBMap_t m_linkDataIndex; //!< index of the LSAs by transit network link data
     std::vector<GlobalRoutingLSA*>
         m_extdatabase; //!< database of External Link State Advertisements
 };
@@ -739,6 +740,7 @@ class GlobalRouteManagerImpl
 
   private:
     SPFVertex* m_spfroot;           //!< the root node
+    Ptr<Node> m_spfrootNode;        //!< the node corresponding to the root vertex
     GlobalRouteManagerLSDB* m_lsdb; //!< the Link State DataBase (LSDB) of the Global Route Manager
 
     /**
@@ -753,6 +755,16 @@ class GlobalRouteManagerImpl
      */
     bool CheckForStubNode(Ipv4Address root);
 
+    /**
+     * \brief Find the node having the given router ID
+     *
+     * \param routerId the router ID
+     * \param hint a node likely to have the router ID (e.g., the originator of
+     * the router LSA), checked first
+     * \returns the node, or nullptr if no node has the router ID
+     */
+    Ptr<Node> FindRouterNode(Ipv4Address routerId, Ptr<Node> hint) const;
+
     /**
      * \brief Calculate the shortest path first (SPF) tree
      *
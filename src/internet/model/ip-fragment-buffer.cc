@@ -0,0 +1,161 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ip-fragment-buffer.h"
+
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("IpFragmentBuffer");
+
+IpFragmentBuffer::IpFragmentBuffer()
+    : m_size(0)
+{
+}
+
+bool
+IpFragmentBuffer::AddFragment(Ptr<Packet> fragment, uint32_t offset)
+{
+    NS_LOG_FUNCTION(this << fragment << offset);
+    uint32_t start = offset;
+    uint32_t end = offset + fragment->GetSize();
+
+    auto range = m_fragments.equal_range(offset);
+    for (auto it = range.first; it != range.second; it++)
+    {
+        if (it->second->GetSize() == fragment->GetSize())
+        {
+            NS_LOG_LOGIC("Duplicate fragment at offset " << offset);
+            return false;
+        }
+    }
+    // multimap insertions with an existing key are done after the equal keys
+    m_fragments.emplace(offset, fragment);
+    m_size += fragment->GetSize();
+
+    // merge the range of the fragment with the covered ranges it touches
+    auto it = m_covered.upper_bound(start);
+    if (it != m_covered.begin())
+    {
+        auto prev = std::prev(it);
+        if (prev->second >= start)
+        {
+            start = prev->first;
+            end = std::max(end, prev->second);
+            it = m_covered.erase(prev);
+        }
+    }
+    while (it != m_covered.end() && it->first <= end)
+    {
+        end = std::max(end, it->second);
+        it = m_covered.erase(it);
+    }
+    m_covered.emplace_hint(it, start, end);
+    return true;
+}
+
+bool
+IpFragmentBuffer::IsEmpty() const
+{
+    return m_fragments.empty();
+}
+
+bool
+IpFragmentBuffer::IsContiguous() const
+{
+    return m_covered.size() == 1 && m_covered.begin()->first == 0;
+}
+
+uint32_t
+IpFragmentBuffer::GetEnd() const
+{
+    return m_covered.empty() ? 0 : m_covered.rbegin()->second;
+}
+
+uint32_t
+IpFragmentBuffer::GetSize() const
+{
+    return m_size;
+}
+
+Ptr<Packet>
+IpFragmentBuffer::GetPacket(Ptr<const Packet> head) const
+{
+    NS_LOG_FUNCTION(this << head);
+    std::vector<Ptr<Packet>> pieces;
+    pieces.reserve(m_fragments.size() + 1);
+    if (head)
+    {
+        pieces.push_back(head->Copy());
+    }
+
+    uint32_t end = 0;
+    for (const auto& fragment : m_fragments)
+    {
+        uint32_t offset = fragment.first;
+        uint32_t size = fragment.second->GetSize();
+        if (offset > end)
+        {
+            break;
+        }
+        if (offset + size <= end)
+        {
+            // no new bytes in this fragment
+            continue;
+        }
+        if (offset == end)
+        {
+            pieces.push_back(fragment.second->Copy());
+        }
+        else
+        {
+            // The fragments are overlapping.  We do not overwrite the "old" with the "new"
+            // because we do not know when each arrived.
+            pieces.push_back(fragment.second->CreateFragment(end - offset, offset + size - end));
+        }
+        end = offset + size;
+    }
+    return Concatenate(pieces);
+}
+
+Ptr<Packet>
+IpFragmentBuffer::Concatenate(std::vector<Ptr<Packet>>& pieces)
+{
+    if (pieces.empty())
+    {
+        return Create<Packet>();
+    }
+    while (pieces.size() > 1)
+    {
+        std::size_t merged = 0;
+        for (std::size_t i = 0; i < pieces.size(); i += 2)
+        {
+            if (i + 1 < pieces.size())
+            {
+                pieces[i]->AddAtEnd(pieces[i + 1]);
+            }
+            pieces[merged++] = pieces[i];
+        }
+        pieces.resize(merged);
+    }
+    return pieces.front();
+}
+
+} // namespace ns3
@@ -0,0 +1,118 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef IP_FRAGMENT_BUFFER_H
+#define IP_FRAGMENT_BUFFER_H
+
+#include "ns3/packet.h"
+#include "ns3/ptr.h"
+
+#include <map>
+#include <stdint.h>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup internet
+ *
+ * \brief Reassembly buffer of the fragments of a packet.
+ *
+ * The fragments are indexed by their offset, and the byte ranges covered by
+ * the fragments received so far are kept as a set of disjoint intervals.
+ * Hence adding a fragment and checking whether the packet is complete take
+ * a logarithmic time in the number of fragments, instead of a full scan of
+ * the fragment list.
+ *
+ * The reassembled packet is built by concatenating the fragments pairwise,
+ * so that every byte is copied a logarithmic number of times, instead of once
+ * per fragment following it.
+ *
+ * The buffer is used by IPv4 and IPv6; the protocol specific rules
+ * (e.g., the handling of the "More Fragments" flag or of overlaps) are left
+ * to the users of the buffer.
+ */
+class IpFragmentBuffer
+{
+  public:
+    IpFragmentBuffer();
+
+    /**
+     * \brief Add a fragment.
+     *
+     * A fragment that is an exact duplicate (same offset and size) of one
+     * already in the buffer is discarded.
+     *
+     * \param fragment the fragment
+     * \param offset the offset of the fragment in the original packet, in bytes
+     * \return true if the fragment has been added, false if it is a duplicate
+     */
+    bool AddFragment(Ptr<Packet> fragment, uint32_t offset);
+
+    /**
+     * \return true if the buffer holds no fragments
+     */
+    bool IsEmpty() const;
+
+    /**
+     * \return true if the fragments cover all the bytes from offset zero to
+     * the end of the last fragment, without holes
+     */
+    bool IsContiguous() const;
+
+    /**
+     * \return the end offset of the last fragment, in bytes
+     */
+    uint32_t GetEnd() const;
+
+    /**
+     * \return the sum of the sizes of the fragments in the buffer, which
+     * exceeds GetEnd() for complete buffers if some fragments overlap
+     */
+    uint32_t GetSize() const;
+
+    /**
+     * \brief Reassemble the fragments.
+     *
+     * The packet is made of the bytes covered contiguously from offset zero.
+     * In case of overlapping fragments, the bytes of the fragment with the
+     * lowest offset (or received first, if the offsets are the same) are used.
+     *
+     * \param head an optional packet (e.g., unfragmentable headers) put
+     * before the reassembled bytes
+     * \return the reassembled packet
+     */
+    Ptr<Packet> GetPacket(Ptr<const Packet> head = nullptr) const;
+
+  private:
+    /**
+     * \brief Concatenate packets, pairwise.
+     * \param pieces the packets, modified by the function
+     * \return the concatenation of the packets
+     */
+    static Ptr<Packet> Concatenate(std::vector<Ptr<Packet>>& pieces);
+
+    /// Fragments, indexed by offset
+    std::multimap<uint32_t, Ptr<Packet>> m_fragments;
+    /// Disjoint ranges covered by the fragments, from start to end offset
+    std::map<uint32_t, uint32_t> m_covered;
+    /// Sum of the sizes of the fragments
+    uint32_t m_size;
+};
+
+} // namespace ns3
+
+#endif /* IP_FRAGMENT_BUFFER_H */
@@ -24,6 +24,8 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -40,14 +42,97 @@ Ipv4EndPointDemux::Ipv4EndPointDemux()
 Ipv4EndPointDemux::~Ipv4EndPointDemux()
 {
     NS_LOG_FUNCTION(this);
+    m_connectedEndPoints.clear();
+    m_wildcardEndPoints.clear();
     for (EndPointsI i = m_endPoints.begin(); i != m_endPoints.end(); i++)
     {
         Ipv4EndPoint* endPoint = *i;
+        endPoint->m_demux = nullptr;
         delete endPoint;
     }
     m_endPoints.clear();
 }
 
+bool
+Ipv4EndPointDemux::FourTuple::operator==(const FourTuple& other) const
+{
+    return localAddress == other.localAddress && localPort == other.localPort &&
+           peerAddress == other.peerAddress && peerPort == other.peerPort;
+}
+
+std::size_t
+Ipv4EndPointDemux::FourTupleHash::operator()(const FourTuple& tuple) const
+{
+    std::size_t hash = Ipv4AddressHash()(tuple.peerAddress);
+    hash = hash * 31 + Ipv4AddressHash()(tuple.localAddress);
+    hash = hash * 31 + tuple.peerPort;
+    hash = hash * 31 + tuple.localPort;
+    return hash;
+}
+
+Ipv4EndPointDemux::FourTuple
+Ipv4EndPointDemux::GetFourTuple(Ipv4EndPoint* endPoint)
+{
+    return {endPoint->GetLocalAddress(),
+            endPoint->GetLocalPort(),
+            endPoint->GetPeerAddress(),
+            endPoint->GetPeerPort()};
+}
+
+bool
+Ipv4EndPointDemux::IsFullySpecified(const FourTuple& tuple)
+{
+    return tuple.localAddress != Ipv4Address::GetAny() &&
+           tuple.peerAddress != Ipv4Address::GetAny() && tuple.peerPort != 0;
+}
+
+Ipv4EndPoint*
+Ipv4EndPointDemux::AddEndPoint(Ipv4EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    m_endPoints.push_back(endPoint);
+    endPoint->m_demux = this;
+    AddToIndex(endPoint);
+    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
+    return endPoint;
+}
+
+void
+Ipv4EndPointDemux::AddToIndex(Ipv4EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    FourTuple tuple = GetFourTuple(endPoint);
+    if (IsFullySpecified(tuple))
+    {
+        m_connectedEndPoints.emplace(tuple, endPoint);
+    }
+    else
+    {
+        m_wildcardEndPoints.push_back(endPoint);
+    }
+}
+
+void
+Ipv4EndPointDemux::RemoveFromIndex(Ipv4EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    FourTuple tuple = GetFourTuple(endPoint);
+    if (!IsFullySpecified(tuple))
+    {
+        m_wildcardEndPoints.remove(endPoint);
+        return;
+    }
+    auto range = m_connectedEndPoints.equal_range(tuple);
+    for (auto it = range.first; it != range.second; it++)
+    {
+        if (it->second == endPoint)
+        {
+            m_connectedEndPoints.erase(it);
+            return;
+        }
+    }
+}
+
 bool
 Ipv4EndPointDemux::LookupPortLocal(uint16_t port)
 {
@@ -88,9 +173,7 @@ Ipv4EndPointDemux::Allocate()
         return nullptr;
     }
     Ipv4EndPoint* endPoint = new Ipv4EndPoint(Ipv4Address::GetAny(), port);
-    m_endPoints.push_back(endPoint);
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
-    return endPoint;
+    return AddEndPoint(endPoint);
 }
 
 Ipv4EndPoint*
@@ -104,9 +187,7 @@ Ipv4EndPointDemux::Allocate(Ipv4Address address)
         return nullptr;
     }
     Ipv4EndPoint* endPoint = new Ipv4EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
-    return endPoint;
+    return AddEndPoint(endPoint);
 }
 
 Ipv4EndPoint*
@@ -127,9 +208,7 @@ Ipv4EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice, Ipv4Address address,
         return nullptr;
     }
     Ipv4EndPoint* endPoint = new Ipv4EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
-    return endPoint;
+    return AddEndPoint(endPoint);
 }
 
 Ipv4EndPoint*
@@ -140,11 +219,29 @@ Ipv4EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
                             uint16_t peerPort)
 {
     NS_LOG_FUNCTION(this << localAddress << localPort << peerAddress << peerPort << boundNetDevice);
-    for (EndPointsI i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    FourTuple tuple{localAddress, localPort, peerAddress, peerPort};
+    EndPoints sameTuple;
+    if (IsFullySpecified(tuple))
+    {
+        auto range = m_connectedEndPoints.equal_range(tuple);
+        for (auto it = range.first; it != range.second; it++)
+        {
+            sameTuple.push_back(it->second);
+        }
+    }
+    else
+    {
+        for (EndPointsI i = m_wildcardEndPoints.begin(); i != m_wildcardEndPoints.end(); i++)
+        {
+            if (GetFourTuple(*i) == tuple)
+            {
+                sameTuple.push_back(*i);
+            }
+        }
+    }
+    for (EndPointsI i = sameTuple.begin(); i != sameTuple.end(); i++)
     {
-        if ((*i)->GetLocalPort() == localPort && (*i)->GetLocalAddress() == localAddress &&
-            (*i)->GetPeerPort() == peerPort && (*i)->GetPeerAddress() == peerAddress &&
-            ((*i)->GetBoundNetDevice() == boundNetDevice || !(*i)->GetBoundNetDevice()))
+        if ((*i)->GetBoundNetDevice() == boundNetDevice || !(*i)->GetBoundNetDevice())
         {
             NS_LOG_WARN("Duplicated endpoint.");
             return nullptr;
@@ -152,11 +249,7 @@ Ipv4EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
     }
     Ipv4EndPoint* endPoint = new Ipv4EndPoint(localAddress, localPort);
     endPoint->SetPeer(peerAddress, peerPort);
-    m_endPoints.push_back(endPoint);
-
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
-
-    return endPoint;
+    return AddEndPoint(endPoint);
 }
 
 void
@@ -167,6 +260,8 @@ Ipv4EndPointDemux::DeAllocate(Ipv4EndPoint* endPoint)
     {
         if (*i == endPoint)
         {
+            RemoveFromIndex(endPoint);
+            endPoint->m_demux = nullptr;
             delete endPoint;
             m_endPoints.erase(i);
             break;
@@ -211,7 +306,40 @@ Ipv4EndPointDemux::Lookup(Ipv4Address daddr,
     EndPoints retval4; // Exact match on all 4
 
     NS_LOG_DEBUG("Looking up endpoint for destination address " << daddr << ":" << dport);
-    for (EndPointsI i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+
+    // A fully specified end point can only be found for case 4 (exact match) or for case 3
+    // (local address bound to x.y.z.0, see below), so it is looked up in the hash index.
+    auto findConnected = [this, incomingInterface](const FourTuple& tuple, EndPoints& found) {
+        auto range = m_connectedEndPoints.equal_range(tuple);
+        for (auto it = range.first; it != range.second; it++)
+        {
+            Ipv4EndPoint* endP = it->second;
+            Ptr<NetDevice> device = endP->GetBoundNetDevice();
+            if (!endP->IsRxEnabled() || (device && device != incomingInterface->GetDevice()))
+            {
+                continue;
+            }
+            if (std::find(found.begin(), found.end(), endP) == found.end())
+            {
+                NS_LOG_LOGIC("Found a fully specified endpoint, adding "
+                             << endP->GetLocalAddress() << ":" << endP->GetLocalPort());
+                found.push_back(endP);
+            }
+        }
+    };
+    findConnected({daddr, dport, saddr, sport}, retval4);
+    for (uint32_t i = 0; i < incomingInterface->GetNAddresses(); i++)
+    {
+        Ipv4InterfaceAddress addr = incomingInterface->GetAddress(i);
+        Ipv4Address addrNetpart = addr.GetLocal().CombineMask(addr.GetMask());
+        if (addrNetpart != daddr && addrNetpart == daddr.CombineMask(addr.GetMask()))
+        {
+            findConnected({addrNetpart, dport, saddr, sport}, retval3);
+        }
+    }
+
+    // All the other end points have at least one wildcard and are scanned
+    for (EndPointsI i = m_wildcardEndPoints.begin(); i != m_wildcardEndPoints.end(); i++)
     {
         Ipv4EndPoint* endP = *i;
 
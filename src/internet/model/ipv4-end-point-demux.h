@@ -26,6 +26,7 @@
 
 #include <list>
 #include <stdint.h>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -171,6 +172,82 @@ class Ipv4EndPointDemux
     void DeAllocate(Ipv4EndPoint* endPoint);
 
   private:
+    friend class Ipv4EndPoint;
+
+    /**
+     * \brief The four-tuple of a fully specified end point.
+     */
+    struct FourTuple
+    {
+        Ipv4Address localAddress; //!< local address
+        uint16_t localPort;       //!< local port
+        Ipv4Address peerAddress;  //!< peer address
+        uint16_t peerPort;        //!< peer port
+
+        /**
+         * \brief Equality operator.
+         * \param other the tuple to compare to
+         * \return true if the two tuples are equal
+         */
+        bool operator==(const FourTuple& other) const;
+    };
+
+    /**
+     * \brief Hash function for FourTuple.
+     */
+    struct FourTupleHash
+    {
+        /**
+         * \brief Compute the hash of a four-tuple.
+         * \param tuple the four-tuple
+         * \return the hash
+         */
+        std::size_t operator()(const FourTuple& tuple) const;
+    };
+
+    /**
+     * \brief Container of the fully specified IPv4 end points, indexed by four-tuple.
+     */
+    typedef std::unordered_multimap<FourTuple, Ipv4EndPoint*, FourTupleHash> ConnectedEndPoints;
+
+    /**
+     * \brief Get the current four-tuple of an end point.
+     * \param endPoint the end point
+     * \return the four-tuple
+     */
+    static FourTuple GetFourTuple(Ipv4EndPoint* endPoint);
+
+    /**
+     * \brief Check if a four-tuple has a specific local address, peer address and peer port.
+     *
+     * An end point with such a four-tuple can only be matched by the exact
+     * four-tuple, hence it is looked up through the hash index rather than
+     * by scanning.
+     *
+     * \param tuple the four-tuple
+     * \return true if the four-tuple is fully specified
+     */
+    static bool IsFullySpecified(const FourTuple& tuple);
+
+    /**
+     * \brief Register a newly created end point.
+     * \param endPoint the end point
+     * \return the end point
+     */
+    Ipv4EndPoint* AddEndPoint(Ipv4EndPoint* endPoint);
+
+    /**
+     * \brief Add an end point to the lookup index, according to its current four-tuple.
+     * \param endPoint the end point
+     */
+    void AddToIndex(Ipv4EndPoint* endPoint);
+
+    /**
+     * \brief Remove an end point from the lookup index, according to its current four-tuple.
+     * \param endPoint the end point
+     */
+    void RemoveFromIndex(Ipv4EndPoint* endPoint);
+
     /**
      * \brief Allocate an ephemeral port.
      * \returns the ephemeral port
@@ -196,6 +273,16 @@ class Ipv4EndPointDemux
      * \brief A list of IPv4 end points.
      */
     EndPoints m_endPoints;
+
+    /**
+     * \brief The fully specified IPv4 end points, indexed by four-tuple.
+     */
+    ConnectedEndPoints m_connectedEndPoints;
+
+    /**
+     * \brief The IPv4 end points with at least one wildcard in their four-tuple.
+     */
+    EndPoints m_wildcardEndPoints;
 };
 
 } // namespace ns3
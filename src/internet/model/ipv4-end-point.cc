@@ -19,6 +19,8 @@
 
 #include "ipv4-end-point.h"
 
+#include "ipv4-end-point-demux.h"
+
 #include "ns3/log.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
@@ -33,7 +35,8 @@ Ipv4EndPoint::Ipv4EndPoint(Ipv4Address address, uint16_t port)
       m_localPort(port),
       m_peerAddr(Ipv4Address::GetAny()),
       m_peerPort(0),
-      m_rxEnabled(true)
+      m_rxEnabled(true),
+      m_demux(nullptr)
 {
     NS_LOG_FUNCTION(this << address << port);
 }
@@ -61,7 +64,15 @@ void
 Ipv4EndPoint::SetLocalAddress(Ipv4Address address)
 {
     NS_LOG_FUNCTION(this << address);
+    if (m_demux)
+    {
+        m_demux->RemoveFromIndex(this);
+    }
     m_localAddr = address;
+    if (m_demux)
+    {
+        m_demux->AddToIndex(this);
+    }
 }
 
 uint16_t
@@ -89,8 +100,16 @@ void
 Ipv4EndPoint::SetPeer(Ipv4Address address, uint16_t port)
 {
     NS_LOG_FUNCTION(this << address << port);
+    if (m_demux)
+    {
+        m_demux->RemoveFromIndex(this);
+    }
     m_peerAddr = address;
     m_peerPort = port;
+    if (m_demux)
+    {
+        m_demux->AddToIndex(this);
+    }
 }
 
 void
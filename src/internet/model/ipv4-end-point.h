@@ -32,6 +32,7 @@ namespace ns3
 {
 
 class Header;
+class Ipv4EndPointDemux;
 class Packet;
 
 /**
@@ -190,6 +191,8 @@ class Ipv4EndPoint
     bool IsRxEnabled();
 
   private:
+    friend class Ipv4EndPointDemux;
+
     /**
      * \brief The local address.
      */
@@ -234,6 +237,13 @@ class Ipv4EndPoint
      * \brief true if the endpoint can receive packets.
      */
     bool m_rxEnabled;
+
+    /**
+     * \brief The demux indexing this endpoint (if any).
+     *
+     * The demux is notified when the four-tuple of the endpoint changes.
+     */
+    Ipv4EndPointDemux* m_demux;
 };
 
 } // namespace ns3
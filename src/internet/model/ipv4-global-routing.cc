@@ -64,7 +64,8 @@ Ipv4GlobalRouting::GetTypeId()
 
 Ipv4GlobalRouting::Ipv4GlobalRouting()
     : m_randomEcmpRouting(false),
-      m_respondToInterfaceEvents(false)
+      m_respondToInterfaceEvents(false),
+      m_generation(1)
 {
     NS_LOG_FUNCTION(this);
 
@@ -83,6 +84,8 @@ Ipv4GlobalRouting::AddHostRouteTo(Ipv4Address dest, Ipv4Address nextHop, uint32_
     Ipv4RoutingTableEntry* route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateHostRouteTo(dest, nextHop, interface);
     m_hostRoutes.push_back(route);
+    m_hostRoutesTrie.Insert(dest, Ipv4Mask::GetOnes(), route);
+    m_generation++;
 }
 
 void
@@ -92,6 +95,8 @@ Ipv4GlobalRouting::AddHostRouteTo(Ipv4Address dest, uint32_t interface)
     Ipv4RoutingTableEntry* route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateHostRouteTo(dest, interface);
     m_hostRoutes.push_back(route);
+    m_hostRoutesTrie.Insert(dest, Ipv4Mask::GetOnes(), route);
+    m_generation++;
 }
 
 void
@@ -104,6 +109,8 @@ Ipv4GlobalRouting::AddNetworkRouteTo(Ipv4Address network,
     Ipv4RoutingTableEntry* route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, nextHop, interface);
     m_networkRoutes.push_back(route);
+    m_networkRoutesTrie.Insert(network, networkMask, route);
+    m_generation++;
 }
 
 void
@@ -113,6 +120,8 @@ Ipv4GlobalRouting::AddNetworkRouteTo(Ipv4Address network, Ipv4Mask networkMask,
     Ipv4RoutingTableEntry* route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, interface);
     m_networkRoutes.push_back(route);
+    m_networkRoutesTrie.Insert(network, networkMask, route);
+    m_generation++;
 }
 
 void
@@ -125,6 +134,8 @@ Ipv4GlobalRouting::AddASExternalRouteTo(Ipv4Address network,
     Ipv4RoutingTableEntry* route = new Ipv4RoutingTableEntry();
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, nextHop, interface);
     m_ASexternalRoutes.push_back(route);
+    m_ASexternalRoutesTrie.Insert(network, networkMask, route);
+    m_generation++;
 }
 
 Ptr<Ipv4Route>
@@ -137,67 +148,57 @@ Ipv4GlobalRouting::LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif)
     typedef std::vector<Ipv4RoutingTableEntry*> RouteVec_t;
     RouteVec_t allRoutes;
 
-    NS_LOG_LOGIC("Number of m_hostRoutes = " << m_hostRoutes.size());
-    for (HostRoutesCI i = m_hostRoutes.begin(); i != m_hostRoutes.end(); i++)
-    {
-        NS_ASSERT((*i)->IsHost());
-        if ((*i)->GetDest() == dest)
+    // a route is usable if it goes through the requested output interface, if any
+    auto isUsable = [this, oif](Ipv4RoutingTableEntry* route) {
+        if (oif && oif != m_ipv4->GetNetDevice(route->GetInterface()))
+        {
+            NS_LOG_LOGIC("Not on requested interface, skipping");
+            return false;
+        }
+        return true;
+    };
+    // collect the usable routes among the ECMP candidates of the longest matching prefix
+    auto collect = [&allRoutes, &isUsable](uint8_t, const RoutesTrie::Candidates& candidates) {
+        for (Ipv4RoutingTableEntry* route : candidates)
         {
-            if (oif)
+            if (isUsable(route))
             {
-                if (oif != m_ipv4->GetNetDevice((*i)->GetInterface()))
-                {
-                    NS_LOG_LOGIC("Not on requested interface, skipping");
-                    continue;
-                }
+                allRoutes.push_back(route);
             }
-            allRoutes.push_back(*i);
-            NS_LOG_LOGIC(allRoutes.size() << "Found global host route" << *i);
         }
+        return !allRoutes.empty();
+    };
+
+    NS_LOG_LOGIC("Number of m_hostRoutes = " << m_hostRoutes.size());
+    const RoutesTrie::Candidates* hostRoutes =
+        m_hostRoutesTrie.Find(dest, Ipv4Mask::GetOnes());
+    if (hostRoutes)
+    {
+        collect(32, *hostRoutes);
+        NS_LOG_LOGIC(allRoutes.size() << " global host routes found");
     }
-    if (allRoutes.size() == 0) // if no host route is found
+    if (allRoutes.empty()) // if no host route is found
     {
         NS_LOG_LOGIC("Number of m_networkRoutes" << m_networkRoutes.size());
-        for (NetworkRoutesI j = m_networkRoutes.begin(); j != m_networkRoutes.end(); j++)
-        {
-            Ipv4Mask mask = (*j)->GetDestNetworkMask();
-            Ipv4Address entry = (*j)->GetDestNetwork();
-            if (mask.IsMatch(dest, entry))
-            {
-                if (oif)
-                {
-                    if (oif != m_ipv4->GetNetDevice((*j)->GetInterface()))
-                    {
-                        NS_LOG_LOGIC("Not on requested interface, skipping");
-                        continue;
-                    }
-                }
-                allRoutes.push_back(*j);
-                NS_LOG_LOGIC(allRoutes.size() << "Found global network route" << *j);
-            }
-        }
+        m_networkRoutesTrie.LongestMatch(dest, collect);
+        NS_LOG_LOGIC(allRoutes.size() << " global network routes found");
     }
-    if (allRoutes.size() == 0) // consider external if no host/network found
+    if (allRoutes.empty()) // consider external if no host/network found
     {
-        for (ASExternalRoutesI k = m_ASexternalRoutes.begin(); k != m_ASexternalRoutes.end(); k++)
-        {
-            Ipv4Mask mask = (*k)->GetDestNetworkMask();
-            Ipv4Address entry = (*k)->GetDestNetwork();
-            if (mask.IsMatch(dest, entry))
-            {
-                NS_LOG_LOGIC("Found external route" << *k);
-                if (oif)
+        m_ASexternalRoutesTrie.LongestMatch(
+            dest,
+            [&allRoutes, &isUsable](uint8_t, const RoutesTrie::Candidates& candidates) {
+                for (Ipv4RoutingTableEntry* route : candidates)
                 {
-                    if (oif != m_ipv4->GetNetDevice((*k)->GetInterface()))
+                    if (isUsable(route))
                     {
-                        NS_LOG_LOGIC("Not on requested interface, skipping");
-                        continue;
+                        NS_LOG_LOGIC("Found external route" << route);
+                        allRoutes.push_back(route);
+                        return true;
                     }
                 }
-                allRoutes.push_back(*k);
-                break;
-            }
-        }
+                return false;
+            });
     }
     if (allRoutes.size() > 0) // if route(s) is found
     {
@@ -297,6 +298,8 @@ Ipv4GlobalRouting::RemoveRoute(uint32_t index)
             if (tmp == index)
             {
                 NS_LOG_LOGIC("Removing route " << index << "; size = " << m_hostRoutes.size());
+                RemoveFromTrie(m_hostRoutesTrie, *i);
+                m_generation++;
                 delete *i;
                 m_hostRoutes.erase(i);
                 NS_LOG_LOGIC("Done removing host route "
@@ -313,6 +316,8 @@ Ipv4GlobalRouting::RemoveRoute(uint32_t index)
         if (tmp == index)
         {
             NS_LOG_LOGIC("Removing route " << index << "; size = " << m_networkRoutes.size());
+            RemoveFromTrie(m_networkRoutesTrie, *j);
+            m_generation++;
             delete *j;
             m_networkRoutes.erase(j);
             NS_LOG_LOGIC("Done removing network route "
@@ -328,6 +333,8 @@ Ipv4GlobalRouting::RemoveRoute(uint32_t index)
         if (tmp == index)
         {
             NS_LOG_LOGIC("Removing route " << index << "; size = " << m_ASexternalRoutes.size());
+            RemoveFromTrie(m_ASexternalRoutesTrie, *k);
+            m_generation++;
             delete *k;
             m_ASexternalRoutes.erase(k);
             NS_LOG_LOGIC("Done removing network route "
@@ -339,6 +346,14 @@ Ipv4GlobalRouting::RemoveRoute(uint32_t index)
     NS_ASSERT(false);
 }
 
+void
+Ipv4GlobalRouting::RemoveFromTrie(RoutesTrie& index, Ipv4RoutingTableEntry* route)
+{
+    [[maybe_unused]] bool removed =
+        index.Remove(route->GetDestNetwork(), route->GetDestNetworkMask(), route);
+    NS_ASSERT_MSG(removed, "Route " << *route << " not found in the lookup index");
+}
+
 int64_t
 Ipv4GlobalRouting::AssignStreams(int64_t stream)
 {
@@ -365,10 +380,21 @@ Ipv4GlobalRouting::DoDispose()
     {
         delete (*l);
     }
+    m_hostRoutesTrie.Clear();
+    m_networkRoutesTrie.Clear();
+    m_ASexternalRoutesTrie.Clear();
+    m_generation++;
 
     Ipv4RoutingProtocol::DoDispose();
 }
 
+uint32_t
+Ipv4GlobalRouting::GetRoutingTableGeneration() const
+{
+    // with random ECMP routing, every lookup may return a different route
+    return m_randomEcmpRouting ? 0 : m_generation;
+}
+
 // Formatted like output of "route -n" command
 void
 Ipv4GlobalRouting::PrintRoutingTable(Ptr<OutputStreamWrapper> stream, Time::Unit unit) const
@@ -19,6 +19,8 @@
 #ifndef IPV4_GLOBAL_ROUTING_H
 #define IPV4_GLOBAL_ROUTING_H
 
+#include "routing-trie.h"
+
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv4-header.h"
 #include "ns3/ipv4-routing-protocol.h"
@@ -65,6 +67,11 @@ class Node;
  *
  * This class deals with Ipv4 unicast routes only.
  *
+ * Routes are indexed by a longest prefix match trie (Ipv4RoutingTrie), so
+ * that the cost of a lookup does not depend on the number of routes.  The
+ * routes to the same prefix form the ECMP candidate set used when
+ * RandomEcmpRouting is enabled.
+ *
  * \see Ipv4RoutingProtocol
  * \see GlobalRouteManager
  */
@@ -108,6 +115,18 @@ class Ipv4GlobalRouting : public Ipv4RoutingProtocol
     void PrintRoutingTable(Ptr<OutputStreamWrapper> stream,
                            Time::Unit unit = Time::S) const override;
 
+    /**
+     * \brief Get the generation of the global routing table.
+     *
+     * The generation changes whenever a route is added or removed.  If
+     * RandomEcmpRouting is enabled, zero is returned, because every lookup
+     * may select a different route among the equal cost ones.
+     *
+     * \returns the generation of the routing table, or zero if the routes
+     * can not be cached
+     */
+    uint32_t GetRoutingTableGeneration() const override;
+
     /**
      * \brief Add a host route to the global routing table.
      *
@@ -273,10 +292,26 @@ class Ipv4GlobalRouting : public Ipv4RoutingProtocol
      */
     Ptr<Ipv4Route> LookupGlobal(Ipv4Address dest, Ptr<NetDevice> oif = nullptr);
 
+    /// Longest prefix match index of routing table entries
+    typedef Ipv4RoutingTrie<Ipv4RoutingTableEntry*> RoutesTrie;
+
+    /**
+     * \brief Remove a route from the lookup index it belongs to.
+     * \param index the lookup index
+     * \param route the route
+     */
+    static void RemoveFromTrie(RoutesTrie& index, Ipv4RoutingTableEntry* route);
+
     HostRoutes m_hostRoutes;             //!< Routes to hosts
     NetworkRoutes m_networkRoutes;       //!< Routes to networks
     ASExternalRoutes m_ASexternalRoutes; //!< External routes imported
 
+    RoutesTrie m_hostRoutesTrie;       //!< Lookup index of m_hostRoutes
+    RoutesTrie m_networkRoutesTrie;    //!< Lookup index of m_networkRoutes
+    RoutesTrie m_ASexternalRoutesTrie; //!< Lookup index of m_ASexternalRoutes
+
+    uint32_t m_generation; //!< Generation of the routing table
+
     Ptr<Ipv4> m_ipv4; //!< associated IPv4 instance
 };
 
@@ -42,6 +42,7 @@ Ipv4Header::Ipv4Header()
       m_fragmentOffset(0),
       m_checksum(0),
       m_goodChecksum(true),
+      m_checksumValid(false),
       m_headerSize(5 * 4)
 {
 }
@@ -57,6 +58,7 @@ void
 Ipv4Header::SetPayloadSize(uint16_t size)
 {
     NS_LOG_FUNCTION(this << size);
+    m_checksumValid = false;
     m_payloadSize = size;
 }
 
@@ -78,6 +80,7 @@ void
 Ipv4Header::SetIdentification(uint16_t identification)
 {
     NS_LOG_FUNCTION(this << identification);
+    m_checksumValid = false;
     m_identification = identification;
 }
 
@@ -85,6 +88,7 @@ void
 Ipv4Header::SetTos(uint8_t tos)
 {
     NS_LOG_FUNCTION(this << static_cast<uint32_t>(tos));
+    m_checksumValid = false;
     m_tos = tos;
 }
 
@@ -92,6 +96,7 @@ void
 Ipv4Header::SetDscp(DscpType dscp)
 {
     NS_LOG_FUNCTION(this << dscp);
+    m_checksumValid = false;
     m_tos &= 0x3; // Clear out the DSCP part, retain 2 bits of ECN
     m_tos |= (dscp << 2);
 }
@@ -100,6 +105,7 @@ void
 Ipv4Header::SetEcn(EcnType ecn)
 {
     NS_LOG_FUNCTION(this << ecn);
+    m_checksumValid = false;
     m_tos &= 0xFC; // Clear out the ECN part, retain 6 bits of DSCP
     m_tos |= ecn;
 }
@@ -203,6 +209,7 @@ void
 Ipv4Header::SetMoreFragments()
 {
     NS_LOG_FUNCTION(this);
+    m_checksumValid = false;
     m_flags |= MORE_FRAGMENTS;
 }
 
@@ -210,6 +217,7 @@ void
 Ipv4Header::SetLastFragment()
 {
     NS_LOG_FUNCTION(this);
+    m_checksumValid = false;
     m_flags &= ~MORE_FRAGMENTS;
 }
 
@@ -224,6 +232,7 @@ void
 Ipv4Header::SetDontFragment()
 {
     NS_LOG_FUNCTION(this);
+    m_checksumValid = false;
     m_flags |= DONT_FRAGMENT;
 }
 
@@ -231,6 +240,7 @@ void
 Ipv4Header::SetMayFragment()
 {
     NS_LOG_FUNCTION(this);
+    m_checksumValid = false;
     m_flags &= ~DONT_FRAGMENT;
 }
 
@@ -245,6 +255,7 @@ void
 Ipv4Header::SetFragmentOffset(uint16_t offsetBytes)
 {
     NS_LOG_FUNCTION(this << offsetBytes);
+    m_checksumValid = false;
     // check if the user is trying to set an invalid offset
     NS_ABORT_MSG_IF((offsetBytes & 0x7), "offsetBytes must be multiple of 8 bytes");
     m_fragmentOffset = offsetBytes;
@@ -267,6 +278,19 @@ void
 Ipv4Header::SetTtl(uint8_t ttl)
 {
     NS_LOG_FUNCTION(this << static_cast<uint32_t>(ttl));
+    if (m_checksumValid)
+    {
+        // RFC 1624 incremental update (eqn. 3) of the checksum, read as the
+        // 16 bits word made of the TTL and protocol fields
+        uint32_t sum = static_cast<uint16_t>(~m_checksum);
+        sum += static_cast<uint16_t>(~(m_ttl | (m_protocol << 8)));
+        sum += ttl | (m_protocol << 8);
+        while (sum >> 16)
+        {
+            sum = (sum & 0xffff) + (sum >> 16);
+        }
+        m_checksum = ~sum;
+    }
     m_ttl = ttl;
 }
 
@@ -288,6 +312,7 @@ void
 Ipv4Header::SetProtocol(uint8_t protocol)
 {
     NS_LOG_FUNCTION(this << static_cast<uint32_t>(protocol));
+    m_checksumValid = false;
     m_protocol = protocol;
 }
 
@@ -295,6 +320,7 @@ void
 Ipv4Header::SetSource(Ipv4Address source)
 {
     NS_LOG_FUNCTION(this << source);
+    m_checksumValid = false;
     m_source = source;
 }
 
@@ -309,6 +335,7 @@ void
 Ipv4Header::SetDestination(Ipv4Address dst)
 {
     NS_LOG_FUNCTION(this << dst);
+    m_checksumValid = false;
     m_destination = dst;
 }
 
@@ -420,8 +447,12 @@ Ipv4Header::Serialize(Buffer::Iterator start) const
 
     if (m_calcChecksum)
     {
-        i = start;
-        uint16_t checksum = i.CalculateIpChecksum(20);
+        uint16_t checksum = m_checksum;
+        if (!m_checksumValid)
+        {
+            i = start;
+            checksum = i.CalculateIpChecksum(20);
+        }
         NS_LOG_LOGIC("checksum=" << checksum);
         i = start;
         i.Next(10);
@@ -480,6 +511,8 @@ Ipv4Header::Deserialize(Buffer::Iterator start)
 
         m_goodChecksum = (checksum == 0);
     }
+    // a verified checksum is kept, and updated when the TTL is decremented
+    m_checksumValid = m_calcChecksum && m_goodChecksum && headerSize == 5 * 4;
     return GetSerializedSize();
 }
 
@@ -88,6 +88,14 @@ Ipv4L3Protocol::GetTypeId()
                           TimeValue(Seconds(1)),
                           MakeTimeAccessor(&Ipv4L3Protocol::m_purge),
                           MakeTimeChecker(Seconds(0)))
+            .AddAttribute("RouteCacheSize",
+                          "The maximum number of routes cached for the locally generated "
+                          "and for the forwarded packets, 0 disables the route cache. "
+                          "Routes are cached only if the routing protocol supports it "
+                          "(see Ipv4RoutingProtocol::GetRoutingTableGeneration).",
+                          UintegerValue(1024),
+                          MakeUintegerAccessor(&Ipv4L3Protocol::m_routeCacheSize),
+                          MakeUintegerChecker<uint32_t>())
             .AddTraceSource("Tx",
                             "Send ipv4 packet to outgoing interface.",
                             MakeTraceSourceAccessor(&Ipv4L3Protocol::m_txTrace),
@@ -132,6 +140,8 @@ Ipv4L3Protocol::GetTypeId()
 }
 
 Ipv4L3Protocol::Ipv4L3Protocol()
+    : m_routeCacheGeneration(0),
+      m_routeCacheKey(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -300,6 +310,7 @@ Ipv4L3Protocol::SetRoutingProtocol(Ptr<Ipv4RoutingProtocol> routingProtocol)
     NS_LOG_FUNCTION(this << routingProtocol);
     m_routingProtocol = routingProtocol;
     m_routingProtocol->SetIpv4(this);
+    FlushRouteCache();
 }
 
 Ptr<Ipv4RoutingProtocol>
@@ -329,6 +340,7 @@ Ipv4L3Protocol::DoDispose()
     m_sockets.clear();
     m_node = nullptr;
     m_routingProtocol = nullptr;
+    FlushRouteCache();
 
     for (MapFragments_t::iterator it = m_fragments.begin(); it != m_fragments.end(); it++)
     {
@@ -435,6 +447,7 @@ Ipv4L3Protocol::AddIpv4Interface(Ptr<Ipv4Interface> interface)
     uint32_t index = m_interfaces.size();
     m_interfaces.push_back(interface);
     m_reverseInterfacesContainer[interface->GetDevice()] = index;
+    FlushRouteCache();
     return index;
 }
 
@@ -674,10 +687,27 @@ Ipv4L3Protocol::Receive(Ptr<NetDevice> device,
     }
 
     NS_ASSERT_MSG(m_routingProtocol, "Need a routing protocol object to process packets");
+    Ipv4RoutingProtocol::UnicastForwardCallback ucb =
+        MakeCallback(&Ipv4L3Protocol::IpForward, this);
+    if (!ipHeader.GetDestination().IsBroadcast() && !ipHeader.GetDestination().IsMulticast() &&
+        ValidateRouteCache())
+    {
+        uint64_t key = GetRouteCacheKey(ipHeader.GetDestination(), ipHeader.GetTos(), interface);
+        auto it = m_forwardRouteCache.find(key);
+        if (it != m_forwardRouteCache.end())
+        {
+            NS_LOG_LOGIC("Forwarding route to " << ipHeader.GetDestination() << " found in cache");
+            IpForward(it->second, packet, ipHeader);
+            return;
+        }
+        // the route is stored by IpForwardAndCache if the packet is forwarded
+        m_routeCacheKey = key;
+        ucb = MakeCallback(&Ipv4L3Protocol::IpForwardAndCache, this);
+    }
     if (!m_routingProtocol->RouteInput(packet,
                                        ipHeader,
                                        device,
-                                       MakeCallback(&Ipv4L3Protocol::IpForward, this),
+                                       ucb,
                                        MakeCallback(&Ipv4L3Protocol::IpMulticastForward, this),
                                        MakeCallback(&Ipv4L3Protocol::LocalDeliver, this),
                                        MakeCallback(&Ipv4L3Protocol::RouteInputError, this)))
@@ -906,16 +936,32 @@ Ipv4L3Protocol::Send(Ptr<Packet> packet,
     Socket::SocketErrno errno_;
     Ptr<NetDevice> oif(nullptr); // unused for now
     Ptr<Ipv4Route> newRoute;
-    if (m_routingProtocol)
+    bool cacheRoute = ValidateRouteCache();
+    uint64_t cacheKey = GetRouteCacheKey(destination, tos, ROUTE_CACHE_ANY_INTERFACE);
+    if (cacheRoute)
     {
-        newRoute = m_routingProtocol->RouteOutput(pktCopyWithTags, ipHeader, oif, errno_);
+        auto it = m_outputRouteCache.find(cacheKey);
+        if (it != m_outputRouteCache.end())
+        {
+            NS_LOG_LOGIC("Route to " << destination << " found in cache");
+            newRoute = it->second;
+            cacheRoute = false;
+        }
     }
-    else
+    if (!m_routingProtocol)
     {
         NS_LOG_ERROR("Ipv4L3Protocol::Send: m_routingProtocol == 0");
     }
+    else if (!newRoute)
+    {
+        newRoute = m_routingProtocol->RouteOutput(pktCopyWithTags, ipHeader, oif, errno_);
+    }
     if (newRoute)
     {
+        if (cacheRoute)
+        {
+            CacheRoute(m_outputRouteCache, cacheKey, newRoute);
+        }
         DecreaseIdentification(source, destination, protocol);
         Send(pktCopyWithTags, source, destination, protocol, newRoute);
     }
@@ -1117,6 +1163,58 @@ Ipv4L3Protocol::IpForward(Ptr<Ipv4Route> rtentry, Ptr<const Packet> p, const Ipv
     SendRealOut(rtentry, packet, ipHeader);
 }
 
+void
+Ipv4L3Protocol::IpForwardAndCache(Ptr<Ipv4Route> rtentry,
+                                  Ptr<const Packet> p,
+                                  const Ipv4Header& header)
+{
+    NS_LOG_FUNCTION(this << rtentry << p << header);
+    CacheRoute(m_forwardRouteCache, m_routeCacheKey, rtentry);
+    IpForward(rtentry, p, header);
+}
+
+uint64_t
+Ipv4L3Protocol::GetRouteCacheKey(Ipv4Address destination, uint8_t tos, uint32_t interface)
+{
+    NS_ASSERT(interface <= ROUTE_CACHE_ANY_INTERFACE);
+    return static_cast<uint64_t>(destination.Get()) | (static_cast<uint64_t>(tos) << 32) |
+           (static_cast<uint64_t>(interface) << 40);
+}
+
+bool
+Ipv4L3Protocol::ValidateRouteCache()
+{
+    if (m_routeCacheSize == 0 || !m_routingProtocol)
+    {
+        return false;
+    }
+    uint32_t generation = m_routingProtocol->GetRoutingTableGeneration();
+    if (generation != m_routeCacheGeneration)
+    {
+        NS_LOG_LOGIC("Routing table generation changed, flushing the route cache");
+        FlushRouteCache();
+        m_routeCacheGeneration = generation;
+    }
+    return generation != 0;
+}
+
+void
+Ipv4L3Protocol::CacheRoute(RouteCache_t& cache, uint64_t key, Ptr<Ipv4Route> route)
+{
+    if (cache.size() >= m_routeCacheSize)
+    {
+        cache.clear();
+    }
+    cache[key] = route;
+}
+
+void
+Ipv4L3Protocol::FlushRouteCache()
+{
+    m_outputRouteCache.clear();
+    m_forwardRouteCache.clear();
+}
+
 void
 Ipv4L3Protocol::LocalDeliver(Ptr<const Packet> packet, const Ipv4Header& ip, uint32_t iif)
 {
@@ -1187,6 +1285,7 @@ Ipv4L3Protocol::AddAddress(uint32_t i, Ipv4InterfaceAddress address)
     NS_LOG_FUNCTION(this << i << address);
     Ptr<Ipv4Interface> interface = GetInterface(i);
     bool retVal = interface->AddAddress(address);
+    FlushRouteCache();
     if (m_routingProtocol)
     {
         m_routingProtocol->NotifyAddAddress(i, address);
@@ -1218,6 +1317,7 @@ Ipv4L3Protocol::RemoveAddress(uint32_t i, uint32_t addressIndex)
     Ipv4InterfaceAddress address = interface->RemoveAddress(addressIndex);
     if (address != Ipv4InterfaceAddress())
     {
+        FlushRouteCache();
         if (m_routingProtocol)
         {
             m_routingProtocol->NotifyRemoveAddress(i, address);
@@ -1241,6 +1341,7 @@ Ipv4L3Protocol::RemoveAddress(uint32_t i, Ipv4Address address)
     Ipv4InterfaceAddress ifAddr = interface->RemoveAddress(address);
     if (ifAddr != Ipv4InterfaceAddress())
     {
+        FlushRouteCache();
         if (m_routingProtocol)
         {
             m_routingProtocol->NotifyRemoveAddress(i, ifAddr);
@@ -1384,6 +1485,7 @@ Ipv4L3Protocol::SetUp(uint32_t i)
     if (interface->GetDevice()->GetMtu() >= 68)
     {
         interface->SetUp();
+        FlushRouteCache();
 
         if (m_routingProtocol)
         {
@@ -1405,6 +1507,7 @@ Ipv4L3Protocol::SetDown(uint32_t ifaceIndex)
     NS_LOG_FUNCTION(this << ifaceIndex);
     Ptr<Ipv4Interface> interface = GetInterface(ifaceIndex);
     interface->SetDown();
+    FlushRouteCache();
 
     if (m_routingProtocol)
     {
@@ -1427,6 +1530,7 @@ Ipv4L3Protocol::SetForwarding(uint32_t i, bool val)
     NS_LOG_FUNCTION(this << i);
     Ptr<Ipv4Interface> interface = GetInterface(i);
     interface->SetForwarding(val);
+    FlushRouteCache();
 }
 
 Ptr<NetDevice>
@@ -1445,6 +1549,7 @@ Ipv4L3Protocol::SetIpForward(bool forward)
     {
         (*i)->SetForwarding(forward);
     }
+    FlushRouteCache();
 }
 
 bool
@@ -1459,6 +1564,7 @@ Ipv4L3Protocol::SetWeakEsModel(bool model)
 {
     NS_LOG_FUNCTION(this << model);
     m_weakEsModel = model;
+    FlushRouteCache();
 }
 
 bool
@@ -1615,7 +1721,8 @@ Ipv4L3Protocol::ProcessFragment(Ptr<Packet>& packet, Ipv4Header& ipHeader, uint3
 }
 
 Ipv4L3Protocol::Fragments::Fragments()
-    : m_moreFragment(0)
+    : m_moreFragment(0),
+      m_lastOffset(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -1627,22 +1734,14 @@ Ipv4L3Protocol::Fragments::AddFragment(Ptr<Packet> fragment,
 {
     NS_LOG_FUNCTION(this << fragment << fragmentOffset << moreFragment);
 
-    std::list<std::pair<Ptr<Packet>, uint16_t>>::iterator it;
-
-    for (it = m_fragments.begin(); it != m_fragments.end(); it++)
-    {
-        if (it->second > fragmentOffset)
-        {
-            break;
-        }
-    }
-
-    if (it == m_fragments.end())
+    // the "More Fragment" bit of the packet is the one of the fragment with the highest offset
+    if (m_fragments.IsEmpty() || fragmentOffset >= m_lastOffset)
     {
         m_moreFragment = moreFragment;
+        m_lastOffset = fragmentOffset;
     }
 
-    m_fragments.insert(it, std::pair<Ptr<Packet>, uint16_t>(fragment, fragmentOffset));
+    m_fragments.AddFragment(fragment, fragmentOffset);
 }
 
 bool
@@ -1650,31 +1749,8 @@ Ipv4L3Protocol::Fragments::IsEntire() const
 {
     NS_LOG_FUNCTION(this);
 
-    bool ret = !m_moreFragment && m_fragments.size() > 0;
-
-    if (ret)
-    {
-        uint16_t lastEndOffset = 0;
-
-        for (std::list<std::pair<Ptr<Packet>, uint16_t>>::const_iterator it = m_fragments.begin();
-             it != m_fragments.end();
-             it++)
-        {
-            // overlapping fragments do exist
-            NS_LOG_LOGIC("Checking overlaps " << lastEndOffset << " - " << it->second);
-
-            if (lastEndOffset < it->second)
-            {
-                ret = false;
-                break;
-            }
-            // fragments might overlap in strange ways
-            uint16_t fragmentEnd = it->first->GetSize() + it->second;
-            lastEndOffset = std::max(lastEndOffset, fragmentEnd);
-        }
-    }
-
-    return ret;
+    // fragments might overlap in strange ways, only holes matter
+    return !m_moreFragment && m_fragments.IsContiguous();
 }
 
 Ptr<Packet>
@@ -1682,37 +1758,7 @@ Ipv4L3Protocol::Fragments::GetPacket() const
 {
     NS_LOG_FUNCTION(this);
 
-    std::list<std::pair<Ptr<Packet>, uint16_t>>::const_iterator it = m_fragments.begin();
-
-    Ptr<Packet> p = it->first->Copy();
-    uint16_t lastEndOffset = p->GetSize();
-    it++;
-
-    for (; it != m_fragments.end(); it++)
-    {
-        if (lastEndOffset > it->second)
-        {
-            // The fragments are overlapping.
-            // We do not overwrite the "old" with the "new" because we do not know when each
-            // arrived. This is different from what Linux does. It is not possible to emulate a
-            // fragmentation attack.
-            uint32_t newStart = lastEndOffset - it->second;
-            if (it->first->GetSize() > newStart)
-            {
-                uint32_t newSize = it->first->GetSize() - newStart;
-                Ptr<Packet> tempFragment = it->first->CreateFragment(newStart, newSize);
-                p->AddAtEnd(tempFragment);
-            }
-        }
-        else
-        {
-            NS_LOG_LOGIC("Adding: " << *(it->first));
-            p->AddAtEnd(it->first);
-        }
-        lastEndOffset = p->GetSize();
-    }
-
-    return p;
+    return m_fragments.GetPacket();
 }
 
 Ptr<Packet>
@@ -1720,34 +1766,7 @@ Ipv4L3Protocol::Fragments::GetPartialPacket() const
 {
     NS_LOG_FUNCTION(this);
 
-    std::list<std::pair<Ptr<Packet>, uint16_t>>::const_iterator it = m_fragments.begin();
-
-    Ptr<Packet> p = Create<Packet>();
-    uint16_t lastEndOffset = 0;
-
-    if (m_fragments.begin()->second > 0)
-    {
-        return p;
-    }
-
-    for (it = m_fragments.begin(); it != m_fragments.end(); it++)
-    {
-        if (lastEndOffset > it->second)
-        {
-            uint32_t newStart = lastEndOffset - it->second;
-            uint32_t newSize = it->first->GetSize() - newStart;
-            Ptr<Packet> tempFragment = it->first->CreateFragment(newStart, newSize);
-            p->AddAtEnd(tempFragment);
-        }
-        else if (lastEndOffset == it->second)
-        {
-            NS_LOG_LOGIC("Adding: " << *(it->first));
-            p->AddAtEnd(it->first);
-        }
-        lastEndOffset = p->GetSize();
-    }
-
-    return p;
+    return m_fragments.GetPacket();
 }
 
 void
@@ -20,6 +20,8 @@
 #ifndef IPV4_L3_PROTOCOL_H
 #define IPV4_L3_PROTOCOL_H
 
+#include "ip-fragment-buffer.h"
+
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv4-header.h"
 #include "ns3/ipv4-routing-protocol.h"
@@ -33,6 +35,7 @@
 #include <list>
 #include <map>
 #include <stdint.h>
+#include <unordered_map>
 #include <vector>
 
 class Ipv4L3ProtocolTestCase;
@@ -340,6 +343,17 @@ class Ipv4L3Protocol : public Ipv4
      */
     void IpForward(Ptr<Ipv4Route> rtentry, Ptr<const Packet> p, const Ipv4Header& header);
 
+    /**
+     * \brief Forward a packet and store its route in the route cache.
+     *
+     * Used as unicast forward callback of the routing protocol when the
+     * route of the packet is not in the route cache yet.
+     * \param rtentry route
+     * \param p packet to forward
+     * \param header IPv4 header to add to the packet
+     */
+    void IpForwardAndCache(Ptr<Ipv4Route> rtentry, Ptr<const Packet> p, const Ipv4Header& header);
+
     /**
      * \brief Forward a multicast packet.
      * \param mrtentry route
@@ -589,10 +603,15 @@ class Ipv4L3Protocol : public Ipv4
          */
         bool m_moreFragment;
 
+        /**
+         * \brief The highest offset of the fragments.
+         */
+        uint16_t m_lastOffset;
+
         /**
          * \brief The current fragments.
          */
-        std::list<std::pair<Ptr<Packet>, uint16_t>> m_fragments;
+        IpFragmentBuffer m_fragments;
 
         /**
          * \brief Timeout iterator to "event" handler
@@ -625,6 +644,54 @@ class Ipv4L3Protocol : public Ipv4
      */
     void RemoveDuplicates();
 
+    /// Route cache, indexed by the key returned by GetRouteCacheKey
+    typedef std::unordered_map<uint64_t, Ptr<Ipv4Route>> RouteCache_t;
+
+    /**
+     * \brief Compute the key of a route cache entry.
+     * \param destination the destination address
+     * \param tos the TOS of the packet
+     * \param interface the input interface index (for forwarded packets), or
+     * ROUTE_CACHE_ANY_INTERFACE (for locally generated packets)
+     * \return the key
+     */
+    static uint64_t GetRouteCacheKey(Ipv4Address destination, uint8_t tos, uint32_t interface);
+
+    /**
+     * \brief Check whether the route cache can be used.
+     *
+     * The route cache is flushed if the routing table generation of the
+     * routing protocol changed since the cached routes were computed.
+     * \return true if the route cache is enabled and the routes of the
+     * routing protocol can be cached
+     */
+    bool ValidateRouteCache();
+
+    /**
+     * \brief Add a route to a route cache, flushing the cache if it is full.
+     * \param cache the route cache
+     * \param key the key of the route
+     * \param route the route
+     */
+    void CacheRoute(RouteCache_t& cache, uint64_t key, Ptr<Ipv4Route> route);
+
+    /**
+     * \brief Flush the route caches.
+     *
+     * Called whenever a change of the stack (address, interface state,
+     * forwarding setting) may change the routes returned by the routing protocol.
+     */
+    void FlushRouteCache();
+
+    /// Interface index used in the route cache keys of locally generated packets
+    static constexpr uint32_t ROUTE_CACHE_ANY_INTERFACE = 0xffffff;
+
+    RouteCache_t m_outputRouteCache;  //!< Routes of the locally generated packets
+    RouteCache_t m_forwardRouteCache; //!< Routes of the forwarded packets
+    uint32_t m_routeCacheSize;        //!< Maximum number of routes in each route cache
+    uint32_t m_routeCacheGeneration;  //!< Routing table generation of the cached routes
+    uint64_t m_routeCacheKey;         //!< Key of the route learned by IpForwardAndCache
+
     bool m_enableDpd;   //!< Enable multicast duplicate packet detection
     DupMap_t m_dups;    //!< map of packet duplicate tuples to expiry event
     Time m_expire;      //!< duplicate entry expiration delay
@@ -87,6 +87,24 @@ Ipv4ListRouting::PrintRoutingTable(Ptr<OutputStreamWrapper> stream, Time::Unit u
     }
 }
 
+uint32_t
+Ipv4ListRouting::GetRoutingTableGeneration() const
+{
+    // The generations of the protocols only grow, hence their sum changes
+    // whenever one of them changes (including when a protocol is added).
+    uint32_t generation = 0;
+    for (const auto& protocol : m_routingProtocols)
+    {
+        uint32_t protocolGeneration = protocol.second->GetRoutingTableGeneration();
+        if (protocolGeneration == 0)
+        {
+            return 0;
+        }
+        generation += protocolGeneration;
+    }
+    return generation;
+}
+
 void
 Ipv4ListRouting::DoInitialize()
 {
@@ -99,6 +99,7 @@ class Ipv4ListRouting : public Ipv4RoutingProtocol
     void SetIpv4(Ptr<Ipv4> ipv4) override;
     void PrintRoutingTable(Ptr<OutputStreamWrapper> stream,
                            Time::Unit unit = Time::S) const override;
+    uint32_t GetRoutingTableGeneration() const override;
 
   protected:
     void DoDispose() override;
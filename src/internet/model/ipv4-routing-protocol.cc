@@ -37,4 +37,10 @@ Ipv4RoutingProtocol::GetTypeId()
     return tid;
 }
 
+uint32_t
+Ipv4RoutingProtocol::GetRoutingTableGeneration() const
+{
+    return 0;
+}
+
 } // namespace ns3
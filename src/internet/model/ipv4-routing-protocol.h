@@ -181,6 +181,26 @@ class Ipv4RoutingProtocol : public Object
      */
     virtual void PrintRoutingTable(Ptr<OutputStreamWrapper> stream,
                                    Time::Unit unit = Time::S) const = 0;
+
+    /**
+     * \brief Get the generation of the routing table
+     *
+     * The generation is a counter that changes whenever the result of
+     * RouteOutput or RouteInput for a given unicast destination may change
+     * (e.g., because a route has been added or removed).  It allows
+     * Ipv4L3Protocol to cache the routes of the protocol, indexed by
+     * destination, TOS and interface, and to invalidate them when needed.
+     * Changes of the addresses and of the state of the interfaces of the
+     * node invalidate the cached routes as well.
+     *
+     * Protocols whose routes may change without notice (e.g., because of
+     * timeouts or per-packet load balancing) must return zero, which is the
+     * default; their routes are never cached.
+     *
+     * \returns the generation of the routing table, or zero if the routes
+     * of the protocol can not be cached
+     */
+    virtual uint32_t GetRoutingTableGeneration() const;
 };
 
 } // namespace ns3
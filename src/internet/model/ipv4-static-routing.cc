@@ -58,7 +58,8 @@ Ipv4StaticRouting::GetTypeId()
 }
 
 Ipv4StaticRouting::Ipv4StaticRouting()
-    : m_ipv4(nullptr)
+    : m_generation(1),
+      m_ipv4(nullptr)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -78,8 +79,7 @@ Ipv4StaticRouting::AddNetworkRouteTo(Ipv4Address network,
 
     if (!LookupRoute(route, metric))
     {
-        Ipv4RoutingTableEntry* routePtr = new Ipv4RoutingTableEntry(route);
-        m_networkRoutes.emplace_back(routePtr, metric);
+        DoAddNetworkRoute(new Ipv4RoutingTableEntry(route), metric);
     }
 }
 
@@ -95,9 +95,7 @@ Ipv4StaticRouting::AddNetworkRouteTo(Ipv4Address network,
         Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, interface);
     if (!LookupRoute(route, metric))
     {
-        Ipv4RoutingTableEntry* routePtr = new Ipv4RoutingTableEntry(route);
-
-        m_networkRoutes.emplace_back(routePtr, metric);
+        DoAddNetworkRoute(new Ipv4RoutingTableEntry(route), metric);
     }
 }
 
@@ -152,7 +150,7 @@ Ipv4StaticRouting::SetDefaultMulticastRoute(uint32_t outputInterface)
     Ipv4Address network = Ipv4Address("224.0.0.0");
     Ipv4Mask networkMask = Ipv4Mask("240.0.0.0");
     *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, outputInterface);
-    m_networkRoutes.emplace_back(route, 0);
+    DoAddNetworkRoute(route, 0);
 }
 
 uint32_t
@@ -224,14 +222,20 @@ Ipv4StaticRouting::RemoveMulticastRoute(uint32_t index)
 bool
 Ipv4StaticRouting::LookupRoute(const Ipv4RoutingTableEntry& route, uint32_t metric)
 {
-    for (NetworkRoutesI j = m_networkRoutes.begin(); j != m_networkRoutes.end(); j++)
+    const NetworkRoutesTrie::Candidates* candidates =
+        m_networkRoutesTrie.Find(route.GetDestNetwork(), route.GetDestNetworkMask());
+    if (!candidates)
     {
-        Ipv4RoutingTableEntry* rtentry = j->first;
+        return false;
+    }
+    for (const auto& candidate : *candidates)
+    {
+        Ipv4RoutingTableEntry* rtentry = candidate.first;
 
         if (rtentry->GetDest() == route.GetDest() &&
             rtentry->GetDestNetworkMask() == route.GetDestNetworkMask() &&
             rtentry->GetGateway() == route.GetGateway() &&
-            rtentry->GetInterface() == route.GetInterface() && j->second == metric)
+            rtentry->GetInterface() == route.GetInterface() && candidate.second == metric)
         {
             return true;
         }
@@ -239,13 +243,33 @@ Ipv4StaticRouting::LookupRoute(const Ipv4RoutingTableEntry& route, uint32_t metr
     return false;
 }
 
+void
+Ipv4StaticRouting::DoAddNetworkRoute(Ipv4RoutingTableEntry* route, uint32_t metric)
+{
+    m_networkRoutes.emplace_back(route, metric);
+    m_generation++;
+    m_networkRoutesTrie.Insert(route->GetDestNetwork(),
+                               route->GetDestNetworkMask(),
+                               m_networkRoutes.back());
+}
+
+Ipv4StaticRouting::NetworkRoutesI
+Ipv4StaticRouting::DoRemoveNetworkRoute(NetworkRoutesI it)
+{
+    [[maybe_unused]] bool removed = m_networkRoutesTrie.Remove(it->first->GetDestNetwork(),
+                                                               it->first->GetDestNetworkMask(),
+                                                               *it);
+    NS_ASSERT_MSG(removed, "Route " << *it->first << " not found in the lookup index");
+    m_generation++;
+    delete it->first;
+    return m_networkRoutes.erase(it);
+}
+
 Ptr<Ipv4Route>
 Ipv4StaticRouting::LookupStatic(Ipv4Address dest, Ptr<NetDevice> oif)
 {
     NS_LOG_FUNCTION(this << dest << " " << oif);
     Ptr<Ipv4Route> rtentry = nullptr;
-    uint16_t longest_mask = 0;
-    uint32_t shortest_metric = 0xffffffff;
     /* when sending on local multicast, there have to be interface specified */
     if (dest.IsLocalMulticast())
     {
@@ -261,55 +285,52 @@ Ipv4StaticRouting::LookupStatic(Ipv4Address dest, Ptr<NetDevice> oif)
         return rtentry;
     }
 
-    for (NetworkRoutesI i = m_networkRoutes.begin(); i != m_networkRoutes.end(); i++)
-    {
-        Ipv4RoutingTableEntry* j = i->first;
-        uint32_t metric = i->second;
-        Ipv4Mask mask = (j)->GetDestNetworkMask();
-        uint16_t masklen = mask.GetPrefixLength();
-        Ipv4Address entry = (j)->GetDestNetwork();
-        NS_LOG_LOGIC("Searching for route to " << dest << ", checking against route to " << entry
-                                               << "/" << masklen);
-        if (mask.IsMatch(dest, entry))
-        {
-            NS_LOG_LOGIC("Found global network route " << j << ", mask length " << masklen
-                                                       << ", metric " << metric);
-            if (oif)
+    // Visit the matching prefixes from the longest to the shortest one, and
+    // stop at the first one having a route on the requested interface.
+    // Among the routes to the same prefix, the one with the lowest metric is
+    // selected.
+    Ipv4RoutingTableEntry* route = nullptr;
+    m_networkRoutesTrie.LongestMatch(
+        dest,
+        [this, dest, oif, &route](uint8_t masklen, const NetworkRoutesTrie::Candidates& routes) {
+            uint32_t shortest_metric = 0xffffffff;
+            for (const auto& candidate : routes)
             {
-                if (oif != m_ipv4->GetNetDevice(j->GetInterface()))
+                Ipv4RoutingTableEntry* j = candidate.first;
+                uint32_t metric = candidate.second;
+                NS_LOG_LOGIC("Found global network route " << j << " to " << dest
+                                                           << ", mask length " << masklen
+                                                           << ", metric " << metric);
+                if (oif)
+                {
+                    if (oif != m_ipv4->GetNetDevice(j->GetInterface()))
+                    {
+                        NS_LOG_LOGIC("Not on requested interface, skipping");
+                        continue;
+                    }
+                }
+                if (metric > shortest_metric)
                 {
-                    NS_LOG_LOGIC("Not on requested interface, skipping");
+                    NS_LOG_LOGIC("Equal mask length, but previous metric shorter, skipping");
                     continue;
                 }
+                shortest_metric = metric;
+                route = j;
+                if (masklen == 32)
+                {
+                    break;
+                }
             }
-            if (masklen < longest_mask) // Not interested if got shorter mask
-            {
-                NS_LOG_LOGIC("Previous match longer, skipping");
-                continue;
-            }
-            if (masklen > longest_mask) // Reset metric if longer masklen
-            {
-                shortest_metric = 0xffffffff;
-            }
-            longest_mask = masklen;
-            if (metric > shortest_metric)
-            {
-                NS_LOG_LOGIC("Equal mask length, but previous metric shorter, skipping");
-                continue;
-            }
-            shortest_metric = metric;
-            Ipv4RoutingTableEntry* route = (j);
-            uint32_t interfaceIdx = route->GetInterface();
-            rtentry = Create<Ipv4Route>();
-            rtentry->SetDestination(route->GetDest());
-            rtentry->SetSource(m_ipv4->SourceAddressSelection(interfaceIdx, route->GetDest()));
-            rtentry->SetGateway(route->GetGateway());
-            rtentry->SetOutputDevice(m_ipv4->GetNetDevice(interfaceIdx));
-            if (masklen == 32)
-            {
-                break;
-            }
-        }
+            return route != nullptr;
+        });
+    if (route)
+    {
+        uint32_t interfaceIdx = route->GetInterface();
+        rtentry = Create<Ipv4Route>();
+        rtentry->SetDestination(route->GetDest());
+        rtentry->SetSource(m_ipv4->SourceAddressSelection(interfaceIdx, route->GetDest()));
+        rtentry->SetGateway(route->GetGateway());
+        rtentry->SetOutputDevice(m_ipv4->GetNetDevice(interfaceIdx));
     }
     if (rtentry)
     {
@@ -457,8 +478,7 @@ Ipv4StaticRouting::RemoveRoute(uint32_t index)
     {
         if (tmp == index)
         {
-            delete j->first;
-            m_networkRoutes.erase(j);
+            DoRemoveNetworkRoute(j);
             return;
         }
         tmp++;
@@ -579,6 +599,12 @@ Ipv4StaticRouting::RouteInput(Ptr<const Packet> p,
     }
 }
 
+uint32_t
+Ipv4StaticRouting::GetRoutingTableGeneration() const
+{
+    return m_generation;
+}
+
 Ipv4StaticRouting::~Ipv4StaticRouting()
 {
     NS_LOG_FUNCTION(this);
@@ -593,6 +619,8 @@ Ipv4StaticRouting::DoDispose()
     {
         delete (j->first);
     }
+    m_networkRoutesTrie.Clear();
+    m_generation++;
     for (MulticastRoutesI i = m_multicastRoutes.begin(); i != m_multicastRoutes.end();
          i = m_multicastRoutes.erase(i))
     {
@@ -632,8 +660,7 @@ Ipv4StaticRouting::NotifyInterfaceDown(uint32_t i)
     {
         if (it->first->GetInterface() == i)
         {
-            delete it->first;
-            it = m_networkRoutes.erase(it);
+            it = DoRemoveNetworkRoute(it);
         }
         else
         {
@@ -677,8 +704,7 @@ Ipv4StaticRouting::NotifyRemoveAddress(uint32_t interface, Ipv4InterfaceAddress
             it->first->GetDestNetwork() == networkAddress &&
             it->first->GetDestNetworkMask() == networkMask)
         {
-            delete it->first;
-            it = m_networkRoutes.erase(it);
+            it = DoRemoveNetworkRoute(it);
         }
         else
         {
@@ -21,6 +21,8 @@
 #ifndef IPV4_STATIC_ROUTING_H
 #define IPV4_STATIC_ROUTING_H
 
+#include "routing-trie.h"
+
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv4-header.h"
 #include "ns3/ipv4-routing-protocol.h"
@@ -59,6 +61,10 @@ class Node;
  * Ipv4RoutingProtocol that defines the interface methods that a routing
  * protocol must support.
  *
+ * Unicast routes are indexed by a longest prefix match trie
+ * (Ipv4RoutingTrie), so that the cost of a lookup is bounded by the
+ * prefix length rather than by the number of routes.
+ *
  * \see Ipv4RoutingProtocol
  * \see Ipv4ListRouting
  * \see Ipv4ListRouting::AddRoutingProtocol
@@ -95,6 +101,7 @@ class Ipv4StaticRouting : public Ipv4RoutingProtocol
     void SetIpv4(Ptr<Ipv4> ipv4) override;
     void PrintRoutingTable(Ptr<OutputStreamWrapper> stream,
                            Time::Unit unit = Time::S) const override;
+    uint32_t GetRoutingTableGeneration() const override;
 
     /**
      * \brief Add a network route to the static routing table.
@@ -371,6 +378,9 @@ class Ipv4StaticRouting : public Ipv4RoutingProtocol
     /// Iterator for container for the network routes
     typedef std::list<std::pair<Ipv4RoutingTableEntry*, uint32_t>>::iterator NetworkRoutesI;
 
+    /// Longest prefix match index of the network routes
+    typedef Ipv4RoutingTrie<std::pair<Ipv4RoutingTableEntry*, uint32_t>> NetworkRoutesTrie;
+
     /// Container for the multicast routes
     typedef std::list<Ipv4MulticastRoutingTableEntry*> MulticastRoutes;
 
@@ -388,6 +398,20 @@ class Ipv4StaticRouting : public Ipv4RoutingProtocol
      */
     bool LookupRoute(const Ipv4RoutingTableEntry& route, uint32_t metric);
 
+    /**
+     * \brief Add a network route to the forwarding table and to its lookup index.
+     * \param route the route
+     * \param metric metric of route
+     */
+    void DoAddNetworkRoute(Ipv4RoutingTableEntry* route, uint32_t metric);
+
+    /**
+     * \brief Remove a network route from the forwarding table and from its lookup index.
+     * \param it iterator to the route
+     * \return iterator to the route following the removed one
+     */
+    NetworkRoutesI DoRemoveNetworkRoute(NetworkRoutesI it);
+
     /**
      * \brief Lookup in the forwarding table for destination.
      * \param dest destination address
@@ -410,6 +434,17 @@ class Ipv4StaticRouting : public Ipv4RoutingProtocol
      */
     NetworkRoutes m_networkRoutes;
 
+    /**
+     * \brief the lookup index of m_networkRoutes.
+     */
+    NetworkRoutesTrie m_networkRoutesTrie;
+
+    /**
+     * \brief the generation of the unicast routing table, changed on every
+     * network route insertion or removal.
+     */
+    uint32_t m_generation;
+
     /**
      * \brief the forwarding table for multicast.
      */
@@ -23,6 +23,8 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -39,14 +41,97 @@ Ipv6EndPointDemux::Ipv6EndPointDemux()
 Ipv6EndPointDemux::~Ipv6EndPointDemux()
 {
     NS_LOG_FUNCTION(this);
+    m_connectedEndPoints.clear();
+    m_wildcardEndPoints.clear();
     for (EndPointsI i = m_endPoints.begin(); i != m_endPoints.end(); i++)
     {
         Ipv6EndPoint* endPoint = *i;
+        endPoint->m_demux = nullptr;
         delete endPoint;
     }
     m_endPoints.clear();
 }
 
+bool
+Ipv6EndPointDemux::FourTuple::operator==(const FourTuple& other) const
+{
+    return localAddress == other.localAddress && localPort == other.localPort &&
+           peerAddress == other.peerAddress && peerPort == other.peerPort;
+}
+
+std::size_t
+Ipv6EndPointDemux::FourTupleHash::operator()(const FourTuple& tuple) const
+{
+    std::size_t hash = Ipv6AddressHash()(tuple.peerAddress);
+    hash = hash * 31 + Ipv6AddressHash()(tuple.localAddress);
+    hash = hash * 31 + tuple.peerPort;
+    hash = hash * 31 + tuple.localPort;
+    return hash;
+}
+
+Ipv6EndPointDemux::FourTuple
+Ipv6EndPointDemux::GetFourTuple(Ipv6EndPoint* endPoint)
+{
+    return {endPoint->GetLocalAddress(),
+            endPoint->GetLocalPort(),
+            endPoint->GetPeerAddress(),
+            endPoint->GetPeerPort()};
+}
+
+bool
+Ipv6EndPointDemux::IsFullySpecified(const FourTuple& tuple)
+{
+    return tuple.localAddress != Ipv6Address::GetAny() &&
+           tuple.peerAddress != Ipv6Address::GetAny() && tuple.peerPort != 0;
+}
+
+Ipv6EndPoint*
+Ipv6EndPointDemux::AddEndPoint(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    m_endPoints.push_back(endPoint);
+    endPoint->m_demux = this;
+    AddToIndex(endPoint);
+    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
+    return endPoint;
+}
+
+void
+Ipv6EndPointDemux::AddToIndex(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    FourTuple tuple = GetFourTuple(endPoint);
+    if (IsFullySpecified(tuple))
+    {
+        m_connectedEndPoints.emplace(tuple, endPoint);
+    }
+    else
+    {
+        m_wildcardEndPoints.push_back(endPoint);
+    }
+}
+
+void
+Ipv6EndPointDemux::RemoveFromIndex(Ipv6EndPoint* endPoint)
+{
+    NS_LOG_FUNCTION(this << endPoint);
+    FourTuple tuple = GetFourTuple(endPoint);
+    if (!IsFullySpecified(tuple))
+    {
+        m_wildcardEndPoints.remove(endPoint);
+        return;
+    }
+    auto range = m_connectedEndPoints.equal_range(tuple);
+    for (auto it = range.first; it != range.second; it++)
+    {
+        if (it->second == endPoint)
+        {
+            m_connectedEndPoints.erase(it);
+            return;
+        }
+    }
+}
+
 bool
 Ipv6EndPointDemux::LookupPortLocal(uint16_t port)
 {
@@ -87,9 +172,7 @@ Ipv6EndPointDemux::Allocate()
         return nullptr;
     }
     Ipv6EndPoint* endPoint = new Ipv6EndPoint(Ipv6Address::GetAny(), port);
-    m_endPoints.push_back(endPoint);
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
-    return endPoint;
+    return AddEndPoint(endPoint);
 }
 
 Ipv6EndPoint*
@@ -103,9 +186,7 @@ Ipv6EndPointDemux::Allocate(Ipv6Address address)
         return nullptr;
     }
     Ipv6EndPoint* endPoint = new Ipv6EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
-    return endPoint;
+    return AddEndPoint(endPoint);
 }
 
 Ipv6EndPoint*
@@ -126,9 +207,7 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice, Ipv6Address address,
         return nullptr;
     }
     Ipv6EndPoint* endPoint = new Ipv6EndPoint(address, port);
-    m_endPoints.push_back(endPoint);
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
-    return endPoint;
+    return AddEndPoint(endPoint);
 }
 
 Ipv6EndPoint*
@@ -139,11 +218,29 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
                             uint16_t peerPort)
 {
     NS_LOG_FUNCTION(this << boundNetDevice << localAddress << localPort << peerAddress << peerPort);
-    for (EndPointsI i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+    FourTuple tuple{localAddress, localPort, peerAddress, peerPort};
+    EndPoints sameTuple;
+    if (IsFullySpecified(tuple))
     {
-        if ((*i)->GetLocalPort() == localPort && (*i)->GetLocalAddress() == localAddress &&
-            (*i)->GetPeerPort() == peerPort && (*i)->GetPeerAddress() == peerAddress &&
-            ((*i)->GetBoundNetDevice() == boundNetDevice || !(*i)->GetBoundNetDevice()))
+        auto range = m_connectedEndPoints.equal_range(tuple);
+        for (auto it = range.first; it != range.second; it++)
+        {
+            sameTuple.push_back(it->second);
+        }
+    }
+    else
+    {
+        for (EndPointsI i = m_wildcardEndPoints.begin(); i != m_wildcardEndPoints.end(); i++)
+        {
+            if (GetFourTuple(*i) == tuple)
+            {
+                sameTuple.push_back(*i);
+            }
+        }
+    }
+    for (EndPointsI i = sameTuple.begin(); i != sameTuple.end(); i++)
+    {
+        if ((*i)->GetBoundNetDevice() == boundNetDevice || !(*i)->GetBoundNetDevice())
         {
             NS_LOG_WARN("Duplicated endpoint.");
             return nullptr;
@@ -151,11 +248,7 @@ Ipv6EndPointDemux::Allocate(Ptr<NetDevice> boundNetDevice,
     }
     Ipv6EndPoint* endPoint = new Ipv6EndPoint(localAddress, localPort);
     endPoint->SetPeer(peerAddress, peerPort);
-    m_endPoints.push_back(endPoint);
-
-    NS_LOG_DEBUG("Now have >>" << m_endPoints.size() << "<< endpoints.");
-
-    return endPoint;
+    return AddEndPoint(endPoint);
 }
 
 void
@@ -166,6 +259,8 @@ Ipv6EndPointDemux::DeAllocate(Ipv6EndPoint* endPoint)
     {
         if (*i == endPoint)
         {
+            RemoveFromIndex(endPoint);
+            endPoint->m_demux = nullptr;
             delete endPoint;
             m_endPoints.erase(i);
             break;
@@ -193,7 +288,26 @@ Ipv6EndPointDemux::Lookup(Ipv6Address daddr,
     EndPoints retval4; /* Exact match on all 4 */
 
     NS_LOG_DEBUG("Looking up endpoint for destination address " << daddr);
-    for (EndPointsI i = m_endPoints.begin(); i != m_endPoints.end(); i++)
+
+    /* A fully specified end point can only be found for an exact match on all 4,
+       so it is looked up in the hash index. */
+    auto range = m_connectedEndPoints.equal_range({daddr, dport, saddr, sport});
+    for (auto it = range.first; it != range.second; it++)
+    {
+        Ipv6EndPoint* endP = it->second;
+        Ptr<NetDevice> device = endP->GetBoundNetDevice();
+        if (!endP->IsRxEnabled() ||
+            (device && (!incomingInterface || device != incomingInterface->GetDevice())))
+        {
+            continue;
+        }
+        NS_LOG_LOGIC("Found a fully specified endpoint, adding " << endP->GetLocalAddress() << ":"
+                                                                 << endP->GetLocalPort());
+        retval4.push_back(endP);
+    }
+
+    /* All the other end points have at least one wildcard and are scanned */
+    for (EndPointsI i = m_wildcardEndPoints.begin(); i != m_wildcardEndPoints.end(); i++)
     {
         Ipv6EndPoint* endP = *i;
 
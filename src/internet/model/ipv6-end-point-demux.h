@@ -26,6 +26,7 @@
 
 #include <list>
 #include <stdint.h>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -161,6 +162,82 @@ class Ipv6EndPointDemux
     EndPoints GetEndPoints() const;
 
   private:
+    friend class Ipv6EndPoint;
+
+    /**
+     * \brief The four-tuple of a fully specified end point.
+     */
+    struct FourTuple
+    {
+        Ipv6Address localAddress; //!< local address
+        uint16_t localPort;       //!< local port
+        Ipv6Address peerAddress;  //!< peer address
+        uint16_t peerPort;        //!< peer port
+
+        /**
+         * \brief Equality operator.
+         * \param other the tuple to compare to
+         * \return true if the two tuples are equal
+         */
+        bool operator==(const FourTuple& other) const;
+    };
+
+    /**
+     * \brief Hash function for FourTuple.
+     */
+    struct FourTupleHash
+    {
+        /**
+         * \brief Compute the hash of a four-tuple.
+         * \param tuple the four-tuple
+         * \return the hash
+         */
+        std::size_t operator()(const FourTuple& tuple) const;
+    };
+
+    /**
+     * \brief Container of the fully specified IPv6 end points, indexed by four-tuple.
+     */
+    typedef std::unordered_multimap<FourTuple, Ipv6EndPoint*, FourTupleHash> ConnectedEndPoints;
+
+    /**
+     * \brief Get the current four-tuple of an end point.
+     * \param endPoint the end point
+     * \return the four-tuple
+     */
+    static FourTuple GetFourTuple(Ipv6EndPoint* endPoint);
+
+    /**
+     * \brief Check if a four-tuple has a specific local address, peer address and peer port.
+     *
+     * An end point with such a four-tuple can only be matched by the exact
+     * four-tuple, hence it is looked up through the hash index rather than
+     * by scanning.
+     *
+     * \param tuple the four-tuple
+     * \return true if the four-tuple is fully specified
+     */
+    static bool IsFullySpecified(const FourTuple& tuple);
+
+    /**
+     * \brief Register a newly created end point.
+     * \param endPoint the end point
+     * \return the end point
+     */
+    Ipv6EndPoint* AddEndPoint(Ipv6EndPoint* endPoint);
+
+    /**
+     * \brief Add an end point to the lookup index, according to its current four-tuple.
+     * \param endPoint the end point
+     */
+    void AddToIndex(Ipv6EndPoint* endPoint);
+
+    /**
+     * \brief Remove an end point from the lookup index, according to its current four-tuple.
+     * \param endPoint the end point
+     */
+    void RemoveFromIndex(Ipv6EndPoint* endPoint);
+
     /**
      * \brief Allocate a ephemeral port.
      * \return a port
@@ -186,6 +263,16 @@ class Ipv6EndPointDemux
      * \brief A list of IPv6 end points.
      */
     EndPoints m_endPoints;
+
+    /**
+     * \brief The fully specified IPv6 end points, indexed by four-tuple.
+     */
+    ConnectedEndPoints m_connectedEndPoints;
+
+    /**
+     * \brief The IPv6 end points with at least one wildcard in their four-tuple.
+     */
+    EndPoints m_wildcardEndPoints;
 };
 
 } /* namespace ns3 */
@@ -32,6 +32,7 @@ namespace ns3
 {
 
 class Header;
+class Ipv6EndPointDemux;
 class Packet;
 
 /**
@@ -194,6 +195,8 @@ class Ipv6EndPoint
     bool IsRxEnabled();
 
   private:
+    friend class Ipv6EndPointDemux;
+
     /**
      * \brief The local address.
      */
@@ -238,6 +241,13 @@ class Ipv6EndPoint
      * \brief true if the endpoint can receive packets.
      */
     bool m_rxEnabled;
+
+    /**
+     * \brief The demux indexing this endpoint (if any).
+     *
+     * The demux is notified when the four-tuple of the endpoint changes.
+     */
+    Ipv6EndPointDemux* m_demux;
 };
 
 } /* namespace ns3 */
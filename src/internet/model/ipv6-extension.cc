@@ -728,7 +728,8 @@ Ipv6ExtensionFragment::HandleTimeout()
 }
 
 Ipv6ExtensionFragment::Fragments::Fragments()
-    : m_moreFragment(0)
+    : m_moreFragment(0),
+      m_lastOffset(0)
 {
 }
 
@@ -742,22 +743,15 @@ Ipv6ExtensionFragment::Fragments::AddFragment(Ptr<Packet> fragment,
                                               bool moreFragment)
 {
     NS_LOG_FUNCTION(this << fragment << fragmentOffset << moreFragment);
-    std::list<std::pair<Ptr<Packet>, uint16_t>>::iterator it;
 
-    for (it = m_packetFragments.begin(); it != m_packetFragments.end(); it++)
-    {
-        if (it->second > fragmentOffset)
-        {
-            break;
-        }
-    }
-
-    if (it == m_packetFragments.end())
+    if (m_packetFragments.IsEmpty() || fragmentOffset >= m_lastOffset)
     {
         m_moreFragment = moreFragment;
+        m_lastOffset = fragmentOffset;
     }
 
-    m_packetFragments.insert(it, std::pair<Ptr<Packet>, uint16_t>(fragment, fragmentOffset));
+    // exact duplicates are discarded (RFC 8200, Section 4.5)
+    m_packetFragments.AddFragment(fragment, fragmentOffset);
 }
 
 void
@@ -770,43 +764,15 @@ Ipv6ExtensionFragment::Fragments::SetUnfragmentablePart(Ptr<Packet> unfragmentab
 bool
 Ipv6ExtensionFragment::Fragments::IsEntire() const
 {
-    bool ret = !m_moreFragment && m_packetFragments.size() > 0;
-
-    if (ret)
-    {
-        uint16_t lastEndOffset = 0;
-
-        for (std::list<std::pair<Ptr<Packet>, uint16_t>>::const_iterator it =
-                 m_packetFragments.begin();
-             it != m_packetFragments.end();
-             it++)
-        {
-            if (lastEndOffset != it->second)
-            {
-                ret = false;
-                break;
-            }
-
-            lastEndOffset += it->first->GetSize();
-        }
-    }
-
-    return ret;
+    // overlapping fragments are not allowed (RFC 5722)
+    return !m_moreFragment && m_packetFragments.IsContiguous() &&
+           m_packetFragments.GetSize() == m_packetFragments.GetEnd();
 }
 
 Ptr<Packet>
 Ipv6ExtensionFragment::Fragments::GetPacket() const
 {
-    Ptr<Packet> p = m_unfragmentable->Copy();
-
-    for (std::list<std::pair<Ptr<Packet>, uint16_t>>::const_iterator it = m_packetFragments.begin();
-         it != m_packetFragments.end();
-         it++)
-    {
-        p->AddAtEnd(it->first);
-    }
-
-    return p;
+    return m_packetFragments.GetPacket(m_unfragmentable);
 }
 
 Ptr<Packet>
@@ -816,25 +782,7 @@ Ipv6ExtensionFragment::Fragments::GetPartialPacket() const
 
     if (m_unfragmentable)
     {
-        p = m_unfragmentable->Copy();
-    }
-    else
-    {
-        return p;
-    }
-
-    uint16_t lastEndOffset = 0;
-
-    for (std::list<std::pair<Ptr<Packet>, uint16_t>>::const_iterator it = m_packetFragments.begin();
-         it != m_packetFragments.end();
-         it++)
-    {
-        if (lastEndOffset != it->second)
-        {
-            break;
-        }
-        p->AddAtEnd(it->first);
-        lastEndOffset += it->first->GetSize();
+        p = m_packetFragments.GetPacket(m_unfragmentable);
     }
 
     return p;
@@ -20,6 +20,7 @@
 #ifndef IPV6_EXTENSION_H
 #define IPV6_EXTENSION_H
 
+#include "ip-fragment-buffer.h"
 #include "ipv6-interface.h"
 
 #include "ns3/buffer.h"
@@ -403,10 +404,15 @@ class Ipv6ExtensionFragment : public Ipv6Extension
          */
         bool m_moreFragment;
 
+        /**
+         * \brief The highest offset of the fragments.
+         */
+        uint16_t m_lastOffset;
+
         /**
          * \brief The current fragments.
          */
-        std::list<std::pair<Ptr<Packet>, uint16_t>> m_packetFragments;
+        IpFragmentBuffer m_packetFragments;
 
         /**
          * \brief The unfragmentable part.
@@ -181,8 +181,7 @@ Ipv6StaticRouting::AddNetworkRouteTo(Ipv6Address network,
 
     if (!LookupRoute(route, metric))
     {
-        Ipv6RoutingTableEntry* routePtr = new Ipv6RoutingTableEntry(route);
-        m_networkRoutes.emplace_back(routePtr, metric);
+        DoAddNetworkRoute(new Ipv6RoutingTableEntry(route), metric);
     }
 }
 
@@ -208,8 +207,7 @@ Ipv6StaticRouting::AddNetworkRouteTo(Ipv6Address network,
                                                                               prefixToUse);
     if (!LookupRoute(route, metric))
     {
-        Ipv6RoutingTableEntry* routePtr = new Ipv6RoutingTableEntry(route);
-        m_networkRoutes.emplace_back(routePtr, metric);
+        DoAddNetworkRoute(new Ipv6RoutingTableEntry(route), metric);
     }
 }
 
@@ -225,8 +223,7 @@ Ipv6StaticRouting::AddNetworkRouteTo(Ipv6Address network,
         Ipv6RoutingTableEntry::CreateNetworkRouteTo(network, networkPrefix, interface);
     if (!LookupRoute(route, metric))
     {
-        Ipv6RoutingTableEntry* routePtr = new Ipv6RoutingTableEntry(route);
-        m_networkRoutes.emplace_back(routePtr, metric);
+        DoAddNetworkRoute(new Ipv6RoutingTableEntry(route), metric);
     }
 }
 
@@ -268,7 +265,7 @@ Ipv6StaticRouting::SetDefaultMulticastRoute(uint32_t outputInterface)
     Ipv6Address network = Ipv6Address("ff00::"); /* RFC 3513 */
     Ipv6Prefix networkMask = Ipv6Prefix(8);
     *route = Ipv6RoutingTableEntry::CreateNetworkRouteTo(network, networkMask, outputInterface);
-    m_networkRoutes.emplace_back(route, 0);
+    DoAddNetworkRoute(route, 0);
 }
 
 uint32_t
@@ -363,15 +360,21 @@ Ipv6StaticRouting::HasNetworkDest(Ipv6Address network, uint32_t interfaceIndex)
 bool
 Ipv6StaticRouting::LookupRoute(const Ipv6RoutingTableEntry& route, uint32_t metric)
 {
-    for (NetworkRoutesI j = m_networkRoutes.begin(); j != m_networkRoutes.end(); j++)
+    const NetworkRoutesTrie::Candidates* candidates =
+        m_networkRoutesTrie.Find(route.GetDestNetwork(), route.GetDestNetworkPrefix());
+    if (!candidates)
     {
-        Ipv6RoutingTableEntry* rtentry = j->first;
+        return false;
+    }
+    for (const auto& candidate : *candidates)
+    {
+        Ipv6RoutingTableEntry* rtentry = candidate.first;
 
         if (rtentry->GetDest() == route.GetDest() &&
             rtentry->GetDestNetworkPrefix() == route.GetDestNetworkPrefix() &&
             rtentry->GetGateway() == route.GetGateway() &&
             rtentry->GetInterface() == route.GetInterface() &&
-            rtentry->GetPrefixToUse() == route.GetPrefixToUse() && j->second == metric)
+            rtentry->GetPrefixToUse() == route.GetPrefixToUse() && candidate.second == metric)
         {
             return true;
         }
@@ -379,13 +382,31 @@ Ipv6StaticRouting::LookupRoute(const Ipv6RoutingTableEntry& route, uint32_t metr
     return false;
 }
 
+void
+Ipv6StaticRouting::DoAddNetworkRoute(Ipv6RoutingTableEntry* route, uint32_t metric)
+{
+    m_networkRoutes.emplace_back(route, metric);
+    m_networkRoutesTrie.Insert(route->GetDestNetwork(),
+                               route->GetDestNetworkPrefix(),
+                               m_networkRoutes.back());
+}
+
+Ipv6StaticRouting::NetworkRoutesI
+Ipv6StaticRouting::DoRemoveNetworkRoute(NetworkRoutesI it)
+{
+    [[maybe_unused]] bool removed = m_networkRoutesTrie.Remove(it->first->GetDestNetwork(),
+                                                               it->first->GetDestNetworkPrefix(),
+                                                               *it);
+    NS_ASSERT_MSG(removed, "Route " << *it->first << " not found in the lookup index");
+    delete it->first;
+    return m_networkRoutes.erase(it);
+}
+
 Ptr<Ipv6Route>
 Ipv6StaticRouting::LookupStatic(Ipv6Address dst, Ptr<NetDevice> interface)
 {
     NS_LOG_FUNCTION(this << dst << interface);
     Ptr<Ipv6Route> rtentry = nullptr;
-    uint16_t longestMask = 0;
-    uint32_t shortestMetric = 0xffffffff;
 
     /* when sending on link-local multicast, there have to be interface specified */
     if (dst.IsLinkLocalMulticast())
@@ -402,74 +423,68 @@ Ipv6StaticRouting::LookupStatic(Ipv6Address dst, Ptr<NetDevice> interface)
         return rtentry;
     }
 
-    for (NetworkRoutesI it = m_networkRoutes.begin(); it != m_networkRoutes.end(); it++)
-    {
-        Ipv6RoutingTableEntry* j = it->first;
-        uint32_t metric = it->second;
-        Ipv6Prefix mask = j->GetDestNetworkPrefix();
-        uint16_t maskLen = mask.GetPrefixLength();
-        Ipv6Address entry = j->GetDestNetwork();
-
-        NS_LOG_LOGIC("Searching for route to " << dst << ", mask length " << maskLen << ", metric "
-                                               << metric);
-
-        if (mask.IsMatch(dst, entry))
-        {
-            NS_LOG_LOGIC("Found global network route " << *j << ", mask length " << maskLen
-                                                       << ", metric " << metric);
-
-            /* if interface is given, check the route will output on this interface */
-            if (!interface || interface == m_ipv6->GetNetDevice(j->GetInterface()))
+    // Visit the matching prefixes from the longest to the shortest one, and
+    // stop at the first one having a route on the requested interface.
+    // Among the routes to the same prefix, the one with the lowest metric is
+    // selected.
+    Ipv6RoutingTableEntry* route = nullptr;
+    m_networkRoutesTrie.LongestMatch(
+        dst,
+        [this, dst, interface, &route](uint8_t maskLen,
+                                       const NetworkRoutesTrie::Candidates& routes) {
+            uint32_t shortestMetric = 0xffffffff;
+            for (const auto& candidate : routes)
             {
-                if (maskLen < longestMask)
+                Ipv6RoutingTableEntry* j = candidate.first;
+                uint32_t metric = candidate.second;
+                NS_LOG_LOGIC("Found global network route " << *j << " to " << dst
+                                                           << ", mask length " << +maskLen
+                                                           << ", metric " << metric);
+
+                /* if interface is given, check the route will output on this interface */
+                if (interface && interface != m_ipv6->GetNetDevice(j->GetInterface()))
                 {
-                    NS_LOG_LOGIC("Previous match longer, skipping");
+                    NS_LOG_LOGIC("Not on requested interface, skipping");
                     continue;
                 }
-
-                if (maskLen > longestMask)
-                {
-                    shortestMetric = 0xffffffff;
-                }
-
-                longestMask = maskLen;
                 if (metric > shortestMetric)
                 {
                     NS_LOG_LOGIC("Equal mask length, but previous metric shorter, skipping");
                     continue;
                 }
-
                 shortestMetric = metric;
-                Ipv6RoutingTableEntry* route = j;
-                uint32_t interfaceIdx = route->GetInterface();
-                rtentry = Create<Ipv6Route>();
-
-                if (route->GetGateway().IsAny())
-                {
-                    rtentry->SetSource(
-                        m_ipv6->SourceAddressSelection(interfaceIdx, route->GetDest()));
-                }
-                else if (route->GetDest().IsAny()) /* default route */
-                {
-                    rtentry->SetSource(m_ipv6->SourceAddressSelection(
-                        interfaceIdx,
-                        route->GetPrefixToUse().IsAny() ? dst : route->GetPrefixToUse()));
-                }
-                else
-                {
-                    rtentry->SetSource(
-                        m_ipv6->SourceAddressSelection(interfaceIdx, route->GetDest()));
-                }
-
-                rtentry->SetDestination(route->GetDest());
-                rtentry->SetGateway(route->GetGateway());
-                rtentry->SetOutputDevice(m_ipv6->GetNetDevice(interfaceIdx));
+                route = j;
                 if (maskLen == 128)
                 {
                     break;
                 }
             }
+            return route != nullptr;
+        });
+
+    if (route)
+    {
+        uint32_t interfaceIdx = route->GetInterface();
+        rtentry = Create<Ipv6Route>();
+
+        if (route->GetGateway().IsAny())
+        {
+            rtentry->SetSource(m_ipv6->SourceAddressSelection(interfaceIdx, route->GetDest()));
         }
+        else if (route->GetDest().IsAny()) /* default route */
+        {
+            rtentry->SetSource(m_ipv6->SourceAddressSelection(
+                interfaceIdx,
+                route->GetPrefixToUse().IsAny() ? dst : route->GetPrefixToUse()));
+        }
+        else
+        {
+            rtentry->SetSource(m_ipv6->SourceAddressSelection(interfaceIdx, route->GetDest()));
+        }
+
+        rtentry->SetDestination(route->GetDest());
+        rtentry->SetGateway(route->GetGateway());
+        rtentry->SetOutputDevice(m_ipv6->GetNetDevice(interfaceIdx));
     }
 
     if (rtentry)
@@ -491,6 +506,7 @@ Ipv6StaticRouting::DoDispose()
         delete j->first;
     }
     m_networkRoutes.clear();
+    m_networkRoutesTrie.Clear();
 
     for (MulticastRoutesI i = m_multicastRoutes.begin(); i != m_multicastRoutes.end();
          i = m_multicastRoutes.erase(i))
@@ -648,8 +664,7 @@ Ipv6StaticRouting::RemoveRoute(uint32_t index)
     {
         if (tmp == index)
         {
-            delete it->first;
-            m_networkRoutes.erase(it);
+            DoRemoveNetworkRoute(it);
             return;
         }
         tmp++;
@@ -671,8 +686,7 @@ Ipv6StaticRouting::RemoveRoute(Ipv6Address network,
         if (network == rtentry->GetDest() && rtentry->GetInterface() == ifIndex &&
             rtentry->GetPrefixToUse() == prefixToUse)
         {
-            delete it->first;
-            m_networkRoutes.erase(it);
+            DoRemoveNetworkRoute(it);
             return;
         }
     }
@@ -813,8 +827,7 @@ Ipv6StaticRouting::NotifyInterfaceDown(uint32_t i)
     {
         if (it->first->GetInterface() == i)
         {
-            delete it->first;
-            it = m_networkRoutes.erase(it);
+            it = DoRemoveNetworkRoute(it);
         }
         else
         {
@@ -851,8 +864,7 @@ Ipv6StaticRouting::NotifyRemoveAddress(uint32_t interface, Ipv6InterfaceAddress
             it->first->GetDestNetwork() == networkAddress &&
             it->first->GetDestNetworkPrefix() == networkMask)
         {
-            delete it->first;
-            it = m_networkRoutes.erase(it);
+            it = DoRemoveNetworkRoute(it);
         }
         else
         {
@@ -909,8 +921,7 @@ Ipv6StaticRouting::NotifyRemoveRoute(Ipv6Address dst,
 
             if (dst == entry && prefix == mask && rtentry->GetInterface() == interface)
             {
-                delete j->first;
-                j = m_networkRoutes.erase(j);
+                j = DoRemoveNetworkRoute(j);
             }
             else
             {
@@ -20,6 +20,8 @@
 #ifndef IPV6_STATIC_ROUTING_H
 #define IPV6_STATIC_ROUTING_H
 
+#include "routing-trie.h"
+
 #include "ns3/ipv6-address.h"
 #include "ns3/ipv6-header.h"
 #include "ns3/ipv6-routing-protocol.h"
@@ -55,6 +57,10 @@ class Ipv6MulticastRoutingTableEntry;
  * Ipv6RoutingProtocol that defines the interface methods that a routing
  * protocol must support.
  *
+ * Unicast routes are indexed by a longest prefix match trie
+ * (Ipv6RoutingTrie), so that the cost of a lookup is bounded by the
+ * prefix length rather than by the number of routes.
+ *
  * \see Ipv6RoutingProtocol
  * \see Ipv6ListRouting
  * \see Ipv6ListRouting::AddRoutingProtocol
@@ -296,6 +302,9 @@ class Ipv6StaticRouting : public Ipv6RoutingProtocol
     /// Iterator for container for the network routes
     typedef std::list<std::pair<Ipv6RoutingTableEntry*, uint32_t>>::iterator NetworkRoutesI;
 
+    /// Longest prefix match index of the network routes
+    typedef Ipv6RoutingTrie<std::pair<Ipv6RoutingTableEntry*, uint32_t>> NetworkRoutesTrie;
+
     /// Container for the multicast routes
     typedef std::list<Ipv6MulticastRoutingTableEntry*> MulticastRoutes;
 
@@ -313,6 +322,20 @@ class Ipv6StaticRouting : public Ipv6RoutingProtocol
      */
     bool LookupRoute(const Ipv6RoutingTableEntry& route, uint32_t metric);
 
+    /**
+     * \brief Add a network route to the forwarding table and to its lookup index.
+     * \param route the route
+     * \param metric metric of route
+     */
+    void DoAddNetworkRoute(Ipv6RoutingTableEntry* route, uint32_t metric);
+
+    /**
+     * \brief Remove a network route from the forwarding table and from its lookup index.
+     * \param it iterator to the route
+     * \return iterator to the route following the removed one
+     */
+    NetworkRoutesI DoRemoveNetworkRoute(NetworkRoutesI it);
+
     /**
      * \brief Lookup in the forwarding table for destination.
      * \param dest destination address
@@ -335,6 +358,11 @@ class Ipv6StaticRouting : public Ipv6RoutingProtocol
      */
     NetworkRoutes m_networkRoutes;
 
+    /**
+     * \brief the lookup index of m_networkRoutes.
+     */
+    NetworkRoutesTrie m_networkRoutesTrie;
+
     /**
      * \brief the forwarding table for multicast.
      */
@@ -28,6 +28,8 @@
 #include "ns3/node.h"
 #include "ns3/uinteger.h"
 
+#include <map>
+
 namespace ns3
 {
 
@@ -101,9 +103,10 @@ NdiscCache::Lookup(Ipv6Address dst)
 {
     NS_LOG_FUNCTION(this << dst);
 
-    if (m_ndCache.find(dst) != m_ndCache.end())
+    CacheI it = m_ndCache.find(dst);
+    if (it != m_ndCache.end())
     {
-        NdiscCache::Entry* entry = m_ndCache[dst];
+        NdiscCache::Entry* entry = it->second;
         NS_LOG_LOGIC("Found an entry: " << *entry);
 
         return entry;
@@ -147,15 +150,12 @@ NdiscCache::Remove(NdiscCache::Entry* entry)
 {
     NS_LOG_FUNCTION(this << entry);
 
-    for (CacheI i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    CacheI i = m_ndCache.find(entry->GetIpv6Address());
+    if (i != m_ndCache.end() && i->second == entry)
     {
-        if ((*i).second == entry)
-        {
-            m_ndCache.erase(i);
-            entry->ClearWaitingPacket();
-            delete entry;
-            return;
-        }
+        m_ndCache.erase(i);
+        entry->ClearWaitingPacket();
+        delete entry;
     }
 }
 
@@ -192,7 +192,9 @@ NdiscCache::PrintNdiscCache(Ptr<OutputStreamWrapper> stream)
     NS_LOG_FUNCTION(this << stream);
     std::ostream* os = stream->GetStream();
 
-    for (CacheI i = m_ndCache.begin(); i != m_ndCache.end(); i++)
+    // print the entries sorted by address
+    std::map<Ipv6Address, NdiscCache::Entry*> sorted(m_ndCache.begin(), m_ndCache.end());
+    for (auto i = sorted.begin(); i != sorted.end(); i++)
     {
         *os << i->first << " dev ";
         std::string found = Names::FindName(m_device);
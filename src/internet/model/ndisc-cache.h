@@ -29,8 +29,8 @@
 #include "ns3/timer.h"
 
 #include <list>
-#include <map>
 #include <stdint.h>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -457,11 +457,11 @@ class NdiscCache : public Object
     /**
      * \brief Neighbor Discovery Cache container
      */
-    typedef std::map<Ipv6Address, NdiscCache::Entry*> Cache;
+    typedef std::unordered_map<Ipv6Address, NdiscCache::Entry*, Ipv6AddressHash> Cache;
     /**
      * \brief Neighbor Discovery Cache container iterator
      */
-    typedef std::map<Ipv6Address, NdiscCache::Entry*>::iterator CacheI;
+    typedef std::unordered_map<Ipv6Address, NdiscCache::Entry*, Ipv6AddressHash>::iterator CacheI;
 
     /**
      * \brief A list of Entry.
@@ -580,6 +580,7 @@ RipNg::DoDispose()
         delete j->first;
     }
     m_routes.clear();
+    m_routesTrie.Clear();
 
     m_nextTriggeredUpdate.Cancel();
     m_nextUnsolicitedUpdate.Cancel();
@@ -606,7 +607,6 @@ RipNg::Lookup(Ipv6Address dst, bool setSource, Ptr<NetDevice> interface)
     NS_LOG_FUNCTION(this << dst << interface);
 
     Ptr<Ipv6Route> rtentry = nullptr;
-    uint16_t longestMask = 0;
 
     /* when sending on link-local multicast, there have to be interface specified */
     if (dst.IsLinkLocalMulticast())
@@ -623,63 +623,57 @@ RipNg::Lookup(Ipv6Address dst, bool setSource, Ptr<NetDevice> interface)
         return rtentry;
     }
 
-    for (RoutesI it = m_routes.begin(); it != m_routes.end(); it++)
-    {
-        RipNgRoutingTableEntry* j = it->first;
-
-        if (j->GetRouteStatus() == RipNgRoutingTableEntry::RIPNG_VALID)
-        {
-            Ipv6Prefix mask = j->GetDestNetworkPrefix();
-            uint16_t maskLen = mask.GetPrefixLength();
-            Ipv6Address entry = j->GetDestNetwork();
-
-            NS_LOG_LOGIC("Searching for route to " << dst << ", mask length " << maskLen);
-
-            if (mask.IsMatch(dst, entry))
+    // Visit the matching prefixes from the longest to the shortest one, and
+    // stop at the first one having a valid route on the requested interface.
+    RipNgRoutingTableEntry* route = nullptr;
+    m_routesTrie.LongestMatch(
+        dst,
+        [this, dst, interface, &route](uint8_t maskLen, const RoutesTrie::Candidates& routes) {
+            for (const auto& it : routes)
             {
-                NS_LOG_LOGIC("Found global network route " << j << ", mask length " << maskLen);
+                RipNgRoutingTableEntry* j = it->first;
+                if (j->GetRouteStatus() != RipNgRoutingTableEntry::RIPNG_VALID)
+                {
+                    continue;
+                }
+                NS_LOG_LOGIC("Found global network route " << j << " to " << dst
+                                                           << ", mask length " << +maskLen);
 
                 /* if interface is given, check the route will output on this interface */
                 if (!interface || interface == m_ipv6->GetNetDevice(j->GetInterface()))
                 {
-                    if (maskLen < longestMask)
-                    {
-                        NS_LOG_LOGIC("Previous match longer, skipping");
-                        continue;
-                    }
-
-                    longestMask = maskLen;
-
-                    Ipv6RoutingTableEntry* route = j;
-                    uint32_t interfaceIdx = route->GetInterface();
-                    rtentry = Create<Ipv6Route>();
+                    route = j;
+                }
+            }
+            return route != nullptr;
+        });
 
-                    if (setSource)
-                    {
-                        if (route->GetGateway().IsAny())
-                        {
-                            rtentry->SetSource(
-                                m_ipv6->SourceAddressSelection(interfaceIdx, route->GetDest()));
-                        }
-                        else if (route->GetDest().IsAny()) /* default route */
-                        {
-                            rtentry->SetSource(m_ipv6->SourceAddressSelection(
-                                interfaceIdx,
-                                route->GetPrefixToUse().IsAny() ? dst : route->GetPrefixToUse()));
-                        }
-                        else
-                        {
-                            rtentry->SetSource(
-                                m_ipv6->SourceAddressSelection(interfaceIdx, route->GetDest()));
-                        }
-                    }
+    if (route)
+    {
+        uint32_t interfaceIdx = route->GetInterface();
+        rtentry = Create<Ipv6Route>();
 
-                    rtentry->SetDestination(route->GetDest());
-                    rtentry->SetGateway(route->GetGateway());
-                    rtentry->SetOutputDevice(m_ipv6->GetNetDevice(interfaceIdx));
-                }
+        if (setSource)
+        {
+            if (route->GetGateway().IsAny())
+            {
+                rtentry->SetSource(m_ipv6->SourceAddressSelection(interfaceIdx, route->GetDest()));
+            }
+            else if (route->GetDest().IsAny()) /* default route */
+            {
+                rtentry->SetSource(m_ipv6->SourceAddressSelection(
+                    interfaceIdx,
+                    route->GetPrefixToUse().IsAny() ? dst : route->GetPrefixToUse()));
+            }
+            else
+            {
+                rtentry->SetSource(m_ipv6->SourceAddressSelection(interfaceIdx, route->GetDest()));
             }
         }
+
+        rtentry->SetDestination(route->GetDest());
+        rtentry->SetGateway(route->GetGateway());
+        rtentry->SetOutputDevice(m_ipv6->GetNetDevice(interfaceIdx));
     }
 
     if (rtentry)
@@ -711,6 +705,7 @@ RipNg::AddNetworkRouteTo(Ipv6Address network,
     route->SetRouteChanged(true);
 
     m_routes.emplace_back(route, EventId());
+    m_routesTrie.Insert(network, networkPrefix, std::prev(m_routes.end()));
 }
 
 void
@@ -724,6 +719,7 @@ RipNg::AddNetworkRouteTo(Ipv6Address network, Ipv6Prefix networkPrefix, uint32_t
     route->SetRouteChanged(true);
 
     m_routes.emplace_back(route, EventId());
+    m_routesTrie.Insert(network, networkPrefix, std::prev(m_routes.end()));
 }
 
 void
@@ -759,6 +755,7 @@ RipNg::DeleteRoute(RipNgRoutingTableEntry* route)
     {
         if (it->first == route)
         {
+            m_routesTrie.Remove(route->GetDestNetwork(), route->GetDestNetworkPrefix(), it);
             delete route;
             m_routes.erase(it);
             return;
@@ -1176,6 +1173,7 @@ RipNg::HandleResponses(RipNgHeader hdr,
             route->SetRouteStatus(RipNgRoutingTableEntry::RIPNG_VALID);
             route->SetRouteChanged(true);
             m_routes.emplace_front(route, EventId());
+            m_routesTrie.Insert(rteAddr, rtePrefix, m_routes.begin());
             EventId invalidateEvent =
                 Simulator::Schedule(m_timeoutDelay, &RipNg::InvalidateRoute, this, route);
             (m_routes.begin())->second = invalidateEvent;
@@ -20,6 +20,8 @@
 #ifndef RIPNG_H
 #define RIPNG_H
 
+#include "routing-trie.h"
+
 #include "ns3/inet6-socket-address.h"
 #include "ns3/ipv6-interface.h"
 #include "ns3/ipv6-l3-protocol.h"
@@ -294,6 +296,9 @@ class RipNg : public Ipv6RoutingProtocol
     /// Iterator for container for the network routes
     typedef std::list<std::pair<RipNgRoutingTableEntry*, EventId>>::iterator RoutesI;
 
+    /// Longest prefix match index of the network routes
+    typedef Ipv6RoutingTrie<RoutesI> RoutesTrie;
+
     /**
      * \brief Receive RIPng packets.
      *
@@ -405,6 +410,7 @@ class RipNg : public Ipv6RoutingProtocol
     void DeleteRoute(RipNgRoutingTableEntry* route);
 
     Routes m_routes;                //!<  the forwarding table for network.
+    RoutesTrie m_routesTrie;        //!< the lookup index of m_routes.
     Ptr<Ipv6> m_ipv6;               //!< IPv6 reference
     Time m_startupDelay;            //!< Random delay before protocol startup.
     Time m_minTriggeredUpdateDelay; //!< Min cooldown delay after a Triggered Update.
@@ -0,0 +1,589 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef ROUTING_TRIE_H
+#define ROUTING_TRIE_H
+
+#include "ns3/assert.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/ipv6-address.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup ipv4Routing
+ * \ingroup ipv6Routing
+ *
+ * \brief Operations on the keys of a RoutingTrie, for an address and mask type.
+ *
+ * A specialization must define the Key type, which holds the bits of an
+ * address, MAX_LENGTH, the number of bits of an address, and the GetLength,
+ * MakeKey, Truncate, BitAt, IsEqual and GetCommonLength static functions.
+ *
+ * \tparam ADDRESS the address type
+ * \tparam MASK the mask type
+ */
+template <typename ADDRESS, typename MASK>
+struct RoutingTrieKey;
+
+/**
+ * \ingroup ipv4Routing
+ *
+ * \brief Keys of a RoutingTrie of IPv4 prefixes: 32-bit integers in host byte order.
+ */
+template <>
+struct RoutingTrieKey<Ipv4Address, Ipv4Mask>
+{
+    /// The bits of an address
+    typedef uint32_t Key;
+
+    /// The number of bits of an address
+    static constexpr uint8_t MAX_LENGTH = 32;
+
+    /**
+     * \param mask a mask
+     * \return the length of the mask, after checking that it is contiguous
+     */
+    static uint8_t GetLength(Ipv4Mask mask)
+    {
+        uint8_t length = mask.GetPrefixLength();
+        NS_ASSERT_MSG(MaskOf(length) == mask.Get(), "Non contiguous mask " << mask);
+        return length;
+    }
+
+    /**
+     * \param address an address
+     * \param length a prefix length
+     * \return the bits of address, with the bits beyond length cleared
+     */
+    static Key MakeKey(Ipv4Address address, uint8_t length)
+    {
+        return Truncate(address.Get(), length);
+    }
+
+    /**
+     * \param key a key
+     * \param length a prefix length
+     * \return key, with the bits beyond length cleared
+     */
+    static Key Truncate(Key key, uint8_t length)
+    {
+        return key & MaskOf(length);
+    }
+
+    /**
+     * \param key a key
+     * \param position the bit position, starting from the most significant bit
+     * \return the bit of key at the given position
+     */
+    static uint8_t BitAt(Key key, uint8_t position)
+    {
+        return (key >> (31 - position)) & 1;
+    }
+
+    /**
+     * \param a a key
+     * \param b another key
+     * \param length the number of bits to compare
+     * \return true if the first length bits of the two keys are equal
+     */
+    static bool IsEqual(Key a, Key b, uint8_t length)
+    {
+        return ((a ^ b) & MaskOf(length)) == 0;
+    }
+
+    /**
+     * \param a a key
+     * \param b another key
+     * \param start a number of leading bits known to be equal in the two keys
+     * \param maxLength the maximum number of bits to compare
+     * \return the number of leading bits that are equal in the two keys, up to maxLength
+     */
+    static uint8_t GetCommonLength(Key a, Key b, uint8_t start, uint8_t maxLength)
+    {
+        uint8_t common = start;
+        while (common < maxLength && BitAt(a, common) == BitAt(b, common))
+        {
+            common++;
+        }
+        return common;
+    }
+
+    /**
+     * \param length a prefix length
+     * \return the corresponding mask in host byte order
+     */
+    static uint32_t MaskOf(uint8_t length)
+    {
+        return length == 0 ? 0 : (0xffffffffU << (32 - length));
+    }
+};
+
+/**
+ * \ingroup ipv6Routing
+ *
+ * \brief Keys of a RoutingTrie of IPv6 prefixes: 128-bit arrays in network byte order.
+ *
+ * Prefixes are compared byte-wise where possible, instead of through
+ * Ipv6Prefix::IsMatch.
+ */
+template <>
+struct RoutingTrieKey<Ipv6Address, Ipv6Prefix>
+{
+    /// The bits of an address
+    typedef std::array<uint8_t, 16> Key;
+
+    /// The number of bits of an address
+    static constexpr uint8_t MAX_LENGTH = 128;
+
+    /**
+     * \param prefix a prefix
+     * \return the number of leading one bits of prefix, after checking that
+     * it is contiguous
+     */
+    static uint8_t GetLength(Ipv6Prefix prefix)
+    {
+        // The length is computed from the prefix bits, which are the ones used by
+        // Ipv6Prefix::IsMatch, rather than taken from Ipv6Prefix::GetPrefixLength.
+        Key bits;
+        prefix.GetBytes(bits.data());
+        uint8_t length = 0;
+        while (length < 128 && BitAt(bits, length) == 1)
+        {
+            length++;
+        }
+        NS_ASSERT_MSG(Truncate(bits, length) == bits, "Non contiguous prefix " << prefix);
+        return length;
+    }
+
+    /**
+     * \param address an address
+     * \param length a prefix length
+     * \return the bytes of address, with the bits beyond length cleared
+     */
+    static Key MakeKey(Ipv6Address address, uint8_t length)
+    {
+        Key key;
+        address.GetBytes(key.data());
+        return Truncate(key, length);
+    }
+
+    /**
+     * \param key a key
+     * \param length a prefix length
+     * \return key, with the bits beyond length cleared
+     */
+    static Key Truncate(Key key, uint8_t length)
+    {
+        uint8_t bytes = length / 8;
+        if (bytes < 16)
+        {
+            key[bytes] &= static_cast<uint8_t>(0xff00 >> (length % 8));
+            std::fill(key.begin() + bytes + 1, key.end(), 0);
+        }
+        return key;
+    }
+
+    /**
+     * \param key a key
+     * \param position the bit position, starting from the most significant bit
+     * \return the bit of key at the given position
+     */
+    static uint8_t BitAt(const Key& key, uint8_t position)
+    {
+        return (key[position / 8] >> (7 - position % 8)) & 1;
+    }
+
+    /**
+     * \param a a key
+     * \param b another key
+     * \param length the number of bits to compare
+     * \return true if the first length bits of the two keys are equal
+     */
+    static bool IsEqual(const Key& a, const Key& b, uint8_t length)
+    {
+        uint8_t bytes = length / 8;
+        if (std::memcmp(a.data(), b.data(), bytes) != 0)
+        {
+            return false;
+        }
+        if (length % 8 == 0)
+        {
+            return true;
+        }
+        uint8_t mask = static_cast<uint8_t>(0xff00 >> (length % 8));
+        return (a[bytes] & mask) == (b[bytes] & mask);
+    }
+
+    /**
+     * \param a a key
+     * \param b another key
+     * \param start a number of leading bits known to be equal in the two keys
+     * \param maxLength the maximum number of bits to compare
+     * \return the number of leading bits that are equal in the two keys, up to maxLength
+     */
+    static uint8_t GetCommonLength(const Key& a, const Key& b, uint8_t start, uint8_t maxLength)
+    {
+        uint8_t common = start;
+        while (common % 8 == 0 && common + 8 <= maxLength && a[common / 8] == b[common / 8])
+        {
+            common += 8;
+        }
+        while (common < maxLength && BitAt(a, common) == BitAt(b, common))
+        {
+            common++;
+        }
+        return common;
+    }
+};
+
+/**
+ * \ingroup ipv4Routing
+ * \ingroup ipv6Routing
+ *
+ * \brief Path-compressed binary trie used as a longest prefix match index
+ * by the IPv4 and IPv6 routing protocols.
+ *
+ * Every node of the trie stores a prefix and the set of values (typically
+ * routing table entries) registered for exactly that prefix, in insertion
+ * order.  Such a set is the ECMP candidate set of the prefix.  Nodes without
+ * values and with a single child are never kept, hence the depth of the trie
+ * is bounded by the number of distinct prefix lengths and a lookup visits at
+ * most one node per prefix length (33 for IPv4, 129 for IPv6), independently
+ * of the number of routes.
+ *
+ * The trie does not own the values: the routing protocols keep their own
+ * containers (used e.g. for index-based access) and use the trie only as a
+ * lookup accelerator.
+ *
+ * \tparam ADDRESS the address type
+ * \tparam MASK the mask type
+ * \tparam T the type of the values stored for each prefix
+ */
+template <typename ADDRESS, typename MASK, typename T>
+class RoutingTrie
+{
+  public:
+    /// The ECMP candidate set associated with a prefix
+    typedef std::vector<T> Candidates;
+
+    RoutingTrie();
+
+    /**
+     * \brief Add a value for the given prefix.
+     * \param network the network address (bits beyond the mask are ignored)
+     * \param mask the network mask; must be contiguous
+     * \param value the value to add to the candidate set of the prefix
+     */
+    void Insert(ADDRESS network, MASK mask, const T& value);
+
+    /**
+     * \brief Remove a value from the candidate set of the given prefix.
+     * \param network the network address (bits beyond the mask are ignored)
+     * \param mask the network mask; must be contiguous
+     * \param value the value to remove
+     * \return true if the value was found and removed
+     */
+    bool Remove(ADDRESS network, MASK mask, const T& value);
+
+    /**
+     * \brief Remove all the values.
+     */
+    void Clear();
+
+    /**
+     * \return the number of values stored in the trie
+     */
+    uint32_t GetSize() const;
+
+    /**
+     * \brief Visit the candidate sets of all the prefixes matching an address,
+     * from the longest to the shortest prefix.
+     *
+     * The visit stops as soon as the visitor returns true.
+     *
+     * \tparam VISITOR a callable with signature bool (uint8_t prefixLength,
+     * const Candidates& candidates)
+     * \param dest the address to match
+     * \param visitor the visitor
+     * \return true if the visitor returned true for one of the candidate sets
+     */
+    template <typename VISITOR>
+    bool LongestMatch(ADDRESS dest, VISITOR visitor) const;
+
+    /**
+     * \brief Get the candidate set of an exact prefix.
+     * \param network the network address (bits beyond the mask are ignored)
+     * \param mask the network mask; must be contiguous
+     * \return the candidate set, or nullptr if the prefix has no value
+     */
+    const Candidates* Find(ADDRESS network, MASK mask) const;
+
+  private:
+    /// Operations on the keys
+    typedef RoutingTrieKey<ADDRESS, MASK> Traits;
+    /// The bits of a prefix
+    typedef typename Traits::Key Key;
+
+    /// A trie node
+    struct Node
+    {
+        Key prefix;                                 //!< prefix bits (masked)
+        uint8_t length;                             //!< prefix length
+        Candidates values;                          //!< values registered for the prefix
+        std::array<std::unique_ptr<Node>, 2> child; //!< children, indexed by next bit
+    };
+
+    /**
+     * \brief Remove the node if it is no longer useful, after a value removal.
+     * \param slot the owning pointer of the node
+     */
+    static void Compact(std::unique_ptr<Node>& slot);
+
+    /**
+     * \brief Remove a value from the subtree rooted at slot.
+     * \param slot the owning pointer of the subtree root
+     * \param prefix the prefix bits
+     * \param length the prefix length
+     * \param value the value
+     * \return true if the value was removed
+     */
+    bool DoRemove(std::unique_ptr<Node>& slot, const Key& prefix, uint8_t length, const T& value);
+
+    std::unique_ptr<Node> m_root; //!< the root node (the /0 prefix)
+    uint32_t m_size;              //!< number of values stored
+};
+
+/**
+ * \ingroup ipv4Routing
+ *
+ * \brief Longest prefix match trie of IPv4 prefixes.
+ *
+ * \tparam T the type of the values stored for each prefix
+ */
+template <typename T>
+using Ipv4RoutingTrie = RoutingTrie<Ipv4Address, Ipv4Mask, T>;
+
+/**
+ * \ingroup ipv6Routing
+ *
+ * \brief Longest prefix match trie of IPv6 prefixes.
+ *
+ * \tparam T the type of the values stored for each prefix
+ */
+template <typename T>
+using Ipv6RoutingTrie = RoutingTrie<Ipv6Address, Ipv6Prefix, T>;
+
+/***************************************************************
+ *  Implementation of the templates declared above.
+ ***************************************************************/
+
+template <typename ADDRESS, typename MASK, typename T>
+RoutingTrie<ADDRESS, MASK, T>::RoutingTrie()
+    : m_root(new Node{Key{}, 0, {}, {}}),
+      m_size(0)
+{
+}
+
+template <typename ADDRESS, typename MASK, typename T>
+void
+RoutingTrie<ADDRESS, MASK, T>::Insert(ADDRESS network, MASK mask, const T& value)
+{
+    uint8_t length = Traits::GetLength(mask);
+    Key key = Traits::MakeKey(network, length);
+    m_size++;
+
+    Node* node = m_root.get();
+    while (node->length < length)
+    {
+        std::unique_ptr<Node>& slot = node->child[Traits::BitAt(key, node->length)];
+        if (!slot)
+        {
+            slot.reset(new Node{key, length, {value}, {}});
+            return;
+        }
+        Node* next = slot.get();
+        uint8_t common = Traits::GetCommonLength(next->prefix,
+                                                 key,
+                                                 node->length,
+                                                 std::min(next->length, length));
+        if (common == next->length)
+        {
+            node = next;
+            continue;
+        }
+        // split the edge with a node for the common part of the two prefixes
+        std::unique_ptr<Node> split(new Node{Traits::Truncate(key, common), common, {}, {}});
+        split->child[Traits::BitAt(next->prefix, common)] = std::move(slot);
+        if (common == length)
+        {
+            split->values.push_back(value);
+        }
+        else
+        {
+            split->child[Traits::BitAt(key, common)].reset(new Node{key, length, {value}, {}});
+        }
+        slot = std::move(split);
+        return;
+    }
+    node->values.push_back(value);
+}
+
+template <typename ADDRESS, typename MASK, typename T>
+bool
+RoutingTrie<ADDRESS, MASK, T>::Remove(ADDRESS network, MASK mask, const T& value)
+{
+    uint8_t length = Traits::GetLength(mask);
+    Key key = Traits::MakeKey(network, length);
+    if (length == 0)
+    {
+        auto it = std::find(m_root->values.begin(), m_root->values.end(), value);
+        if (it == m_root->values.end())
+        {
+            return false;
+        }
+        m_root->values.erase(it);
+        m_size--;
+        return true;
+    }
+    return DoRemove(m_root->child[Traits::BitAt(key, 0)], key, length, value);
+}
+
+template <typename ADDRESS, typename MASK, typename T>
+bool
+RoutingTrie<ADDRESS, MASK, T>::DoRemove(std::unique_ptr<Node>& slot,
+                                        const Key& prefix,
+                                        uint8_t length,
+                                        const T& value)
+{
+    if (!slot || slot->length > length || !Traits::IsEqual(prefix, slot->prefix, slot->length))
+    {
+        return false;
+    }
+    bool removed = false;
+    if (slot->length == length)
+    {
+        auto it = std::find(slot->values.begin(), slot->values.end(), value);
+        if (it != slot->values.end())
+        {
+            slot->values.erase(it);
+            m_size--;
+            removed = true;
+        }
+    }
+    else
+    {
+        removed =
+            DoRemove(slot->child[Traits::BitAt(prefix, slot->length)], prefix, length, value);
+    }
+    if (removed)
+    {
+        Compact(slot);
+    }
+    return removed;
+}
+
+template <typename ADDRESS, typename MASK, typename T>
+void
+RoutingTrie<ADDRESS, MASK, T>::Compact(std::unique_ptr<Node>& slot)
+{
+    if (!slot->values.empty())
+    {
+        return;
+    }
+    if (!slot->child[0] || !slot->child[1])
+    {
+        // zero or one child: the node can be bypassed
+        std::unique_ptr<Node> next = std::move(slot->child[slot->child[0] ? 0 : 1]);
+        slot = std::move(next);
+    }
+}
+
+template <typename ADDRESS, typename MASK, typename T>
+void
+RoutingTrie<ADDRESS, MASK, T>::Clear()
+{
+    m_root.reset(new Node{Key{}, 0, {}, {}});
+    m_size = 0;
+}
+
+template <typename ADDRESS, typename MASK, typename T>
+uint32_t
+RoutingTrie<ADDRESS, MASK, T>::GetSize() const
+{
+    return m_size;
+}
+
+template <typename ADDRESS, typename MASK, typename T>
+template <typename VISITOR>
+bool
+RoutingTrie<ADDRESS, MASK, T>::LongestMatch(ADDRESS dest, VISITOR visitor) const
+{
+    Key key = Traits::MakeKey(dest, Traits::MAX_LENGTH);
+    std::array<const Node*, Traits::MAX_LENGTH + 1> path;
+    uint8_t depth = 0;
+    const Node* node = m_root.get();
+    while (node && Traits::IsEqual(key, node->prefix, node->length))
+    {
+        if (!node->values.empty())
+        {
+            path[depth++] = node;
+        }
+        if (node->length == Traits::MAX_LENGTH)
+        {
+            break;
+        }
+        node = node->child[Traits::BitAt(key, node->length)].get();
+    }
+    while (depth > 0)
+    {
+        depth--;
+        if (visitor(path[depth]->length, path[depth]->values))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename ADDRESS, typename MASK, typename T>
+const typename RoutingTrie<ADDRESS, MASK, T>::Candidates*
+RoutingTrie<ADDRESS, MASK, T>::Find(ADDRESS network, MASK mask) const
+{
+    uint8_t length = Traits::GetLength(mask);
+    Key key = Traits::MakeKey(network, length);
+    const Node* node = m_root.get();
+    while (node && node->length <= length && Traits::IsEqual(key, node->prefix, node->length))
+    {
+        if (node->length == length)
+        {
+            return node->values.empty() ? nullptr : &node->values;
+        }
+        node = node->child[Traits::BitAt(key, node->length)].get();
+    }
+    return nullptr;
+}
+
+} // namespace ns3
+
+#endif /* ROUTING_TRIE_H */
@@ -584,9 +584,10 @@ TcpL4Protocol::SendPacketV4(Ptr<Packet> packet,
                             const TcpHeader& outgoing,
                             const Ipv4Address& saddr,
                             const Ipv4Address& daddr,
-                            Ptr<NetDevice> oif) const
+                            Ptr<NetDevice> oif,
+                            uint32_t segmentSize) const
 {
-    NS_LOG_FUNCTION(this << packet << saddr << daddr << oif);
+    NS_LOG_FUNCTION(this << packet << saddr << daddr << oif << segmentSize);
     NS_LOG_LOGIC("TcpL4Protocol " << this << " sending seq " << outgoing.GetSequenceNumber()
                                   << " ack " << outgoing.GetAckNumber() << " flags "
                                   << TcpHeader::FlagsToString(outgoing.GetFlags()) << " data size "
@@ -602,7 +603,16 @@ TcpL4Protocol::SendPacketV4(Ptr<Packet> packet,
     }
     outgoingHeader.InitializeChecksum(saddr, daddr, PROT_NUMBER);
 
-    packet->AddHeader(outgoingHeader);
+    std::vector<Ptr<Packet>> segments;
+    if (segmentSize > 0 && packet->GetSize() > segmentSize)
+    {
+        segments = Segment(packet, outgoingHeader, segmentSize);
+        packet = segments.front();
+    }
+    else
+    {
+        packet->AddHeader(outgoingHeader);
+    }
 
     Ptr<Ipv4> ipv4 = m_node->GetObject<Ipv4>();
     if (ipv4)
@@ -622,7 +632,18 @@ TcpL4Protocol::SendPacketV4(Ptr<Packet> packet,
             NS_LOG_ERROR("No IPV4 Routing Protocol");
             route = nullptr;
         }
-        m_downTarget(packet, saddr, daddr, PROT_NUMBER, route);
+        if (segments.empty())
+        {
+            m_downTarget(packet, saddr, daddr, PROT_NUMBER, route);
+        }
+        else
+        {
+            // All the segments follow the route of the first one
+            for (const auto& segment : segments)
+            {
+                m_downTarget(segment, saddr, daddr, PROT_NUMBER, route);
+            }
+        }
     }
     else
     {
@@ -635,9 +656,10 @@ TcpL4Protocol::SendPacketV6(Ptr<Packet> packet,
                             const TcpHeader& outgoing,
                             const Ipv6Address& saddr,
                             const Ipv6Address& daddr,
-                            Ptr<NetDevice> oif) const
+                            Ptr<NetDevice> oif,
+                            uint32_t segmentSize) const
 {
-    NS_LOG_FUNCTION(this << packet << saddr << daddr << oif);
+    NS_LOG_FUNCTION(this << packet << saddr << daddr << oif << segmentSize);
     NS_LOG_LOGIC("TcpL4Protocol " << this << " sending seq " << outgoing.GetSequenceNumber()
                                   << " ack " << outgoing.GetAckNumber() << " flags "
                                   << TcpHeader::FlagsToString(outgoing.GetFlags()) << " data size "
@@ -650,7 +672,8 @@ TcpL4Protocol::SendPacketV6(Ptr<Packet> packet,
                            outgoing,
                            saddr.GetIpv4MappedAddress(),
                            daddr.GetIpv4MappedAddress(),
-                           oif));
+                           oif,
+                           segmentSize));
     }
     TcpHeader outgoingHeader = outgoing;
     /** \todo UrgentPointer */
@@ -661,7 +684,16 @@ TcpL4Protocol::SendPacketV6(Ptr<Packet> packet,
     }
     outgoingHeader.InitializeChecksum(saddr, daddr, PROT_NUMBER);
 
-    packet->AddHeader(outgoingHeader);
+    std::vector<Ptr<Packet>> segments;
+    if (segmentSize > 0 && packet->GetSize() > segmentSize)
+    {
+        segments = Segment(packet, outgoingHeader, segmentSize);
+        packet = segments.front();
+    }
+    else
+    {
+        packet->AddHeader(outgoingHeader);
+    }
 
     Ptr<Ipv6L3Protocol> ipv6 = m_node->GetObject<Ipv6L3Protocol>();
     if (ipv6)
@@ -681,7 +713,18 @@ TcpL4Protocol::SendPacketV6(Ptr<Packet> packet,
             NS_LOG_ERROR("No IPV6 Routing Protocol");
             route = nullptr;
         }
-        m_downTarget6(packet, saddr, daddr, PROT_NUMBER, route);
+        if (segments.empty())
+        {
+            m_downTarget6(packet, saddr, daddr, PROT_NUMBER, route);
+        }
+        else
+        {
+            // All the segments follow the route of the first one
+            for (const auto& segment : segments)
+            {
+                m_downTarget6(segment, saddr, daddr, PROT_NUMBER, route);
+            }
+        }
     }
     else
     {
@@ -689,14 +732,48 @@ TcpL4Protocol::SendPacketV6(Ptr<Packet> packet,
     }
 }
 
+std::vector<Ptr<Packet>>
+TcpL4Protocol::Segment(Ptr<Packet> packet, const TcpHeader& outgoing, uint32_t segmentSize) const
+{
+    NS_LOG_FUNCTION(this << packet << outgoing << segmentSize);
+    NS_ASSERT(segmentSize > 0);
+
+    std::vector<Ptr<Packet>> segments;
+    uint32_t size = packet->GetSize();
+    segments.reserve((size + segmentSize - 1) / segmentSize);
+    for (uint32_t offset = 0; offset < size; offset += segmentSize)
+    {
+        uint32_t length = std::min(segmentSize, size - offset);
+        Ptr<Packet> segment = packet->CreateFragment(offset, length);
+        TcpHeader header = outgoing;
+        header.SetSequenceNumber(outgoing.GetSequenceNumber() + SequenceNumber32(offset));
+        uint8_t flags = outgoing.GetFlags();
+        if (offset > 0)
+        {
+            flags &= ~TcpHeader::CWR;
+        }
+        if (offset + length < size)
+        {
+            flags &= ~TcpHeader::FIN;
+        }
+        header.SetFlags(flags);
+        segment->AddHeader(header);
+        segments.push_back(segment);
+    }
+    NS_LOG_LOGIC("Super-segment of size " << size << " split in " << segments.size()
+                                          << " segments");
+    return segments;
+}
+
 void
 TcpL4Protocol::SendPacket(Ptr<Packet> pkt,
                           const TcpHeader& outgoing,
                           const Address& saddr,
                           const Address& daddr,
-                          Ptr<NetDevice> oif) const
+                          Ptr<NetDevice> oif,
+                          uint32_t segmentSize) const
 {
-    NS_LOG_FUNCTION(this << pkt << outgoing << saddr << daddr << oif);
+    NS_LOG_FUNCTION(this << pkt << outgoing << saddr << daddr << oif << segmentSize);
     if (Ipv4Address::IsMatchingType(saddr))
     {
         NS_ASSERT(Ipv4Address::IsMatchingType(daddr));
@@ -705,7 +782,8 @@ TcpL4Protocol::SendPacket(Ptr<Packet> pkt,
                      outgoing,
                      Ipv4Address::ConvertFrom(saddr),
                      Ipv4Address::ConvertFrom(daddr),
-                     oif);
+                     oif,
+                     segmentSize);
 
         return;
     }
@@ -717,7 +795,8 @@ TcpL4Protocol::SendPacket(Ptr<Packet> pkt,
                      outgoing,
                      Ipv6Address::ConvertFrom(saddr),
                      Ipv6Address::ConvertFrom(daddr),
-                     oif);
+                     oif,
+                     segmentSize);
 
         return;
     }
@@ -726,7 +805,7 @@ TcpL4Protocol::SendPacket(Ptr<Packet> pkt,
         InetSocketAddress s = InetSocketAddress::ConvertFrom(saddr);
         InetSocketAddress d = InetSocketAddress::ConvertFrom(daddr);
 
-        SendPacketV4(pkt, outgoing, s.GetIpv4(), d.GetIpv4(), oif);
+        SendPacketV4(pkt, outgoing, s.GetIpv4(), d.GetIpv4(), oif, segmentSize);
 
         return;
     }
@@ -735,7 +814,7 @@ TcpL4Protocol::SendPacket(Ptr<Packet> pkt,
         Inet6SocketAddress s = Inet6SocketAddress::ConvertFrom(saddr);
         Inet6SocketAddress d = Inet6SocketAddress::ConvertFrom(daddr);
 
-        SendPacketV6(pkt, outgoing, s.GetIpv6(), d.GetIpv6(), oif);
+        SendPacketV6(pkt, outgoing, s.GetIpv6(), d.GetIpv6(), oif, segmentSize);
 
         return;
     }
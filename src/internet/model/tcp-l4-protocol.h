@@ -27,6 +27,7 @@
 #include "ns3/sequence-number.h"
 
 #include <stdint.h>
+#include <vector>
 
 namespace ns3
 {
@@ -221,12 +222,15 @@ class TcpL4Protocol : public IpL4Protocol
      * \param saddr The source Ipv4Address
      * \param daddr The destination Ipv4Address
      * \param oif The output interface bound. Defaults to null (unspecified).
+     * \param segmentSize If not zero and smaller than the packet, the packet is a
+     * super-segment that is split in segments of this size (generic segmentation offload)
      */
     void SendPacket(Ptr<Packet> pkt,
                     const TcpHeader& outgoing,
                     const Address& saddr,
                     const Address& daddr,
-                    Ptr<NetDevice> oif = nullptr) const;
+                    Ptr<NetDevice> oif = nullptr,
+                    uint32_t segmentSize = 0) const;
 
     /**
      * \brief Make a socket fully operational
@@ -352,12 +356,15 @@ class TcpL4Protocol : public IpL4Protocol
      * \param saddr The source Ipv4Address
      * \param daddr The destination Ipv4Address
      * \param oif The output interface bound. Defaults to null (unspecified).
+     * \param segmentSize If not zero and smaller than the packet, the packet is a
+     * super-segment that is split in segments of this size (generic segmentation offload)
      */
     void SendPacketV4(Ptr<Packet> pkt,
                       const TcpHeader& outgoing,
                       const Ipv4Address& saddr,
                       const Ipv4Address& daddr,
-                      Ptr<NetDevice> oif = nullptr) const;
+                      Ptr<NetDevice> oif = nullptr,
+                      uint32_t segmentSize = 0) const;
 
     /**
      * \brief Send a packet via TCP (IPv6)
@@ -367,12 +374,31 @@ class TcpL4Protocol : public IpL4Protocol
      * \param saddr The source Ipv4Address
      * \param daddr The destination Ipv4Address
      * \param oif The output interface bound. Defaults to null (unspecified).
+     * \param segmentSize If not zero and smaller than the packet, the packet is a
+     * super-segment that is split in segments of this size (generic segmentation offload)
      */
     void SendPacketV6(Ptr<Packet> pkt,
                       const TcpHeader& outgoing,
                       const Ipv6Address& saddr,
                       const Ipv6Address& daddr,
-                      Ptr<NetDevice> oif = nullptr) const;
+                      Ptr<NetDevice> oif = nullptr,
+                      uint32_t segmentSize = 0) const;
+
+    /**
+     * \brief Split a super-segment in segments of a given size
+     *
+     * Each segment gets a copy of the header with the corresponding sequence
+     * number. The CWR flag is kept only in the first segment, and the FIN flag
+     * only in the last one.
+     *
+     * \param packet The payload of the super-segment
+     * \param outgoing The header of the super-segment
+     * \param segmentSize The maximum size of the payload of each segment
+     * \returns the segments, headers included
+     */
+    std::vector<Ptr<Packet>> Segment(Ptr<Packet> packet,
+                                     const TcpHeader& outgoing,
+                                     uint32_t segmentSize) const;
 };
 
 } // namespace ns3
@@ -171,8 +171,25 @@ TcpRxBuffer::Add(Ptr<Packet> p, const TcpHeader& tcph)
             headSeq = tailSeq;
         }
     }
-    // Remove overlapped bytes from packet
-    BufIterator i = m_data.begin();
+    if (headSeq >= tailSeq)
+    {
+        NS_LOG_LOGIC("Nothing to buffer");
+        return false;
+    }
+    // Fast path for duplicates: data entirely covered by a range already in the buffer
+    auto range = m_ranges.upper_bound(headSeq);
+    if (range != m_ranges.begin() && std::prev(range)->second >= tailSeq)
+    {
+        NS_LOG_LOGIC("Nothing to buffer, data already received");
+        return false;
+    }
+    // Remove overlapped bytes from packet. The scan starts from the last packet
+    // starting at or before headSeq, as the packets before cannot overlap.
+    BufIterator i = m_data.upper_bound(headSeq);
+    if (i != m_data.begin())
+    {
+        --i;
+    }
     while (i != m_data.end() && i->first <= tailSeq)
     {
         SequenceNumber32 lastByteSeq = i->first + SequenceNumber32(i->second->GetSize());
@@ -211,6 +228,7 @@ TcpRxBuffer::Add(Ptr<Packet> p, const TcpHeader& tcph)
     // Insert packet into buffer
     NS_ASSERT(m_data.find(headSeq) == m_data.end()); // Shouldn't be there yet
     m_data[headSeq] = p;
+    AddRange(headSeq, tailSeq);
 
     if (headSeq > m_nextRxSeq)
     {
@@ -221,18 +239,14 @@ TcpRxBuffer::Add(Ptr<Packet> p, const TcpHeader& tcph)
     NS_LOG_LOGIC("Buffered packet of seqno=" << headSeq << " len=" << p->GetSize());
     // Update variables
     m_size += p->GetSize(); // Occupancy
-    for (i = m_data.begin(); i != m_data.end(); ++i)
+    if (m_data.find(m_nextRxSeq) != m_data.end())
     {
-        if (i->first < m_nextRxSeq)
-        {
-            continue;
-        }
-        else if (i->first > m_nextRxSeq)
-        {
-            break;
-        };
-        m_nextRxSeq = i->first + SequenceNumber32(i->second->GetSize());
-        m_availBytes += i->second->GetSize();
+        // The data starting at m_nextRxSeq is now in the buffer: all the
+        // range containing it becomes available
+        range = std::prev(m_ranges.upper_bound(m_nextRxSeq));
+        NS_ASSERT(range->first <= m_nextRxSeq && range->second > m_nextRxSeq);
+        m_availBytes += static_cast<uint32_t>(range->second - m_nextRxSeq);
+        m_nextRxSeq = range->second;
         ClearSackList(m_nextRxSeq);
     }
     NS_LOG_LOGIC("Updated buffer occupancy=" << m_size << " nextRxSeq=" << m_nextRxSeq);
@@ -370,6 +384,29 @@ TcpRxBuffer::ClearSackList(const SequenceNumber32& seq)
     }
 }
 
+void
+TcpRxBuffer::AddRange(const SequenceNumber32& head, const SequenceNumber32& tail)
+{
+    NS_LOG_FUNCTION(this << head << tail);
+
+    SequenceNumber32 first = head;
+    SequenceNumber32 last = tail;
+    auto it = m_ranges.upper_bound(head);
+    if (it != m_ranges.begin() && std::prev(it)->second >= head)
+    {
+        // Coalesce with the range preceding (or containing) head
+        --it;
+        first = it->first;
+    }
+    while (it != m_ranges.end() && it->first <= tail)
+    {
+        // Coalesce with the ranges overlapping or adjacent to the block
+        last = std::max(last, it->second);
+        it = m_ranges.erase(it);
+    }
+    m_ranges.emplace_hint(it, first, last);
+}
+
 TcpOptionSack::SackList
 TcpRxBuffer::GetSackList() const
 {
@@ -389,6 +426,7 @@ TcpRxBuffer::Extract(uint32_t maxSize)
         return nullptr; // No contiguous block to return
     }
     NS_ASSERT(m_data.size());              // At least we have something to extract
+    NS_ASSERT(m_ranges.begin()->first == m_data.begin()->first);
     Ptr<Packet> outPkt = Create<Packet>(); // The packet that contains all the data to return
     BufIterator i;
     while (extractSize)
@@ -416,6 +454,25 @@ TcpRxBuffer::Extract(uint32_t maxSize)
             extractSize = 0;
         }
     }
+    // Remove the extracted data from the ranges
+    if (m_data.empty())
+    {
+        m_ranges.clear();
+    }
+    else
+    {
+        SequenceNumber32 first = m_data.begin()->first;
+        while (m_ranges.begin()->second <= first)
+        {
+            m_ranges.erase(m_ranges.begin());
+        }
+        if (m_ranges.begin()->first < first)
+        {
+            SequenceNumber32 last = m_ranges.begin()->second;
+            m_ranges.erase(m_ranges.begin());
+            m_ranges.emplace(first, last);
+        }
+    }
     if (outPkt->GetSize() == 0)
     {
         NS_LOG_LOGIC("Nothing extracted.");
@@ -219,6 +219,16 @@ class TcpRxBuffer : public Object
      */
     void ClearSackList(const SequenceNumber32& seq);
 
+    /**
+     * \brief Add a block of data to the set of ranges covered by the buffer
+     *
+     * The block is coalesced with the ranges it overlaps or is adjacent to.
+     *
+     * \param head sequence number of the first byte of the block
+     * \param tail sequence number following the last byte of the block
+     */
+    void AddRange(const SequenceNumber32& head, const SequenceNumber32& tail);
+
     TcpOptionSack::SackList m_sackList; //!< Sack list (updated constantly)
 
     /// container for data stored in the buffer
@@ -231,6 +241,8 @@ class TcpRxBuffer : public Object
     uint32_t m_maxBuffer;  //!< Upper bound of the number of data bytes in buffer (RCV.WND)
     uint32_t m_availBytes; //!< Number of bytes available to read, i.e. contiguous block at head
     std::map<SequenceNumber32, Ptr<Packet>> m_data; //!< Corresponding data (may be null)
+    /// Contiguous ranges of data in the buffer, from first to last (excluded) sequence number
+    std::map<SequenceNumber32, SequenceNumber32> m_ranges;
 };
 
 } // namespace ns3
@@ -163,6 +163,13 @@ TcpSocketBase::GetTypeId()
                           BooleanValue(true),
                           MakeBooleanAccessor(&TcpSocketBase::m_limitedTx),
                           MakeBooleanChecker())
+            .AddAttribute("GsoMaxSize",
+                          "Maximum size of the super-segments passed to TcpL4Protocol, which "
+                          "splits them in segments of one MSS (generic segmentation "
+                          "offload). 0 disables GSO.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&TcpSocketBase::m_gsoMaxSize),
+                          MakeUintegerChecker<uint32_t>(0, 65535))
             .AddAttribute("UseEcn",
                           "Parameter to set ECN functionality",
                           EnumValue(TcpSocketState::Off),
@@ -374,6 +381,8 @@ TcpSocketBase::TcpSocketBase(const TcpSocketBase& sock)
       m_txTrace(sock.m_txTrace),
       m_rxTrace(sock.m_rxTrace),
       m_pacingTimer(Timer::CANCEL_ON_DESTROY),
+      m_pacingCalendar(sock.m_pacingCalendar),
+      m_gsoMaxSize(sock.m_gsoMaxSize),
       m_ecnEchoSeq(sock.m_ecnEchoSeq),
       m_ecnCESeq(sock.m_ecnCESeq),
       m_ecnCWRSeq(sock.m_ecnCWRSeq)
@@ -496,6 +505,8 @@ void
 TcpSocketBase::SetNode(Ptr<Node> node)
 {
     m_node = node;
+    // use the pacing calendar of the node, if any
+    m_pacingCalendar = node ? node->GetObject<PacingCalendar>() : nullptr;
 }
 
 /* Associate the L4 protocol (e.g. mux/demux) with this socket */
@@ -3139,12 +3150,12 @@ TcpSocketBase::SendDataPacket(SequenceNumber32 seq, uint32_t maxSize, bool withA
     if (IsPacingEnabled())
     {
         NS_LOG_INFO("Pacing is enabled");
-        if (m_pacingTimer.IsExpired())
+        if (!IsPacingTimerRunning())
         {
             NS_LOG_DEBUG("Current Pacing Rate " << m_tcb->m_pacingRate);
             NS_LOG_DEBUG("Timer is in expired state, activate it "
                          << m_tcb->m_pacingRate.Get().CalculateBytesTxTime(sz));
-            m_pacingTimer.Schedule(m_tcb->m_pacingRate.Get().CalculateBytesTxTime(sz));
+            StartPacingTimer(m_tcb->m_pacingRate.Get().CalculateBytesTxTime(sz));
         }
         else
         {
@@ -3172,8 +3183,6 @@ TcpSocketBase::SendDataPacket(SequenceNumber32 seq, uint32_t maxSize, bool withA
         NS_LOG_INFO("CWR flags set");
     }
 
-    AddSocketTags(p);
-
     if (m_closeOnEmpty && (remainingData == 0))
     {
         flags |= TcpHeader::FIN;
@@ -3188,6 +3197,39 @@ TcpSocketBase::SendDataPacket(SequenceNumber32 seq, uint32_t maxSize, bool withA
             m_state = LAST_ACK;
         }
     }
+
+    // With GSO, a full-sized segment can be extended by the following one.
+    // The header (and its options) of the first segment is used for the
+    // whole super-segment: TcpL4Protocol keeps CWR only in the first segment,
+    // and FIN only in the last one.
+    if (m_gsoPacket && seq == m_gsoHeader.GetSequenceNumber() + m_gsoPacket->GetSize() &&
+        m_gsoPacket->GetSize() % m_tcb->m_segmentSize == 0 &&
+        m_gsoPacket->GetSize() + sz <= m_gsoMaxSize &&
+        (m_gsoHeader.GetFlags() & TcpHeader::FIN) == 0 && (flags & TcpHeader::CWR) == 0)
+    {
+        NS_LOG_DEBUG("Segment of size " << sz << " added to the GSO super-segment");
+        m_gsoPacket->AddAtEnd(p);
+        m_gsoHeader.SetFlags(m_gsoHeader.GetFlags() | (flags & TcpHeader::FIN));
+        UpdateRttHistory(seq, sz, isRetransmission);
+        if (m_tcb->m_congState == TcpSocketState::CA_RECOVERY ||
+            m_tcb->m_congState == TcpSocketState::CA_CWR)
+        {
+            m_recoveryOps->UpdateBytesSent(sz);
+        }
+        if (!isRetransmission)
+        {
+            m_gsoDataSent += seq + sz - m_tcb->m_highTxMark.Get();
+        }
+        m_tcb->m_highTxMark = std::max(seq + sz, m_tcb->m_highTxMark.Get());
+        return sz;
+    }
+    SendGsoSegment();
+
+    if (!m_gsoBatching)
+    {
+        AddSocketTags(p);
+    }
+
     TcpHeader header;
     header.SetFlags(flags);
     header.SetSequenceNumber(seq);
@@ -3215,29 +3257,42 @@ TcpSocketBase::SendDataPacket(SequenceNumber32 seq, uint32_t maxSize, bool withA
         m_retxEvent = Simulator::Schedule(m_rto, &TcpSocketBase::ReTxTimeout, this);
     }
 
-    m_txTrace(p, header, this);
-
-    if (m_endPoint)
+    if (m_gsoBatching)
     {
-        m_tcp->SendPacket(p,
-                          header,
-                          m_endPoint->GetLocalAddress(),
-                          m_endPoint->GetPeerAddress(),
-                          m_boundnetdevice);
-        NS_LOG_DEBUG("Send segment of size "
-                     << sz << " with remaining data " << remainingData << " via TcpL4Protocol to "
-                     << m_endPoint->GetPeerAddress() << ". Header " << header);
+        // Start a new super-segment, sent by SendPendingData
+        NS_LOG_DEBUG("Segment of size " << sz << " starts a GSO super-segment");
+        m_gsoPacket = Create<Packet>();
+        m_gsoPacket->AddAtEnd(p);
+        m_gsoHeader = header;
     }
     else
     {
-        m_tcp->SendPacket(p,
-                          header,
-                          m_endPoint6->GetLocalAddress(),
-                          m_endPoint6->GetPeerAddress(),
-                          m_boundnetdevice);
-        NS_LOG_DEBUG("Send segment of size "
-                     << sz << " with remaining data " << remainingData << " via TcpL4Protocol to "
-                     << m_endPoint6->GetPeerAddress() << ". Header " << header);
+        m_txTrace(p, header, this);
+
+        if (m_endPoint)
+        {
+            m_tcp->SendPacket(p,
+                              header,
+                              m_endPoint->GetLocalAddress(),
+                              m_endPoint->GetPeerAddress(),
+                              m_boundnetdevice);
+            NS_LOG_DEBUG("Send segment of size " << sz << " with remaining data "
+                                                 << remainingData << " via TcpL4Protocol to "
+                                                 << m_endPoint->GetPeerAddress() << ". Header "
+                                                 << header);
+        }
+        else
+        {
+            m_tcp->SendPacket(p,
+                              header,
+                              m_endPoint6->GetLocalAddress(),
+                              m_endPoint6->GetPeerAddress(),
+                              m_boundnetdevice);
+            NS_LOG_DEBUG("Send segment of size " << sz << " with remaining data "
+                                                 << remainingData << " via TcpL4Protocol to "
+                                                 << m_endPoint6->GetPeerAddress() << ". Header "
+                                                 << header);
+        }
     }
 
     UpdateRttHistory(seq, sz, isRetransmission);
@@ -3252,15 +3307,70 @@ TcpSocketBase::SendDataPacket(SequenceNumber32 seq, uint32_t maxSize, bool withA
     // Notify the application of the data being sent unless this is a retransmit
     if (!isRetransmission)
     {
-        Simulator::ScheduleNow(&TcpSocketBase::NotifyDataSent,
-                               this,
-                               (seq + sz - m_tcb->m_highTxMark.Get()));
+        if (m_gsoBatching)
+        {
+            m_gsoDataSent += seq + sz - m_tcb->m_highTxMark.Get();
+        }
+        else
+        {
+            Simulator::ScheduleNow(&TcpSocketBase::NotifyDataSent,
+                                   this,
+                                   (seq + sz - m_tcb->m_highTxMark.Get()));
+        }
     }
     // Update highTxMark
     m_tcb->m_highTxMark = std::max(seq + sz, m_tcb->m_highTxMark.Get());
     return sz;
 }
 
+bool
+TcpSocketBase::IsGsoEnabled() const
+{
+    return m_gsoMaxSize > m_tcb->m_segmentSize && !m_tcb->m_pacing;
+}
+
+void
+TcpSocketBase::SendGsoSegment()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_gsoPacket)
+    {
+        return;
+    }
+    Ptr<Packet> p = m_gsoPacket;
+    m_gsoPacket = nullptr;
+    AddSocketTags(p);
+    m_txTrace(p, m_gsoHeader, this);
+
+    NS_LOG_DEBUG("Send GSO super-segment of size " << p->GetSize() << " via TcpL4Protocol. Header "
+                                                   << m_gsoHeader);
+    if (m_endPoint)
+    {
+        m_tcp->SendPacket(p,
+                          m_gsoHeader,
+                          m_endPoint->GetLocalAddress(),
+                          m_endPoint->GetPeerAddress(),
+                          m_boundnetdevice,
+                          m_tcb->m_segmentSize);
+    }
+    else
+    {
+        m_tcp->SendPacket(p,
+                          m_gsoHeader,
+                          m_endPoint6->GetLocalAddress(),
+                          m_endPoint6->GetPeerAddress(),
+                          m_boundnetdevice,
+                          m_tcb->m_segmentSize);
+    }
+
+    if (m_gsoDataSent > 0)
+    {
+        Simulator::ScheduleNow(&TcpSocketBase::NotifyDataSent, this, m_gsoDataSent);
+        m_gsoDataSent = 0;
+    }
+}
+
 void
 TcpSocketBase::UpdateRttHistory(const SequenceNumber32& seq, uint32_t sz, bool isRetransmission)
 {
@@ -3303,6 +3413,12 @@ TcpSocketBase::SendPendingData(bool withAck)
 
     uint32_t nPacketsSent = 0;
     uint32_t availableWindow = AvailableWindow();
+    // Collect the segments in GSO super-segments, unless this is a nested call
+    bool startGso = IsGsoEnabled() && !m_gsoBatching;
+    if (startGso)
+    {
+        m_gsoBatching = true;
+    }
 
     // RFC 6675, Section (C)
     // If cwnd - pipe >= 1 SMSS, the sender SHOULD transmit one or more
@@ -3314,9 +3430,9 @@ TcpSocketBase::SendPendingData(bool withAck)
         if (IsPacingEnabled())
         {
             NS_LOG_INFO("Pacing is enabled");
-            if (m_pacingTimer.IsRunning())
+            if (IsPacingTimerRunning())
             {
-                NS_LOG_INFO("Skipping Packet due to pacing" << m_pacingTimer.GetDelayLeft());
+                NS_LOG_INFO("Skipping Packet due to pacing");
                 break;
             }
             NS_LOG_INFO("Timer is not running");
@@ -3405,12 +3521,12 @@ TcpSocketBase::SendPendingData(bool withAck)
             if (IsPacingEnabled())
             {
                 NS_LOG_INFO("Pacing is enabled");
-                if (m_pacingTimer.IsExpired())
+                if (!IsPacingTimerRunning())
                 {
                     NS_LOG_DEBUG("Current Pacing Rate " << m_tcb->m_pacingRate);
                     NS_LOG_DEBUG("Timer is in expired state, activate it "
                                  << m_tcb->m_pacingRate.Get().CalculateBytesTxTime(sz));
-                    m_pacingTimer.Schedule(m_tcb->m_pacingRate.Get().CalculateBytesTxTime(sz));
+                    StartPacingTimer(m_tcb->m_pacingRate.Get().CalculateBytesTxTime(sz));
                     break;
                 }
             }
@@ -3427,6 +3543,12 @@ TcpSocketBase::SendPendingData(bool withAck)
         // loop again!
     }
 
+    if (startGso)
+    {
+        SendGsoSegment();
+        m_gsoBatching = false;
+    }
+
     if (nPacketsSent > 0)
     {
         if (!m_sackEnabled)
@@ -3838,7 +3960,7 @@ TcpSocketBase::ReTxTimeout()
     m_tcb->m_cWnd = m_tcb->m_segmentSize;
     m_tcb->m_cWndInfl = m_tcb->m_cWnd;
 
-    m_pacingTimer.Cancel();
+    CancelPacingTimer();
 
     NS_LOG_DEBUG("RTO. Reset cwnd to " << m_tcb->m_cWnd << ", ssthresh to " << m_tcb->m_ssThresh
                                        << ", restart from seqnum " << m_txBuffer->HeadSequence()
@@ -4000,7 +4122,7 @@ TcpSocketBase::CancelAllTimers()
     m_lastAckEvent.Cancel();
     m_timewaitEvent.Cancel();
     m_sendPendingDataEvent.Cancel();
-    m_pacingTimer.Cancel();
+    CancelPacingTimer();
 }
 
 /* Move TCP to Time_Wait state and schedule a transition to Closed state */
@@ -4565,6 +4687,43 @@ TcpSocketBase::NotifyPacingPerformed()
     SendPendingData(m_connected);
 }
 
+bool
+TcpSocketBase::IsPacingTimerRunning() const
+{
+    if (m_pacingCalendar)
+    {
+        return m_pacingCalendar->IsPending(m_pacingRelease);
+    }
+    return m_pacingTimer.IsRunning();
+}
+
+void
+TcpSocketBase::StartPacingTimer(const Time& delay)
+{
+    NS_LOG_FUNCTION(this << delay);
+    if (m_pacingCalendar)
+    {
+        m_pacingRelease = m_pacingCalendar->Schedule(
+            delay,
+            MakeCallback(&TcpSocketBase::NotifyPacingPerformed, this));
+    }
+    else
+    {
+        m_pacingTimer.Schedule(delay);
+    }
+}
+
+void
+TcpSocketBase::CancelPacingTimer()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_pacingCalendar)
+    {
+        m_pacingCalendar->Cancel(m_pacingRelease);
+    }
+    m_pacingTimer.Cancel();
+}
+
 bool
 TcpSocketBase::IsPacingEnabled() const
 {
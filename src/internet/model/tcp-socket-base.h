@@ -24,7 +24,9 @@
 #include "ns3/ipv4-header.h"
 #include "ns3/ipv6-header.h"
 #include "ns3/node.h"
+#include "ns3/pacing-calendar.h"
 #include "ns3/sequence-number.h"
+#include "ns3/tcp-header.h"
 #include "ns3/tcp-socket-state.h"
 #include "ns3/tcp-socket.h"
 #include "ns3/timer.h"
@@ -41,7 +43,6 @@ class Ipv6EndPoint;
 class Node;
 class Packet;
 class TcpL4Protocol;
-class TcpHeader;
 class TcpCongestionOps;
 class TcpRecoveryOps;
 class RttEstimator;
@@ -808,6 +809,23 @@ class TcpSocketBase : public TcpSocket
      */
     virtual uint32_t SendDataPacket(SequenceNumber32 seq, uint32_t maxSize, bool withAck);
 
+    /**
+     * \brief Check if generic segmentation offload (GSO) can be used
+     *
+     * With GSO, the segments sent by a call to SendPendingData are collected
+     * in super-segments of at most GsoMaxSize bytes, which are split by
+     * TcpL4Protocol after the routing decision. GSO is not used when pacing
+     * is enabled.
+     *
+     * \returns true if GSO can be used
+     */
+    bool IsGsoEnabled() const;
+
+    /**
+     * \brief Send the pending GSO super-segment, if any, to TcpL4Protocol
+     */
+    void SendGsoSegment();
+
     /**
      * \brief Send a empty packet that carries a flag, e.g., ACK
      *
@@ -1241,6 +1259,28 @@ class TcpSocketBase : public TcpSocket
      */
     void NotifyPacingPerformed();
 
+    /**
+     * \brief Check whether the pacing timer is running
+     *
+     * If a PacingCalendar is aggregated to the node, the pacing timer is a
+     * release of the calendar, so that the paced sockets of the node share
+     * the events of the calendar slots.
+     *
+     * \return true if the pacing timer is running
+     */
+    bool IsPacingTimerRunning() const;
+
+    /**
+     * \brief Start the pacing timer
+     * \param delay the delay before the next transmission
+     */
+    void StartPacingTimer(const Time& delay);
+
+    /**
+     * \brief Cancel the pacing timer
+     */
+    void CancelPacingTimer();
+
     /**
      * \brief Return true if packets in the current window should be paced
      * \return true if pacing is currently enabled
@@ -1385,6 +1425,15 @@ class TcpSocketBase : public TcpSocket
 
     // Pacing related variable
     Timer m_pacingTimer{Timer::CANCEL_ON_DESTROY}; //!< Pacing Event
+    Ptr<PacingCalendar> m_pacingCalendar;          //!< Pacing calendar of the node, if any
+    PacingCalendar::ReleaseId m_pacingRelease{0};  //!< Pacing release, if the calendar is used
+
+    // Generic segmentation offload
+    uint32_t m_gsoMaxSize{0};  //!< Maximum size of a GSO super-segment (0 to disable GSO)
+    bool m_gsoBatching{false}; //!< Whether the segments are collected in a super-segment
+    Ptr<Packet> m_gsoPacket;   //!< Payload of the pending super-segment
+    TcpHeader m_gsoHeader;     //!< Header of the pending super-segment
+    uint32_t m_gsoDataSent{0}; //!< New data in the pending super-segment
 
     // Parameters related to Explicit Congestion Notification
     TracedValue<SequenceNumber32> m_ecnEchoSeq{
@@ -61,7 +61,8 @@ TcpTxBuffer::TcpTxBuffer(uint32_t n)
     : m_maxBuffer(32768),
       m_size(0),
       m_sentSize(0),
-      m_firstByteSeq(n)
+      m_firstByteSeq(n),
+      m_lostMarkedUpTo(n)
 {
     m_rWndCallback = MakeNullCallback<uint32_t>();
 }
@@ -177,6 +178,8 @@ TcpTxBuffer::SetHeadSequence(const SequenceNumber32& seq)
     // if you change the head with data already sent, something bad will happen
     NS_ASSERT(m_sentList.size() == 0);
     m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+    m_sentIndex.clear();
+    m_lostMarkedUpTo = seq;
 }
 
 bool
@@ -298,6 +301,7 @@ TcpTxBuffer::GetNewSegment(uint32_t numBytes)
 
     m_appList.erase(it);
     m_sentList.insert(m_sentList.end(), item);
+    m_sentIndex.emplace_hint(m_sentIndex.end(), item->m_startSeq, std::prev(m_sentList.end()));
     m_sentSize += item->m_packet->GetSize();
 
     return item;
@@ -311,41 +315,57 @@ TcpTxBuffer::GetTransmittedSegment(uint32_t numBytes, const SequenceNumber32& se
     NS_ASSERT(numBytes <= m_sentSize);
     NS_ASSERT(m_sentList.size() >= 1);
 
-    auto it = m_sentList.begin();
     bool listEdited = false;
     uint32_t s = numBytes;
 
     // Avoid to merge different packet for this retransmission if flags are
     // different.
-    for (; it != m_sentList.end(); ++it)
+    auto found = m_sentIndex.find(seq);
+    if (found != m_sentIndex.end())
     {
-        if ((*it)->m_startSeq == seq)
+        auto it = found->second;
+        auto next = it;
+        next++;
+        if (next != m_sentList.end())
         {
-            auto next = it;
-            next++;
-            if (next != m_sentList.end())
+            // Next is not sacked and have the same value for m_lost ... there is the
+            // possibility to merge
+            if ((!(*next)->m_sacked) && ((*it)->m_lost == (*next)->m_lost))
             {
-                // Next is not sacked and have the same value for m_lost ... there is the
-                // possibility to merge
-                if ((!(*next)->m_sacked) && ((*it)->m_lost == (*next)->m_lost))
-                {
-                    s = std::min(s, (*it)->m_packet->GetSize() + (*next)->m_packet->GetSize());
-                }
-                else
-                {
-                    // Next is sacked... better to retransmit only the first segment
-                    s = std::min(s, (*it)->m_packet->GetSize());
-                }
+                s = std::min(s, (*it)->m_packet->GetSize() + (*next)->m_packet->GetSize());
             }
             else
             {
+                // Next is sacked... better to retransmit only the first segment
                 s = std::min(s, (*it)->m_packet->GetSize());
             }
-            break;
+        }
+        else
+        {
+            s = std::min(s, (*it)->m_packet->GetSize());
         }
     }
 
-    TcpTxItem* item = GetPacketFromList(m_sentList, m_firstByteSeq, s, seq, &listEdited);
+    // Start the walk from the item preceding the one that contains seq: it is
+    // not edited, and the items before it do not need to be visited
+    auto containing = m_sentIndex.upper_bound(seq);
+    NS_ASSERT(containing != m_sentIndex.begin());
+    --containing;
+    PacketList::iterator startIt = m_sentList.end();
+    SequenceNumber32 startSeq = m_firstByteSeq;
+    if (containing != m_sentIndex.begin())
+    {
+        --containing;
+        startIt = containing->second;
+        startSeq = containing->first;
+    }
+
+    TcpTxItem* item = GetPacketFromList(m_sentList, startIt, startSeq, s, seq, &listEdited);
+
+    if (listEdited)
+    {
+        ReindexSentList(startIt, seq + s);
+    }
 
     if (!item->m_retrans)
     {
@@ -356,6 +376,24 @@ TcpTxBuffer::GetTransmittedSegment(uint32_t numBytes, const SequenceNumber32& se
     return item;
 }
 
+void
+TcpTxBuffer::ReindexSentList(PacketList::iterator startIt, const SequenceNumber32& lastSeq)
+{
+    NS_LOG_FUNCTION(this << lastSeq);
+    PacketList::iterator it = startIt == m_sentList.end() ? m_sentList.begin() : std::next(startIt);
+    if (it == m_sentList.end())
+    {
+        return;
+    }
+    // Items have been split or merged only in [(*it)->m_startSeq, lastSeq]
+    m_sentIndex.erase(m_sentIndex.lower_bound((*it)->m_startSeq),
+                      m_sentIndex.upper_bound(lastSeq));
+    for (; it != m_sentList.end() && (*it)->m_startSeq <= lastSeq; ++it)
+    {
+        m_sentIndex.emplace((*it)->m_startSeq, it);
+    }
+}
+
 std::pair<TcpTxBuffer::PacketList::const_iterator, SequenceNumber32>
 TcpTxBuffer::FindHighestSacked() const
 {
@@ -404,6 +442,17 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                                uint32_t numBytes,
                                const SequenceNumber32& seq,
                                bool* listEdited) const
+{
+    return GetPacketFromList(list, list.end(), listStartFrom, numBytes, seq, listEdited);
+}
+
+TcpTxItem*
+TcpTxBuffer::GetPacketFromList(PacketList& list,
+                               PacketList::iterator startIt,
+                               const SequenceNumber32& listStartFrom,
+                               uint32_t numBytes,
+                               const SequenceNumber32& seq,
+                               bool* listEdited) const
 {
     NS_LOG_FUNCTION(this << numBytes << seq);
 
@@ -437,14 +486,14 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
     Ptr<Packet> currentPacket = nullptr;
     TcpTxItem* currentItem = nullptr;
     TcpTxItem* outItem = nullptr;
-    PacketList::iterator it = list.begin();
+    PacketList::iterator it = startIt == list.end() ? list.begin() : startIt;
     SequenceNumber32 beginOfCurrentPacket = listStartFrom;
 
     while (it != list.end())
     {
         currentItem = *it;
         currentPacket = currentItem->m_packet;
-        NS_ASSERT_MSG(list != m_sentList || currentItem->m_startSeq >= m_firstByteSeq,
+        NS_ASSERT_MSG(&list != &m_sentList || currentItem->m_startSeq >= m_firstByteSeq,
                       "start: " << m_firstByteSeq
                                 << " currentItem start: " << currentItem->m_startSeq);
 
@@ -479,7 +528,7 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                     *listEdited = true;
                 }
 
-                return GetPacketFromList(list, listStartFrom, numBytes, seq, listEdited);
+                return GetPacketFromList(list, startIt, listStartFrom, numBytes, seq, listEdited);
             }
             else
             {
@@ -528,7 +577,12 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                         *listEdited = true;
                     }
 
-                    return GetPacketFromList(list, listStartFrom, numBytes, seq, listEdited);
+                    return GetPacketFromList(list,
+                                             startIt,
+                                             listStartFrom,
+                                             numBytes,
+                                             seq,
+                                             listEdited);
                 }
             }
             else if (numBytes < currentPacket->GetSize())
@@ -577,7 +631,7 @@ TcpTxBuffer::GetPacketFromList(PacketList& list,
                 *listEdited = true;
             }
 
-            return GetPacketFromList(list, listStartFrom, numBytes, seq, listEdited);
+            return GetPacketFromList(list, startIt, listStartFrom, numBytes, seq, listEdited);
         }
     }
 
@@ -652,16 +706,17 @@ bool
 TcpTxBuffer::IsRetransmittedDataAcked(const SequenceNumber32& ack) const
 {
     NS_LOG_FUNCTION(this);
-    for (const auto& it : m_sentList)
+    // The only item that can end at ack is the one preceding the first item
+    // starting at or after ack
+    auto it = m_sentIndex.lower_bound(ack);
+    if (it == m_sentIndex.begin())
     {
-        TcpTxItem* item = it;
-        Ptr<Packet> p = item->m_packet;
-        if (item->m_startSeq + p->GetSize() == ack && !item->m_sacked && item->m_retrans)
-        {
-            return true;
-        }
+        return false;
     }
-    return false;
+    --it;
+    TcpTxItem* item = *(it->second);
+    Ptr<Packet> p = item->m_packet;
+    return item->m_startSeq + p->GetSize() == ack && !item->m_sacked && item->m_retrans;
 }
 
 void
@@ -709,6 +764,7 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
 
             RemoveFromCounts(item, pktSize);
 
+            m_sentIndex.erase(m_sentIndex.begin());
             i = m_sentList.erase(i);
             NS_LOG_INFO("Removed " << *item << " lost: " << m_lostOut << " retrans: " << m_retrans
                                    << " sacked: " << m_sackedOut << ". Remaining data " << m_size);
@@ -727,7 +783,9 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
             NS_LOG_INFO(*item);
             // PacketTags are preserved when fragmenting
             item->m_packet = item->m_packet->CreateFragment(offset, pktSize);
+            m_sentIndex.erase(m_sentIndex.begin());
             item->m_startSeq += offset;
+            m_sentIndex.emplace_hint(m_sentIndex.begin(), item->m_startSeq, i);
             m_size -= offset;
             m_sentSize -= offset;
             m_firstByteSeq += offset;
@@ -772,6 +830,11 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
         m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
     }
 
+    if (m_lostMarkedUpTo < m_firstByteSeq)
+    {
+        m_lostMarkedUpTo = m_firstByteSeq;
+    }
+
     NS_LOG_DEBUG("Discarded up to " << seq << " lost: " << m_lostOut << " retrans: " << m_retrans
                                     << " sacked: " << m_sackedOut);
     NS_LOG_LOGIC("Buffer status after discarding data " << *this);
@@ -790,15 +853,22 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
 
     for (auto option_it = list.begin(); option_it != list.end(); ++option_it)
     {
-        PacketList::iterator item_it = m_sentList.begin();
-        SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-
         if (m_firstByteSeq + m_sentSize < (*option_it).first)
         {
             NS_LOG_INFO("Not updating scoreboard, the option block is outside the sent list");
             return bytesSacked;
         }
 
+        // Items starting before the block cannot be sacked by it: start from
+        // the first item starting inside the block
+        auto index_it = m_sentIndex.lower_bound((*option_it).first);
+        if (index_it == m_sentIndex.end())
+        {
+            continue;
+        }
+        PacketList::iterator item_it = index_it->second;
+        SequenceNumber32 beginOfCurrentPacket = index_it->first;
+
         while (item_it != m_sentList.end())
         {
             uint32_t pktSize = (*item_it)->m_packet->GetSize();
@@ -879,6 +949,8 @@ TcpTxBuffer::UpdateLostCount()
 {
     NS_LOG_FUNCTION(this);
     uint32_t sacked = 0;
+    bool thresholdReached = false;
+    SequenceNumber32 lostMarkedUpTo = m_lostMarkedUpTo;
     SequenceNumber32 beginOfCurrentPacket = m_highestSack.second;
     if (m_highestSack.first == m_sentList.end())
     {
@@ -901,6 +973,18 @@ TcpTxBuffer::UpdateLostCount()
 
         if (sacked >= m_dupAckThresh)
         {
+            if (item->m_startSeq < lostMarkedUpTo)
+            {
+                // This segment and all the ones below it are already either
+                // lost or sacked
+                break;
+            }
+            if (!thresholdReached)
+            {
+                // All the segments from this one downwards end up either lost or sacked
+                thresholdReached = true;
+                m_lostMarkedUpTo = item->m_startSeq;
+            }
             if (!item->m_sacked && !item->m_lost)
             {
                 item->m_lost = true;
@@ -928,35 +1012,31 @@ TcpTxBuffer::IsLost(const SequenceNumber32& seq) const
 {
     NS_LOG_FUNCTION(this << seq);
 
-    SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-    PacketList::const_iterator it;
-
     if (seq >= m_highestSack.second)
     {
         return false;
     }
 
-    // In theory, using a map and hints when inserting elements can improve
-    // performance
-    for (it = m_sentList.begin(); it != m_sentList.end(); ++it)
+    // Search for the first item starting at or after seq
+    auto index_it = m_sentIndex.lower_bound(seq);
+    if (index_it == m_sentIndex.end())
     {
-        // Search for the right iterator before calling IsLost()
-        if (beginOfCurrentPacket >= seq)
-        {
-            if ((*it)->m_lost == true)
-            {
-                NS_LOG_INFO("seq=" << seq << " is lost because of lost flag");
-                return true;
-            }
+        return false;
+    }
 
-            if ((*it)->m_sacked == true)
-            {
-                NS_LOG_INFO("seq=" << seq << " is not lost because of sacked flag");
-                return false;
-            }
+    for (PacketList::const_iterator it = index_it->second; it != m_sentList.end(); ++it)
+    {
+        if ((*it)->m_lost == true)
+        {
+            NS_LOG_INFO("seq=" << seq << " is lost because of lost flag");
+            return true;
         }
 
-        beginOfCurrentPacket += (*it)->m_packet->GetSize();
+        if ((*it)->m_sacked == true)
+        {
+            NS_LOG_INFO("seq=" << seq << " is not lost because of sacked flag");
+            return false;
+        }
     }
 
     return false;
@@ -1226,6 +1306,7 @@ TcpTxBuffer::ResetRenoSack()
     }
 
     m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+    m_lostMarkedUpTo = m_firstByteSeq;
 }
 
 void
@@ -1255,6 +1336,8 @@ TcpTxBuffer::ResetSentList()
     m_retrans = 0;
     m_sackedOut = 0;
     m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+    m_sentIndex.clear();
+    m_lostMarkedUpTo = m_firstByteSeq;
 }
 
 void
@@ -1265,8 +1348,13 @@ TcpTxBuffer::ResetLastSegmentSent()
     {
         TcpTxItem* item = m_sentList.back();
 
+        m_sentIndex.erase(std::prev(m_sentIndex.end()));
         m_sentList.pop_back();
         m_sentSize -= item->m_packet->GetSize();
+        if (m_lostMarkedUpTo > item->m_startSeq)
+        {
+            m_lostMarkedUpTo = item->m_startSeq;
+        }
         if (item->m_retrans)
         {
             m_retrans -= item->m_packet->GetSize();
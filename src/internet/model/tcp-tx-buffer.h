@@ -27,6 +27,8 @@
 #include "ns3/tcp-tx-item.h"
 #include "ns3/traced-value.h"
 
+#include <map>
+
 namespace ns3
 {
 class Packet;
@@ -412,6 +414,12 @@ class TcpTxBuffer : public Object
 
     typedef std::list<TcpTxItem*> PacketList; //!< container for data stored in the buffer
 
+    /**
+     * \brief Index of the sent list, mapping the starting sequence number of
+     * each item to its position in the list
+     */
+    typedef std::map<SequenceNumber32, PacketList::iterator> SentListIndex;
+
     /**
      * \brief Update the lost count
      *
@@ -427,9 +435,10 @@ class TcpTxBuffer : public Object
      * The {New}Reno cases, for now, are managed in TcpSocketBase through the
      * call to MarkHeadAsLost.
      * This function is, therefore, called after a SACK option has been received,
-     * and updates the lost count. It can be probably optimized by not walking
-     * the entire list, but a subset.
-     *
+     * and updates the lost count. The walk stops at m_lostMarkedUpTo, below
+     * which every segment is already marked as either lost or sacked, so
+     * that the cost is proportional to the segments sent or sacked since the
+     * previous update rather than to the size of the sent list.
      */
     void UpdateLostCount();
 
@@ -565,6 +574,40 @@ class TcpTxBuffer : public Object
                                  const SequenceNumber32& requestedSeq,
                                  bool* listEdited = nullptr) const;
 
+    /**
+     * \brief Get a block (which is returned as Packet) from a list, starting
+     * the walk from a given item
+     *
+     * Same as the other GetPacketFromList, but the list is walked starting
+     * from startIt instead of from its beginning. The item pointed by startIt
+     * must precede the one containing requestedSeq, since it is not edited.
+     *
+     * \param list List to extract block from
+     * \param startIt Item from which the walk starts, or list.end () to start
+     * from the beginning of the list
+     * \param startingSeq Starting sequence of the item pointed by startIt (or
+     * of the list, if startIt is list.end ())
+     * \param numBytes Bytes to extract, starting from requestedSeq
+     * \param requestedSeq Requested sequence
+     * \param listEdited output parameter which indicates if the list has been edited
+     * \return the item that contains the right packet
+     */
+    TcpTxItem* GetPacketFromList(PacketList& list,
+                                 PacketList::iterator startIt,
+                                 const SequenceNumber32& startingSeq,
+                                 uint32_t numBytes,
+                                 const SequenceNumber32& requestedSeq,
+                                 bool* listEdited = nullptr) const;
+
+    /**
+     * \brief Rebuild the index of the part of the sent list edited by GetPacketFromList
+     *
+     * \param startIt the item from which GetPacketFromList started the walk (which
+     * has not been edited), or m_sentList.end () if it started from the beginning
+     * \param lastSeq the last sequence number of the edited part
+     */
+    void ReindexSentList(PacketList::iterator startIt, const SequenceNumber32& lastSeq);
+
     /**
      * \brief Merge two TcpTxItem
      *
@@ -612,6 +655,9 @@ class TcpTxBuffer : public Object
         m_firstByteSeq; //!< Sequence number of the first byte in data (SND.UNA)
     std::pair<PacketList::const_iterator, SequenceNumber32> m_highestSack; //!< Highest SACK byte
 
+    SentListIndex m_sentIndex;         //!< Index of m_sentList by starting sequence number
+    SequenceNumber32 m_lostMarkedUpTo; //!< Segments starting below are either lost or sacked
+
     uint32_t m_lostOut{0};   //!< Number of lost bytes
     uint32_t m_sackedOut{0}; //!< Number of sacked bytes
     uint32_t m_retrans{0};   //!< Number of retransmitted bytes
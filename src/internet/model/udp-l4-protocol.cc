@@ -521,6 +521,62 @@ UdpL4Protocol::Send(Ptr<Packet> packet,
     m_downTarget6(packet, saddr, daddr, PROT_NUMBER, route);
 }
 
+void
+UdpL4Protocol::SendBatch(const std::vector<Ptr<Packet>>& packets,
+                         Ipv4Address saddr,
+                         Ipv4Address daddr,
+                         uint16_t sport,
+                         uint16_t dport,
+                         Ptr<Ipv4Route> route)
+{
+    NS_LOG_FUNCTION(this << packets.size() << saddr << daddr << sport << dport << route);
+
+    // The length and the checksum are computed when the header is serialized,
+    // hence the same header can be added to all the packets
+    UdpHeader udpHeader;
+    if (Node::ChecksumEnabled())
+    {
+        udpHeader.EnableChecksums();
+        udpHeader.InitializeChecksum(saddr, daddr, PROT_NUMBER);
+    }
+    udpHeader.SetDestinationPort(dport);
+    udpHeader.SetSourcePort(sport);
+
+    for (const auto& packet : packets)
+    {
+        packet->AddHeader(udpHeader);
+        m_downTarget(packet, saddr, daddr, PROT_NUMBER, route);
+    }
+}
+
+void
+UdpL4Protocol::SendBatch(const std::vector<Ptr<Packet>>& packets,
+                         Ipv6Address saddr,
+                         Ipv6Address daddr,
+                         uint16_t sport,
+                         uint16_t dport,
+                         Ptr<Ipv6Route> route)
+{
+    NS_LOG_FUNCTION(this << packets.size() << saddr << daddr << sport << dport << route);
+
+    // The length and the checksum are computed when the header is serialized,
+    // hence the same header can be added to all the packets
+    UdpHeader udpHeader;
+    if (Node::ChecksumEnabled())
+    {
+        udpHeader.EnableChecksums();
+        udpHeader.InitializeChecksum(saddr, daddr, PROT_NUMBER);
+    }
+    udpHeader.SetDestinationPort(dport);
+    udpHeader.SetSourcePort(sport);
+
+    for (const auto& packet : packets)
+    {
+        packet->AddHeader(udpHeader);
+        m_downTarget6(packet, saddr, daddr, PROT_NUMBER, route);
+    }
+}
+
 void
 UdpL4Protocol::SetDownTarget(IpL4Protocol::DownTargetCallback callback)
 {
@@ -26,6 +26,7 @@
 #include "ns3/ptr.h"
 
 #include <stdint.h>
+#include <vector>
 
 namespace ns3
 {
@@ -240,6 +241,44 @@ class UdpL4Protocol : public IpL4Protocol
               uint16_t sport,
               uint16_t dport,
               Ptr<Ipv6Route> route);
+    /**
+     * \brief Send a batch of packets via UDP (IPv4)
+     *
+     * The UDP header is built once for the whole batch, and all the packets
+     * are sent along the same route.
+     *
+     * \param packets The packets to send
+     * \param saddr The source Ipv4Address
+     * \param daddr The destination Ipv4Address
+     * \param sport The source port number
+     * \param dport The destination port number
+     * \param route The route
+     */
+    void SendBatch(const std::vector<Ptr<Packet>>& packets,
+                   Ipv4Address saddr,
+                   Ipv4Address daddr,
+                   uint16_t sport,
+                   uint16_t dport,
+                   Ptr<Ipv4Route> route);
+    /**
+     * \brief Send a batch of packets via UDP (IPv6)
+     *
+     * The UDP header is built once for the whole batch, and all the packets
+     * are sent along the same route.
+     *
+     * \param packets The packets to send
+     * \param saddr The source Ipv6Address
+     * \param daddr The destination Ipv6Address
+     * \param sport The source port number
+     * \param dport The destination port number
+     * \param route The route
+     */
+    void SendBatch(const std::vector<Ptr<Packet>>& packets,
+                   Ipv6Address saddr,
+                   Ipv6Address daddr,
+                   uint16_t sport,
+                   uint16_t dport,
+                   Ptr<Ipv6Route> route);
 
     // inherited from Ipv4L4Protocol
     enum IpL4Protocol::RxStatus Receive(Ptr<Packet> p,
@@ -521,62 +521,10 @@ UdpSocketImpl::DoSendTo(Ptr<Packet> p, Ipv4Address dest, uint16_t port, uint8_t
         return -1;
     }
 
-    uint8_t priority = GetPriority();
-    if (tos)
-    {
-        SocketIpTosTag ipTosTag;
-        ipTosTag.SetTos(tos);
-        // This packet may already have a SocketIpTosTag (see BUG 2440)
-        p->ReplacePacketTag(ipTosTag);
-        priority = IpTos2Priority(tos);
-    }
-
-    if (priority)
-    {
-        SocketPriorityTag priorityTag;
-        priorityTag.SetPriority(priority);
-        p->ReplacePacketTag(priorityTag);
-    }
+    AddIpv4Tags(p, dest, tos);
 
     Ptr<Ipv4> ipv4 = m_node->GetObject<Ipv4>();
 
-    // Locally override the IP TTL for this socket
-    // We cannot directly modify the TTL at this stage, so we set a Packet tag
-    // The destination can be either multicast, unicast/anycast, or
-    // either all-hosts broadcast or limited (subnet-directed) broadcast.
-    // For the latter two broadcast types, the TTL will later be set to one
-    // irrespective of what is set in these socket options.  So, this tagging
-    // may end up setting the TTL of a limited broadcast packet to be
-    // the same as a unicast, but it will be fixed further down the stack
-    if (m_ipMulticastTtl != 0 && dest.IsMulticast())
-    {
-        SocketIpTtlTag tag;
-        tag.SetTtl(m_ipMulticastTtl);
-        p->AddPacketTag(tag);
-    }
-    else if (IsManualIpTtl() && GetIpTtl() != 0 && !dest.IsMulticast() && !dest.IsBroadcast())
-    {
-        SocketIpTtlTag tag;
-        tag.SetTtl(GetIpTtl());
-        p->AddPacketTag(tag);
-    }
-    {
-        SocketSetDontFragmentTag tag;
-        bool found = p->RemovePacketTag(tag);
-        if (!found)
-        {
-            if (m_mtuDiscover)
-            {
-                tag.Enable();
-            }
-            else
-            {
-                tag.Disable();
-            }
-            p->AddPacketTag(tag);
-        }
-    }
-
     // Note that some systems will only send limited broadcast packets
     // out of the "default" interface; here we send it out all interfaces
     if (dest.IsBroadcast())
@@ -637,20 +585,10 @@ UdpSocketImpl::DoSendTo(Ptr<Packet> p, Ipv4Address dest, uint16_t port, uint8_t
         if (route)
         {
             NS_LOG_LOGIC("Route exists");
-            if (!m_allowBroadcast)
+            if (!m_allowBroadcast && IsSubnetDirectedBroadcast(dest, route))
             {
-                // Here we try to route subnet-directed broadcasts
-                uint32_t outputIfIndex = ipv4->GetInterfaceForDevice(route->GetOutputDevice());
-                uint32_t ifNAddr = ipv4->GetNAddresses(outputIfIndex);
-                for (uint32_t addrI = 0; addrI < ifNAddr; ++addrI)
-                {
-                    Ipv4InterfaceAddress ifAddr = ipv4->GetAddress(outputIfIndex, addrI);
-                    if (dest == ifAddr.GetBroadcast())
-                    {
-                        m_errno = ERROR_OPNOTSUPP;
-                        return -1;
-                    }
-                }
+                m_errno = ERROR_OPNOTSUPP;
+                return -1;
             }
 
             header.SetSource(route->GetSource());
@@ -715,43 +653,10 @@ UdpSocketImpl::DoSendTo(Ptr<Packet> p, Ipv6Address dest, uint16_t port)
         return -1;
     }
 
-    if (IsManualIpv6Tclass())
-    {
-        SocketIpv6TclassTag ipTclassTag;
-        ipTclassTag.SetTclass(GetIpv6Tclass());
-        p->AddPacketTag(ipTclassTag);
-    }
-
-    uint8_t priority = GetPriority();
-    if (priority)
-    {
-        SocketPriorityTag priorityTag;
-        priorityTag.SetPriority(priority);
-        p->ReplacePacketTag(priorityTag);
-    }
+    AddIpv6Tags(p, dest);
 
     Ptr<Ipv6> ipv6 = m_node->GetObject<Ipv6>();
 
-    // Locally override the IP TTL for this socket
-    // We cannot directly modify the TTL at this stage, so we set a Packet tag
-    // The destination can be either multicast, unicast/anycast, or
-    // either all-hosts broadcast or limited (subnet-directed) broadcast.
-    // For the latter two broadcast types, the TTL will later be set to one
-    // irrespective of what is set in these socket options.  So, this tagging
-    // may end up setting the TTL of a limited broadcast packet to be
-    // the same as a unicast, but it will be fixed further down the stack
-    if (m_ipMulticastTtl != 0 && dest.IsMulticast())
-    {
-        SocketIpv6HopLimitTag tag;
-        tag.SetHopLimit(m_ipMulticastTtl);
-        p->AddPacketTag(tag);
-    }
-    else if (IsManualIpv6HopLimit() && GetIpv6HopLimit() != 0 && !dest.IsMulticast())
-    {
-        SocketIpv6HopLimitTag tag;
-        tag.SetHopLimit(GetIpv6HopLimit());
-        p->AddPacketTag(tag);
-    }
     // There is no analgous to an IPv4 broadcast address in IPv6.
     // Instead, we use a set of link-local, site-local, and global
     // multicast addresses.  The Ipv6 routing layers should all
@@ -811,6 +716,246 @@ UdpSocketImpl::DoSendTo(Ptr<Packet> p, Ipv6Address dest, uint16_t port)
     return 0;
 }
 
+void
+UdpSocketImpl::AddIpv4Tags(Ptr<Packet> p, Ipv4Address dest, uint8_t tos) const
+{
+    NS_LOG_FUNCTION(this << p << dest << (uint16_t)tos);
+
+    uint8_t priority = GetPriority();
+    if (tos)
+    {
+        SocketIpTosTag ipTosTag;
+        ipTosTag.SetTos(tos);
+        // This packet may already have a SocketIpTosTag (see BUG 2440)
+        p->ReplacePacketTag(ipTosTag);
+        priority = IpTos2Priority(tos);
+    }
+
+    if (priority)
+    {
+        SocketPriorityTag priorityTag;
+        priorityTag.SetPriority(priority);
+        p->ReplacePacketTag(priorityTag);
+    }
+
+    // Locally override the IP TTL for this socket
+    // We cannot directly modify the TTL at this stage, so we set a Packet tag
+    // The destination can be either multicast, unicast/anycast, or
+    // either all-hosts broadcast or limited (subnet-directed) broadcast.
+    // For the latter two broadcast types, the TTL will later be set to one
+    // irrespective of what is set in these socket options.  So, this tagging
+    // may end up setting the TTL of a limited broadcast packet to be
+    // the same as a unicast, but it will be fixed further down the stack
+    if (m_ipMulticastTtl != 0 && dest.IsMulticast())
+    {
+        SocketIpTtlTag tag;
+        tag.SetTtl(m_ipMulticastTtl);
+        p->AddPacketTag(tag);
+    }
+    else if (IsManualIpTtl() && GetIpTtl() != 0 && !dest.IsMulticast() && !dest.IsBroadcast())
+    {
+        SocketIpTtlTag tag;
+        tag.SetTtl(GetIpTtl());
+        p->AddPacketTag(tag);
+    }
+    {
+        SocketSetDontFragmentTag tag;
+        bool found = p->RemovePacketTag(tag);
+        if (!found)
+        {
+            if (m_mtuDiscover)
+            {
+                tag.Enable();
+            }
+            else
+            {
+                tag.Disable();
+            }
+            p->AddPacketTag(tag);
+        }
+    }
+}
+
+bool
+UdpSocketImpl::IsSubnetDirectedBroadcast(Ipv4Address dest, Ptr<Ipv4Route> route) const
+{
+    NS_LOG_FUNCTION(this << dest << route);
+
+    // Here we try to route subnet-directed broadcasts
+    Ptr<Ipv4> ipv4 = m_node->GetObject<Ipv4>();
+    uint32_t outputIfIndex = ipv4->GetInterfaceForDevice(route->GetOutputDevice());
+    uint32_t ifNAddr = ipv4->GetNAddresses(outputIfIndex);
+    for (uint32_t addrI = 0; addrI < ifNAddr; ++addrI)
+    {
+        Ipv4InterfaceAddress ifAddr = ipv4->GetAddress(outputIfIndex, addrI);
+        if (dest == ifAddr.GetBroadcast())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+UdpSocketImpl::AddIpv6Tags(Ptr<Packet> p, Ipv6Address dest) const
+{
+    NS_LOG_FUNCTION(this << p << dest);
+
+    if (IsManualIpv6Tclass())
+    {
+        SocketIpv6TclassTag ipTclassTag;
+        ipTclassTag.SetTclass(GetIpv6Tclass());
+        p->AddPacketTag(ipTclassTag);
+    }
+
+    uint8_t priority = GetPriority();
+    if (priority)
+    {
+        SocketPriorityTag priorityTag;
+        priorityTag.SetPriority(priority);
+        p->ReplacePacketTag(priorityTag);
+    }
+
+    // Locally override the IP TTL for this socket
+    // We cannot directly modify the TTL at this stage, so we set a Packet tag
+    // The destination can be either multicast, unicast/anycast, or
+    // either all-hosts broadcast or limited (subnet-directed) broadcast.
+    // For the latter two broadcast types, the TTL will later be set to one
+    // irrespective of what is set in these socket options.  So, this tagging
+    // may end up setting the TTL of a limited broadcast packet to be
+    // the same as a unicast, but it will be fixed further down the stack
+    if (m_ipMulticastTtl != 0 && dest.IsMulticast())
+    {
+        SocketIpv6HopLimitTag tag;
+        tag.SetHopLimit(m_ipMulticastTtl);
+        p->AddPacketTag(tag);
+    }
+    else if (IsManualIpv6HopLimit() && GetIpv6HopLimit() != 0 && !dest.IsMulticast())
+    {
+        SocketIpv6HopLimitTag tag;
+        tag.SetHopLimit(GetIpv6HopLimit());
+        p->AddPacketTag(tag);
+    }
+}
+
+int
+UdpSocketImpl::DoSendBatchTo(const std::vector<Ptr<Packet>>& packets,
+                             Ipv4Address dest,
+                             uint16_t port,
+                             uint8_t tos)
+{
+    NS_LOG_FUNCTION(this << packets.size() << dest << port << (uint16_t)tos);
+    NS_ASSERT(m_endPoint != nullptr && !packets.empty());
+
+    if (m_shutdownSend)
+    {
+        m_errno = ERROR_SHUTDOWN;
+        return -1;
+    }
+
+    // As with sendmmsg(), the batch stops at the first packet that can not be sent
+    std::vector<Ptr<Packet>> copies;
+    copies.reserve(packets.size());
+    for (const auto& p : packets)
+    {
+        if (p->GetSize() > GetTxAvailable())
+        {
+            break;
+        }
+        AddIpv4Tags(p, dest, tos);
+        copies.push_back(p->Copy());
+    }
+    if (copies.empty())
+    {
+        m_errno = ERROR_MSGSIZE;
+        return -1;
+    }
+
+    // A single route lookup for the whole batch
+    Ptr<Ipv4> ipv4 = m_node->GetObject<Ipv4>();
+    Ipv4Header header;
+    header.SetDestination(dest);
+    header.SetProtocol(UdpL4Protocol::PROT_NUMBER);
+    Socket::SocketErrno errno_;
+    Ptr<Ipv4Route> route =
+        ipv4->GetRoutingProtocol()->RouteOutput(packets.front(), header, m_boundnetdevice, errno_);
+    if (!route)
+    {
+        NS_LOG_LOGIC("No route to destination");
+        NS_LOG_ERROR(errno_);
+        m_errno = errno_;
+        return -1;
+    }
+    if (!m_allowBroadcast && IsSubnetDirectedBroadcast(dest, route))
+    {
+        m_errno = ERROR_OPNOTSUPP;
+        return -1;
+    }
+
+    m_udp->SendBatch(copies, route->GetSource(), dest, m_endPoint->GetLocalPort(), port, route);
+    for (std::size_t i = 0; i < copies.size(); i++)
+    {
+        NotifyDataSent(packets[i]->GetSize());
+    }
+    return copies.size();
+}
+
+int
+UdpSocketImpl::DoSendBatchTo(const std::vector<Ptr<Packet>>& packets,
+                             Ipv6Address dest,
+                             uint16_t port)
+{
+    NS_LOG_FUNCTION(this << packets.size() << dest << port);
+    NS_ASSERT(m_endPoint6 != nullptr && !packets.empty());
+
+    if (m_shutdownSend)
+    {
+        m_errno = ERROR_SHUTDOWN;
+        return -1;
+    }
+
+    // As with sendmmsg(), the batch stops at the first packet that can not be sent
+    std::vector<Ptr<Packet>> copies;
+    copies.reserve(packets.size());
+    for (const auto& p : packets)
+    {
+        if (p->GetSize() > GetTxAvailable())
+        {
+            break;
+        }
+        AddIpv6Tags(p, dest);
+        copies.push_back(p->Copy());
+    }
+    if (copies.empty())
+    {
+        m_errno = ERROR_MSGSIZE;
+        return -1;
+    }
+
+    // A single route lookup for the whole batch
+    Ptr<Ipv6> ipv6 = m_node->GetObject<Ipv6>();
+    Ipv6Header header;
+    header.SetDestination(dest);
+    header.SetNextHeader(UdpL4Protocol::PROT_NUMBER);
+    Socket::SocketErrno errno_;
+    Ptr<Ipv6Route> route =
+        ipv6->GetRoutingProtocol()->RouteOutput(packets.front(), header, m_boundnetdevice, errno_);
+    if (!route)
+    {
+        NS_LOG_LOGIC("No route to destination");
+        NS_LOG_ERROR(errno_);
+        m_errno = errno_;
+        return -1;
+    }
+
+    m_udp->SendBatch(copies, route->GetSource(), dest, m_endPoint6->GetLocalPort(), port, route);
+    for (std::size_t i = 0; i < copies.size(); i++)
+    {
+        NotifyDataSent(packets[i]->GetSize());
+    }
+    return copies.size();
+}
+
 // maximum message size for UDP broadcast is limited by MTU
 // size of underlying link; we are not checking that now.
 // \todo Check MTU size of underlying link
@@ -845,6 +990,44 @@ UdpSocketImpl::SendTo(Ptr<Packet> p, uint32_t flags, const Address& address)
     return -1;
 }
 
+int
+UdpSocketImpl::SendBatch(const std::vector<Ptr<Packet>>& packets, uint32_t flags)
+{
+    NS_LOG_FUNCTION(this << packets.size() << flags);
+
+    if (!m_connected)
+    {
+        m_errno = ERROR_NOTCONN;
+        return -1;
+    }
+    if (packets.empty())
+    {
+        return 0;
+    }
+
+    // The batch shares the route lookup only for the destinations reached
+    // through the routing protocol; otherwise, the packets are sent one by one.
+    if (Ipv4Address::IsMatchingType(m_defaultAddress) && m_endPoint &&
+        m_endPoint->GetLocalAddress() == Ipv4Address::GetAny())
+    {
+        Ipv4Address dest = Ipv4Address::ConvertFrom(m_defaultAddress);
+        if (!dest.IsBroadcast() && m_node->GetObject<Ipv4>()->GetRoutingProtocol())
+        {
+            return DoSendBatchTo(packets, dest, m_defaultPort, GetIpTos());
+        }
+    }
+    else if (Ipv6Address::IsMatchingType(m_defaultAddress) && m_endPoint6 &&
+             m_endPoint6->GetLocalAddress() == Ipv6Address::GetAny())
+    {
+        Ipv6Address dest = Ipv6Address::ConvertFrom(m_defaultAddress);
+        if (!dest.IsIpv4MappedAddress() && m_node->GetObject<Ipv6>()->GetRoutingProtocol())
+        {
+            return DoSendBatchTo(packets, dest, m_defaultPort);
+        }
+    }
+    return Socket::SendBatch(packets, flags);
+}
+
 uint32_t
 UdpSocketImpl::GetRxAvailable() const
 {
@@ -31,11 +31,13 @@
 
 #include <queue>
 #include <stdint.h>
+#include <vector>
 
 namespace ns3
 {
 
 class Ipv4EndPoint;
+class Ipv4Route;
 class Ipv6EndPoint;
 class Node;
 class Packet;
@@ -107,6 +109,7 @@ class UdpSocketImpl : public UdpSocket
     uint32_t GetTxAvailable() const override;
     int Send(Ptr<Packet> p, uint32_t flags) override;
     int SendTo(Ptr<Packet> p, uint32_t flags, const Address& address) override;
+    int SendBatch(const std::vector<Ptr<Packet>>& packets, uint32_t flags) override;
     uint32_t GetRxAvailable() const override;
     Ptr<Packet> Recv(uint32_t maxSize, uint32_t flags) override;
     Ptr<Packet> RecvFrom(uint32_t maxSize, uint32_t flags, Address& fromAddress) override;
@@ -217,6 +220,48 @@ class UdpSocketImpl : public UdpSocket
      * \returns 0 on success, -1 on failure
      */
     int DoSendTo(Ptr<Packet> p, Ipv6Address daddr, uint16_t dport);
+    /**
+     * \brief Send a batch of packets to a specific destination and port (IPv4),
+     * with a single route lookup
+     * \param packets packets
+     * \param daddr destination address
+     * \param dport destination port
+     * \param tos ToS
+     * \returns the number of packets sent, -1 on failure
+     */
+    int DoSendBatchTo(const std::vector<Ptr<Packet>>& packets,
+                      Ipv4Address daddr,
+                      uint16_t dport,
+                      uint8_t tos);
+    /**
+     * \brief Send a batch of packets to a specific destination and port (IPv6),
+     * with a single route lookup
+     * \param packets packets
+     * \param daddr destination address
+     * \param dport destination port
+     * \returns the number of packets sent, -1 on failure
+     */
+    int DoSendBatchTo(const std::vector<Ptr<Packet>>& packets, Ipv6Address daddr, uint16_t dport);
+    /**
+     * \brief Add to a packet the tags set by the socket options (IPv4)
+     * \param p packet
+     * \param daddr destination address
+     * \param tos ToS
+     */
+    void AddIpv4Tags(Ptr<Packet> p, Ipv4Address daddr, uint8_t tos) const;
+    /**
+     * \brief Add to a packet the tags set by the socket options (IPv6)
+     * \param p packet
+     * \param daddr destination address
+     */
+    void AddIpv6Tags(Ptr<Packet> p, Ipv6Address daddr) const;
+    /**
+     * \brief Check if a destination is the broadcast address of the output interface
+     * \param daddr destination address
+     * \param route the route to the destination
+     * \returns true if daddr is a subnet-directed broadcast address
+     */
+    bool IsSubnetDirectedBroadcast(Ipv4Address daddr, Ptr<Ipv4Route> route) const;
 
     /**
      * \brief Called by the L3 protocol when it received an ICMP packet to pass on to TCP.
@@ -26,7 +26,9 @@
 #include "ns3/simulator.h"
 #include "ns3/test.h"
 
+#include <algorithm>
 #include <cstdlib> // for rand()
+#include <list>
 
 using namespace ns3;
 
@@ -65,13 +67,95 @@ GlobalRouteManagerImplTestCase::DoRun()
         candidate.Push(v);
     }
 
+    uint32_t lastDistance = 0;
     for (int i = 0; i < 100; ++i)
     {
         SPFVertex* v = candidate.Pop();
+        NS_TEST_ASSERT_MSG_EQ((v->GetDistanceFromRoot() >= lastDistance),
+                              true,
+                              "Vertices not popped in order of distance");
+        lastDistance = v->GetDistanceFromRoot();
         delete v;
         v = nullptr;
     }
 
+    // Vertices are found by ID, and decreasing the distance of a vertex moves
+    // it after the vertices with the same distance
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        SPFVertex* v = new SPFVertex;
+        v->SetVertexId(Ipv4Address(i + 1));
+        v->SetDistanceFromRoot(i < 5 ? 10 : 20);
+        candidate.Push(v);
+    }
+    SPFVertex* cw = candidate.Find(Ipv4Address(8));
+    NS_TEST_ASSERT_MSG_NE(cw, nullptr, "Vertex not found in the candidate queue");
+    cw->SetDistanceFromRoot(10);
+    candidate.Update(cw);
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        SPFVertex* v = candidate.Pop();
+        uint32_t expected = (i < 5 ? i + 1 : (i == 5 ? 8 : (i < 8 ? i : i + 1)));
+        NS_TEST_ASSERT_MSG_EQ(v->GetVertexId(),
+                              Ipv4Address(expected),
+                              "Unexpected order of the candidate queue");
+        delete v;
+    }
+    NS_TEST_ASSERT_MSG_EQ(candidate.Find(Ipv4Address(8)),
+                          nullptr,
+                          "Popped vertex still found in the candidate queue");
+
+    // The vertices are popped in the same order as from the sorted list used
+    // before the heap, in which new vertices were inserted after the vertices
+    // with the same priority and the list was stable sorted after a vertex
+    // distance was decreased
+    auto compare = [](const SPFVertex* v1, const SPFVertex* v2) {
+        if (v1->GetDistanceFromRoot() != v2->GetDistanceFromRoot())
+        {
+            return v1->GetDistanceFromRoot() < v2->GetDistanceFromRoot();
+        }
+        return v1->GetVertexType() == SPFVertex::VertexNetwork &&
+               v2->GetVertexType() == SPFVertex::VertexRouter;
+    };
+    std::list<SPFVertex*> sortedList;
+    uint32_t nextId = 1;
+    for (int i = 0; i < 2000 || !sortedList.empty(); ++i)
+    {
+        int operation = (i < 2000 ? std::rand() % 4 : 3);
+        if (operation < 2 || sortedList.empty())
+        {
+            SPFVertex* v = new SPFVertex;
+            v->SetVertexId(Ipv4Address(nextId++));
+            v->SetVertexType(std::rand() % 2 ? SPFVertex::VertexRouter : SPFVertex::VertexNetwork);
+            v->SetDistanceFromRoot(std::rand() % 20);
+            candidate.Push(v);
+            sortedList.insert(std::upper_bound(sortedList.begin(), sortedList.end(), v, compare),
+                              v);
+        }
+        else if (operation == 2)
+        {
+            auto it = sortedList.begin();
+            std::advance(it, std::rand() % sortedList.size());
+            SPFVertex* v = *it;
+            if (v->GetDistanceFromRoot() > 0)
+            {
+                v->SetDistanceFromRoot(std::rand() % v->GetDistanceFromRoot());
+                candidate.Update(candidate.Find(v->GetVertexId()));
+                sortedList.sort(compare);
+            }
+        }
+        else
+        {
+            SPFVertex* v = candidate.Pop();
+            NS_TEST_ASSERT_MSG_EQ(v->GetVertexId(),
+                                  sortedList.front()->GetVertexId(),
+                                  "Vertex popped out of the order of the sorted list");
+            sortedList.pop_front();
+            delete v;
+        }
+    }
+    NS_TEST_ASSERT_MSG_EQ(candidate.Empty(), true, "The candidate queue should be empty");
+
     // Build fake link state database; four routers (0-3), 3 point-to-point
     // links
     //
@@ -200,6 +284,28 @@ GlobalRouteManagerImplTestCase::DoRun()
                           srmlsdb->GetLSA(lsa2->GetLinkStateId()),
                           "The Ipv4Address is not stored as the link state ID");
 
+    // An LSA with the address of an LSA in the database is not stored, nor
+    // indexed by the link data of its transit network link records
+    GlobalRoutingLinkRecord* lr12 =
+        new GlobalRoutingLinkRecord(GlobalRoutingLinkRecord::TransitNetwork,
+                                    "10.1.4.1",
+                                    "10.1.4.2",
+                                    1);
+
+    GlobalRoutingLSA* lsa4 = new GlobalRoutingLSA();
+    lsa4->SetLSType(GlobalRoutingLSA::RouterLSA);
+    lsa4->SetLinkStateId("0.0.0.3");
+    lsa4->SetAdvertisingRouter("0.0.0.3");
+    lsa4->AddLinkRecord(lr12);
+    srmlsdb->Insert(lsa4->GetLinkStateId(), lsa4);
+    NS_TEST_ASSERT_MSG_EQ(lsa3,
+                          srmlsdb->GetLSA(lsa3->GetLinkStateId()),
+                          "The LSA in the database has been replaced");
+    NS_TEST_ASSERT_MSG_EQ(srmlsdb->GetLSAByLinkData(lr12->GetLinkData()),
+                          nullptr,
+                          "An LSA not in the database is indexed by its link data");
+    delete lsa4;
+
     // next, calculate routes based on the manually created LSDB
     GlobalRouteManagerImpl* srm = new GlobalRouteManagerImpl();
     srm->DebugUseLsdb(srmlsdb); // manually add in an LSDB
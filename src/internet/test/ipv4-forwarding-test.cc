@@ -24,6 +24,7 @@
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-l3-protocol.h"
 #include "ns3/ipv4-routing-helper.h"
+#include "ns3/ipv4-routing-table-entry.h"
 #include "ns3/ipv4-static-routing.h"
 #include "ns3/log.h"
 #include "ns3/node.h"
@@ -217,7 +218,29 @@ Ipv4ForwardingTest::DoRun()
     m_receivedPacket->RemoveAllByteTags();
     m_receivedPacket = nullptr;
 
+    // The route of the forwarding node is now cached
+    SendData(txSocket, "10.0.0.2");
+    NS_TEST_EXPECT_MSG_EQ(m_receivedPacket->GetSize(), 123, "IPv4 Forwarding with cached route");
+
+    // Removing the route must invalidate the cached one
     Ptr<Ipv4> ipv4 = fwNode->GetObject<Ipv4>();
+    Ptr<Ipv4StaticRouting> fwStaticRouting =
+        Ipv4RoutingHelper::GetRouting<Ipv4StaticRouting>(ipv4->GetRoutingProtocol());
+    for (uint32_t i = 0; i < fwStaticRouting->GetNRoutes(); i++)
+    {
+        if (fwStaticRouting->GetRoute(i).GetDestNetwork() == Ipv4Address("10.0.0.0"))
+        {
+            fwStaticRouting->RemoveRoute(i);
+            break;
+        }
+    }
+    SendData(txSocket, "10.0.0.2");
+    NS_TEST_EXPECT_MSG_EQ(m_receivedPacket->GetSize(), 0, "IPv4 Forwarding without route");
+
+    fwStaticRouting->AddNetworkRouteTo(Ipv4Address("10.0.0.0"), Ipv4Mask("/16"), 1);
+    SendData(txSocket, "10.0.0.2");
+    NS_TEST_EXPECT_MSG_EQ(m_receivedPacket->GetSize(), 123, "IPv4 Forwarding with restored route");
+
     ipv4->SetAttribute("IpForward", BooleanValue(false));
     SendData(txSocket, "10.0.0.2");
     NS_TEST_EXPECT_MSG_EQ(m_receivedPacket->GetSize(), 0, "IPv4 Forwarding off");
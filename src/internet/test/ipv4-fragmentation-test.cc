@@ -26,6 +26,7 @@
 #include "ns3/error-channel.h"
 #include "ns3/icmpv4-l4-protocol.h"
 #include "ns3/inet-socket-address.h"
+#include "ns3/ip-fragment-buffer.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-l3-protocol.h"
 #include "ns3/ipv4-list-routing.h"
@@ -52,6 +53,7 @@
 
 #include <limits>
 #include <string>
+#include <vector>
 
 using namespace ns3;
 
@@ -577,6 +579,91 @@ Ipv4FragmentationTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IpFragmentBuffer Test: fragments received out of order, overlapping
+ * and duplicated.
+ */
+class IpFragmentBufferTest : public TestCase
+{
+  public:
+    IpFragmentBufferTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Check the content of a reassembled packet.
+     * \param packet the reassembled packet
+     * \param size the expected size
+     * \param msg the message to print on failure
+     */
+    void CheckPacket(Ptr<Packet> packet, uint32_t size, std::string msg);
+
+    Ptr<Packet> m_original; //!< The packet to reassemble
+};
+
+IpFragmentBufferTest::IpFragmentBufferTest()
+    : TestCase("Reassembly of out of order, overlapping and duplicate fragments")
+{
+}
+
+void
+IpFragmentBufferTest::CheckPacket(Ptr<Packet> packet, uint32_t size, std::string msg)
+{
+    NS_TEST_ASSERT_MSG_EQ(packet->GetSize(), size, msg << ": wrong size");
+    std::vector<uint8_t> expected(size);
+    std::vector<uint8_t> received(size);
+    m_original->CopyData(expected.data(), size);
+    packet->CopyData(received.data(), size);
+    NS_TEST_EXPECT_MSG_EQ((expected == received), true, msg << ": wrong content");
+}
+
+void
+IpFragmentBufferTest::DoRun()
+{
+    std::vector<uint8_t> data(1000);
+    for (uint32_t i = 0; i < data.size(); i++)
+    {
+        data[i] = i % 251;
+    }
+    m_original = Create<Packet>(data.data(), data.size());
+
+    IpFragmentBuffer buffer;
+    NS_TEST_EXPECT_MSG_EQ(buffer.IsEmpty(), true, "The buffer should be empty");
+    NS_TEST_EXPECT_MSG_EQ(buffer.IsContiguous(), false, "An empty buffer is not contiguous");
+
+    // last fragment first
+    NS_TEST_EXPECT_MSG_EQ(buffer.AddFragment(m_original->CreateFragment(800, 200), 800),
+                          true,
+                          "Fragment not added");
+    NS_TEST_EXPECT_MSG_EQ(buffer.IsContiguous(), false, "Hole at the start of the packet");
+    NS_TEST_EXPECT_MSG_EQ(buffer.GetEnd(), 1000, "Wrong end offset");
+    CheckPacket(buffer.GetPacket(), 0, "Partial packet with a hole at the start");
+
+    buffer.AddFragment(m_original->CreateFragment(0, 300), 0);
+    NS_TEST_EXPECT_MSG_EQ(buffer.AddFragment(m_original->CreateFragment(0, 300), 0),
+                          false,
+                          "Duplicate fragment not detected");
+    NS_TEST_EXPECT_MSG_EQ(buffer.IsContiguous(), false, "Hole in the middle of the packet");
+    CheckPacket(buffer.GetPacket(), 300, "Partial packet");
+
+    // overlapping fragments, one of them entirely covered by the others
+    buffer.AddFragment(m_original->CreateFragment(500, 320), 500);
+    buffer.AddFragment(m_original->CreateFragment(600, 100), 600);
+    NS_TEST_EXPECT_MSG_EQ(buffer.IsContiguous(), false, "Hole in the middle of the packet");
+    buffer.AddFragment(m_original->CreateFragment(250, 300), 250);
+    NS_TEST_EXPECT_MSG_EQ(buffer.IsContiguous(), true, "All the bytes have been received");
+    NS_TEST_EXPECT_MSG_EQ(buffer.GetSize(), 1220, "Wrong size of the fragments");
+    CheckPacket(buffer.GetPacket(), 1000, "Reassembled packet");
+
+    // reassembly after a header
+    Ptr<Packet> head = Create<Packet>(20);
+    NS_TEST_EXPECT_MSG_EQ(buffer.GetPacket(head)->GetSize(), 1020, "Wrong size with header");
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -594,6 +681,7 @@ Ipv4FragmentationTestSuite::Ipv4FragmentationTestSuite()
 {
     AddTestCase(new Ipv4FragmentationTest(false), TestCase::QUICK);
     AddTestCase(new Ipv4FragmentationTest(true), TestCase::QUICK);
+    AddTestCase(new IpFragmentBufferTest, TestCase::QUICK);
 }
 
 static Ipv4FragmentationTestSuite
@@ -48,6 +48,7 @@
 #include <sstream>
 #include <string>
 #include <sys/types.h>
+#include <vector>
 
 using namespace ns3;
 
@@ -291,6 +292,94 @@ Ipv4HeaderTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 Header checksum Test
+ *
+ * Checks that the checksum of a received header, incrementally updated when
+ * the TTL changes, is the same as the checksum computed from scratch.
+ */
+class Ipv4HeaderChecksumTest : public TestCase
+{
+  public:
+    void DoRun() override;
+    Ipv4HeaderChecksumTest();
+
+  private:
+    /**
+     * \brief Serialize a header.
+     * \param header The header.
+     * \return The buffer holding the serialized header.
+     */
+    Buffer Serialize(const Ipv4Header& header);
+};
+
+Ipv4HeaderChecksumTest::Ipv4HeaderChecksumTest()
+    : TestCase("IPv4 Header checksum Test")
+{
+}
+
+Buffer
+Ipv4HeaderChecksumTest::Serialize(const Ipv4Header& header)
+{
+    Buffer buffer;
+    buffer.AddAtStart(header.GetSerializedSize());
+    header.Serialize(buffer.Begin());
+    return buffer;
+}
+
+void
+Ipv4HeaderChecksumTest::DoRun()
+{
+    std::vector<uint8_t> ttls = {255, 64, 2, 1, 0};
+    std::vector<uint8_t> protocols = {1, 6, 17, 255};
+    for (uint8_t protocol : protocols)
+    {
+        for (uint8_t ttl : ttls)
+        {
+            Ipv4Header header;
+            header.EnableChecksum();
+            header.SetSource(Ipv4Address("10.1.2.3"));
+            header.SetDestination(Ipv4Address("192.168.255.254"));
+            header.SetProtocol(protocol);
+            header.SetPayloadSize(1480);
+            header.SetIdentification(0xfedc);
+            header.SetTos(0xb8);
+            header.SetTtl(ttl);
+
+            Ipv4Header received;
+            received.EnableChecksum();
+            Buffer buffer = Serialize(header);
+            received.Deserialize(buffer.Begin());
+            NS_TEST_ASSERT_MSG_EQ(received.IsChecksumOk(), true, "Bad checksum");
+
+            // new TTL, as done by the forwarding code
+            received.SetTtl(ttl - 1);
+            header.SetTtl(ttl - 1);
+            Buffer updated = Serialize(received);
+            Buffer computed = Serialize(header);
+            NS_TEST_ASSERT_MSG_EQ(updated.GetSize(), computed.GetSize(), "Bad header size");
+            for (uint32_t i = 0; i < computed.GetSize(); i++)
+            {
+                NS_TEST_EXPECT_MSG_EQ(static_cast<uint32_t>(updated.PeekData()[i]),
+                                      static_cast<uint32_t>(computed.PeekData()[i]),
+                                      "Bad byte " << i << " for TTL " << +ttl);
+            }
+
+            // any other change voids the received checksum
+            received.Deserialize(updated.Begin());
+            NS_TEST_ASSERT_MSG_EQ(received.IsChecksumOk(), true, "Bad incremental checksum");
+            received.SetTtl(ttl);
+            received.SetTos(0x20);
+            received.Deserialize(Serialize(received).Begin());
+            NS_TEST_ASSERT_MSG_EQ(received.IsChecksumOk(), true, "Bad checksum after TOS change");
+            NS_TEST_EXPECT_MSG_EQ(received.GetTos(), 0x20, "Bad TOS");
+        }
+    }
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -304,6 +393,7 @@ class Ipv4HeaderTestSuite : public TestSuite
         : TestSuite("ipv4-header", UNIT)
     {
         AddTestCase(new Ipv4HeaderTest, TestCase::QUICK);
+        AddTestCase(new Ipv4HeaderChecksumTest, TestCase::QUICK);
     }
 };
 
@@ -17,6 +17,7 @@
  * Author: Zhiheng Dong <dzh2077@gmail.com>
  */
 
+#include "ns3/arp-cache.h"
 #include "ns3/icmpv4-l4-protocol.h"
 #include "ns3/icmpv6-l4-protocol.h"
 #include "ns3/internet-stack-helper.h"
@@ -1228,6 +1229,109 @@ DynamicPartialTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief ARP cache wait reply retransmission Test
+ *
+ * Checks that the ARP requests are retransmitted, in address order, only
+ * for the entries waiting for a reply, and that the pending packets are
+ * dropped once the maximum number of retries is reached.
+ */
+class ArpCacheWaitReplyTest : public TestCase
+{
+  public:
+    ArpCacheWaitReplyTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Record an ARP request.
+     * \param cache the ARP cache
+     * \param address the address to resolve
+     */
+    void ArpRequest(Ptr<const ArpCache> cache, Ipv4Address address);
+
+    /**
+     * \brief Record a dropped packet.
+     * \param packet the packet
+     */
+    void Drop(Ptr<const Packet> packet);
+
+    std::vector<Ipv4Address> m_requests; //!< the addresses of the ARP requests sent
+    uint32_t m_drops{0};                 //!< number of dropped packets
+};
+
+ArpCacheWaitReplyTest::ArpCacheWaitReplyTest()
+    : TestCase("The ARP requests are retransmitted for the entries waiting for a reply")
+{
+}
+
+void
+ArpCacheWaitReplyTest::ArpRequest(Ptr<const ArpCache> cache, Ipv4Address address)
+{
+    m_requests.push_back(address);
+}
+
+void
+ArpCacheWaitReplyTest::Drop(Ptr<const Packet> packet)
+{
+    m_drops++;
+}
+
+void
+ArpCacheWaitReplyTest::DoRun()
+{
+    Ptr<Node> node = CreateObject<Node>();
+    Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice>();
+    node->AddDevice(device);
+    Ptr<ArpCache> cache = CreateObject<ArpCache>();
+    cache->SetAttribute("MaxRetries", UintegerValue(3));
+    cache->SetAttribute("WaitReplyTimeout", TimeValue(Seconds(1)));
+    cache->SetDevice(device, nullptr);
+    cache->SetArpRequestCallback(MakeCallback(&ArpCacheWaitReplyTest::ArpRequest, this));
+    cache->TraceConnectWithoutContext("Drop", MakeCallback(&ArpCacheWaitReplyTest::Drop, this));
+
+    ArpCache::Entry* entry3 = cache->Add(Ipv4Address("10.0.0.3"));
+    entry3->MarkWaitReply(ArpCache::Ipv4PayloadHeaderPair(Create<Packet>(), Ipv4Header()));
+    ArpCache::Entry* entry1 = cache->Add(Ipv4Address("10.0.0.1"));
+    entry1->MarkWaitReply(ArpCache::Ipv4PayloadHeaderPair(Create<Packet>(), Ipv4Header()));
+    ArpCache::Entry* entry2 = cache->Add(Ipv4Address("10.0.0.2"));
+    NS_TEST_EXPECT_MSG_EQ(cache->Lookup(Ipv4Address("10.0.0.2")), entry2, "Entry not found");
+
+    Simulator::Stop(Seconds(1.5));
+    Simulator::Run();
+    NS_TEST_ASSERT_MSG_EQ(m_requests.size(), 2, "Unexpected number of ARP requests");
+    NS_TEST_EXPECT_MSG_EQ(m_requests[0], Ipv4Address("10.0.0.1"), "Requests not in order");
+    NS_TEST_EXPECT_MSG_EQ(m_requests[1], Ipv4Address("10.0.0.3"), "Requests not in order");
+
+    // a reply for 10.0.0.1 stops its retransmissions
+    m_requests.clear();
+    entry1->MarkAlive(Mac48Address("00:00:00:00:00:01"));
+    Simulator::Stop(Seconds(1));
+    Simulator::Run();
+    NS_TEST_ASSERT_MSG_EQ(m_requests.size(), 1, "Unexpected number of ARP requests");
+    NS_TEST_EXPECT_MSG_EQ(m_requests[0], Ipv4Address("10.0.0.3"), "Wrong ARP request");
+
+    // 10.0.0.3 never replies
+    m_requests.clear();
+    Simulator::Stop(Seconds(10));
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(m_requests.size(), 1, "Unexpected number of ARP requests");
+    NS_TEST_EXPECT_MSG_EQ(entry3->IsDead(), true, "Entry should be dead");
+    NS_TEST_EXPECT_MSG_EQ(m_drops, 1, "The pending packet should have been dropped");
+
+    cache->Remove(entry3);
+    NS_TEST_EXPECT_MSG_EQ((cache->Lookup(Ipv4Address("10.0.0.3")) == nullptr),
+                          true,
+                          "Removed entry still found");
+    NS_TEST_EXPECT_MSG_EQ(cache->Lookup(Ipv4Address("10.0.0.1")), entry1, "Entry not found");
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -1247,6 +1351,7 @@ class NeighborCacheTestSuite : public TestSuite
         AddTestCase(new FlushTest, TestCase::QUICK);
         AddTestCase(new DuplicateTest, TestCase::QUICK);
         AddTestCase(new DynamicPartialTest, TestCase::QUICK);
+        AddTestCase(new ArpCacheWaitReplyTest, TestCase::QUICK);
     }
 };
 
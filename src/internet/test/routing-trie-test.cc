@@ -0,0 +1,267 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/ipv4-address.h"
+#include "ns3/ipv6-address.h"
+#include "ns3/routing-trie.h"
+#include "ns3/test.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief A prefix of the routing trie test
+ */
+struct RoutingTriePrefix
+{
+    const char* network; //!< the network address
+    uint32_t length;     //!< the prefix length
+};
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Routing trie (longest prefix match index) Test
+ *
+ * The value stored for each prefix is the prefix length; a second value, the
+ * prefix length plus one, is stored for the ECMP prefix.
+ *
+ * \tparam ADDRESS the address type
+ * \tparam MASK the mask type
+ */
+template <typename ADDRESS, typename MASK>
+class RoutingTrieTestCase : public TestCase
+{
+  public:
+    /**
+     * The prefixes of the test, by role
+     */
+    enum PrefixIndex
+    {
+        DEFAULT = 0, //!< the default prefix
+        SHORT,       //!< a short prefix
+        SIBLING,     //!< a prefix one bit longer than SHORT, within SHORT but not MIDDLE
+        MIDDLE,      //!< a prefix within SHORT
+        ECMP,        //!< a prefix within MIDDLE, with two values
+        HOST,        //!< a host prefix within ECMP
+        N_PREFIXES   //!< the number of prefixes
+    };
+
+    /// The prefixes of the test
+    typedef std::array<RoutingTriePrefix, N_PREFIXES> Prefixes;
+    /// Addresses whose longest match is the prefix of the same index (but HOST)
+    typedef std::array<const char*, HOST> Addresses;
+
+    /**
+     * Constructor
+     *
+     * \param family the name of the address family
+     * \param prefixes the prefixes
+     * \param addresses addresses whose longest match is the prefix of the same index
+     */
+    RoutingTrieTestCase(std::string family, Prefixes prefixes, Addresses addresses);
+
+  private:
+    void DoRun() override;
+
+    /// The trie under test
+    typedef RoutingTrie<ADDRESS, MASK, uint32_t> Trie;
+
+    /**
+     * \param length a prefix length
+     * \return the mask of the given length
+     */
+    static MASK MakeMask(uint8_t length);
+
+    /**
+     * \brief Get the values of the longest prefix matching an address.
+     * \param trie the trie
+     * \param dest the address
+     * \return the values of the longest matching prefix
+     */
+    static std::vector<uint32_t> Lookup(const Trie& trie, const char* dest);
+
+    /**
+     * \param trie the trie
+     * \param index the index of a prefix
+     * \param value the value to remove
+     * \return true if the value was removed
+     */
+    bool Remove(Trie& trie, PrefixIndex index, uint32_t value) const;
+
+    Prefixes m_prefixes;   //!< the prefixes
+    Addresses m_addresses; //!< the addresses matching each prefix
+};
+
+template <typename ADDRESS, typename MASK>
+RoutingTrieTestCase<ADDRESS, MASK>::RoutingTrieTestCase(std::string family,
+                                                        Prefixes prefixes,
+                                                        Addresses addresses)
+    : TestCase("Longest prefix match trie of " + family + " prefixes"),
+      m_prefixes(prefixes),
+      m_addresses(addresses)
+{
+}
+
+template <>
+Ipv4Mask
+RoutingTrieTestCase<Ipv4Address, Ipv4Mask>::MakeMask(uint8_t length)
+{
+    return Ipv4Mask(("/" + std::to_string(length)).c_str());
+}
+
+template <>
+Ipv6Prefix
+RoutingTrieTestCase<Ipv6Address, Ipv6Prefix>::MakeMask(uint8_t length)
+{
+    return Ipv6Prefix(length);
+}
+
+template <typename ADDRESS, typename MASK>
+std::vector<uint32_t>
+RoutingTrieTestCase<ADDRESS, MASK>::Lookup(const Trie& trie, const char* dest)
+{
+    std::vector<uint32_t> found;
+    trie.LongestMatch(ADDRESS(dest),
+                      [&found](uint8_t, const typename Trie::Candidates& values) {
+                          found = values;
+                          return true;
+                      });
+    return found;
+}
+
+template <typename ADDRESS, typename MASK>
+bool
+RoutingTrieTestCase<ADDRESS, MASK>::Remove(Trie& trie, PrefixIndex index, uint32_t value) const
+{
+    return trie.Remove(ADDRESS(m_prefixes[index].network),
+                       MakeMask(m_prefixes[index].length),
+                       value);
+}
+
+template <typename ADDRESS, typename MASK>
+void
+RoutingTrieTestCase<ADDRESS, MASK>::DoRun()
+{
+    Trie trie;
+    for (const auto& prefix : m_prefixes)
+    {
+        trie.Insert(ADDRESS(prefix.network), MakeMask(prefix.length), prefix.length);
+    }
+    uint32_t ecmpLength = m_prefixes[ECMP].length;
+    trie.Insert(ADDRESS(m_prefixes[ECMP].network), MakeMask(ecmpLength), ecmpLength + 1);
+    NS_TEST_EXPECT_MSG_EQ(trie.GetSize(), 7, "Unexpected number of values");
+
+    for (uint8_t i = DEFAULT; i < ECMP; i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(Lookup(trie, m_addresses[i]).at(0),
+                              m_prefixes[i].length,
+                              "Route not matched for " << m_addresses[i]);
+    }
+    const char* host = m_prefixes[HOST].network;
+    NS_TEST_EXPECT_MSG_EQ(Lookup(trie, host).at(0),
+                          m_prefixes[HOST].length,
+                          "Host route not matched");
+    std::vector<uint32_t> ecmp = Lookup(trie, m_addresses[ECMP]);
+    NS_TEST_ASSERT_MSG_EQ(ecmp.size(), 2, "Wrong ECMP candidate set size");
+    NS_TEST_EXPECT_MSG_EQ(ecmp[0], ecmpLength, "ECMP candidates not in insertion order");
+    NS_TEST_EXPECT_MSG_EQ(ecmp[1], ecmpLength + 1, "ECMP candidates not in insertion order");
+
+    NS_TEST_EXPECT_MSG_EQ(Remove(trie, ECMP, m_prefixes[HOST].length),
+                          false,
+                          "Removed a value from the wrong prefix");
+    NS_TEST_EXPECT_MSG_EQ(Remove(trie, HOST, m_prefixes[HOST].length),
+                          true,
+                          "Failed to remove the host route");
+    NS_TEST_EXPECT_MSG_EQ(Lookup(trie, host).size(), 2, "ECMP routes not matched");
+    Remove(trie, ECMP, ecmpLength);
+    Remove(trie, ECMP, ecmpLength + 1);
+    NS_TEST_EXPECT_MSG_EQ(Lookup(trie, host).at(0),
+                          m_prefixes[MIDDLE].length,
+                          "Middle route not matched");
+    Remove(trie, MIDDLE, m_prefixes[MIDDLE].length);
+    NS_TEST_EXPECT_MSG_EQ(Lookup(trie, host).at(0),
+                          m_prefixes[SHORT].length,
+                          "Short route not matched");
+    NS_TEST_EXPECT_MSG_EQ(Lookup(trie, m_prefixes[SIBLING].network).at(0),
+                          m_prefixes[SIBLING].length,
+                          "Sibling route not matched");
+    NS_TEST_EXPECT_MSG_EQ(trie.Find(ADDRESS(m_prefixes[SHORT].network),
+                                    MakeMask(m_prefixes[SHORT].length))
+                              ->size(),
+                          1,
+                          "Short prefix not found");
+    NS_TEST_EXPECT_MSG_EQ((trie.Find(ADDRESS(m_prefixes[MIDDLE].network),
+                                     MakeMask(m_prefixes[MIDDLE].length)) == nullptr),
+                          true,
+                          "Removed prefix still found");
+    NS_TEST_EXPECT_MSG_EQ(trie.GetSize(), 3, "Unexpected number of values");
+
+    trie.Clear();
+    NS_TEST_EXPECT_MSG_EQ(trie.GetSize(), 0, "The trie should be empty");
+    NS_TEST_EXPECT_MSG_EQ(Lookup(trie, host).empty(), true, "No route should match");
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Routing trie TestSuite
+ */
+class RoutingTrieTestSuite : public TestSuite
+{
+  public:
+    RoutingTrieTestSuite();
+};
+
+RoutingTrieTestSuite::RoutingTrieTestSuite()
+    : TestSuite("routing-trie", UNIT)
+{
+    AddTestCase(new RoutingTrieTestCase<Ipv4Address, Ipv4Mask>("IPv4",
+                                                               {{{"0.0.0.0", 0},
+                                                                 {"10.0.0.0", 8},
+                                                                 {"10.128.0.1", 9},
+                                                                 {"10.1.0.0", 16},
+                                                                 {"10.1.2.0", 24},
+                                                                 {"10.1.2.3", 32}}},
+                                                               {"192.168.0.1",
+                                                                "10.2.0.1",
+                                                                "10.200.0.1",
+                                                                "10.1.3.1",
+                                                                "10.1.2.4"}),
+                TestCase::QUICK);
+    AddTestCase(new RoutingTrieTestCase<Ipv6Address, Ipv6Prefix>("IPv6",
+                                                                 {{{"::", 0},
+                                                                   {"2001:db8::", 32},
+                                                                   {"2001:db8:8000::1", 33},
+                                                                   {"2001:db8:1::", 48},
+                                                                   {"2001:db8:1:2::", 64},
+                                                                   {"2001:db8:1:2::3", 128}}},
+                                                                 {"2002::1",
+                                                                  "2001:db8:2::1",
+                                                                  "2001:db8:c000::1",
+                                                                  "2001:db8:1:3::1",
+                                                                  "2001:db8:1:2::4"}),
+                TestCase::QUICK);
+}
+
+static RoutingTrieTestSuite g_routingTrieTestSuite; //!< Static variable for test initialization
@@ -42,6 +42,11 @@ class TcpRxBufferTestCase : public TestCase
      * \brief Test the SACK list update.
      */
     void TestUpdateSACKList();
+
+    /**
+     * \brief Test the buffer with a large amount of reordered data.
+     */
+    void TestReordering();
 };
 
 TcpRxBufferTestCase::TcpRxBufferTestCase()
@@ -53,6 +58,7 @@ void
 TcpRxBufferTestCase::DoRun()
 {
     TestUpdateSACKList();
+    TestReordering();
 }
 
 void
@@ -289,6 +295,85 @@ TcpRxBufferTestCase::TestUpdateSACKList()
     NS_TEST_ASSERT_MSG_EQ(sackList.size(), 0, "SACK list should contain no element");
 }
 
+void
+TcpRxBufferTestCase::TestReordering()
+{
+    TcpRxBuffer rxBuf;
+    TcpHeader h;
+    const uint32_t segments = 1000;
+    const uint32_t segmentSize = 100;
+    rxBuf.SetNextRxSequence(SequenceNumber32(1));
+    rxBuf.SetMaxBufferSize(segments * segmentSize);
+
+    // Each byte of the stream contains its offset modulo 251
+    auto createSegment = [segmentSize](uint32_t i) {
+        uint8_t data[segmentSize];
+        for (uint32_t j = 0; j < segmentSize; ++j)
+        {
+            data[j] = (i * segmentSize + j) % 251;
+        }
+        return Create<Packet>(data, segmentSize);
+    };
+
+    // The odd segments are received first
+    for (uint32_t i = 1; i < segments; i += 2)
+    {
+        h.SetSequenceNumber(SequenceNumber32(i * segmentSize + 1));
+        NS_TEST_ASSERT_MSG_EQ(rxBuf.Add(createSegment(i), h), true, "Segment not buffered");
+    }
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.NextRxSequence(),
+                          SequenceNumber32(1),
+                          "Sequence number differs from expected");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Size(), segments * segmentSize / 2, "Wrong buffer occupancy");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Available(), 0, "Data available with a hole at the head");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.GetSackListSize(), 4, "SACK list should contain 4 blocks");
+
+    // Duplicates are discarded
+    h.SetSequenceNumber(SequenceNumber32(501));
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Add(createSegment(5), h), false, "Duplicate segment buffered");
+    h.SetSequenceNumber(SequenceNumber32(521));
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Add(Create<Packet>(50), h), false, "Duplicate data buffered");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Size(), segments * segmentSize / 2, "Wrong buffer occupancy");
+
+    // The even segments are received in reverse order, the first one fills
+    // the hole at the head of the buffer
+    for (uint32_t i = segments - 2;; i -= 2)
+    {
+        h.SetSequenceNumber(SequenceNumber32(i * segmentSize + 1));
+        NS_TEST_ASSERT_MSG_EQ(rxBuf.Add(createSegment(i), h), true, "Segment not buffered");
+        NS_TEST_ASSERT_MSG_EQ(rxBuf.Available(),
+                              (i == 0 ? segments * segmentSize : 0),
+                              "Wrong number of available bytes");
+        if (i == 0)
+        {
+            break;
+        }
+    }
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.NextRxSequence(),
+                          SequenceNumber32(segments * segmentSize + 1),
+                          "Sequence number differs from expected");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.GetSackListSize(), 0, "SACK list should contain no element");
+
+    // Extract the data in chunks not aligned with the segments
+    uint32_t offset = 0;
+    while (rxBuf.Available() > 0)
+    {
+        Ptr<Packet> p = rxBuf.Extract(1234);
+        NS_TEST_ASSERT_MSG_EQ(p->GetSize(),
+                              std::min<uint32_t>(1234, segments * segmentSize - offset),
+                              "Wrong extracted size");
+        std::vector<uint8_t> data(p->GetSize());
+        p->CopyData(data.data(), data.size());
+        for (uint32_t j = 0; j < data.size(); ++j)
+        {
+            NS_TEST_ASSERT_MSG_EQ(data[j], (offset + j) % 251, "Wrong data at offset " << offset);
+        }
+        offset += p->GetSize();
+    }
+    NS_TEST_ASSERT_MSG_EQ(offset, segments * segmentSize, "Wrong number of extracted bytes");
+    NS_TEST_ASSERT_MSG_EQ(rxBuf.Size(), 0, "Buffer not empty");
+}
+
 void
 TcpRxBufferTestCase::DoTeardown()
 {
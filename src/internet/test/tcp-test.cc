@@ -37,7 +37,9 @@
 #include "ns3/simple-net-device.h"
 #include "ns3/simulator.h"
 #include "ns3/socket-factory.h"
+#include "ns3/tcp-header.h"
 #include "ns3/tcp-l4-protocol.h"
+#include "ns3/tcp-socket-base.h"
 #include "ns3/tcp-socket-factory.h"
 #include "ns3/test.h"
 #include "ns3/traffic-control-layer.h"
@@ -67,13 +69,15 @@ class TcpTestCase : public TestCase
      * \param serverWriteSize Server data size when sending.
      * \param serverReadSize Server data size when receiving.
      * \param useIpv6 Use IPv6 instead of IPv4.
+     * \param gsoMaxSize Maximum size of the GSO super-segments (0 to disable GSO).
      */
     TcpTestCase(uint32_t totalStreamSize,
                 uint32_t sourceWriteSize,
                 uint32_t sourceReadSize,
                 uint32_t serverWriteSize,
                 uint32_t serverReadSize,
-                bool useIpv6);
+                bool useIpv6,
+                uint32_t gsoMaxSize = 0);
 
   private:
     void DoRun() override;
@@ -146,6 +150,20 @@ class TcpTestCase : public TestCase
      * \param sock The socket.
      */
     void SourceHandleRecv(Ptr<Socket> sock);
+    /**
+     * \brief Client: Segment (or GSO super-segment) passed to TcpL4Protocol.
+     * \param p The packet.
+     * \param h The TCP header.
+     * \param sock The socket.
+     */
+    void SourceTx(Ptr<const Packet> p, const TcpHeader& h, Ptr<const TcpSocketBase> sock);
+    /**
+     * \brief Server: Segment received.
+     * \param p The packet.
+     * \param h The TCP header.
+     * \param sock The socket.
+     */
+    void ServerRx(Ptr<const Packet> p, const TcpHeader& h, Ptr<const TcpSocketBase> sock);
 
     uint32_t m_totalBytes;           //!< Total stream size (in bytes).
     uint32_t m_sourceWriteSize;      //!< Client data size when sending.
@@ -160,7 +178,11 @@ class TcpTestCase : public TestCase
     uint8_t* m_sourceRxPayload;      //!< Client Rx payload.
     uint8_t* m_serverRxPayload;      //!< Server Rx payload.
 
-    bool m_useIpv6; //!< Use IPv6 instead of IPv4.
+    bool m_useIpv6;         //!< Use IPv6 instead of IPv4.
+    uint32_t m_gsoMaxSize;  //!< Maximum size of the GSO super-segments.
+    uint32_t m_maxSourceTx; //!< Largest payload passed by the client to TcpL4Protocol.
+    uint32_t m_maxServerRx; //!< Largest payload received by the server.
+    uint32_t m_segmentSize; //!< Client segment size.
 };
 
 static std::string
@@ -170,12 +192,17 @@ Name(std::string str,
      uint32_t serverReadSize,
      uint32_t serverWriteSize,
      uint32_t sourceReadSize,
-     bool useIpv6)
+     bool useIpv6,
+     uint32_t gsoMaxSize)
 {
     std::ostringstream oss;
     oss << str << " total=" << totalStreamSize << " sourceWrite=" << sourceWriteSize
         << " sourceRead=" << sourceReadSize << " serverRead=" << serverReadSize
         << " serverWrite=" << serverWriteSize << " useIpv6=" << useIpv6;
+    if (gsoMaxSize > 0)
+    {
+        oss << " gsoMaxSize=" << gsoMaxSize;
+    }
     return oss.str();
 }
 
@@ -192,20 +219,23 @@ TcpTestCase::TcpTestCase(uint32_t totalStreamSize,
                          uint32_t sourceReadSize,
                          uint32_t serverWriteSize,
                          uint32_t serverReadSize,
-                         bool useIpv6)
+                         bool useIpv6,
+                         uint32_t gsoMaxSize)
     : TestCase(Name("Send string data from client to server and back",
                     totalStreamSize,
                     sourceWriteSize,
                     serverReadSize,
                     serverWriteSize,
                     sourceReadSize,
-                    useIpv6)),
+                    useIpv6,
+                    gsoMaxSize)),
       m_totalBytes(totalStreamSize),
       m_sourceWriteSize(sourceWriteSize),
       m_sourceReadSize(sourceReadSize),
       m_serverWriteSize(serverWriteSize),
       m_serverReadSize(serverReadSize),
-      m_useIpv6(useIpv6)
+      m_useIpv6(useIpv6),
+      m_gsoMaxSize(gsoMaxSize)
 {
 }
 
@@ -216,6 +246,8 @@ TcpTestCase::DoRun()
     m_currentSourceRxBytes = 0;
     m_currentServerRxBytes = 0;
     m_currentServerTxBytes = 0;
+    m_maxSourceTx = 0;
+    m_maxServerRx = 0;
     m_sourceTxPayload = new uint8_t[m_totalBytes];
     m_sourceRxPayload = new uint8_t[m_totalBytes];
     m_serverRxPayload = new uint8_t[m_totalBytes];
@@ -247,6 +279,24 @@ TcpTestCase::DoRun()
     NS_TEST_EXPECT_MSG_EQ(memcmp(m_sourceTxPayload, m_sourceRxPayload, m_totalBytes),
                           0,
                           "Source received back expected data buffers");
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(m_maxServerRx,
+                                m_segmentSize,
+                                "Server received a segment larger than the segment size");
+    if (m_gsoMaxSize > 0)
+    {
+        NS_TEST_EXPECT_MSG_GT(m_maxSourceTx,
+                              m_segmentSize,
+                              "Client did not send any GSO super-segment");
+        NS_TEST_EXPECT_MSG_LT_OR_EQ(m_maxSourceTx,
+                                    m_gsoMaxSize,
+                                    "Client sent a super-segment larger than GsoMaxSize");
+    }
+    else
+    {
+        NS_TEST_EXPECT_MSG_LT_OR_EQ(m_maxSourceTx,
+                                    m_segmentSize,
+                                    "Client sent a segment larger than the segment size");
+    }
 }
 
 void
@@ -262,6 +312,7 @@ void
 TcpTestCase::ServerHandleConnectionCreated(Ptr<Socket> s, const Address& addr)
 {
     s->SetRecvCallback(MakeCallback(&TcpTestCase::ServerHandleRecv, this));
+    s->TraceConnectWithoutContext("Rx", MakeCallback(&TcpTestCase::ServerRx, this));
     s->SetSendCallback(MakeCallback(&TcpTestCase::ServerHandleSend, this));
 }
 
@@ -346,6 +397,18 @@ TcpTestCase::SourceHandleRecv(Ptr<Socket> sock)
     }
 }
 
+void
+TcpTestCase::SourceTx(Ptr<const Packet> p, const TcpHeader& h, Ptr<const TcpSocketBase> sock)
+{
+    m_maxSourceTx = std::max(m_maxSourceTx, p->GetSize());
+}
+
+void
+TcpTestCase::ServerRx(Ptr<const Packet> p, const TcpHeader& h, Ptr<const TcpSocketBase> sock)
+{
+    m_maxServerRx = std::max(m_maxServerRx, p->GetSize());
+}
+
 Ptr<Node>
 TcpTestCase::CreateInternetNode()
 {
@@ -423,6 +486,12 @@ TcpTestCase::SetupDefaultSim()
 
     source->SetRecvCallback(MakeCallback(&TcpTestCase::SourceHandleRecv, this));
     source->SetSendCallback(MakeCallback(&TcpTestCase::SourceHandleSend, this));
+    source->TraceConnectWithoutContext("Tx", MakeCallback(&TcpTestCase::SourceTx, this));
+    server->SetAttribute("GsoMaxSize", UintegerValue(m_gsoMaxSize));
+    source->SetAttribute("GsoMaxSize", UintegerValue(m_gsoMaxSize));
+    UintegerValue segmentSize;
+    source->GetAttribute("SegmentSize", segmentSize);
+    m_segmentSize = segmentSize.Get();
 
     Address peerAddress;
     int err = source->GetPeerName(peerAddress);
@@ -473,6 +542,12 @@ TcpTestCase::SetupDefaultSim6()
 
     source->SetRecvCallback(MakeCallback(&TcpTestCase::SourceHandleRecv, this));
     source->SetSendCallback(MakeCallback(&TcpTestCase::SourceHandleSend, this));
+    source->TraceConnectWithoutContext("Tx", MakeCallback(&TcpTestCase::SourceTx, this));
+    server->SetAttribute("GsoMaxSize", UintegerValue(m_gsoMaxSize));
+    source->SetAttribute("GsoMaxSize", UintegerValue(m_gsoMaxSize));
+    UintegerValue segmentSize;
+    source->GetAttribute("SegmentSize", segmentSize);
+    m_segmentSize = segmentSize.Get();
 
     Address peerAddress;
     int err = source->GetPeerName(peerAddress);
@@ -558,6 +633,10 @@ class TcpTestSuite : public TestSuite
         AddTestCase(new TcpTestCase(13, 200, 200, 200, 200, true), TestCase::QUICK);
         AddTestCase(new TcpTestCase(13, 1, 1, 1, 1, true), TestCase::QUICK);
         AddTestCase(new TcpTestCase(100000, 100, 50, 100, 20, true), TestCase::QUICK);
+
+        // Same as above, with generic segmentation offload
+        AddTestCase(new TcpTestCase(100000, 100, 50, 100, 20, false, 65535), TestCase::QUICK);
+        AddTestCase(new TcpTestCase(100000, 100, 50, 100, 20, true, 65535), TestCase::QUICK);
     }
 };
 
@@ -53,6 +53,8 @@ class TcpTxBufferTestCase : public TestCase
     /** \brief Test the logic of merging items in GetTransmittedSegment()
      * which is triggered by CopyFromSequence()*/
     void TestMergeItemsWhenGetTransmittedSegment();
+    /** \brief Test the scoreboard with a large number of segments in flight */
+    void TestLargeScoreboard();
     /**
      * \brief Callback to provide a value of receiver window
      * \returns the receiver window size
@@ -100,6 +102,15 @@ TcpTxBufferTestCase::DoRun()
                         &TcpTxBufferTestCase::TestMergeItemsWhenGetTransmittedSegment,
                         this);
 
+    /*
+     * Scoreboard with a large window:
+     * -> every tenth segment is lost, all the others are SACKed one by one
+     * -> retransmissions split the lost items
+     * -> NextSeg walks the whole scoreboard
+     * -> cumulative ACKs discard part of the sent list
+     */
+    Simulator::Schedule(Seconds(0.0), &TcpTxBufferTestCase::TestLargeScoreboard, this);
+
     Simulator::Run();
     Simulator::Destroy();
 }
@@ -420,6 +431,109 @@ TcpTxBufferTestCase::TestMergeItemsWhenGetTransmittedSegment()
     txBuf.CopyFromSequence(2000, SequenceNumber32(1));
 }
 
+void
+TcpTxBufferTestCase::TestLargeScoreboard()
+{
+    Ptr<TcpTxBuffer> txBuf = CreateObject<TcpTxBuffer>();
+    txBuf->SetRWndCallback(MakeCallback(&TcpTxBufferTestCase::GetRWnd, this));
+    txBuf->SetMaxBufferSize(4000000);
+    txBuf->SetHeadSequence(SequenceNumber32(1));
+    txBuf->SetSegmentSize(1000);
+    txBuf->SetDupAckThresh(3);
+    txBuf->SetSackEnabled(true);
+
+    const uint32_t segments = 2000;
+    txBuf->Add(Create<Packet>(segments * 1000));
+    for (uint32_t i = 0; i < segments; ++i)
+    {
+        txBuf->CopyFromSequence(1000, SequenceNumber32(i * 1000 + 1));
+    }
+
+    // Every tenth segment is lost, the receiver SACKs all the others
+    Ptr<TcpOptionSack> sack = CreateObject<TcpOptionSack>();
+    for (uint32_t i = 0; i < segments; ++i)
+    {
+        if (i % 10 != 0)
+        {
+            sack->ClearSackList();
+            sack->AddSackBlock(TcpOptionSack::SackBlock(SequenceNumber32(i * 1000 + 1),
+                                                        SequenceNumber32(i * 1000 + 1001)));
+            txBuf->Update(sack->GetSackList());
+        }
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), 1800000, "Wrong number of SACKed bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(), 200000, "Wrong number of lost bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->BytesInFlight(), 0, "Wrong number of bytes in flight");
+    for (uint32_t i = 0; i < segments; i += 7)
+    {
+        NS_TEST_ASSERT_MSG_EQ(txBuf->IsLost(SequenceNumber32(i * 1000 + 1)),
+                              (i % 10 == 0),
+                              "Wrong lost state for segment " << i);
+    }
+
+    // Retransmit a whole lost segment, and the first half of another one
+    txBuf->CopyFromSequence(1000, SequenceNumber32(1000001));
+    txBuf->CopyFromSequence(500, SequenceNumber32(100001));
+
+    // Retransmitted segments stay marked as lost until they are (S)ACKed
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(), 200000, "Wrong number of lost bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetRetransmitsCount(),
+                          1500,
+                          "Wrong number of retransmitted bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->IsLost(SequenceNumber32(100501)),
+                          true,
+                          "Second half of a split segment is not lost");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->IsRetransmittedDataAcked(SequenceNumber32(1001001)),
+                          true,
+                          "ACK of a retransmitted segment not detected");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->IsRetransmittedDataAcked(SequenceNumber32(100501)),
+                          true,
+                          "ACK of a retransmitted half segment not detected");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->IsRetransmittedDataAcked(SequenceNumber32(1000001)),
+                          false,
+                          "ACK of a SACKed segment detected as retransmitted");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->IsRetransmittedDataAcked(SequenceNumber32(101001)),
+                          false,
+                          "ACK of a lost segment detected as retransmitted");
+
+    // A cumulative ACK removes the first 200 segments
+    txBuf->DiscardUpTo(SequenceNumber32(200001));
+
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), 1620000, "Wrong number of SACKed bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(), 180000, "Wrong number of lost bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetRetransmitsCount(),
+                          1000,
+                          "Wrong number of retransmitted bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->IsLost(SequenceNumber32(200001)),
+                          true,
+                          "Lost segment after a cumulative ACK not lost");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->IsLost(SequenceNumber32(201001)),
+                          false,
+                          "SACKed segment after a cumulative ACK lost");
+
+    // Retransmit the rest of the lost segments, then ACK everything
+    SequenceNumber32 next;
+    SequenceNumber32 nextHigh;
+    uint32_t retransmitted = 0;
+    while (txBuf->NextSeg(&next, &nextHigh, false) && next < SequenceNumber32(segments * 1000 + 1))
+    {
+        NS_TEST_ASSERT_MSG_EQ(txBuf->IsLost(next), true, "NextSeg returned a segment not lost");
+        txBuf->CopyFromSequence(nextHigh - next, next);
+        ++retransmitted;
+    }
+    NS_TEST_ASSERT_MSG_EQ(retransmitted, 179, "Wrong number of retransmitted segments");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetRetransmitsCount(),
+                          180000,
+                          "Wrong number of retransmitted bytes");
+
+    txBuf->DiscardUpTo(SequenceNumber32(segments * 1000 + 1));
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetSacked(), 0, "Wrong number of SACKed bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetLost(), 0, "Wrong number of lost bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->GetRetransmitsCount(), 0, "Wrong number of retransmitted bytes");
+    NS_TEST_ASSERT_MSG_EQ(txBuf->BytesInFlight(), 0, "Wrong number of bytes in flight");
+}
+
 void
 TcpTxBufferTestCase::TestTransmittedBlock()
 {
@@ -28,11 +28,15 @@
 #include "ns3/inet-socket-address.h"
 #include "ns3/inet6-socket-address.h"
 #include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-end-point-demux.h"
+#include "ns3/ipv4-end-point.h"
 #include "ns3/ipv4-l3-protocol.h"
 #include "ns3/ipv4-list-routing.h"
 #include "ns3/ipv4-queue-disc-item.h"
 #include "ns3/ipv4-static-routing.h"
 #include "ns3/ipv6-address-helper.h"
+#include "ns3/ipv6-end-point-demux.h"
+#include "ns3/ipv6-end-point.h"
 #include "ns3/ipv6-l3-protocol.h"
 #include "ns3/ipv6-list-routing.h"
 #include "ns3/ipv6-static-routing.h"
@@ -181,6 +185,7 @@ class UdpSocketImplTest : public TestCase
     Ptr<Packet> m_receivedPacket;        //!< Received packet (1).
     Ptr<Packet> m_receivedPacket2;       //!< Received packet (2).
     Ptr<Ipv4QueueDiscItem> m_sentPacket; //!< Sent packet.
+    uint32_t m_receivedCount{0};         //!< Number of packets received (1).
 
     /**
      * \brief Get the TOS of the received packet.
@@ -216,6 +221,16 @@ class UdpSocketImplTest : public TestCase
      * \param socket The sending socket.
      */
     void SendData(Ptr<Socket> socket);
+    /**
+     * \brief Send a batch of packets.
+     * \param socket The sending socket.
+     */
+    void DoSendBatch(Ptr<Socket> socket);
+    /**
+     * \brief Send a batch of packets.
+     * \param socket The sending socket.
+     */
+    void SendBatch(Ptr<Socket> socket);
 
   public:
     void DoRun() override;
@@ -250,6 +265,7 @@ UdpSocketImplTest::ReceivePkt(Ptr<Socket> socket)
     uint32_t availableData;
     availableData = socket->GetRxAvailable();
     m_receivedPacket = socket->Recv(std::numeric_limits<uint32_t>::max(), 0);
+    m_receivedCount++;
     NS_TEST_ASSERT_MSG_EQ(availableData,
                           m_receivedPacket->GetSize(),
                           "ReceivedPacket size is not equal to the Rx buffer size");
@@ -329,6 +345,24 @@ UdpSocketImplTest::SendData(Ptr<Socket> socket)
     Simulator::Run();
 }
 
+void
+UdpSocketImplTest::DoSendBatch(Ptr<Socket> socket)
+{
+    std::vector<Ptr<Packet>> packets{Create<Packet>(100), Create<Packet>(200), Create<Packet>(300)};
+    NS_TEST_EXPECT_MSG_EQ(socket->SendBatch(packets, 0), 3, "all the packets should be sent");
+}
+
+void
+UdpSocketImplTest::SendBatch(Ptr<Socket> socket)
+{
+    Simulator::ScheduleWithContext(socket->GetNode()->GetId(),
+                                   Seconds(0),
+                                   &UdpSocketImplTest::DoSendBatch,
+                                   this,
+                                   socket);
+    Simulator::Run();
+}
+
 void
 UdpSocketImplTest::DoRun()
 {
@@ -519,6 +553,17 @@ UdpSocketImplTest::DoRun()
 
     m_receivedPacket->RemoveAllByteTags();
 
+    // Batch test: the packets of a batch are sent in order with the socket options
+    m_receivedCount = 0;
+    SendBatch(txSocket);
+    NS_TEST_EXPECT_MSG_EQ(m_receivedCount, 3, "all the packets of the batch should be received");
+    NS_TEST_EXPECT_MSG_EQ(m_receivedPacket->GetSize(), 300, "the last packet should be the last");
+
+    NS_TEST_EXPECT_MSG_EQ(GetTos(), 0xb8, "the TOS should be set to 0xb8");
+    NS_TEST_EXPECT_MSG_EQ(GetPriority(), 4, "Interactive bulk (4)");
+
+    m_receivedPacket->RemoveAllByteTags();
+
     Simulator::Destroy();
 }
 
@@ -766,6 +811,144 @@ Udp6SocketImplTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief End point demultiplexer test.
+ *
+ * Checks that the four-tuple index of Ipv4EndPointDemux and Ipv6EndPointDemux
+ * follows the changes of the end points, and that wildcard end points are used
+ * when there is no exact match.
+ */
+class EndPointDemuxTest : public TestCase
+{
+  public:
+    EndPointDemuxTest();
+
+  private:
+    void DoRun() override;
+    /// Test the IPv4 demultiplexer
+    void DoRunIpv4();
+    /// Test the IPv6 demultiplexer
+    void DoRunIpv6();
+};
+
+EndPointDemuxTest::EndPointDemuxTest()
+    : TestCase("UDP and TCP end point demultiplexer test")
+{
+}
+
+void
+EndPointDemuxTest::DoRunIpv4()
+{
+    Ipv4EndPointDemux demux;
+    Ptr<Ipv4Interface> iface = CreateObject<Ipv4Interface>();
+    iface->AddAddress(Ipv4InterfaceAddress("10.0.0.1", "255.255.255.0"));
+    Ipv4Address local("10.0.0.1");
+    Ipv4Address peer("10.0.0.2");
+
+    Ipv4EndPoint* listener = demux.Allocate(nullptr, Ipv4Address::GetAny(), 80);
+    Ipv4EndPoint* connected = demux.Allocate(nullptr, local, 80, peer, 1000);
+    NS_TEST_ASSERT_MSG_NE(connected, nullptr, "Allocation failed");
+    NS_TEST_EXPECT_MSG_EQ(demux.Allocate(nullptr, local, 80, peer, 1000),
+                          nullptr,
+                          "Duplicated end point allocated");
+
+    Ipv4EndPointDemux::EndPoints found = demux.Lookup(local, 80, peer, 1000, iface);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Exact match not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), connected, "Wrong end point for the exact match");
+    found = demux.Lookup(local, 80, peer, 1001, iface);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Wildcard match not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), listener, "Wrong end point for the wildcard match");
+
+    // an end point connected after its allocation
+    Ipv4EndPoint* client = demux.Allocate();
+    uint16_t port = client->GetLocalPort();
+    client->SetLocalAddress(local);
+    client->SetPeer(peer, 443);
+    found = demux.Lookup(local, port, peer, 443, iface);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Connected end point not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), client, "Wrong connected end point");
+    client->SetPeer(Ipv4Address("10.0.0.3"), 443);
+    NS_TEST_EXPECT_MSG_EQ(demux.Lookup(local, port, peer, 443, iface).size(),
+                          0,
+                          "End point found with its previous peer");
+    NS_TEST_EXPECT_MSG_EQ(demux.Lookup(local, port, "10.0.0.3", 443, iface).size(),
+                          1,
+                          "End point not found with its new peer");
+
+    // subnet-directed local address
+    Ipv4EndPoint* subnet = demux.Allocate(nullptr, "10.0.0.0", 81, peer, 1000);
+    found = demux.Lookup("10.0.0.255", 81, peer, 1000, iface);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Subnet-directed end point not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), subnet, "Wrong subnet-directed end point");
+
+    connected->SetRxEnabled(false);
+    found = demux.Lookup(local, 80, peer, 1000, iface);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Wildcard match not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), listener, "Disabled end point found");
+    connected->SetRxEnabled(true);
+
+    demux.DeAllocate(connected);
+    found = demux.Lookup(local, 80, peer, 1000, iface);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Wildcard match not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), listener, "Deallocated end point found");
+    NS_TEST_EXPECT_MSG_EQ(demux.GetAllEndPoints().size(), 3, "Wrong number of end points");
+}
+
+void
+EndPointDemuxTest::DoRunIpv6()
+{
+    Ipv6EndPointDemux demux;
+    Ptr<Ipv6Interface> iface = CreateObject<Ipv6Interface>();
+    Ipv6Address local("2001:db8::1");
+    Ipv6Address peer("2001:db8::2");
+
+    Ipv6EndPoint* listener = demux.Allocate(nullptr, Ipv6Address::GetAny(), 80);
+    Ipv6EndPoint* connected = demux.Allocate(nullptr, local, 80, peer, 1000);
+    NS_TEST_ASSERT_MSG_NE(connected, nullptr, "Allocation failed");
+    NS_TEST_EXPECT_MSG_EQ(demux.Allocate(nullptr, local, 80, peer, 1000),
+                          nullptr,
+                          "Duplicated end point allocated");
+
+    Ipv6EndPointDemux::EndPoints found = demux.Lookup(local, 80, peer, 1000, iface);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Exact match not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), connected, "Wrong end point for the exact match");
+    found = demux.Lookup(local, 80, peer, 1001, iface);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Wildcard match not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), listener, "Wrong end point for the wildcard match");
+
+    // an end point connected after its allocation
+    Ipv6EndPoint* client = demux.Allocate();
+    client->SetLocalAddress(local);
+    client->SetLocalPort(5000);
+    client->SetPeer(peer, 443);
+    found = demux.Lookup(local, 5000, peer, 443, iface);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Connected end point not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), client, "Wrong connected end point");
+    client->SetPeer(Ipv6Address("2001:db8::3"), 443);
+    NS_TEST_EXPECT_MSG_EQ(demux.Lookup(local, 5000, peer, 443, iface).size(),
+                          0,
+                          "End point found with its previous peer");
+    NS_TEST_EXPECT_MSG_EQ(demux.Lookup(local, 5000, "2001:db8::3", 443, iface).size(),
+                          1,
+                          "End point not found with its new peer");
+
+    demux.DeAllocate(connected);
+    found = demux.Lookup(local, 80, peer, 1000, iface);
+    NS_TEST_ASSERT_MSG_EQ(found.size(), 1, "Wildcard match not found");
+    NS_TEST_EXPECT_MSG_EQ(found.front(), listener, "Deallocated end point found");
+    NS_TEST_EXPECT_MSG_EQ(demux.GetEndPoints().size(), 2, "Wrong number of end points");
+}
+
+void
+EndPointDemuxTest::DoRun()
+{
+    DoRunIpv4();
+    DoRunIpv6();
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -782,6 +965,7 @@ class UdpTestSuite : public TestSuite
         AddTestCase(new UdpSocketLoopbackTest, TestCase::QUICK);
         AddTestCase(new Udp6SocketImplTest, TestCase::QUICK);
         AddTestCase(new Udp6SocketLoopbackTest, TestCase::QUICK);
+        AddTestCase(new EndPointDemuxTest, TestCase::QUICK);
     }
 };
 
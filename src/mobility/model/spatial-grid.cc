@@ -0,0 +1,218 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "spatial-grid.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SpatialGrid");
+
+SpatialGrid::SpatialGrid()
+    : m_cellSize(100)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+SpatialGrid::~SpatialGrid()
+{
+    NS_LOG_FUNCTION(this);
+    Clear();
+}
+
+void
+SpatialGrid::SetCellSize(double cellSize)
+{
+    NS_LOG_FUNCTION(this << cellSize);
+    NS_ASSERT_MSG(cellSize > 0, "The size of the cells must be positive");
+    Clear();
+    m_cellSize = cellSize;
+}
+
+double
+SpatialGrid::GetCellSize() const
+{
+    return m_cellSize;
+}
+
+void
+SpatialGrid::Add(uint32_t id, Ptr<MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << id << mobility);
+    NS_ASSERT_MSG(mobility, "The item has no mobility model");
+    NS_ASSERT_MSG(m_items.find(id) == m_items.end(), "Item " << id << " already in the grid");
+
+    Item& item = m_items[id];
+    item.mobility = mobility;
+    item.courseChange = MakeCallback(&SpatialGrid::CourseChanged, this, id);
+    item.binned = false;
+    mobility->TraceConnectWithoutContext("CourseChange", item.courseChange);
+    Bin(id, item);
+}
+
+void
+SpatialGrid::Remove(uint32_t id)
+{
+    NS_LOG_FUNCTION(this << id);
+    auto it = m_items.find(id);
+    if (it == m_items.end())
+    {
+        return;
+    }
+    Unbin(id, it->second);
+    it->second.mobility->TraceDisconnectWithoutContext("CourseChange", it->second.courseChange);
+    m_changed.erase(id);
+    m_items.erase(it);
+}
+
+void
+SpatialGrid::Clear()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto& item : m_items)
+    {
+        item.second.mobility->TraceDisconnectWithoutContext("CourseChange",
+                                                            item.second.courseChange);
+    }
+    m_items.clear();
+    m_cells.clear();
+    m_moving.clear();
+    m_changed.clear();
+}
+
+uint32_t
+SpatialGrid::GetN() const
+{
+    return m_items.size();
+}
+
+void
+SpatialGrid::GetItemsInRange(const Vector& position, double range, std::vector<uint32_t>& ids)
+{
+    NS_LOG_FUNCTION(this << position << range);
+    Update();
+    ids.clear();
+
+    // the number of cells overlapping the square, computed in floating point
+    // to cope with infinite ranges
+    double side = std::floor((position.x + range) / m_cellSize) -
+                  std::floor((position.x - range) / m_cellSize) + 1;
+    if (side * side > m_cells.size())
+    {
+        // fewer non-empty cells than cells in the square, check them all
+        for (const auto& cell : m_cells)
+        {
+            double xMin = cell.first.first * m_cellSize;
+            double yMin = cell.first.second * m_cellSize;
+            if (xMin <= position.x + range && xMin + m_cellSize >= position.x - range &&
+                yMin <= position.y + range && yMin + m_cellSize >= position.y - range)
+            {
+                ids.insert(ids.end(), cell.second.begin(), cell.second.end());
+            }
+        }
+    }
+    else
+    {
+        int64_t xMin = GetCellCoordinate(position.x - range);
+        int64_t xMax = GetCellCoordinate(position.x + range);
+        int64_t yMin = GetCellCoordinate(position.y - range);
+        int64_t yMax = GetCellCoordinate(position.y + range);
+        for (int64_t x = xMin; x <= xMax; x++)
+        {
+            // the cells of a column are contiguous in the map
+            for (auto it = m_cells.lower_bound(Cell(x, yMin));
+                 it != m_cells.end() && it->first <= Cell(x, yMax);
+                 it++)
+            {
+                ids.insert(ids.end(), it->second.begin(), it->second.end());
+            }
+        }
+    }
+    ids.insert(ids.end(), m_moving.begin(), m_moving.end());
+    std::sort(ids.begin(), ids.end());
+}
+
+void
+SpatialGrid::CourseChanged(uint32_t id, Ptr<const MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << id << mobility);
+    m_changed.insert(id);
+}
+
+void
+SpatialGrid::Update()
+{
+    // getting the position may trigger course changes, which are recorded
+    // for the next update
+    std::set<uint32_t> changed;
+    changed.swap(m_changed);
+    for (uint32_t id : changed)
+    {
+        auto it = m_items.find(id);
+        NS_ASSERT(it != m_items.end());
+        Unbin(id, it->second);
+        Bin(id, it->second);
+    }
+}
+
+void
+SpatialGrid::Bin(uint32_t id, Item& item)
+{
+    Vector velocity = item.mobility->GetVelocity();
+    if (velocity.x != 0 || velocity.y != 0 || velocity.z != 0)
+    {
+        NS_LOG_LOGIC("Item " << id << " is moving");
+        m_moving.insert(id);
+        return;
+    }
+    Vector position = item.mobility->GetPosition();
+    item.cell = Cell(GetCellCoordinate(position.x), GetCellCoordinate(position.y));
+    item.binned = true;
+    m_cells[item.cell].push_back(id);
+    NS_LOG_LOGIC("Item " << id << " in cell (" << item.cell.first << ", " << item.cell.second
+                         << ")");
+}
+
+void
+SpatialGrid::Unbin(uint32_t id, Item& item)
+{
+    if (!item.binned)
+    {
+        m_moving.erase(id);
+        return;
+    }
+    auto cell = m_cells.find(item.cell);
+    NS_ASSERT(cell != m_cells.end());
+    cell->second.erase(std::find(cell->second.begin(), cell->second.end(), id));
+    if (cell->second.empty())
+    {
+        m_cells.erase(cell);
+    }
+    item.binned = false;
+}
+
+int64_t
+SpatialGrid::GetCellCoordinate(double coordinate) const
+{
+    return static_cast<int64_t>(std::floor(coordinate / m_cellSize));
+}
+
+} // namespace ns3
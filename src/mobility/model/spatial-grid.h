@@ -0,0 +1,161 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include "mobility-model.h"
+
+#include "ns3/callback.h"
+#include "ns3/ptr.h"
+#include "ns3/vector.h"
+
+#include <map>
+#include <set>
+#include <stdint.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup mobility
+ * \brief Uniform grid index of the positions of a set of mobility models.
+ *
+ * The items, identified by an integer, are binned in square cells
+ * according to the (x, y) position of their mobility model, so that the
+ * items close to a position are found without scanning all the items.
+ *
+ * The index is updated lazily: the grid listens to the CourseChange trace
+ * of the mobility models, and the items which changed course are moved to
+ * their new cell at the next query.  The position of a moving item changes
+ * without course change notifications, hence the items with a non-null
+ * velocity are not binned and are returned by every query.
+ */
+class SpatialGrid
+{
+  public:
+    SpatialGrid();
+    ~SpatialGrid();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    SpatialGrid(const SpatialGrid&) = delete;
+    SpatialGrid& operator=(const SpatialGrid&) = delete;
+
+    /**
+     * \brief Set the size of the cells, which removes all the items.
+     * \param cellSize the side of the cells, in meters
+     */
+    void SetCellSize(double cellSize);
+
+    /**
+     * \return the side of the cells, in meters
+     */
+    double GetCellSize() const;
+
+    /**
+     * \brief Add an item.
+     * \param id the identifier of the item, which must not be in the grid
+     * \param mobility the mobility model of the item
+     */
+    void Add(uint32_t id, Ptr<MobilityModel> mobility);
+
+    /**
+     * \brief Remove an item, if it is in the grid.
+     * \param id the identifier of the item
+     */
+    void Remove(uint32_t id);
+
+    /**
+     * \brief Remove all the items.
+     */
+    void Clear();
+
+    /**
+     * \return the number of items in the grid
+     */
+    uint32_t GetN() const;
+
+    /**
+     * \brief Get the items that may be within the given distance of a position.
+     *
+     * The items returned are the ones binned in the cells overlapping the
+     * square of side 2 * \p range centered in \p position, plus the moving
+     * items.  Hence some items may be farther than \p range, and the caller
+     * has to check their actual distance if needed.
+     *
+     * \param position the position
+     * \param range the distance, in meters
+     * \param [out] ids the identifiers of the items, in increasing order
+     */
+    void GetItemsInRange(const Vector& position, double range, std::vector<uint32_t>& ids);
+
+  private:
+    /// Cell coordinates
+    typedef std::pair<int64_t, int64_t> Cell;
+
+    /// An item of the grid
+    struct Item
+    {
+        Ptr<MobilityModel> mobility;                           //!< Mobility model of the item
+        Callback<void, Ptr<const MobilityModel>> courseChange; //!< CourseChange trace sink
+        bool binned;                                           //!< Whether the item is in a cell
+        Cell cell;                                             //!< Cell of the item, if binned
+    };
+
+    /**
+     * \brief Record that an item changed course.
+     * \param id the identifier of the item
+     * \param mobility the mobility model of the item
+     */
+    void CourseChanged(uint32_t id, Ptr<const MobilityModel> mobility);
+
+    /**
+     * \brief Move the items which changed course to their current cell.
+     */
+    void Update();
+
+    /**
+     * \brief Put an item in the cell of its current position, or in the
+     * moving items if its velocity is not null.
+     * \param id the identifier of the item
+     * \param item the item
+     */
+    void Bin(uint32_t id, Item& item);
+
+    /**
+     * \brief Remove an item from its cell or from the moving items.
+     * \param id the identifier of the item
+     * \param item the item
+     */
+    void Unbin(uint32_t id, Item& item);
+
+    /**
+     * \param coordinate a coordinate, in meters
+     * \return the coordinate of the cell including the given coordinate
+     */
+    int64_t GetCellCoordinate(double coordinate) const;
+
+    double m_cellSize;                             //!< Side of the cells, in meters
+    std::unordered_map<uint32_t, Item> m_items;    //!< Items, indexed by identifier
+    std::map<Cell, std::vector<uint32_t>> m_cells; //!< Identifiers of the binned items
+    std::set<uint32_t> m_moving;                   //!< Identifiers of the moving items
+    std::set<uint32_t> m_changed;                  //!< Items which changed course
+};
+
+} // namespace ns3
+
+#endif /* SPATIAL_GRID_H */
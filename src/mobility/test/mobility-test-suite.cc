@@ -23,14 +23,20 @@
  */
 
 #include "ns3/boolean.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
 #include "ns3/mobility-helper.h"
 #include "ns3/mobility-model.h"
 #include "ns3/scheduler.h"
 #include "ns3/simulator.h"
+#include "ns3/spatial-grid.h"
 #include "ns3/test.h"
 #include "ns3/vector.h"
 #include "ns3/waypoint-mobility-model.h"
 
+#include <limits>
+#include <vector>
+
 using namespace ns3;
 
 /**
@@ -476,6 +482,98 @@ WaypointMobilityModelViaHelper::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Test the items returned by SpatialGrid queries, as the items
+ * are moved, start or stop moving, and are removed
+ */
+class SpatialGridTest : public TestCase
+{
+  public:
+    SpatialGridTest();
+
+  private:
+    void DoRun() override;
+    /**
+     * Check the items returned by a query around the origin
+     * \param range the range of the query
+     * \param expected the expected items
+     * \param msg the message printed if the check fails
+     */
+    void CheckItems(double range, std::vector<uint32_t> expected, std::string msg);
+
+    SpatialGrid m_grid; ///< the grid
+};
+
+SpatialGridTest::SpatialGridTest()
+    : TestCase("Test the items in range returned by SpatialGrid")
+{
+}
+
+void
+SpatialGridTest::CheckItems(double range, std::vector<uint32_t> expected, std::string msg)
+{
+    std::vector<uint32_t> ids;
+    m_grid.GetItemsInRange(Vector(0.0, 0.0, 0.0), range, ids);
+    NS_TEST_ASSERT_MSG_EQ(ids.size(), expected.size(), msg << ": unexpected number of items");
+    for (std::size_t i = 0; i < ids.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(ids[i], expected[i], msg << ": unexpected item");
+    }
+}
+
+void
+SpatialGridTest::DoRun()
+{
+    m_grid.SetCellSize(100);
+
+    Ptr<ConstantPositionMobilityModel> near = CreateObject<ConstantPositionMobilityModel>();
+    near->SetPosition(Vector(10.0, -10.0, 0.0));
+    Ptr<ConstantPositionMobilityModel> middle = CreateObject<ConstantPositionMobilityModel>();
+    middle->SetPosition(Vector(150.0, 0.0, 0.0));
+    Ptr<ConstantPositionMobilityModel> far = CreateObject<ConstantPositionMobilityModel>();
+    far->SetPosition(Vector(1000.0, 1000.0, 0.0));
+    Ptr<ConstantVelocityMobilityModel> moving = CreateObject<ConstantVelocityMobilityModel>();
+    moving->SetPosition(Vector(5000.0, 5000.0, 0.0));
+    moving->SetVelocity(Vector(1.0, 0.0, 0.0));
+
+    // the items are added in a different order than their identifiers
+    m_grid.Add(3, moving);
+    m_grid.Add(2, far);
+    m_grid.Add(0, near);
+    m_grid.Add(1, middle);
+    NS_TEST_EXPECT_MSG_EQ(m_grid.GetN(), 4, "Unexpected number of items");
+
+    CheckItems(50, {0, 3}, "Short range");
+    CheckItems(200, {0, 1, 3}, "Medium range");
+    CheckItems(std::numeric_limits<double>::infinity(), {0, 1, 2, 3}, "Infinite range");
+
+    // moved items are found in their new cell
+    middle->SetPosition(Vector(-2000.0, 0.0, 0.0));
+    far->SetPosition(Vector(0.0, 120.0, 0.0));
+    CheckItems(200, {0, 2, 3}, "Medium range after moving");
+
+    // items which stop moving are binned, items which start moving are not
+    moving->SetVelocity(Vector(0.0, 0.0, 0.0));
+    CheckItems(200, {0, 2}, "Medium range after stopping");
+    Ptr<ConstantVelocityMobilityModel> start = CreateObject<ConstantVelocityMobilityModel>();
+    start->SetPosition(Vector(-5000.0, 0.0, 0.0));
+    m_grid.Add(4, start);
+    CheckItems(200, {0, 2}, "Medium range with a static item");
+    start->SetVelocity(Vector(0.0, 1.0, 0.0));
+    CheckItems(200, {0, 2, 4}, "Medium range after starting");
+
+    m_grid.Remove(0);
+    m_grid.Remove(4);
+    CheckItems(200, {2}, "Medium range after removing");
+    NS_TEST_EXPECT_MSG_EQ(m_grid.GetN(), 3, "Unexpected number of items");
+
+    m_grid.Clear();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup mobility-test
  * \ingroup tests
@@ -495,6 +593,7 @@ MobilityTestSuite::MobilityTestSuite()
     AddTestCase(new WaypointLazyNotifyTrue, TestCase::QUICK);
     AddTestCase(new WaypointInitialPositionIsWaypoint, TestCase::QUICK);
     AddTestCase(new WaypointMobilityModelViaHelper, TestCase::QUICK);
+    AddTestCase(new SpatialGridTest, TestCase::QUICK);
 }
 
 static MobilityTestSuite mobilityTestSuite; ///< the test suite
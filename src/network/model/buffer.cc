@@ -21,6 +21,8 @@
 #include "ns3/assert.h"
 #include "ns3/log.h"
 
+#include <algorithm>
+
 #define LOG_INTERNAL_STATE(y)                                                                      \
     NS_LOG_LOGIC(y << "start=" << m_start << ", end=" << m_end                                     \
                    << ", zero start=" << m_zeroAreaStart << ", zero end=" << m_zeroAreaEnd         \
@@ -47,6 +49,47 @@ struct Zeroes
     const uint32_t size; //!< buffer size
 } g_zeroes;              //!< Zero-filled buffer
 
+/**
+ * \ingroup packet
+ * \brief Compute the one's complement sum (RFC 1071) of a memory area.
+ *
+ * The area is read as a sequence of 16 bit little endian words (as done by
+ * Buffer::Iterator::ReadU16), eight bytes at a time.
+ *
+ * \param data the memory area
+ * \param size the size of the memory area
+ * \return the sum, folded to 16 bits
+ */
+uint16_t
+OnesComplementSum(const uint8_t* data, uint32_t size)
+{
+    uint64_t sum = 0;
+    while (size >= 8)
+    {
+        uint32_t low = data[0] | (data[1] << 8) | (data[2] << 16) | (uint32_t(data[3]) << 24);
+        uint32_t high = data[4] | (data[5] << 8) | (data[6] << 16) | (uint32_t(data[7]) << 24);
+        sum += low;
+        sum += high;
+        data += 8;
+        size -= 8;
+    }
+    while (size >= 2)
+    {
+        sum += data[0] | (data[1] << 8);
+        data += 2;
+        size -= 2;
+    }
+    if (size)
+    {
+        sum += data[0];
+    }
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return sum;
+}
+
 } // namespace
 
 namespace ns3
@@ -1145,17 +1188,40 @@ uint16_t
 Buffer::Iterator::CalculateIpChecksum(uint16_t size, uint32_t initialChecksum)
 {
     NS_LOG_FUNCTION(this << size << initialChecksum);
-    /* see RFC 1071 to understand this code. */
-    uint32_t sum = initialChecksum;
-
-    for (int j = 0; j < size / 2; j++)
+    NS_ASSERT_MSG(m_current + size <= m_dataEnd, GetReadErrorMessage());
+    /* see RFC 1071 to understand this code.
+     * The data before and after the virtual zero area are summed separately
+     * (the zero area does not change the sum).  The sum of an area starting at
+     * an odd offset is byte-swapped, which is equivalent to summing its words
+     * with the bytes swapped (RFC 1071, section 2.B).
+     */
+    uint64_t sum = initialChecksum;
+    uint32_t end = m_current + size;
+    uint32_t offset = 0;
+
+    if (m_current < m_zeroStart)
     {
-        sum += ReadU16();
+        uint32_t areaEnd = std::min(end, m_zeroStart);
+        sum += OnesComplementSum(&m_data[m_current], areaEnd - m_current);
+        offset += areaEnd - m_current;
+        m_current = areaEnd;
     }
-
-    if (size & 1)
+    if (m_current < end && m_current < m_zeroEnd)
+    {
+        uint32_t areaEnd = std::min(end, m_zeroEnd);
+        offset += areaEnd - m_current;
+        m_current = areaEnd;
+    }
+    if (m_current < end)
     {
-        sum += ReadU8();
+        uint16_t areaSum = OnesComplementSum(&m_data[m_current - (m_zeroEnd - m_zeroStart)],
+                                             end - m_current);
+        if (offset & 1)
+        {
+            areaSum = (areaSum << 8) | (areaSum >> 8);
+        }
+        sum += areaSum;
+        m_current = end;
     }
 
     while (sum >> 16)
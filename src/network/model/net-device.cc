@@ -20,6 +20,7 @@
 #include "net-device.h"
 
 #include "ns3/log.h"
+#include "ns3/queue-item.h"
 
 namespace ns3
 {
@@ -40,4 +41,19 @@ NetDevice::~NetDevice()
     NS_LOG_FUNCTION(this);
 }
 
+uint32_t
+NetDevice::SendBatch(const std::vector<Ptr<QueueDiscItem>>& items)
+{
+    NS_LOG_FUNCTION(this << items.size());
+    uint32_t sent = 0;
+    for (const auto& item : items)
+    {
+        if (Send(item->GetPacket(), item->GetAddress(), item->GetProtocol()))
+        {
+            sent++;
+        }
+    }
+    return sent;
+}
+
 } // namespace ns3
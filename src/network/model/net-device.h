@@ -30,12 +30,14 @@
 #include "ns3/ptr.h"
 
 #include <stdint.h>
+#include <vector>
 
 namespace ns3
 {
 
 class Node;
 class Channel;
+class QueueDiscItem;
 
 /**
  * \ingroup network
@@ -264,6 +266,20 @@ class NetDevice : public Object
                           const Address& source,
                           const Address& dest,
                           uint16_t protocolNumber) = 0;
+    /**
+     * \brief Send a batch of packets.
+     *
+     * Called by the traffic control layer when a queue disc dequeues several
+     * packets at once (bulk dequeue). Devices can override this method to
+     * handle the whole batch at once, e.g., by starting a single transmission
+     * chain for all the packets. The default implementation calls Send for
+     * every packet.
+     *
+     * \param items the packets, along with their destination address and
+     *        protocol number
+     * \return the number of packets whose Send operation succeeded
+     */
+    virtual uint32_t SendBatch(const std::vector<Ptr<QueueDiscItem>>& items);
     /**
      * \returns the node base class which contains this network
      *          interface.
@@ -136,6 +136,22 @@ Socket::Send(Ptr<Packet> p)
     return Send(p, 0);
 }
 
+int
+Socket::SendBatch(const std::vector<Ptr<Packet>>& packets, uint32_t flags)
+{
+    NS_LOG_FUNCTION(this << packets.size() << flags);
+    int sent = 0;
+    for (const auto& p : packets)
+    {
+        if (Send(p, flags) < 0)
+        {
+            return sent > 0 ? sent : -1;
+        }
+        sent++;
+    }
+    return sent;
+}
+
 int
 Socket::Send(const uint8_t* buf, uint32_t size, uint32_t flags)
 {
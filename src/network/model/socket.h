@@ -33,6 +33,7 @@
 #include "ns3/tag.h"
 
 #include <stdint.h>
+#include <vector>
 
 namespace ns3
 {
@@ -391,6 +392,26 @@ class Socket : public Object
      */
     virtual int SendTo(Ptr<Packet> p, uint32_t flags, const Address& toAddress) = 0;
 
+    /**
+     * \brief Send a batch of packets to the remote host
+     *
+     * This function is similar to the sendmmsg() function call in
+     * the Linux C library: the packets are sent in order, as if Send()
+     * was called for each of them, and the sending stops at the first
+     * packet that can not be sent.
+     *
+     * Subclasses may override this method to share the per-packet costs
+     * (e.g., the route lookup and the construction of the headers) among
+     * all the packets of the batch.  The default implementation calls
+     * Send() for each packet.
+     *
+     * \param packets the packets to send
+     * \param flags Socket control flags
+     * \returns the number of packets accepted for transmission, or -1 if
+     *          the first packet could not be sent (SocketErrno is then set).
+     */
+    virtual int SendBatch(const std::vector<Ptr<Packet>>& packets, uint32_t flags);
+
     /**
      * Return number of bytes which can be returned from one or
      * multiple calls to Recv.
@@ -394,6 +394,51 @@ BufferTest::DoRun()
     val2 <<= 8;
     val2 |= i.ReadU8();
     NS_TEST_ASSERT_MSG_EQ(val1, val2, "Bad ReadNtohU16()");
+
+    // checksum over a buffer with a zero area, starting at even and odd offsets
+    buffer = Buffer(37);
+    buffer.AddAtStart(23);
+    buffer.AddAtEnd(41);
+    i = buffer.Begin();
+    for (uint32_t j = 0; j < 23; j++)
+    {
+        i.WriteU8(static_cast<uint8_t>(j * 37 + 0xe1));
+    }
+    i = buffer.End();
+    i.Prev(41);
+    for (uint32_t j = 0; j < 41; j++)
+    {
+        i.WriteU8(static_cast<uint8_t>(j * 53 + 0xf7));
+    }
+    for (uint32_t start = 0; start < 4; start++)
+    {
+        for (uint32_t size = 0; size + start <= buffer.GetSize(); size += 7)
+        {
+            i = buffer.Begin();
+            i.Next(start);
+            uint32_t sum = 0x1234;
+            for (uint32_t j = 0; j < size / 2; j++)
+            {
+                sum += i.ReadU16();
+            }
+            if (size & 1)
+            {
+                sum += i.ReadU8();
+            }
+            while (sum >> 16)
+            {
+                sum = (sum & 0xffff) + (sum >> 16);
+            }
+            i = buffer.Begin();
+            i.Next(start);
+            NS_TEST_ASSERT_MSG_EQ(i.CalculateIpChecksum(size, 0x1234),
+                                  static_cast<uint16_t>(~sum),
+                                  "Bad checksum from offset " << start << " size " << size);
+            NS_TEST_ASSERT_MSG_EQ(i.GetDistanceFrom(buffer.Begin()),
+                                  start + size,
+                                  "Bad iterator position after checksum");
+        }
+    }
 }
 
 /**
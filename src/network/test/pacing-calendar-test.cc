@@ -0,0 +1,127 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/pacing-calendar.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <map>
+
+using namespace ns3;
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Pacing Calendar Test
+ *
+ * Releases scheduled in the same slot are performed by a single event, at
+ * the end of the slot; cancelled releases are not performed, and releases
+ * scheduled while a slot is being released are performed in the right slot.
+ */
+class PacingCalendarTest : public TestCase
+{
+  public:
+    PacingCalendarTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Record the time of a release.
+     * \param flow the flow released
+     */
+    void Release(uint32_t flow);
+
+    Ptr<PacingCalendar> m_calendar;      //!< The calendar
+    std::map<uint32_t, Time> m_releases; //!< Release time of each flow
+};
+
+PacingCalendarTest::PacingCalendarTest()
+    : TestCase("Pacing calendar releases")
+{
+}
+
+void
+PacingCalendarTest::Release(uint32_t flow)
+{
+    m_releases[flow] = Simulator::Now();
+    if (flow == 1)
+    {
+        // released in the current slot, by a new event
+        m_calendar->Schedule(Time(0), MakeCallback(&PacingCalendarTest::Release, this, 5));
+    }
+}
+
+void
+PacingCalendarTest::DoRun()
+{
+    m_calendar = CreateObject<PacingCalendar>();
+    m_calendar->SetAttribute("Granularity", TimeValue(MilliSeconds(1)));
+
+    m_calendar->Schedule(MicroSeconds(200), MakeCallback(&PacingCalendarTest::Release, this, 1));
+    m_calendar->Schedule(MicroSeconds(700), MakeCallback(&PacingCalendarTest::Release, this, 2));
+    m_calendar->Schedule(MicroSeconds(1500), MakeCallback(&PacingCalendarTest::Release, this, 3));
+    PacingCalendar::ReleaseId id =
+        m_calendar->Schedule(MicroSeconds(300),
+                             MakeCallback(&PacingCalendarTest::Release, this, 4));
+
+    NS_TEST_EXPECT_MSG_EQ(m_calendar->GetNPending(), 4, "Unexpected number of pending releases");
+    NS_TEST_EXPECT_MSG_EQ(m_calendar->IsPending(id), true, "The release should be pending");
+    NS_TEST_EXPECT_MSG_EQ(m_calendar->GetDelayLeft(id),
+                          MilliSeconds(1),
+                          "The release should be rounded up to the end of the slot");
+    m_calendar->Cancel(id);
+    NS_TEST_EXPECT_MSG_EQ(m_calendar->IsPending(id), false, "The release should be cancelled");
+
+    uint64_t events = Simulator::GetEventCount();
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(Simulator::GetEventCount() - events,
+                          3,
+                          "Expected one event per slot and one for the late release");
+    NS_TEST_EXPECT_MSG_EQ(m_releases.size(), 4, "Unexpected number of releases");
+    NS_TEST_EXPECT_MSG_EQ(m_releases[1], MilliSeconds(1), "Unexpected release time");
+    NS_TEST_EXPECT_MSG_EQ(m_releases[2], MilliSeconds(1), "Unexpected release time");
+    NS_TEST_EXPECT_MSG_EQ(m_releases[3], MilliSeconds(2), "Unexpected release time");
+    NS_TEST_EXPECT_MSG_EQ(m_releases.count(4), 0, "A cancelled release has been performed");
+    NS_TEST_EXPECT_MSG_EQ(m_releases[5], MilliSeconds(1), "Unexpected release time");
+    NS_TEST_EXPECT_MSG_EQ(m_calendar->GetNPending(), 0, "No release should be pending");
+
+    Simulator::Destroy();
+    m_calendar->Dispose();
+    m_calendar = nullptr;
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Pacing Calendar TestSuite
+ */
+class PacingCalendarTestSuite : public TestSuite
+{
+  public:
+    PacingCalendarTestSuite();
+};
+
+PacingCalendarTestSuite::PacingCalendarTestSuite()
+    : TestSuite("pacing-calendar", UNIT)
+{
+    AddTestCase(new PacingCalendarTest(), TestCase::QUICK);
+}
+
+static PacingCalendarTestSuite
+    g_pacingCalendarTestSuite; //!< Static variable for test initialization
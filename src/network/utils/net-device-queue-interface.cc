@@ -43,6 +43,7 @@ NetDeviceQueue::GetTypeId()
 NetDeviceQueue::NetDeviceQueue()
     : m_stoppedByDevice(false),
       m_stoppedByQueueLimits(false),
+      m_inBatch(false),
       NS_LOG_TEMPLATE_DEFINE("NetDeviceQueueInterface")
 {
     NS_LOG_FUNCTION(this);
@@ -55,6 +56,7 @@ NetDeviceQueue::~NetDeviceQueue()
     m_queueLimits = nullptr;
     m_wakeCallback.Nullify();
     m_device = nullptr;
+    m_hasRoom = nullptr;
 }
 
 bool
@@ -64,6 +66,13 @@ NetDeviceQueue::IsStopped() const
     return m_stoppedByDevice || m_stoppedByQueueLimits;
 }
 
+bool
+NetDeviceQueue::HasRoomFor(uint32_t nPackets) const
+{
+    NS_LOG_FUNCTION(this << nPackets);
+    return m_hasRoom && m_hasRoom(nPackets);
+}
+
 void
 NetDeviceQueue::Start()
 {
@@ -117,13 +126,31 @@ NetDeviceQueue::NotifyQueuedBytes(uint32_t bytes)
         return;
     }
     m_queueLimits->Queued(bytes);
-    if (m_queueLimits->Available() >= 0)
+    if (m_inBatch || m_queueLimits->Available() >= 0)
     {
         return;
     }
     m_stoppedByQueueLimits = true;
 }
 
+void
+NetDeviceQueue::BeginBatch()
+{
+    NS_LOG_FUNCTION(this);
+    m_inBatch = true;
+}
+
+void
+NetDeviceQueue::EndBatch()
+{
+    NS_LOG_FUNCTION(this);
+    m_inBatch = false;
+    if (m_queueLimits && m_queueLimits->Available() < 0)
+    {
+        m_stoppedByQueueLimits = true;
+    }
+}
+
 void
 NetDeviceQueue::NotifyTransmittedBytes(uint32_t bytes)
 {
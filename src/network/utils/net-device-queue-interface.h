@@ -93,6 +93,18 @@ class NetDeviceQueue : public Object
      */
     virtual bool IsStopped() const;
 
+    /**
+     * \brief Check whether the device transmission queue can store further packets.
+     * \param nPackets the number of packets
+     * \return true if the device queue connected through ConnectQueueTraces can
+     *         store the given number of packets of maximum size (the MTU of the
+     *         device) in addition to the packets it holds, false if it cannot or
+     *         if no device queue is connected.
+     *
+     * Called by queue discs to bound the number of packets dequeued in bulk.
+     */
+    bool HasRoomFor(uint32_t nPackets) const;
+
     /**
      * \brief Notify this NetDeviceQueue that the NetDeviceQueueInterface was
      *        aggregated to an object.
@@ -131,6 +143,24 @@ class NetDeviceQueue : public Object
      */
     virtual void NotifyTransmittedBytes(uint32_t bytes);
 
+    /**
+     * \brief Called by the netdevice before it enqueues a batch of packets
+     *
+     * Until EndBatch is called, the bytes reported by NotifyQueuedBytes are
+     * accounted for by the queue limits object, but the queue is not stopped
+     * if the limit is exceeded.
+     * This is the analogous to the xmit_more flag of the Linux kernel.
+     */
+    void BeginBatch();
+
+    /**
+     * \brief Called by the netdevice after it enqueued a batch of packets
+     *
+     * Stop the queue if the bytes queued during the batch exceed the limit
+     * set by the queue limits object.
+     */
+    void EndBatch();
+
     /**
      * \brief Reset queue limits state
      */
@@ -206,9 +236,12 @@ class NetDeviceQueue : public Object
   private:
     bool m_stoppedByDevice;         //!< True if the queue has been stopped by the device
     bool m_stoppedByQueueLimits;    //!< True if the queue has been stopped by a queue limits object
+    bool m_inBatch;                 //!< True if the device is enqueuing a batch of packets
     Ptr<QueueLimits> m_queueLimits; //!< Queue limits object
     WakeCallback m_wakeCallback;    //!< Wake callback
     Ptr<NetDevice> m_device;        //!< the netdevice aggregated to the NetDeviceQueueInterface
+    /// Check whether the connected device queue can store the given number of packets
+    std::function<bool(uint32_t)> m_hasRoom;
 
     NS_LOG_TEMPLATE_DECLARE; //!< redefinition of the log component
 };
@@ -333,6 +366,12 @@ NetDeviceQueue::ConnectQueueTraces(Ptr<QueueType> queue)
     queue->TraceConnectWithoutContext(
         "DropBeforeEnqueue",
         MakeCallback(&NetDeviceQueue::PacketDiscarded<QueueType>, this).Bind(PeekPointer(queue)));
+
+    QueueType* q = PeekPointer(queue);
+    m_hasRoom = [this, q](uint32_t nPackets) {
+        NS_ASSERT_MSG(m_device, "Aggregated NetDevice not set");
+        return !q->WouldOverflow(nPackets, nPackets * m_device->GetMtu());
+    };
 }
 
 template <typename QueueType>
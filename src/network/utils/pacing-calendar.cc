@@ -0,0 +1,159 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "pacing-calendar.h"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PacingCalendar");
+
+NS_OBJECT_ENSURE_REGISTERED(PacingCalendar);
+
+TypeId
+PacingCalendar::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::PacingCalendar")
+            .SetParent<Object>()
+            .SetGroupName("Network")
+            .AddConstructor<PacingCalendar>()
+            .AddAttribute("Granularity",
+                          "The duration of the slots of the calendar. The release times are "
+                          "rounded up to a multiple of the granularity; zero disables the "
+                          "rounding, so that only the releases with the same time share an event.",
+                          TimeValue(MicroSeconds(10)),
+                          MakeTimeAccessor(&PacingCalendar::m_granularity),
+                          MakeTimeChecker(Time(0)));
+    return tid;
+}
+
+PacingCalendar::PacingCalendar()
+    : m_nextId(1)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+PacingCalendar::~PacingCalendar()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+PacingCalendar::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_event.Cancel();
+    m_slots.clear();
+    m_pending.clear();
+    Object::DoDispose();
+}
+
+PacingCalendar::ReleaseId
+PacingCalendar::Schedule(const Time& delay, const Callback<void>& release)
+{
+    NS_LOG_FUNCTION(this << delay);
+    NS_ASSERT_MSG(!delay.IsStrictlyNegative(), "Negative delay");
+
+    Time now = Simulator::Now();
+    Time slot = now + delay;
+    if (m_granularity.IsStrictlyPositive())
+    {
+        int64_t step = m_granularity.GetTimeStep();
+        slot = TimeStep((slot.GetTimeStep() + step - 1) / step * step);
+    }
+
+    ReleaseId id = m_nextId++;
+    m_slots[slot].emplace_back(id, release);
+    m_pending[id] = slot;
+    NS_LOG_LOGIC("Release " << id << " scheduled at " << slot.As(Time::S));
+
+    if (!m_event.IsRunning() || slot < m_eventTime)
+    {
+        // remove the event of the later slot rather than leaving it cancelled in the queue
+        Simulator::Remove(m_event);
+        m_eventTime = slot;
+        m_event = Simulator::Schedule(slot - now, &PacingCalendar::ReleaseSlot, this);
+    }
+    return id;
+}
+
+void
+PacingCalendar::Cancel(ReleaseId id)
+{
+    NS_LOG_FUNCTION(this << id);
+    // the callback is discarded when the slot is released
+    m_pending.erase(id);
+}
+
+bool
+PacingCalendar::IsPending(ReleaseId id) const
+{
+    return m_pending.find(id) != m_pending.end();
+}
+
+Time
+PacingCalendar::GetDelayLeft(ReleaseId id) const
+{
+    auto it = m_pending.find(id);
+    if (it == m_pending.end())
+    {
+        return Time(0);
+    }
+    return it->second - Simulator::Now();
+}
+
+uint32_t
+PacingCalendar::GetNPending() const
+{
+    return m_pending.size();
+}
+
+void
+PacingCalendar::ReleaseSlot()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!m_slots.empty() && m_slots.begin()->first == Simulator::Now());
+
+    Releases releases = std::move(m_slots.begin()->second);
+    m_slots.erase(m_slots.begin());
+
+    // schedule the next slot first, the releases may add releases to any slot
+    if (!m_slots.empty())
+    {
+        m_eventTime = m_slots.begin()->first;
+        m_event = Simulator::Schedule(m_eventTime - Simulator::Now(),
+                                      &PacingCalendar::ReleaseSlot,
+                                      this);
+    }
+
+    NS_LOG_LOGIC("Releasing a slot of " << releases.size() << " releases");
+    for (auto& release : releases)
+    {
+        auto it = m_pending.find(release.first);
+        if (it == m_pending.end())
+        {
+            // cancelled
+            continue;
+        }
+        m_pending.erase(it);
+        release.second();
+    }
+}
+
+} // namespace ns3
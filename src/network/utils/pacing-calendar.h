@@ -0,0 +1,123 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PACING_CALENDAR_H
+#define PACING_CALENDAR_H
+
+#include "ns3/callback.h"
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+
+#include <map>
+#include <stdint.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup network
+ *
+ * \brief Calendar of the release times of the paced or shaped flows of a node.
+ *
+ * Pacing and shaping entities (e.g., TCP sockets with pacing enabled or
+ * token bucket queue discs) ask the calendar to call them back when they
+ * can send again, instead of scheduling an event each.  The release times
+ * are rounded up to a multiple of the granularity of the calendar, and all
+ * the releases falling in the same slot are performed by a single event.
+ * Hence, a large number of paced flows cost one event per slot instead of
+ * one event per packet.
+ *
+ * The calendar is used by the pacing and shaping entities of a node if it
+ * is aggregated to the node, e.g.:
+ *
+ * \code
+ *   node->AggregateObject(CreateObject<PacingCalendar>());
+ * \endcode
+ *
+ * Note that the granularity delays the releases by up to one slot.
+ */
+class PacingCalendar : public Object
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    PacingCalendar();
+    ~PacingCalendar() override;
+
+    /// Identifier of a release, 0 is never used
+    typedef uint64_t ReleaseId;
+
+    /**
+     * \brief Schedule a release.
+     * \param delay the minimum delay before the release
+     * \param release the callback invoked at the release time
+     * \return the identifier of the release
+     */
+    ReleaseId Schedule(const Time& delay, const Callback<void>& release);
+
+    /**
+     * \brief Cancel a release, if it is pending.
+     * \param id the identifier of the release
+     */
+    void Cancel(ReleaseId id);
+
+    /**
+     * \param id the identifier of a release
+     * \return true if the release has been scheduled and neither performed nor cancelled
+     */
+    bool IsPending(ReleaseId id) const;
+
+    /**
+     * \param id the identifier of a release
+     * \return the time left before the release, or zero if it is not pending
+     */
+    Time GetDelayLeft(ReleaseId id) const;
+
+    /**
+     * \return the number of pending releases
+     */
+    uint32_t GetNPending() const;
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /**
+     * \brief Perform the releases of the first slot and schedule the next slot.
+     */
+    void ReleaseSlot();
+
+    /// Releases of a slot, in the order they have been scheduled
+    typedef std::vector<std::pair<ReleaseId, Callback<void>>> Releases;
+
+    Time m_granularity;                            //!< Duration of a slot
+    std::map<Time, Releases> m_slots;              //!< Releases, indexed by slot time
+    std::unordered_map<ReleaseId, Time> m_pending; //!< Slot times of the pending releases
+    ReleaseId m_nextId;                            //!< Identifier of the next release
+    EventId m_event;                               //!< Event of the first slot
+    Time m_eventTime;                              //!< Time of the first slot event
+};
+
+} // namespace ns3
+
+#endif /* PACING_CALENDAR_H */
@@ -24,7 +24,9 @@
 #include "ns3/llc-snap-header.h"
 #include "ns3/log.h"
 #include "ns3/mac48-address.h"
+#include "ns3/net-device-queue-interface.h"
 #include "ns3/pointer.h"
+#include "ns3/queue-item.h"
 #include "ns3/queue.h"
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
@@ -559,6 +561,71 @@ PointToPointNetDevice::Send(Ptr<Packet> packet, const Address& dest, uint16_t pr
     return false;
 }
 
+uint32_t
+PointToPointNetDevice::SendBatch(const std::vector<Ptr<QueueDiscItem>>& items)
+{
+    NS_LOG_FUNCTION(this << items.size());
+
+    if (IsLinkUp() == false)
+    {
+        for (const auto& item : items)
+        {
+            m_macTxDropTrace(item->GetPacket());
+        }
+        return 0;
+    }
+
+    //
+    // Check the queue limits once, at the end of the batch
+    //
+    Ptr<NetDeviceQueue> txq;
+    Ptr<NetDeviceQueueInterface> ndqi = GetObject<NetDeviceQueueInterface>();
+    if (ndqi && ndqi->GetNTxQueues() > 0)
+    {
+        txq = ndqi->GetTxQueue(0);
+        txq->BeginBatch();
+    }
+
+    //
+    // Enqueue all the packets first, then start the transmission of the first
+    // one if the channel is ready. The following packets are sent back to back
+    // by the transmit complete events.
+    //
+    uint32_t sent = 0;
+    for (const auto& item : items)
+    {
+        Ptr<Packet> packet = item->GetPacket();
+        AddHeader(packet, item->GetProtocol());
+        m_macTxTrace(packet);
+        if (m_queue->Enqueue(packet))
+        {
+            sent++;
+        }
+        else
+        {
+            m_macTxDropTrace(packet);
+        }
+    }
+
+    if (txq)
+    {
+        txq->EndBatch();
+    }
+
+    if (m_txMachineState == READY && !m_queue->IsEmpty())
+    {
+        Ptr<Packet> packet = m_queue->Dequeue();
+        m_snifferTrace(packet);
+        m_promiscSnifferTrace(packet);
+        // the dequeued packet may have been queued before the batch
+        if (!TransmitStart(packet) && sent > 0)
+        {
+            sent--;
+        }
+    }
+    return sent;
+}
+
 bool
 PointToPointNetDevice::SendFrom(Ptr<Packet> packet,
                                 const Address& source,
@@ -185,6 +185,7 @@ class PointToPointNetDevice : public NetDevice
                   const Address& source,
                   const Address& dest,
                   uint16_t protocolNumber) override;
+    uint32_t SendBatch(const std::vector<Ptr<QueueDiscItem>>& items) override;
 
     Ptr<Node> GetNode() const override;
     void SetNode(Ptr<Node> node) override;
@@ -29,7 +29,9 @@
 #include "ns3/pointer.h"
 #include "ns3/string.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace ns3
 {
@@ -82,6 +84,26 @@ PropagationLossModel::CalcRxPower(double txPowerDbm,
     return self;
 }
 
+double
+PropagationLossModel::GetMaxRange(double txPowerDbm, double rxPowerDbm) const
+{
+    double range = DoGetMaxRange(txPowerDbm, rxPowerDbm);
+    if (m_next && !std::isinf(range))
+    {
+        // the models of the chain never amplify the signal, hence the
+        // reception power is bounded by the one of each model
+        double nextRange = m_next->GetMaxRange(txPowerDbm, rxPowerDbm);
+        range = std::isinf(nextRange) ? nextRange : std::min(range, nextRange);
+    }
+    return range;
+}
+
+double
+PropagationLossModel::DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const
+{
+    return std::numeric_limits<double>::infinity();
+}
+
 int64_t
 PropagationLossModel::AssignStreams(int64_t stream)
 {
@@ -281,6 +303,23 @@ FriisPropagationLossModel::DoCalcRxPower(double txPowerDbm,
     return txPowerDbm - std::max(lossDb, m_minLoss);
 }
 
+double
+FriisPropagationLossModel::DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const
+{
+    if (m_minLoss < 0)
+    {
+        // the signal may be amplified at short distances
+        return std::numeric_limits<double>::infinity();
+    }
+    double maxLossDb = txPowerDbm - rxPowerDbm;
+    if (maxLossDb < m_minLoss)
+    {
+        return 0;
+    }
+    // invert lossDb = 10 * log10 (16 * pi^2 * d^2 * L / lambda^2)
+    return m_lambda / (4 * M_PI) * std::pow(10.0, (maxLossDb - 10 * log10(m_systemLoss)) / 20);
+}
+
 int64_t
 FriisPropagationLossModel::DoAssignStreams(int64_t stream)
 {
@@ -554,6 +593,22 @@ LogDistancePropagationLossModel::DoCalcRxPower(double txPowerDbm,
     return txPowerDbm + rxc;
 }
 
+double
+LogDistancePropagationLossModel::DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const
+{
+    if (m_referenceLoss < 0 || m_exponent <= 0)
+    {
+        // the signal may be amplified or is not attenuated with the distance
+        return std::numeric_limits<double>::infinity();
+    }
+    double maxPathLossDb = txPowerDbm - m_referenceLoss - rxPowerDbm;
+    if (maxPathLossDb < 0)
+    {
+        return 0;
+    }
+    return m_referenceDistance * std::pow(10.0, maxPathLossDb / (10 * m_exponent));
+}
+
 int64_t
 LogDistancePropagationLossModel::DoAssignStreams(int64_t stream)
 {
@@ -948,6 +1003,17 @@ RangePropagationLossModel::DoCalcRxPower(double txPowerDbm,
     }
 }
 
+double
+RangePropagationLossModel::DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const
+{
+    if (rxPowerDbm <= -1000)
+    {
+        // the signal beyond the range is received as well
+        return std::numeric_limits<double>::infinity();
+    }
+    return txPowerDbm < rxPowerDbm ? 0 : m_range;
+}
+
 int64_t
 RangePropagationLossModel::DoAssignStreams(int64_t stream)
 {
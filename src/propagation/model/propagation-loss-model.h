@@ -101,6 +101,21 @@ class PropagationLossModel : public Object
      */
     double CalcRxPower(double txPowerDbm, Ptr<MobilityModel> a, Ptr<MobilityModel> b) const;
 
+    /**
+     * Returns an upper bound of the distance at which the Rx Power is at
+     * least the given value, taking into account all the
+     * PropagationLossModel(s) chained to the current one.
+     *
+     * A bound is known only if all the models in the chain provide one;
+     * otherwise, this method returns infinity.
+     *
+     * \param txPowerDbm transmission power (in dBm)
+     * \param rxPowerDbm reception power (in dBm)
+     * \returns the maximum distance (in meters) at which the reception power
+     * is at least rxPowerDbm
+     */
+    double GetMaxRange(double txPowerDbm, double rxPowerDbm) const;
+
     /**
      * If this loss model uses objects of type RandomVariableStream,
      * set the stream numbers to the integers starting with the offset
@@ -139,6 +154,22 @@ class PropagationLossModel : public Object
                                  Ptr<MobilityModel> a,
                                  Ptr<MobilityModel> b) const = 0;
 
+    /**
+     * Returns an upper bound of the distance at which the Rx Power
+     * computed by this model is at least the given value.
+     *
+     * The models overriding this method must never return a reception
+     * power larger than the transmission power, so that the bounds of the
+     * models in a chain can be combined.  The default implementation
+     * returns infinity, i.e., no bound is known.
+     *
+     * \param txPowerDbm transmission power (in dBm)
+     * \param rxPowerDbm reception power (in dBm)
+     * \returns the maximum distance (in meters) at which the reception power
+     * is at least rxPowerDbm
+     */
+    virtual double DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const;
+
     Ptr<PropagationLossModel> m_next; //!< Next propagation loss model in the list
 };
 
@@ -303,6 +334,7 @@ class FriisPropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    double DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const override;
     int64_t DoAssignStreams(int64_t stream) override;
 
     /**
@@ -491,6 +523,7 @@ class LogDistancePropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    double DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const override;
 
     int64_t DoAssignStreams(int64_t stream) override;
 
@@ -776,6 +809,7 @@ class RangePropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    double DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const override;
 
     int64_t DoAssignStreams(int64_t stream) override;
 
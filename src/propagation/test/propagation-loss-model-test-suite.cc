@@ -489,6 +489,100 @@ RangePropagationLossModelTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief Test the maximum range of the propagation loss models
+ *
+ * The received power must be above the threshold just within the range,
+ * and below it just beyond the range.  The chains of models have a range
+ * only if all their models bound it.
+ */
+class MaxRangePropagationLossModelTestCase : public TestCase
+{
+  public:
+    MaxRangePropagationLossModelTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the range of a loss model
+     * \param lossModel the loss model
+     * \param expectedRange the expected range (m), or a negative value if it
+     * has to be derived from the received power only
+     * \param msg the message printed if the check fails
+     */
+    void CheckRange(Ptr<PropagationLossModel> lossModel, double expectedRange, std::string msg);
+
+    double m_txPowerDbm; //!< Tx power [dBm]
+    double m_rxPowerDbm; //!< Rx power threshold [dBm]
+};
+
+MaxRangePropagationLossModelTestCase::MaxRangePropagationLossModelTestCase()
+    : TestCase("Test the maximum range of the propagation loss models"),
+      m_txPowerDbm(16.0206),
+      m_rxPowerDbm(-82)
+{
+}
+
+void
+MaxRangePropagationLossModelTestCase::CheckRange(Ptr<PropagationLossModel> lossModel,
+                                                 double expectedRange,
+                                                 std::string msg)
+{
+    double range = lossModel->GetMaxRange(m_txPowerDbm, m_rxPowerDbm);
+    if (expectedRange >= 0)
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(range, expectedRange, 1e-6, msg << ": unexpected range");
+    }
+    Ptr<MobilityModel> a = CreateObject<ConstantPositionMobilityModel>();
+    a->SetPosition(Vector(0, 0, 0));
+    Ptr<MobilityModel> b = CreateObject<ConstantPositionMobilityModel>();
+    b->SetPosition(Vector(range * 0.999, 0, 0));
+    NS_TEST_EXPECT_MSG_GT_OR_EQ(lossModel->CalcRxPower(m_txPowerDbm, a, b),
+                                m_rxPowerDbm,
+                                msg << ": signal too weak within the range");
+    b->SetPosition(Vector(range * 1.001, 0, 0));
+    NS_TEST_EXPECT_MSG_LT(lossModel->CalcRxPower(m_txPowerDbm, a, b),
+                          m_rxPowerDbm,
+                          msg << ": signal too strong beyond the range");
+}
+
+void
+MaxRangePropagationLossModelTestCase::DoRun()
+{
+    Ptr<FriisPropagationLossModel> friis = CreateObject<FriisPropagationLossModel>();
+    friis->SetFrequency(2.4e9);
+    CheckRange(friis, -1, "Friis");
+
+    Ptr<LogDistancePropagationLossModel> logDistance =
+        CreateObject<LogDistancePropagationLossModel>();
+    logDistance->SetReference(1, 46.6777);
+    logDistance->SetPathLossExponent(3);
+    CheckRange(logDistance, -1, "Log distance");
+
+    Ptr<RangePropagationLossModel> range = CreateObject<RangePropagationLossModel>();
+    range->SetAttribute("MaxRange", DoubleValue(50));
+    CheckRange(range, 50, "Range");
+
+    // the range of a chain is the smallest range of its models
+    logDistance->SetNext(range);
+    CheckRange(logDistance, 50, "Log distance and range");
+
+    // random models do not bound the range
+    Ptr<NakagamiPropagationLossModel> nakagami = CreateObject<NakagamiPropagationLossModel>();
+    NS_TEST_EXPECT_MSG_EQ(std::isinf(nakagami->GetMaxRange(m_txPowerDbm, m_rxPowerDbm)),
+                          true,
+                          "Nakagami should not bound the range");
+    range->SetNext(nakagami);
+    NS_TEST_EXPECT_MSG_EQ(std::isinf(logDistance->GetMaxRange(m_txPowerDbm, m_rxPowerDbm)),
+                          true,
+                          "A chain including Nakagami should not bound the range");
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup propagation-tests
  *
@@ -515,6 +609,7 @@ PropagationLossModelsTestSuite::PropagationLossModelsTestSuite()
     AddTestCase(new LogDistancePropagationLossModelTestCase, TestCase::QUICK);
     AddTestCase(new MatrixPropagationLossModelTestCase, TestCase::QUICK);
     AddTestCase(new RangePropagationLossModelTestCase, TestCase::QUICK);
+    AddTestCase(new MaxRangePropagationLossModelTestCase, TestCase::QUICK);
 }
 
 /// Static variable for test initialization
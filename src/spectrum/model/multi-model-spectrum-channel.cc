@@ -129,6 +129,7 @@ MultiModelSpectrumChannel::RemoveRx(Ptr<SpectrumPhy> phy)
             break; // there should be at most one entry
         }
     }
+    RemoveRxFromGrid(phy);
 }
 
 void
@@ -187,6 +188,7 @@ MultiModelSpectrumChannel::AddRx(Ptr<SpectrumPhy> phy)
         // spectrum model is already known, just add the device to the corresponding list
         rxInfoIterator->second.m_rxPhys.push_back(phy);
     }
+    AddRxToGrid(phy);
 }
 
 TxSpectrumModelInfoMap_t::const_iterator
@@ -251,6 +253,20 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
     m_txSigParamsTrace(txParamsTrace);
 
     Ptr<MobilityModel> txMobility = txParams->txPhy->GetMobility();
+    double maxLossDb = GetMaxLossDb(txParams);
+    std::vector<Ptr<SpectrumPhy>> candidates;
+    bool culled = GetRxCandidates(txParams, maxLossDb, candidates);
+    if (culled)
+    {
+        // group the candidates by RX SpectrumModel, keeping within each group
+        // the order of the receivers of the RX SpectrumModel
+        std::stable_sort(candidates.begin(),
+                         candidates.end(),
+                         [](const Ptr<SpectrumPhy>& a, const Ptr<SpectrumPhy>& b) {
+                             return a->GetRxSpectrumModel()->GetUid() <
+                                    b->GetRxSpectrumModel()->GetUid();
+                         });
+    }
     SpectrumModelUid_t txSpectrumModelUid = txParams->psd->GetSpectrumModelUid();
     NS_LOG_LOGIC("txSpectrumModelUid " << txSpectrumModelUid);
 
@@ -292,9 +308,25 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
             convertedTxPowerSpectrum = rxConverterIterator->second.Convert(txParams->psd);
         }
 
-        for (auto rxPhyIterator = rxInfoIterator->second.m_rxPhys.begin();
-             rxPhyIterator != rxInfoIterator->second.m_rxPhys.end();
-             ++rxPhyIterator)
+        auto rxPhyBegin = rxInfoIterator->second.m_rxPhys.cbegin();
+        auto rxPhyEnd = rxInfoIterator->second.m_rxPhys.cend();
+        if (culled)
+        {
+            rxPhyBegin = std::lower_bound(candidates.cbegin(),
+                                          candidates.cend(),
+                                          rxSpectrumModelUid,
+                                          [](const Ptr<SpectrumPhy>& phy, SpectrumModelUid_t uid) {
+                                              return phy->GetRxSpectrumModel()->GetUid() < uid;
+                                          });
+            rxPhyEnd = std::upper_bound(rxPhyBegin,
+                                        candidates.cend(),
+                                        rxSpectrumModelUid,
+                                        [](SpectrumModelUid_t uid, const Ptr<SpectrumPhy>& phy) {
+                                            return uid < phy->GetRxSpectrumModel()->GetUid();
+                                        });
+        }
+
+        for (auto rxPhyIterator = rxPhyBegin; rxPhyIterator != rxPhyEnd; ++rxPhyIterator)
         {
             NS_ASSERT_MSG((*rxPhyIterator)->GetRxSpectrumModel()->GetUid() == rxSpectrumModelUid,
                           "SpectrumModel change was not notified to MultiModelSpectrumChannel "
@@ -317,10 +349,8 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                     }
                 }
 
-                NS_LOG_LOGIC("copying signal parameters " << txParams);
-                Ptr<SpectrumSignalParameters> rxParams = txParams->Copy();
-                rxParams->psd = Copy<SpectrumValue>(convertedTxPowerSpectrum);
                 Time delay = MicroSeconds(0);
+                double pathGainLinear = 1;
 
                 Ptr<MobilityModel> receiverMobility = (*rxPhyIterator)->GetMobility();
 
@@ -330,10 +360,10 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                     double rxAntennaGain = 0;
                     double propagationGainDb = 0;
                     double pathLossDb = 0;
-                    if (rxParams->txAntenna)
+                    if (txParams->txAntenna)
                     {
                         Angles txAngles(receiverMobility->GetPosition(), txMobility->GetPosition());
-                        txAntennaGain = rxParams->txAntenna->GetGainDb(txAngles);
+                        txAntennaGain = txParams->txAntenna->GetGainDb(txAngles);
                         NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
                         pathLossDb -= txAntennaGain;
                     }
@@ -363,13 +393,12 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                                 pathLossDb);
                     // Pathloss trace
                     m_pathLossTrace(txParams->txPhy, *rxPhyIterator, pathLossDb);
-                    if (pathLossDb > m_maxLossDb)
+                    if (pathLossDb > maxLossDb)
                     {
                         // beyond range
                         continue;
                     }
-                    double pathGainLinear = std::pow(10.0, (-pathLossDb) / 10.0);
-                    *(rxParams->psd) *= pathGainLinear;
+                    pathGainLinear = std::pow(10.0, (-pathLossDb) / 10.0);
 
                     if (m_propagationDelay)
                     {
@@ -377,6 +406,11 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                     }
                 }
 
+                NS_LOG_LOGIC("copying signal parameters " << txParams);
+                Ptr<SpectrumSignalParameters> rxParams = txParams->Copy();
+                rxParams->psd = Copy<SpectrumValue>(convertedTxPowerSpectrum);
+                *(rxParams->psd) *= pathGainLinear;
+
                 if (rxNetDevice)
                 {
                     // the receiver has a NetDevice, so we expect that it is attached to a Node
@@ -78,6 +78,7 @@ SingleModelSpectrumChannel::RemoveRx(Ptr<SpectrumPhy> phy)
     {
         m_phyList.erase(it);
     }
+    RemoveRxFromGrid(phy);
 }
 
 void
@@ -85,6 +86,7 @@ SingleModelSpectrumChannel::AddRx(Ptr<SpectrumPhy> phy)
 {
     NS_LOG_FUNCTION(this << phy);
     m_phyList.push_back(phy);
+    AddRxToGrid(phy);
 }
 
 void
@@ -113,9 +115,14 @@ SingleModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
     }
 
     Ptr<MobilityModel> senderMobility = txParams->txPhy->GetMobility();
+    double maxLossDb = GetMaxLossDb(txParams);
+    PhyList candidates;
+    // the candidates are in the order of m_phyList
+    const PhyList& rxPhys =
+        GetRxCandidates(txParams, maxLossDb, candidates) ? candidates : m_phyList;
 
-    for (PhyList::const_iterator rxPhyIterator = m_phyList.begin();
-         rxPhyIterator != m_phyList.end();
+    for (PhyList::const_iterator rxPhyIterator = rxPhys.begin();
+         rxPhyIterator != rxPhys.end();
          ++rxPhyIterator)
     {
         Ptr<NetDevice> rxNetDevice = (*rxPhyIterator)->GetDevice();
@@ -135,10 +142,9 @@ SingleModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
         if ((*rxPhyIterator) != txParams->txPhy)
         {
             Time delay = MicroSeconds(0);
+            double pathGainLinear = 1;
 
             Ptr<MobilityModel> receiverMobility = (*rxPhyIterator)->GetMobility();
-            NS_LOG_LOGIC("copying signal parameters " << txParams);
-            Ptr<SpectrumSignalParameters> rxParams = txParams->Copy();
 
             if (senderMobility && receiverMobility)
             {
@@ -146,10 +152,10 @@ SingleModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                 double rxAntennaGain = 0;
                 double propagationGainDb = 0;
                 double pathLossDb = 0;
-                if (rxParams->txAntenna)
+                if (txParams->txAntenna)
                 {
                     Angles txAngles(receiverMobility->GetPosition(), senderMobility->GetPosition());
-                    txAntennaGain = rxParams->txAntenna->GetGainDb(txAngles);
+                    txAntennaGain = txParams->txAntenna->GetGainDb(txAngles);
                     NS_LOG_LOGIC("txAntennaGain = " << txAntennaGain << " dB");
                     pathLossDb -= txAntennaGain;
                 }
@@ -179,13 +185,12 @@ SingleModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                             pathLossDb);
                 // Pathloss trace
                 m_pathLossTrace(txParams->txPhy, *rxPhyIterator, pathLossDb);
-                if (pathLossDb > m_maxLossDb)
+                if (pathLossDb > maxLossDb)
                 {
                     // beyond range
                     continue;
                 }
-                double pathGainLinear = std::pow(10.0, (-pathLossDb) / 10.0);
-                *(rxParams->psd) *= pathGainLinear;
+                pathGainLinear = std::pow(10.0, (-pathLossDb) / 10.0);
 
                 if (m_propagationDelay)
                 {
@@ -193,6 +198,10 @@ SingleModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                 }
             }
 
+            NS_LOG_LOGIC("copying signal parameters " << txParams);
+            Ptr<SpectrumSignalParameters> rxParams = txParams->Copy();
+            *(rxParams->psd) *= pathGainLinear;
+
             if (rxNetDevice)
             {
                 // the receiver has a NetDevice, so we expect that it is attached to a Node
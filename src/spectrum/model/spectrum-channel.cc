@@ -22,6 +22,11 @@
 #include <ns3/double.h>
 #include <ns3/log.h>
 #include <ns3/pointer.h>
+#include <ns3/spectrum-value.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
 
 namespace ns3
 {
@@ -31,6 +36,7 @@ NS_LOG_COMPONENT_DEFINE("SpectrumChannel");
 NS_OBJECT_ENSURE_REGISTERED(SpectrumChannel);
 
 SpectrumChannel::SpectrumChannel()
+    : m_rxGridNextId(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -46,6 +52,10 @@ SpectrumChannel::DoDispose()
     m_propagationLoss = nullptr;
     m_propagationDelay = nullptr;
     m_spectrumPropagationLoss = nullptr;
+    m_rxGrid.Clear();
+    m_rxGridPhys.clear();
+    m_rxGridIds.clear();
+    m_rxGridPending.clear();
 }
 
 TypeId
@@ -70,6 +80,41 @@ SpectrumChannel::GetTypeId()
                           MakeDoubleAccessor(&SpectrumChannel::m_maxLossDb),
                           MakeDoubleChecker<double>())
 
+            .AddAttribute("InterferenceFloor",
+                          "The minimum received power, in dBm, of the signals passed to the "
+                          "receiving PHY. Signals for which the total transmitted power "
+                          "minus the loss computed from the antenna gains and the "
+                          "PropagationLossModel is below this value will not be propagated "
+                          "to the receiver. Like MaxLossDb, this parameter is to be used to "
+                          "reduce the computational load by not propagating signals that "
+                          "are too weak to matter; the default value corresponds to "
+                          "considering all signals for reception.",
+                          DoubleValue(-1.0e9),
+                          MakeDoubleAccessor(&SpectrumChannel::m_interferenceFloorDbm),
+                          MakeDoubleChecker<double>())
+
+            .AddAttribute("ReceiverGridCellSize",
+                          "If positive, the receivers are indexed in a grid of square cells "
+                          "of this size (in meters) according to their position, so that "
+                          "the receivers farther than the range of a signal, given by "
+                          "MaxLossDb, InterferenceFloor and MaxAntennaGain, are culled "
+                          "without computing their path loss. The range is known only if "
+                          "all the models of the PropagationLossModel chain bound it, "
+                          "otherwise no receiver is culled. Zero disables the grid.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&SpectrumChannel::m_gridCellSize),
+                          MakeDoubleChecker<double>(0))
+
+            .AddAttribute("MaxAntennaGain",
+                          "The maximum sum of the gains of the TX and RX antennas, in dB, "
+                          "used to compute the range of the signals when culling the "
+                          "receivers with the grid (see ReceiverGridCellSize). If the sum "
+                          "of the antenna gains exceeds this value, receivers in range "
+                          "may be culled.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&SpectrumChannel::m_maxAntennaGainDb),
+                          MakeDoubleChecker<double>())
+
             .AddAttribute("PropagationLossModel",
                           "A pointer to the propagation loss model attached to this channel.",
                           PointerValue(nullptr),
@@ -173,4 +218,121 @@ SpectrumChannel::GetPropagationLossModel()
     return m_propagationLoss;
 }
 
+double
+SpectrumChannel::GetMaxLossDb(Ptr<const SpectrumSignalParameters> params) const
+{
+    if (m_interferenceFloorDbm <= -1.0e9)
+    {
+        // the interference floor is disabled
+        return m_maxLossDb;
+    }
+    double txPowerW = Integral(*params->psd);
+    if (txPowerW <= 0)
+    {
+        return m_maxLossDb;
+    }
+    double txPowerDbm = 10 * std::log10(txPowerW) + 30;
+    return std::min(m_maxLossDb, txPowerDbm - m_interferenceFloorDbm);
+}
+
+bool
+SpectrumChannel::GetRxCandidates(Ptr<const SpectrumSignalParameters> params,
+                                 double maxLossDb,
+                                 std::vector<Ptr<SpectrumPhy>>& candidates)
+{
+    NS_LOG_FUNCTION(this << params << maxLossDb);
+    if (m_gridCellSize <= 0 || !m_propagationLoss)
+    {
+        return false;
+    }
+    Ptr<MobilityModel> txMobility = params->txPhy->GetMobility();
+    if (!txMobility)
+    {
+        return false;
+    }
+    // the antenna gains are not known before computing the path loss
+    double range = m_propagationLoss->GetMaxRange(0, -maxLossDb - m_maxAntennaGainDb);
+    if (std::isinf(range))
+    {
+        return false;
+    }
+
+    UpdateRxGrid();
+    std::vector<uint32_t> ids;
+    m_rxGrid.GetItemsInRange(txMobility->GetPosition(), range, ids);
+    // the receivers without a mobility model are never culled; the identifiers
+    // follow the order of registration and both lists are sorted
+    std::vector<uint32_t> allIds;
+    allIds.reserve(ids.size() + m_rxGridPending.size());
+    std::merge(ids.begin(),
+               ids.end(),
+               m_rxGridPending.begin(),
+               m_rxGridPending.end(),
+               std::back_inserter(allIds));
+    candidates.clear();
+    candidates.reserve(allIds.size());
+    for (uint32_t id : allIds)
+    {
+        candidates.push_back(m_rxGridPhys.at(id));
+    }
+    NS_LOG_LOGIC(candidates.size() << " receivers within " << range << " m");
+    return true;
+}
+
+void
+SpectrumChannel::AddRxToGrid(Ptr<SpectrumPhy> phy)
+{
+    NS_LOG_FUNCTION(this << phy);
+    if (m_rxGridIds.find(phy) == m_rxGridIds.end())
+    {
+        // the mobility model may not be set yet, the receiver is added to
+        // the grid at the next transmission
+        uint32_t id = m_rxGridNextId++;
+        m_rxGridPhys[id] = phy;
+        m_rxGridIds[phy] = id;
+        m_rxGridPending.insert(id);
+    }
+}
+
+void
+SpectrumChannel::RemoveRxFromGrid(Ptr<SpectrumPhy> phy)
+{
+    NS_LOG_FUNCTION(this << phy);
+    auto it = m_rxGridIds.find(phy);
+    if (it != m_rxGridIds.end())
+    {
+        if (m_rxGridPending.erase(it->second) == 0)
+        {
+            m_rxGrid.Remove(it->second);
+        }
+        m_rxGridPhys.erase(it->second);
+        m_rxGridIds.erase(it);
+    }
+}
+
+void
+SpectrumChannel::UpdateRxGrid()
+{
+    if (m_rxGrid.GetCellSize() != m_gridCellSize)
+    {
+        // changing the size of the cells empties the grid
+        m_rxGrid.SetCellSize(m_gridCellSize);
+        for (const auto& phy : m_rxGridIds)
+        {
+            m_rxGridPending.insert(phy.second);
+        }
+    }
+    for (auto it = m_rxGridPending.begin(); it != m_rxGridPending.end();)
+    {
+        Ptr<MobilityModel> mobility = m_rxGridPhys.at(*it)->GetMobility();
+        if (!mobility)
+        {
+            ++it;
+            continue;
+        }
+        m_rxGrid.Add(*it, mobility);
+        it = m_rxGridPending.erase(it);
+    }
+}
+
 } // namespace ns3
@@ -27,11 +27,17 @@
 #include <ns3/phased-array-spectrum-propagation-loss-model.h>
 #include <ns3/propagation-delay-model.h>
 #include <ns3/propagation-loss-model.h>
+#include <ns3/spatial-grid.h>
 #include <ns3/spectrum-phy.h>
 #include <ns3/spectrum-propagation-loss-model.h>
 #include <ns3/spectrum-signal-parameters.h>
 #include <ns3/traced-callback.h>
 
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
 namespace ns3
 {
 
@@ -187,6 +193,52 @@ class SpectrumChannel : public Channel
     typedef void (*SignalParametersTracedCallback)(Ptr<SpectrumSignalParameters> params);
 
   protected:
+    /**
+     * \brief Get the maximum path loss of a signal.
+     *
+     * The signal is not propagated to the receivers for which the path loss
+     * computed from the antenna gains and the PropagationLossModel is larger
+     * than the MaxLossDb attribute, or for which the received power would be
+     * below the InterferenceFloor attribute.
+     *
+     * \param params the parameters of the signal
+     * \return the maximum path loss, in dB
+     */
+    double GetMaxLossDb(Ptr<const SpectrumSignalParameters> params) const;
+
+    /**
+     * \brief Get the receivers which may be in range of a signal.
+     *
+     * If the ReceiverGridCellSize attribute is positive, the receivers are
+     * indexed by position, and the receivers farther from the transmitter
+     * than the range of the signal are culled.  The range is computed from the
+     * maximum path loss of the signal, the MaxAntennaGain attribute and the
+     * PropagationLossModel; if any model of the chain does not provide a
+     * bound, no receiver is culled.  The receivers must be registered with
+     * AddRxToGrid; the candidates are returned in the order of registration.
+     *
+     * \param params the parameters of the signal
+     * \param maxLossDb the maximum path loss of the signal, in dB
+     * \param [out] candidates the receivers which may be in range
+     * \return true if the receivers have been culled, false if all the
+     * receivers are in range, in which case \p candidates is not set
+     */
+    bool GetRxCandidates(Ptr<const SpectrumSignalParameters> params,
+                         double maxLossDb,
+                         std::vector<Ptr<SpectrumPhy>>& candidates);
+
+    /**
+     * \brief Register a receiver, so that it can be culled by GetRxCandidates.
+     * \param phy the receiver
+     */
+    void AddRxToGrid(Ptr<SpectrumPhy> phy);
+
+    /**
+     * \brief Unregister a receiver.
+     * \param phy the receiver
+     */
+    void RemoveRxFromGrid(Ptr<SpectrumPhy> phy);
+
     /**
      * The `PathLoss` trace source. Exporting the pointers to the Tx and Rx
      * SpectrumPhy and a pathloss value, in dB.
@@ -237,6 +289,22 @@ class SpectrumChannel : public Channel
      * Frequency-dependent propagation loss model to be used with this channel.
      */
     Ptr<PhasedArraySpectrumPropagationLossModel> m_phasedArraySpectrumPropagationLoss;
+
+  private:
+    /**
+     * \brief Add the receivers which have a mobility model to the grid.
+     */
+    void UpdateRxGrid();
+
+    double m_interferenceFloorDbm;                    //!< Minimum received power, in dBm
+    double m_gridCellSize;                            //!< Size of the cells of the receiver grid
+    double m_maxAntennaGainDb;                        //!< Maximum sum of the antenna gains, in dB
+    SpatialGrid m_rxGrid;                             //!< Receivers, indexed by position
+    std::unordered_map<uint32_t, Ptr<SpectrumPhy>>
+        m_rxGridPhys;                                 //!< Registered receivers, by identifier
+    uint32_t m_rxGridNextId;                          //!< Identifier of the next registered receiver
+    std::map<Ptr<SpectrumPhy>, uint32_t> m_rxGridIds; //!< Identifiers of the registered receivers
+    std::set<uint32_t> m_rxGridPending;               //!< Receivers not in the grid yet
 };
 
 } // namespace ns3
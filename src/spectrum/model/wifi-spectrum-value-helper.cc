@@ -30,6 +30,7 @@
 #include <cmath>
 #include <map>
 #include <sstream>
+#include <tuple>
 
 namespace ns3
 {
@@ -85,6 +86,82 @@ operator<(const WifiSpectrumModelId& a, const WifiSpectrumModelId& b)
 static std::map<WifiSpectrumModelId, Ptr<SpectrumModel>>
     g_wifiSpectrumModelMap; ///< static initializer for the class
 
+/// Transmit spectrum masks
+enum WifiTxPsdMaskType : uint8_t
+{
+    WIFI_TX_PSD_MASK_OFDM = 0,
+    WIFI_TX_PSD_MASK_DUPLICATED_20MHZ,
+    WIFI_TX_PSD_MASK_HT_OFDM,
+    WIFI_TX_PSD_MASK_HE_OFDM
+};
+
+///< Wifi transmit power spectral density shape structure
+struct WifiTxPsdShapeId
+{
+    WifiTxPsdMaskType m_maskType;             ///< transmit spectrum mask
+    uint32_t m_centerFrequency;               ///< center frequency (in MHz)
+    uint16_t m_channelWidth;                  ///< channel width (in MHz)
+    uint16_t m_guardBandwidth;                ///< guard band width (in MHz)
+    double m_minInnerBandDbr;                 ///< minimum relative power in the inner band (dBr)
+    double m_minOuterBandDbr;                 ///< minimum relative power in the outer band (dBr)
+    double m_lowestPointDbr;                  ///< relative power of the outermost subcarriers
+    std::vector<bool> m_puncturedSubchannels; ///< whether each 20 MHz subchannel is punctured
+};
+
+/**
+ * Less than operator
+ * \param a the first transmit PSD shape to compare
+ * \param b the second transmit PSD shape to compare
+ * \returns true if the first shape is less than the second shape
+ */
+bool
+operator<(const WifiTxPsdShapeId& a, const WifiTxPsdShapeId& b)
+{
+    return std::tie(a.m_maskType,
+                    a.m_centerFrequency,
+                    a.m_channelWidth,
+                    a.m_guardBandwidth,
+                    a.m_minInnerBandDbr,
+                    a.m_minOuterBandDbr,
+                    a.m_lowestPointDbr,
+                    a.m_puncturedSubchannels) < std::tie(b.m_maskType,
+                                                         b.m_centerFrequency,
+                                                         b.m_channelWidth,
+                                                         b.m_guardBandwidth,
+                                                         b.m_minInnerBandDbr,
+                                                         b.m_minOuterBandDbr,
+                                                         b.m_lowestPointDbr,
+                                                         b.m_puncturedSubchannels);
+}
+
+/// Transmit power spectral densities of 1 W, which are shared by all the transmissions
+static std::map<WifiTxPsdShapeId, Ptr<const SpectrumValue>> g_wifiTxPsdShapeMap;
+
+/**
+ * Get a transmit power spectral density from its shape, which is built
+ * the first time it is requested.
+ *
+ * \tparam F \deduced the type of the function building the shape
+ * \param id the identifier of the shape
+ * \param txPowerW the transmit power (W) to allocate
+ * \param createShape the function building the shape, for a transmit power of 1 W
+ * \return a pointer to a newly allocated SpectrumValue holding the shape scaled by the
+ * transmit power
+ */
+template <class F>
+static Ptr<SpectrumValue>
+GetScaledTxPsdShape(const WifiTxPsdShapeId& id, double txPowerW, F createShape)
+{
+    auto it = g_wifiTxPsdShapeMap.find(id);
+    if (it == g_wifiTxPsdShapeMap.end())
+    {
+        it = g_wifiTxPsdShapeMap.emplace(id, createShape()).first;
+    }
+    Ptr<SpectrumValue> c = it->second->Copy();
+    *c *= txPowerW;
+    return c;
+}
+
 Ptr<SpectrumModel>
 WifiSpectrumValueHelper::GetSpectrumModel(uint32_t centerFrequency,
                                           uint16_t channelWidth,
@@ -177,6 +254,37 @@ WifiSpectrumValueHelper::CreateOfdmTxPowerSpectralDensity(uint32_t centerFrequen
                                                           double minInnerBandDbr,
                                                           double minOuterBandDbr,
                                                           double lowestPointDbr)
+{
+    NS_LOG_FUNCTION(centerFrequency << channelWidth << txPowerW << guardBandwidth << minInnerBandDbr
+                                    << minOuterBandDbr << lowestPointDbr);
+    return GetScaledTxPsdShape({WIFI_TX_PSD_MASK_OFDM,
+                                centerFrequency,
+                                channelWidth,
+                                guardBandwidth,
+                                minInnerBandDbr,
+                                minOuterBandDbr,
+                                lowestPointDbr,
+                                {}},
+                               txPowerW,
+                               [=]() {
+                                   return DoCreateOfdmTxPowerSpectralDensity(centerFrequency,
+                                                                             channelWidth,
+                                                                             1,
+                                                                             guardBandwidth,
+                                                                             minInnerBandDbr,
+                                                                             minOuterBandDbr,
+                                                                             lowestPointDbr);
+                               });
+}
+
+Ptr<SpectrumValue>
+WifiSpectrumValueHelper::DoCreateOfdmTxPowerSpectralDensity(uint32_t centerFrequency,
+                                                            uint16_t channelWidth,
+                                                            double txPowerW,
+                                                            uint16_t guardBandwidth,
+                                                            double minInnerBandDbr,
+                                                            double minOuterBandDbr,
+                                                            double lowestPointDbr)
 {
     NS_LOG_FUNCTION(centerFrequency << channelWidth << txPowerW << guardBandwidth << minInnerBandDbr
                                     << minOuterBandDbr << lowestPointDbr);
@@ -251,6 +359,41 @@ WifiSpectrumValueHelper::CreateDuplicated20MhzTxPowerSpectralDensity(
     double minOuterBandDbr,
     double lowestPointDbr,
     const std::vector<bool>& puncturedSubchannels)
+{
+    NS_LOG_FUNCTION(centerFrequency << channelWidth << txPowerW << guardBandwidth << minInnerBandDbr
+                                    << minOuterBandDbr << lowestPointDbr);
+    return GetScaledTxPsdShape({WIFI_TX_PSD_MASK_DUPLICATED_20MHZ,
+                                centerFrequency,
+                                channelWidth,
+                                guardBandwidth,
+                                minInnerBandDbr,
+                                minOuterBandDbr,
+                                lowestPointDbr,
+                                puncturedSubchannels},
+                               txPowerW,
+                               [&]() {
+                                   return DoCreateDuplicated20MhzTxPowerSpectralDensity(
+                                       centerFrequency,
+                                       channelWidth,
+                                       1,
+                                       guardBandwidth,
+                                       minInnerBandDbr,
+                                       minOuterBandDbr,
+                                       lowestPointDbr,
+                                       puncturedSubchannels);
+                               });
+}
+
+Ptr<SpectrumValue>
+WifiSpectrumValueHelper::DoCreateDuplicated20MhzTxPowerSpectralDensity(
+    uint32_t centerFrequency,
+    uint16_t channelWidth,
+    double txPowerW,
+    uint16_t guardBandwidth,
+    double minInnerBandDbr,
+    double minOuterBandDbr,
+    double lowestPointDbr,
+    const std::vector<bool>& puncturedSubchannels)
 {
     NS_LOG_FUNCTION(centerFrequency << channelWidth << txPowerW << guardBandwidth << minInnerBandDbr
                                     << minOuterBandDbr << lowestPointDbr);
@@ -325,6 +468,37 @@ WifiSpectrumValueHelper::CreateHtOfdmTxPowerSpectralDensity(uint32_t centerFrequ
                                                             double minInnerBandDbr,
                                                             double minOuterBandDbr,
                                                             double lowestPointDbr)
+{
+    NS_LOG_FUNCTION(centerFrequency << channelWidth << txPowerW << guardBandwidth << minInnerBandDbr
+                                    << minOuterBandDbr << lowestPointDbr);
+    return GetScaledTxPsdShape({WIFI_TX_PSD_MASK_HT_OFDM,
+                                centerFrequency,
+                                channelWidth,
+                                guardBandwidth,
+                                minInnerBandDbr,
+                                minOuterBandDbr,
+                                lowestPointDbr,
+                                {}},
+                               txPowerW,
+                               [=]() {
+                                   return DoCreateHtOfdmTxPowerSpectralDensity(centerFrequency,
+                                                                               channelWidth,
+                                                                               1,
+                                                                               guardBandwidth,
+                                                                               minInnerBandDbr,
+                                                                               minOuterBandDbr,
+                                                                               lowestPointDbr);
+                               });
+}
+
+Ptr<SpectrumValue>
+WifiSpectrumValueHelper::DoCreateHtOfdmTxPowerSpectralDensity(uint32_t centerFrequency,
+                                                              uint16_t channelWidth,
+                                                              double txPowerW,
+                                                              uint16_t guardBandwidth,
+                                                              double minInnerBandDbr,
+                                                              double minOuterBandDbr,
+                                                              double lowestPointDbr)
 {
     NS_LOG_FUNCTION(centerFrequency << channelWidth << txPowerW << guardBandwidth << minInnerBandDbr
                                     << minOuterBandDbr << lowestPointDbr);
@@ -392,6 +566,41 @@ WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
     double minOuterBandDbr,
     double lowestPointDbr,
     const std::vector<bool>& puncturedSubchannels)
+{
+    NS_LOG_FUNCTION(centerFrequency << channelWidth << txPowerW << guardBandwidth << minInnerBandDbr
+                                    << minOuterBandDbr << lowestPointDbr);
+    return GetScaledTxPsdShape({WIFI_TX_PSD_MASK_HE_OFDM,
+                                centerFrequency,
+                                channelWidth,
+                                guardBandwidth,
+                                minInnerBandDbr,
+                                minOuterBandDbr,
+                                lowestPointDbr,
+                                puncturedSubchannels},
+                               txPowerW,
+                               [&]() {
+                                   return DoCreateHeOfdmTxPowerSpectralDensity(
+                                       centerFrequency,
+                                       channelWidth,
+                                       1,
+                                       guardBandwidth,
+                                       minInnerBandDbr,
+                                       minOuterBandDbr,
+                                       lowestPointDbr,
+                                       puncturedSubchannels);
+                               });
+}
+
+Ptr<SpectrumValue>
+WifiSpectrumValueHelper::DoCreateHeOfdmTxPowerSpectralDensity(
+    uint32_t centerFrequency,
+    uint16_t channelWidth,
+    double txPowerW,
+    uint16_t guardBandwidth,
+    double minInnerBandDbr,
+    double minOuterBandDbr,
+    double lowestPointDbr,
+    const std::vector<bool>& puncturedSubchannels)
 {
     NS_LOG_FUNCTION(centerFrequency << channelWidth << txPowerW << guardBandwidth << minInnerBandDbr
                                     << minOuterBandDbr << lowestPointDbr);
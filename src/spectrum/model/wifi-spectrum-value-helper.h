@@ -38,6 +38,10 @@ typedef std::pair<uint32_t, uint32_t> WifiSpectrumBand;
  *  This class defines all functions to create a spectrum model for
  *  Wi-Fi based on a a spectral model aligned with an OFDM subcarrier
  *  spacing of 312.5 KHz (model also reused for DSSS modulations)
+ *
+ *  The transmit power spectral densities shaped by an OFDM transmit
+ *  spectrum mask are built once for a transmit power of 1 W per set of
+ *  parameters, and then only scaled by the transmit power.
  */
 class WifiSpectrumValueHelper
 {
@@ -339,6 +343,55 @@ class WifiSpectrumValueHelper
      * \return band power in W
      */
     static double GetBandPowerW(Ptr<SpectrumValue> psd, const WifiSpectrumBand& band);
+
+  private:
+    /**
+     * \copydoc CreateOfdmTxPowerSpectralDensity
+     */
+    static Ptr<SpectrumValue> DoCreateOfdmTxPowerSpectralDensity(uint32_t centerFrequency,
+                                                                 uint16_t channelWidth,
+                                                                 double txPowerW,
+                                                                 uint16_t guardBandwidth,
+                                                                 double minInnerBandDbr,
+                                                                 double minOuterbandDbr,
+                                                                 double lowestPointDbr);
+
+    /**
+     * \copydoc CreateDuplicated20MhzTxPowerSpectralDensity
+     */
+    static Ptr<SpectrumValue> DoCreateDuplicated20MhzTxPowerSpectralDensity(
+        uint32_t centerFrequency,
+        uint16_t channelWidth,
+        double txPowerW,
+        uint16_t guardBandwidth,
+        double minInnerBandDbr,
+        double minOuterbandDbr,
+        double lowestPointDbr,
+        const std::vector<bool>& puncturedSubchannels);
+
+    /**
+     * \copydoc CreateHtOfdmTxPowerSpectralDensity
+     */
+    static Ptr<SpectrumValue> DoCreateHtOfdmTxPowerSpectralDensity(uint32_t centerFrequency,
+                                                                   uint16_t channelWidth,
+                                                                   double txPowerW,
+                                                                   uint16_t guardBandwidth,
+                                                                   double minInnerBandDbr,
+                                                                   double minOuterbandDbr,
+                                                                   double lowestPointDbr);
+
+    /**
+     * \copydoc CreateHeOfdmTxPowerSpectralDensity
+     */
+    static Ptr<SpectrumValue> DoCreateHeOfdmTxPowerSpectralDensity(
+        uint32_t centerFrequency,
+        uint16_t channelWidth,
+        double txPowerW,
+        uint16_t guardBandwidth,
+        double minInnerBandDbr,
+        double minOuterbandDbr,
+        double lowestPointDbr,
+        const std::vector<bool>& puncturedSubchannels);
 };
 
 /**
@@ -0,0 +1,292 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/double.h>
+#include <ns3/log.h>
+#include <ns3/multi-model-spectrum-channel.h>
+#include <ns3/net-device.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/simulator.h>
+#include <ns3/single-model-spectrum-channel.h>
+#include <ns3/spectrum-phy.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/test.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("SpectrumChannelCullingTest");
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief SpectrumPhy counting the signals it receives
+ */
+class CountingSpectrumPhy : public SpectrumPhy
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param model the spectrum model of the PHY
+     * \param position the position of the PHY
+     */
+    CountingSpectrumPhy(Ptr<const SpectrumModel> model, const Vector& position);
+
+    // inherited from SpectrumPhy
+    void SetDevice(Ptr<NetDevice> d) override;
+    Ptr<NetDevice> GetDevice() const override;
+    void SetMobility(Ptr<MobilityModel> m) override;
+    Ptr<MobilityModel> GetMobility() const override;
+    void SetChannel(Ptr<SpectrumChannel> c) override;
+    Ptr<const SpectrumModel> GetRxSpectrumModel() const override;
+    Ptr<Object> GetAntenna() const override;
+    void StartRx(Ptr<SpectrumSignalParameters> params) override;
+
+    uint32_t m_rx; //!< Number of signals received
+
+  private:
+    Ptr<const SpectrumModel> m_model; //!< Spectrum model
+    Ptr<MobilityModel> m_mobility;    //!< Mobility model
+};
+
+CountingSpectrumPhy::CountingSpectrumPhy(Ptr<const SpectrumModel> model, const Vector& position)
+    : m_rx(0),
+      m_model(model)
+{
+    m_mobility = CreateObject<ConstantPositionMobilityModel>();
+    m_mobility->SetPosition(position);
+}
+
+void
+CountingSpectrumPhy::SetDevice(Ptr<NetDevice> d)
+{
+}
+
+Ptr<NetDevice>
+CountingSpectrumPhy::GetDevice() const
+{
+    return nullptr;
+}
+
+void
+CountingSpectrumPhy::SetMobility(Ptr<MobilityModel> m)
+{
+    m_mobility = m;
+}
+
+Ptr<MobilityModel>
+CountingSpectrumPhy::GetMobility() const
+{
+    return m_mobility;
+}
+
+void
+CountingSpectrumPhy::SetChannel(Ptr<SpectrumChannel> c)
+{
+}
+
+Ptr<const SpectrumModel>
+CountingSpectrumPhy::GetRxSpectrumModel() const
+{
+    return m_model;
+}
+
+Ptr<Object>
+CountingSpectrumPhy::GetAntenna() const
+{
+    return nullptr;
+}
+
+void
+CountingSpectrumPhy::StartRx(Ptr<SpectrumSignalParameters> params)
+{
+    m_rx++;
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief Spectrum channel receiver culling test
+ *
+ * A 0 dBm signal is sent to receivers at 10 m, 100 m and 10 km with the
+ * Friis model at 5.15 GHz (path loss of about 67, 87 and 127 dB).  With an
+ * interference floor of -100 dBm, the farthest receiver does not receive the
+ * signal; with the receiver grid enabled, its path loss is not even computed.
+ * The receivers are added to the channel from the farthest to the nearest, and
+ * the path losses must be computed in that order.
+ */
+class SpectrumChannelCullingTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param channelType the TypeId name of the channel
+     */
+    SpectrumChannelCullingTestCase(std::string channelType);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Send a signal and count the signals received and the path losses computed.
+     *
+     * \param floorDbm the InterferenceFloor attribute of the channel
+     * \param cellSize the ReceiverGridCellSize attribute of the channel
+     * \param [out] rx the number of signals received by each receiver
+     * \return the number of path losses computed
+     */
+    uint32_t Send(double floorDbm, double cellSize, std::vector<uint32_t>& rx);
+
+    /**
+     * Record a path loss computation
+     *
+     * \param txPhy the TX PHY
+     * \param rxPhy the RX PHY
+     * \param lossDb the path loss, in dB
+     */
+    void PathLoss(Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb);
+
+    std::string m_channelType;                    //!< TypeId name of the channel
+    uint32_t m_pathLosses;                        //!< Number of path losses computed
+    std::vector<Ptr<const SpectrumPhy>> m_lossRx; //!< Receivers of the path losses computed
+};
+
+SpectrumChannelCullingTestCase::SpectrumChannelCullingTestCase(std::string channelType)
+    : TestCase("Check the receiver culling of " + channelType),
+      m_channelType(channelType),
+      m_pathLosses(0)
+{
+}
+
+void
+SpectrumChannelCullingTestCase::PathLoss(Ptr<const SpectrumPhy> txPhy,
+                                         Ptr<const SpectrumPhy> rxPhy,
+                                         double lossDb)
+{
+    m_pathLosses++;
+    m_lossRx.push_back(rxPhy);
+}
+
+uint32_t
+SpectrumChannelCullingTestCase::Send(double floorDbm, double cellSize, std::vector<uint32_t>& rx)
+{
+    ObjectFactory factory;
+    factory.SetTypeId(m_channelType);
+    factory.Set("InterferenceFloor", DoubleValue(floorDbm));
+    factory.Set("ReceiverGridCellSize", DoubleValue(cellSize));
+    Ptr<SpectrumChannel> channel = factory.Create<SpectrumChannel>();
+    channel->AddPropagationLossModel(CreateObject<FriisPropagationLossModel>());
+    channel->TraceConnectWithoutContext(
+        "PathLoss",
+        MakeCallback(&SpectrumChannelCullingTestCase::PathLoss, this));
+
+    Bands bands;
+    BandInfo band;
+    band.fl = 5.14e9;
+    band.fc = 5.15e9;
+    band.fh = 5.16e9;
+    bands.push_back(band);
+    Ptr<SpectrumModel> model = Create<SpectrumModel>(bands);
+
+    Ptr<CountingSpectrumPhy> txPhy = Create<CountingSpectrumPhy>(model, Vector(0, 0, 0));
+    std::vector<Ptr<CountingSpectrumPhy>> rxPhys;
+    for (double x : {10.0, 100.0, 10000.0})
+    {
+        rxPhys.push_back(Create<CountingSpectrumPhy>(model, Vector(x, 0, 0)));
+    }
+    for (auto it = rxPhys.rbegin(); it != rxPhys.rend(); ++it)
+    {
+        channel->AddRx(*it);
+    }
+
+    Ptr<SpectrumSignalParameters> params = Create<SpectrumSignalParameters>();
+    params->duration = MicroSeconds(100);
+    params->txPhy = txPhy;
+    params->psd = Create<SpectrumValue>(model);
+    (*params->psd)[0] = 1e-3 / 2e7; // 0 dBm over 20 MHz
+
+    m_pathLosses = 0;
+    m_lossRx.clear();
+    channel->StartTx(params);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    std::vector<std::size_t> indices;
+    for (const auto& phy : m_lossRx)
+    {
+        indices.push_back(std::find(rxPhys.begin(), rxPhys.end(), phy) - rxPhys.begin());
+    }
+    NS_TEST_EXPECT_MSG_EQ(std::is_sorted(indices.rbegin(), indices.rend()),
+                          true,
+                          "The receivers should be visited in the order they were added");
+
+    rx.clear();
+    for (const auto& phy : rxPhys)
+    {
+        rx.push_back(phy->m_rx);
+    }
+    channel->Dispose();
+    return m_pathLosses;
+}
+
+void
+SpectrumChannelCullingTestCase::DoRun()
+{
+    std::vector<uint32_t> rx;
+
+    // no floor, the grid cannot bound the range
+    NS_TEST_EXPECT_MSG_EQ(Send(-1e9, 50, rx), 3, "All the path losses should be computed");
+    NS_TEST_EXPECT_MSG_EQ(rx[2], 1, "The farthest receiver should receive the signal");
+
+    // floor without grid
+    NS_TEST_EXPECT_MSG_EQ(Send(-100, 0, rx), 3, "All the path losses should be computed");
+    NS_TEST_EXPECT_MSG_EQ(rx[0], 1, "The nearest receiver should receive the signal");
+    NS_TEST_EXPECT_MSG_EQ(rx[1], 1, "The second receiver should receive the signal");
+    NS_TEST_EXPECT_MSG_EQ(rx[2], 0, "The farthest receiver should not receive the signal");
+
+    // floor with grid, the range is about 460 m
+    NS_TEST_EXPECT_MSG_EQ(Send(-100, 50, rx), 2, "The farthest receiver should be culled");
+    NS_TEST_EXPECT_MSG_EQ(rx[0], 1, "The nearest receiver should receive the signal");
+    NS_TEST_EXPECT_MSG_EQ(rx[1], 1, "The second receiver should receive the signal");
+    NS_TEST_EXPECT_MSG_EQ(rx[2], 0, "The farthest receiver should not receive the signal");
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief Spectrum channel receiver culling TestSuite
+ */
+class SpectrumChannelCullingTestSuite : public TestSuite
+{
+  public:
+    SpectrumChannelCullingTestSuite();
+};
+
+SpectrumChannelCullingTestSuite::SpectrumChannelCullingTestSuite()
+    : TestSuite("spectrum-channel-culling", UNIT)
+{
+    AddTestCase(new SpectrumChannelCullingTestCase("ns3::SingleModelSpectrumChannel"),
+                TestCase::QUICK);
+    AddTestCase(new SpectrumChannelCullingTestCase("ns3::MultiModelSpectrumChannel"),
+                TestCase::QUICK);
+}
+
+/// Static variable for test initialization
+static SpectrumChannelCullingTestSuite g_spectrumChannelCullingTestSuite;
@@ -236,22 +236,20 @@ FqCobaltQueueDisc::SetAssociativeHash(uint32_t flowHash)
 
     for (uint32_t i = outerHash; i < outerHash + m_setWays; i++)
     {
-        auto it = m_flowsIndices.find(i);
+        FlowTableEntry& entry = m_flowTable[i];
 
-        if (it == m_flowsIndices.end() ||
-            (m_tags.find(i) != m_tags.end() && m_tags[i] == flowHash) ||
-            StaticCast<FqCobaltFlow>(GetQueueDiscClass(it->second))->GetStatus() ==
-                FqCobaltFlow::INACTIVE)
+        if (!entry.flow || entry.tag == flowHash ||
+            entry.flow->GetStatus() == FqCobaltFlow::INACTIVE)
         {
             // this queue has not been created yet or is associated with this flow
             // or is inactive, hence we can use it
-            m_tags[i] = flowHash;
+            entry.tag = flowHash;
             return i;
         }
     }
 
     // all the queues of the set are used. Use the first queue of the set
-    m_tags[outerHash] = flowHash;
+    m_flowTable[outerHash].tag = flowHash;
     return outerHash;
 }
 
@@ -292,8 +290,9 @@ FqCobaltQueueDisc::DoEnqueue(Ptr<QueueDiscItem> item)
         h = flowHash % m_flows;
     }
 
-    Ptr<FqCobaltFlow> flow;
-    if (m_flowsIndices.find(h) == m_flowsIndices.end())
+    FlowTableEntry& entry = m_flowTable[h];
+    Ptr<FqCobaltFlow> flow = entry.flow;
+    if (!flow)
     {
         NS_LOG_DEBUG("Creating a new flow queue with index " << h);
         flow = m_flowFactory.Create<FqCobaltFlow>();
@@ -312,23 +311,20 @@ FqCobaltQueueDisc::DoEnqueue(Ptr<QueueDiscItem> item)
         flow->SetIndex(h);
         AddQueueDiscClass(flow);
 
-        m_flowsIndices[h] = GetNQueueDiscClasses() - 1;
-    }
-    else
-    {
-        flow = StaticCast<FqCobaltFlow>(GetQueueDiscClass(m_flowsIndices[h]));
+        entry.flow = flow;
+        entry.position = m_inactiveFlows.insert(m_inactiveFlows.end(), flow);
     }
 
     if (flow->GetStatus() == FqCobaltFlow::INACTIVE)
     {
         flow->SetStatus(FqCobaltFlow::NEW_FLOW);
         flow->SetDeficit(m_quantum);
-        m_newFlows.push_back(flow);
+        m_newFlows.splice(m_newFlows.end(), m_inactiveFlows, entry.position);
     }
 
     flow->GetQueueDisc()->Enqueue(item);
 
-    NS_LOG_DEBUG("Packet enqueued into flow " << h << "; flow index " << m_flowsIndices[h]);
+    NS_LOG_DEBUG("Packet enqueued into flow " << h);
 
     if (GetCurrentSize() > GetMaxSize())
     {
@@ -360,8 +356,7 @@ FqCobaltQueueDisc::DoDequeue()
                 NS_LOG_DEBUG("Increase deficit for new flow index " << flow->GetIndex());
                 flow->IncreaseDeficit(m_quantum);
                 flow->SetStatus(FqCobaltFlow::OLD_FLOW);
-                m_oldFlows.push_back(flow);
-                m_newFlows.pop_front();
+                m_oldFlows.splice(m_oldFlows.end(), m_newFlows, m_newFlows.begin());
             }
             else
             {
@@ -378,8 +373,7 @@ FqCobaltQueueDisc::DoDequeue()
             {
                 NS_LOG_DEBUG("Increase deficit for old flow index " << flow->GetIndex());
                 flow->IncreaseDeficit(m_quantum);
-                m_oldFlows.push_back(flow);
-                m_oldFlows.pop_front();
+                m_oldFlows.splice(m_oldFlows.end(), m_oldFlows, m_oldFlows.begin());
             }
             else
             {
@@ -402,13 +396,12 @@ FqCobaltQueueDisc::DoDequeue()
             if (!m_newFlows.empty())
             {
                 flow->SetStatus(FqCobaltFlow::OLD_FLOW);
-                m_oldFlows.push_back(flow);
-                m_newFlows.pop_front();
+                m_oldFlows.splice(m_oldFlows.end(), m_newFlows, m_newFlows.begin());
             }
             else
             {
                 flow->SetStatus(FqCobaltFlow::INACTIVE);
-                m_oldFlows.pop_front();
+                m_inactiveFlows.splice(m_inactiveFlows.end(), m_oldFlows, m_oldFlows.begin());
             }
         }
         else
@@ -483,6 +476,7 @@ FqCobaltQueueDisc::InitializeParams()
     NS_LOG_FUNCTION(this);
 
     m_flowFactory.SetTypeId("ns3::FqCobaltFlow");
+    m_flowTable.assign(m_flows, FlowTableEntry());
 
     m_queueDiscFactory.SetTypeId("ns3::CobaltQueueDisc");
     m_queueDiscFactory.Set("MaxSize", QueueSizeValue(GetMaxSize()));
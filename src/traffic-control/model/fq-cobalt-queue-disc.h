@@ -31,7 +31,7 @@
 #include "ns3/queue-disc.h"
 
 #include <list>
-#include <map>
+#include <vector>
 
 namespace ns3
 {
@@ -189,11 +189,27 @@ class FqCobaltQueueDisc : public QueueDisc
     double m_Pdrop;       //!< Drop Probability
     Time m_blueThreshold; //!< Threshold to enable blue enhancement
 
-    std::list<Ptr<FqCobaltFlow>> m_newFlows; //!< The list of new flows
-    std::list<Ptr<FqCobaltFlow>> m_oldFlows; //!< The list of old flows
+    /// List of flows
+    typedef std::list<Ptr<FqCobaltFlow>> FlowList;
 
-    std::map<uint32_t, uint32_t> m_flowsIndices; //!< Map with the index of class for each flow
-    std::map<uint32_t, uint32_t> m_tags;         //!< Tags used by set associative hash
+    /**
+     * \brief Entry of the flow table.
+     *
+     * A flow is always in one of the lists of new, old or inactive flows, so
+     * that it is moved from a list to another by splicing its list node.
+     */
+    struct FlowTableEntry
+    {
+        Ptr<FqCobaltFlow> flow;      //!< the flow, null if not created yet
+        FlowList::iterator position; //!< the node of the flow in the list of its status
+        uint32_t tag;                //!< tag used by set associative hash
+    };
+
+    FlowList m_newFlows;      //!< The list of new flows
+    FlowList m_oldFlows;      //!< The list of old flows
+    FlowList m_inactiveFlows; //!< The list of inactive flows
+
+    std::vector<FlowTableEntry> m_flowTable; //!< Flow table, indexed by the index of the queue
 
     ObjectFactory m_flowFactory;      //!< Factory to create a new flow
     ObjectFactory m_queueDiscFactory; //!< Factory to create a new queue
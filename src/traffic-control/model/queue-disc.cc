@@ -19,16 +19,21 @@
 #include "queue-disc.h"
 
 #include "ns3/abort.h"
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 #include "ns3/net-device-queue-interface.h"
 #include "ns3/object-vector.h"
 #include "ns3/packet.h"
 #include "ns3/pointer.h"
+#include "ns3/queue-limits.h"
 #include "ns3/queue.h"
 #include "ns3/simulator.h"
 #include "ns3/socket.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace ns3
 {
 
@@ -260,6 +265,14 @@ QueueDisc::GetTypeId()
                           UintegerValue(DEFAULT_QUOTA),
                           MakeUintegerAccessor(&QueueDisc::SetQuota, &QueueDisc::GetQuota),
                           MakeUintegerChecker<uint32_t>())
+            .AddAttribute("BulkDequeue",
+                          "Whether to dequeue several packets at once and send them to the "
+                          "device as a batch. Packets are dequeued in bulk only if the device "
+                          "has a single transmission queue; the size of the batch is bounded "
+                          "by the room in the device queue and by the byte queue limits.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&QueueDisc::m_bulkDequeue),
+                          MakeBooleanChecker())
             .AddAttribute("InternalQueueList",
                           "The list of internal queues.",
                           ObjectVectorValue(),
@@ -322,6 +335,7 @@ QueueDisc::QueueDisc(QueueDiscSizePolicy policy)
     : m_nPackets(0),
       m_nBytes(0),
       m_maxSize(QueueSize("1p")), // to avoid that setting the mode at construction time is ignored
+      m_bulkDequeue(false),
       m_running(false),
       m_peeked(false),
       m_sizePolicy(policy),
@@ -384,6 +398,7 @@ QueueDisc::DoDispose()
     m_classes.clear();
     m_devQueueIface = nullptr;
     m_send = nullptr;
+    m_sendBatch = nullptr;
     m_requeued = nullptr;
     m_internalQueueDbeFunctor = nullptr;
     m_internalQueueDadFunctor = nullptr;
@@ -559,6 +574,20 @@ QueueDisc::GetSendCallback() const
     return m_send;
 }
 
+void
+QueueDisc::SetSendBatchCallback(SendBatchCallback func)
+{
+    NS_LOG_FUNCTION(this);
+    m_sendBatch = func;
+}
+
+QueueDisc::SendBatchCallback
+QueueDisc::GetSendBatchCallback() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_sendBatch;
+}
+
 void
 QueueDisc::SetQuota(const uint32_t quota)
 {
@@ -957,9 +986,10 @@ QueueDisc::Run()
     if (RunBegin())
     {
         uint32_t quota = m_quota;
-        while (Restart())
+        uint32_t packets = 0;
+        while (Restart(packets))
         {
-            quota -= 1;
+            quota -= std::min(quota, packets);
             if (quota <= 0)
             {
                 /// \todo netif_schedule (q);
@@ -991,9 +1021,10 @@ QueueDisc::RunEnd()
 }
 
 bool
-QueueDisc::Restart()
+QueueDisc::Restart(uint32_t& packets)
 {
     NS_LOG_FUNCTION(this);
+    packets = 0;
     Ptr<QueueDiscItem> item = DequeuePacket();
     if (!item)
     {
@@ -1001,6 +1032,17 @@ QueueDisc::Restart()
         return false;
     }
 
+    if (m_bulkDequeue && m_sendBatch)
+    {
+        std::vector<Ptr<QueueDiscItem>> items = BulkDequeue(item);
+        if (items.size() > 1)
+        {
+            packets = items.size();
+            return TransmitBatch(items);
+        }
+    }
+
+    packets = 1;
     return Transmit(item);
 }
 
@@ -1054,6 +1096,45 @@ QueueDisc::DequeuePacket()
     return item;
 }
 
+std::vector<Ptr<QueueDiscItem>>
+QueueDisc::BulkDequeue(Ptr<QueueDiscItem> item)
+{
+    NS_LOG_FUNCTION(this << item);
+
+    std::vector<Ptr<QueueDiscItem>> items{item};
+
+    if (!m_devQueueIface || m_devQueueIface->GetNTxQueues() > 1)
+    {
+        return items;
+    }
+    Ptr<NetDeviceQueue> txq = m_devQueueIface->GetTxQueue(0);
+    if (txq->IsStopped())
+    {
+        return items;
+    }
+
+    // the batch must fit in the device queue and, as in Linux, within the byte
+    // queue limits, if any
+    Ptr<QueueLimits> queueLimits = txq->GetQueueLimits();
+    int64_t bytes = std::numeric_limits<int64_t>::max();
+    if (queueLimits)
+    {
+        bytes = queueLimits->Available() - static_cast<int64_t>(item->GetSize());
+    }
+    while (bytes > 0 && txq->HasRoomFor(items.size() + 1))
+    {
+        Ptr<QueueDiscItem> next = DequeuePacket();
+        if (!next)
+        {
+            break;
+        }
+        items.push_back(next);
+        bytes -= next->GetSize();
+    }
+    NS_LOG_LOGIC("Dequeued a batch of " << items.size() << " packets");
+    return items;
+}
+
 void
 QueueDisc::Requeue(Ptr<QueueDiscItem> item)
 {
@@ -1117,4 +1198,23 @@ QueueDisc::Transmit(Ptr<QueueDiscItem> item)
     return true;
 }
 
+bool
+QueueDisc::TransmitBatch(const std::vector<Ptr<QueueDiscItem>>& items)
+{
+    NS_LOG_FUNCTION(this << items.size());
+    NS_ASSERT(m_devQueueIface && m_devQueueIface->GetNTxQueues() == 1);
+
+    // a single queue device makes no use of the priority tag
+    for (const auto& item : items)
+    {
+        SocketPriorityTag priorityTag;
+        item->GetPacket()->RemovePacketTag(priorityTag);
+    }
+    NS_ASSERT_MSG(m_sendBatch, "Send batch callback not set");
+    m_sendBatch(items);
+
+    // as in Transmit, packets sent to the device are never requeued
+    return GetNPackets() != 0 && !m_devQueueIface->GetTxQueue(0)->IsStopped();
+}
+
 } // namespace ns3
@@ -378,6 +378,26 @@ class QueueDisc : public Object
      */
     SendCallback GetSendCallback() const;
 
+    /// Callback invoked to send a batch of packets to the receiving object when Run is called
+    typedef std::function<void(const std::vector<Ptr<QueueDiscItem>>&)> SendBatchCallback;
+
+    /**
+     * \param func the callback to send a batch of packets to the receiving object.
+     *
+     * Set the callback used by the TransmitBatch method (called eventually by the
+     * Run method) to send the packets dequeued by a bulk dequeue to the receiving
+     * object. If this callback is not set, packets are never dequeued in bulk.
+     */
+    void SetSendBatchCallback(SendBatchCallback func);
+
+    /**
+     * \return the callback to send a batch of packets to the receiving object.
+     *
+     * Get the callback used by the TransmitBatch method (called eventually by the
+     * Run method) to send a batch of packets to the receiving object.
+     */
+    SendBatchCallback GetSendBatchCallback() const;
+
     /**
      * \brief Set the maximum number of dequeue operations following a packet enqueue
      * \param quota the maximum number of dequeue operations following a packet enqueue.
@@ -644,9 +664,12 @@ class QueueDisc : public Object
     /**
      * Modelled after the Linux function qdisc_restart (net/sched/sch_generic.c)
      * Dequeue a packet (by calling DequeuePacket) and send it to the device (by calling Transmit).
+     * If bulk dequeue is enabled, further packets are dequeued (by calling BulkDequeue) and
+     * the whole batch is sent to the device (by calling TransmitBatch).
+     * \param packets the number of packets sent to the device
      * \return true if a packet is successfully sent to the device.
      */
-    bool Restart();
+    bool Restart(uint32_t& packets);
 
     /**
      * Modelled after the Linux function dequeue_skb (net/sched/sch_generic.c)
@@ -654,6 +677,15 @@ class QueueDisc : public Object
      */
     Ptr<QueueDiscItem> DequeuePacket();
 
+    /**
+     * Modelled after the Linux function try_bulk_dequeue_skb (net/sched/sch_generic.c)
+     * Dequeue further packets to be sent along with the given one, as long as the
+     * device queue has room for them and the byte queue limits allow.
+     * \param item the packet already dequeued
+     * \return the batch of packets, starting with the given one
+     */
+    std::vector<Ptr<QueueDiscItem>> BulkDequeue(Ptr<QueueDiscItem> item);
+
     /**
      * Modelled after the Linux function dev_requeue_skb (net/sched/sch_generic.c)
      * Requeues a packet whose transmission failed.
@@ -670,6 +702,14 @@ class QueueDisc : public Object
      */
     bool Transmit(Ptr<QueueDiscItem> item);
 
+    /**
+     * Modelled after the Linux function sch_direct_xmit (net/sched/sch_generic.c)
+     * Sends a batch of packets to the device. The device queue must not be stopped.
+     * \param items the packets to transmit
+     * \return true if the device queue is not stopped and the queue disc is not empty
+     */
+    bool TransmitBatch(const std::vector<Ptr<QueueDiscItem>>& items);
+
     /**
      * \brief Perform the actions required when the queue disc is notified of
      *        a packet enqueue
@@ -700,6 +740,8 @@ class QueueDisc : public Object
     uint32_t m_quota; //!< Maximum number of packets dequeued in a qdisc run
     Ptr<NetDeviceQueueInterface> m_devQueueIface; //!< NetDevice queue interface
     SendCallback m_send;           //!< Callback used to send a packet to the receiving object
+    SendBatchCallback m_sendBatch; //!< Callback used to send a batch to the receiving object
+    bool m_bulkDequeue;            //!< Whether packets are dequeued in bulk
     bool m_running;                //!< The queue disc is performing multiple dequeue operations
     Ptr<QueueDiscItem> m_requeued; //!< The last packet that failed to be transmitted
     bool m_peeked;                 //!< A packet was dequeued because Peek was called
@@ -33,6 +33,7 @@
 #include "ns3/enum.h"
 #include "ns3/log.h"
 #include "ns3/net-device-queue-interface.h"
+#include "ns3/node.h"
 #include "ns3/object-factory.h"
 #include "ns3/simulator.h"
 #include "ns3/uinteger.h"
@@ -44,6 +45,43 @@ NS_LOG_COMPONENT_DEFINE("TbfQueueDisc");
 
 NS_OBJECT_ENSURE_REGISTERED(TbfQueueDisc);
 
+/**
+ * \brief Compute the number of tokens entering a bucket in the given time.
+ *
+ * The computation is done in integer arithmetic and the result is rounded
+ * to the nearest integer.  As the tokens in a bucket are capped, the result
+ * is capped to the given maximum to avoid overflows.
+ *
+ * \param rate the rate at which tokens enter the bucket
+ * \param delta the elapsed time
+ * \param max the maximum number of tokens returned
+ * \return the number of tokens, in bytes
+ */
+static uint64_t
+TokensInTime(const DataRate& rate, const Time& delta, uint64_t max)
+{
+    const uint64_t nsPerSecond = 1000000000;
+    uint64_t bitsPerSecond = rate.GetBitRate();
+    uint64_t ns = delta.GetNanoSeconds();
+    uint64_t seconds = ns / nsPerSecond;
+    uint64_t rest = ns % nsPerSecond;
+
+    if (bitsPerSecond == 0)
+    {
+        return 0;
+    }
+    if (seconds / 8 > max / bitsPerSecond)
+    {
+        return max;
+    }
+    // the bits are converted to bytes last, so that sub-byte rates are not
+    // truncated; the rate is split so that (rest * bitsPerSecond) does not
+    // overflow, and the bits are counted in units of 1/nsPerSecond
+    uint64_t bits = seconds * bitsPerSecond + rest * (bitsPerSecond / nsPerSecond);
+    uint64_t fraction = rest * (bitsPerSecond % nsPerSecond);
+    return bits / 8 + ((bits % 8) * nsPerSecond + fraction + 4 * nsPerSecond) / (8 * nsPerSecond);
+}
+
 TypeId
 TbfQueueDisc::GetTypeId()
 {
@@ -92,7 +130,8 @@ TbfQueueDisc::GetTypeId()
 }
 
 TbfQueueDisc::TbfQueueDisc()
-    : QueueDisc(QueueDiscSizePolicy::SINGLE_CHILD_QUEUE_DISC)
+    : QueueDisc(QueueDiscSizePolicy::SINGLE_CHILD_QUEUE_DISC),
+      m_release(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -106,6 +145,12 @@ void
 TbfQueueDisc::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    m_id.Cancel();
+    if (m_calendar)
+    {
+        m_calendar->Cancel(m_release);
+        m_calendar = nullptr;
+    }
     QueueDisc::DoDispose();
 }
 
@@ -210,12 +255,12 @@ TbfQueueDisc::DoDequeue()
         int64_t ptoks = 0;
         Time now = Simulator::Now();
 
-        double delta = (now - m_timeCheckPoint).GetSeconds();
-        NS_LOG_LOGIC("Time Difference delta " << delta);
+        Time delta = now - m_timeCheckPoint;
+        NS_LOG_LOGIC("Time Difference delta " << delta.As(Time::S));
 
         if (m_peakRate > DataRate("0bps"))
         {
-            ptoks = m_ptokens + round(delta * (m_peakRate.GetBitRate() / 8));
+            ptoks = m_ptokens + TokensInTime(m_peakRate, delta, m_mtu);
             if (ptoks > m_mtu)
             {
                 ptoks = m_mtu;
@@ -225,7 +270,7 @@ TbfQueueDisc::DoDequeue()
             ptoks -= pktSize;
         }
 
-        btoks = m_btokens + round(delta * (m_rate.GetBitRate() / 8));
+        btoks = m_btokens + TokensInTime(m_rate, delta, m_burst);
 
         if (btoks > m_burst)
         {
@@ -261,7 +306,10 @@ TbfQueueDisc::DoDequeue()
         // A packet gets blocked if the above if() condition is not satisfied:
         // either or both btoks and ptoks are negative.  In that case, we have
         // to schedule the waking of queue when enough tokens are available.
-        if (m_id.IsExpired() == true)
+        // If a pacing calendar is aggregated to the node, the waking is
+        // scheduled in the calendar, so that it shares the event of the slot
+        // with the other paced flows of the node.
+        if (m_calendar ? !m_calendar->IsPending(m_release) : m_id.IsExpired())
         {
             NS_ASSERT_MSG(m_rate.GetBitRate() > 0, "Rate must be positive");
             Time requiredDelayTime;
@@ -287,7 +335,15 @@ TbfQueueDisc::DoDequeue()
                 }
             }
             NS_ASSERT_MSG(requiredDelayTime.GetSeconds() >= 0, "Negative time");
-            m_id = Simulator::Schedule(requiredDelayTime, &QueueDisc::Run, this);
+            if (m_calendar)
+            {
+                m_release =
+                    m_calendar->Schedule(requiredDelayTime, MakeCallback(&QueueDisc::Run, this));
+            }
+            else
+            {
+                m_id = Simulator::Schedule(requiredDelayTime, &QueueDisc::Run, this);
+            }
             NS_LOG_LOGIC("Waking Event Scheduled in " << requiredDelayTime.As(Time::S));
         }
     }
@@ -384,6 +440,14 @@ TbfQueueDisc::InitializeParams()
     // Initialising other variables to 0.
     m_timeCheckPoint = Seconds(0);
     m_id = EventId();
+
+    Ptr<NetDeviceQueueInterface> ndqi = GetNetDeviceQueueInterface();
+    Ptr<NetDevice> dev;
+    // use the pacing calendar of the node, if any
+    if (ndqi && (dev = ndqi->GetObject<NetDevice>()) && dev->GetNode())
+    {
+        m_calendar = dev->GetNode()->GetObject<PacingCalendar>();
+    }
 }
 
 } // namespace ns3
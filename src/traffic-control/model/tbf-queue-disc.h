@@ -32,6 +32,7 @@
 #include "ns3/data-rate.h"
 #include "ns3/event-id.h"
 #include "ns3/nstime.h"
+#include "ns3/pacing-calendar.h"
 #include "ns3/queue-disc.h"
 #include "ns3/random-variable-stream.h"
 #include "ns3/trace-source-accessor.h"
@@ -161,6 +162,8 @@ class TbfQueueDisc : public QueueDisc
     TracedValue<uint32_t> m_ptokens; //!< Current number of tokens in second bucket
     Time m_timeCheckPoint;           //!< Time check-point
     EventId m_id; //!< EventId of the scheduled queue waking event when enough tokens are available
+    Ptr<PacingCalendar> m_calendar;      //!< Pacing calendar of the node, if any
+    PacingCalendar::ReleaseId m_release; //!< Queue waking release, if the calendar is used
 };
 
 } // namespace ns3
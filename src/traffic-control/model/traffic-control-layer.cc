@@ -211,6 +211,9 @@ TrafficControlLayer::ScanDevices()
                 q->SetSendCallback([dev](Ptr<QueueDiscItem> item) {
                     dev->Send(item->GetPacket(), item->GetAddress(), item->GetProtocol());
                 });
+                q->SetSendBatchCallback([dev](const std::vector<Ptr<QueueDiscItem>>& items) {
+                    dev->SendBatch(items);
+                });
             }
         }
     }
@@ -275,6 +278,7 @@ TrafficControlLayer::DeleteRootQueueDiscOnDevice(Ptr<NetDevice> device)
     {
         q->SetNetDeviceQueueInterface(nullptr);
         q->SetSendCallback(nullptr);
+        q->SetSendBatchCallback(nullptr);
     }
     ndi->second.m_queueDiscsToWake.clear();
 
@@ -18,6 +18,7 @@
  *
  */
 
+#include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/data-rate.h"
 #include "ns3/double.h"
@@ -25,6 +26,7 @@
 #include "ns3/net-device-queue-interface.h"
 #include "ns3/node-container.h"
 #include "ns3/pointer.h"
+#include "ns3/queue-disc.h"
 #include "ns3/queue.h"
 #include "ns3/simple-net-device-helper.h"
 #include "ns3/simulator.h"
@@ -494,6 +496,175 @@ TcFlowControlTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup traffic-control-test
+ * \ingroup tests
+ *
+ * \brief Traffic Control Bulk Dequeue Test Case
+ *
+ * Ten packets are enqueued in the queue disc while the device queue (which
+ * can store 5 packets) is stopped. When the device queue is woken, the queue
+ * disc dequeues (if bulk dequeue is enabled) a batch of 5 packets, which are
+ * all sent to the device before the next dequeue. The remaining packets are
+ * sent one at a time, as the device transmits the packets.
+ */
+class TcBulkDequeueTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param bulkDequeue whether bulk dequeue is enabled
+     */
+    TcBulkDequeueTestCase(bool bulkDequeue);
+
+  private:
+    void DoRun() override;
+    /**
+     * Stop the device queue and send packets to the traffic control layer
+     * \param n the node
+     * \param dev the device
+     * \param nPackets the number of packets to send
+     */
+    void SendPackets(Ptr<Node> n, Ptr<NetDevice> dev, uint16_t nPackets);
+    /**
+     * Record a packet dequeued by the queue disc
+     * \param item the dequeued packet
+     */
+    void QueueDiscDequeue(Ptr<const QueueDiscItem> item);
+    /**
+     * Record a packet enqueued in the device queue
+     * \param packet the enqueued packet
+     */
+    void DeviceEnqueue(Ptr<const Packet> packet);
+    /**
+     * Record a packet dequeued from the device queue
+     * \param packet the dequeued packet
+     */
+    void DeviceDequeue(Ptr<const Packet> packet);
+    /**
+     * Record a packet dropped by the device queue
+     * \param packet the dropped packet
+     */
+    void DeviceDrop(Ptr<const Packet> packet);
+
+    bool m_bulkDequeue;     //!< whether bulk dequeue is enabled
+    uint32_t m_burst;       //!< number of packets dequeued since the last device enqueue
+    uint32_t m_maxBurst;    //!< maximum number of packets dequeued before a device enqueue
+    uint32_t m_transmitted; //!< number of packets dequeued from the device queue
+    uint32_t m_deviceDrops; //!< number of packets dropped by the device queue
+};
+
+TcBulkDequeueTestCase::TcBulkDequeueTestCase(bool bulkDequeue)
+    : TestCase(std::string("Test the bulk dequeue of packets, ") +
+               (bulkDequeue ? "enabled" : "disabled")),
+      m_bulkDequeue(bulkDequeue),
+      m_burst(0),
+      m_maxBurst(0),
+      m_transmitted(0),
+      m_deviceDrops(0)
+{
+}
+
+void
+TcBulkDequeueTestCase::SendPackets(Ptr<Node> n, Ptr<NetDevice> dev, uint16_t nPackets)
+{
+    dev->GetObject<NetDeviceQueueInterface>()->GetTxQueue(0)->Stop();
+    Ptr<TrafficControlLayer> tc = n->GetObject<TrafficControlLayer>();
+    for (uint16_t i = 0; i < nPackets; i++)
+    {
+        tc->Send(dev, Create<QueueDiscTestItem>(Create<Packet>(1000)));
+    }
+}
+
+void
+TcBulkDequeueTestCase::QueueDiscDequeue(Ptr<const QueueDiscItem> item)
+{
+    m_burst++;
+    m_maxBurst = std::max(m_maxBurst, m_burst);
+}
+
+void
+TcBulkDequeueTestCase::DeviceEnqueue(Ptr<const Packet> packet)
+{
+    m_burst = 0;
+}
+
+void
+TcBulkDequeueTestCase::DeviceDequeue(Ptr<const Packet> packet)
+{
+    m_transmitted++;
+}
+
+void
+TcBulkDequeueTestCase::DeviceDrop(Ptr<const Packet> packet)
+{
+    m_deviceDrops++;
+}
+
+void
+TcBulkDequeueTestCase::DoRun()
+{
+    NodeContainer n;
+    n.Create(2);
+
+    n.Get(0)->AggregateObject(CreateObject<TrafficControlLayer>());
+    n.Get(1)->AggregateObject(CreateObject<TrafficControlLayer>());
+
+    SimpleNetDeviceHelper simple;
+
+    NetDeviceContainer rxDevC = simple.Install(n.Get(1));
+
+    simple.SetDeviceAttribute("DataRate", DataRateValue(DataRate("1Mb/s")));
+    simple.SetQueue("ns3::DropTailQueue", "MaxSize", StringValue("5p"));
+
+    Ptr<NetDevice> txDev =
+        simple.Install(n.Get(0), DynamicCast<SimpleChannel>(rxDevC.Get(0)->GetChannel())).Get(0);
+
+    TrafficControlHelper tch;
+    tch.SetRootQueueDisc("ns3::FifoQueueDisc",
+                         "BulkDequeue",
+                         BooleanValue(m_bulkDequeue),
+                         "Quota",
+                         UintegerValue(64));
+    QueueDiscContainer qdiscs = tch.Install(txDev);
+
+    qdiscs.Get(0)->TraceConnectWithoutContext(
+        "Dequeue",
+        MakeCallback(&TcBulkDequeueTestCase::QueueDiscDequeue, this));
+    PointerValue ptr;
+    txDev->GetAttribute("TxQueue", ptr);
+    Ptr<Queue<Packet>> queue = ptr.Get<Queue<Packet>>();
+    queue->TraceConnectWithoutContext("Enqueue",
+                                      MakeCallback(&TcBulkDequeueTestCase::DeviceEnqueue, this));
+    queue->TraceConnectWithoutContext("Dequeue",
+                                      MakeCallback(&TcBulkDequeueTestCase::DeviceDequeue, this));
+    queue->TraceConnectWithoutContext("Drop",
+                                      MakeCallback(&TcBulkDequeueTestCase::DeviceDrop, this));
+
+    // enqueue 10 packets in the queue disc while the device queue is stopped
+    Simulator::Schedule(Seconds(0),
+                        &TcBulkDequeueTestCase::SendPackets,
+                        this,
+                        n.Get(0),
+                        txDev,
+                        10);
+    Simulator::Schedule(MilliSeconds(1), [&]() {
+        NS_TEST_EXPECT_MSG_EQ(qdiscs.Get(0)->GetNPackets(),
+                              10,
+                              "Packets dequeued from the queue disc");
+        txDev->GetObject<NetDeviceQueueInterface>()->GetTxQueue(0)->Wake();
+    });
+    Simulator::Run();
+
+    uint32_t expectedBurst = (m_bulkDequeue ? 5 : 1);
+    NS_TEST_EXPECT_MSG_EQ(m_maxBurst, expectedBurst, "Unexpected number of packets dequeued");
+    NS_TEST_EXPECT_MSG_EQ(m_transmitted, 10, "All the packets must be transmitted");
+    NS_TEST_EXPECT_MSG_EQ(m_deviceDrops, 0, "No packet must be dropped by the device queue");
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup traffic-control-test
  * \ingroup tests
@@ -519,5 +690,7 @@ static class TcFlowControlTestSuite : public TestSuite
         // TODO: Right now, this test only works for 5000B and 10 packets (it's hard coded). Should
         // also be made parametric.
         AddTestCase(new TcFlowControlTestCase(QueueSizeUnit::BYTES, 5000, 10), TestCase::QUICK);
+        AddTestCase(new TcBulkDequeueTestCase(false), TestCase::QUICK);
+        AddTestCase(new TcBulkDequeueTestCase(true), TestCase::QUICK);
     }
 } g_tcFlowControlTestSuite; ///< the test suite
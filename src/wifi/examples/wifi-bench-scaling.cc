@@ -0,0 +1,688 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks the simulation of Wi-Fi networks of increasing size,
+// so that the performance of the Wi-Fi model (frame exchange managers, PHY entities,
+// interference helper, channels) can be tracked over releases.
+//
+// Each scenario is made of a number of overlapping 802.11ax BSSs operating on the
+// same 5 GHz channel. The APs are placed on a line, 10 meters apart, and the stations
+// of a BSS are evenly spaced on a circle of 5 meters of radius centered at their AP.
+// Every station sends a constant bit rate uplink flow of packets to its AP, or receives
+// one from its AP (through packet sockets, to leave out the Internet stack), at a fixed
+// MCS. With OFDMA, the APs use a multi-user scheduler (round robin by default): in
+// downlink, the APs send DL MU PPDUs; in uplink, the APs periodically request channel
+// access to solicit TB PPDUs from their stations (after a BSRP Trigger Frame). Traffic starts
+// after a warmup period, which lets the stations associate; only the time after the
+// warmup period is measured. Random variable streams are assigned to the devices of
+// every scenario in the same manner, so the results do not depend on the sweep.
+//
+// The scenarios are the cartesian product of the comma-separated lists of values
+// given for the following arguments:
+// --nStations (number of stations per BSS)
+// --nBss (number of overlapping BSSs)
+// --channelWidth (20, 40, 80 or 160 MHz)
+// --maxAmpduSize (maximum A-MPDU size in bytes, 0 disables A-MPDU aggregation)
+// --phy (yans, spectrum)
+// --direction (ul, dl)
+// --ofdma (0, 1; OFDMA scenarios are only run with the spectrum PHY model)
+//
+// The following arguments apply to all the scenarios:
+// --yansGridCellSize (ReceiverGridCellSize of the YansWifiChannel)
+// --interferenceFloor (InterferenceFloor of the spectrum channel)
+// --spectrumGridCellSize (ReceiverGridCellSize of the spectrum channel)
+// --abstraction (Abstraction of the PHYs: None, Eesm or Miesm)
+// --muScheduler (type of the multi-user scheduler of the APs in the OFDMA scenarios)
+//
+// One line of comma-separated values is printed for each scenario, after a header
+// line. The columns are:
+// - the scenario identifier and parameters;
+// - the wall clock time (ms) spent to set up the scenario and to run the measured period;
+// - the number of events executed in the measured period, the number of events executed
+//   per wall clock second and the wall clock time (ms) per simulated second;
+// - the user and system CPU time (ms) of the measured period;
+// - the peak resident set size (kB) of the process so far (run one scenario per
+//   process to get the peak of each scenario);
+// - the activity of each layer in the measured period: PSDUs transmitted by the PHY,
+//   PPDUs whose reception started, PSDUs received successfully and dropped by the PHY,
+//   MSDUs transmitted and received by the MAC, and bytes received by the applications;
+// - the aggregate throughput (Mbps).
+//
+// Sample usage:
+// ./ns3 run "wifi-bench-scaling --nStations=1,8,32 --nBss=1,2 --phy=yans,spectrum"
+// ./ns3 run "wifi-bench-scaling --nStations=32 --nBss=1 --channelWidth=80 --direction=dl,ul
+//            --ofdma=0,1 --phy=spectrum"
+
+#include "ns3/abort.h"
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/config.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/multi-model-spectrum-channel.h"
+#include "ns3/packet-socket-address.h"
+#include "ns3/packet-socket-client.h"
+#include "ns3/packet-socket-helper.h"
+#include "ns3/packet-socket-server.h"
+#include "ns3/propagation-delay-model.h"
+#include "ns3/propagation-loss-model.h"
+#include "ns3/simulator.h"
+#include "ns3/spectrum-wifi-helper.h"
+#include "ns3/ssid.h"
+#include "ns3/string.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/uinteger.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef __WIN32__
+#include <sys/resource.h>
+#endif
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("WifiBenchScaling");
+
+/**
+ * Parameters of a scenario
+ */
+struct Scenario
+{
+    std::string phy;             ///< the PHY model ("yans" or "spectrum")
+    uint32_t nBss;               ///< the number of overlapping BSSs
+    uint32_t nStations;          ///< the number of stations per BSS
+    uint16_t channelWidth;       ///< the channel width in MHz
+    uint32_t maxAmpduSize;       ///< the maximum A-MPDU size in bytes
+    std::string direction;       ///< the direction of the flows ("ul" or "dl")
+    bool ofdma;                  ///< whether the APs use a multi-user scheduler
+    uint8_t mcs;                 ///< the HE MCS used by all the devices
+    uint32_t payloadSize;        ///< the size of the packets in bytes
+    double offeredLoad;          ///< the offered load per BSS in Mbps
+    Time warmup;                 ///< the duration of the warmup period
+    Time simulationTime;         ///< the duration of the measured period
+    double yansGridCellSize;     ///< the ReceiverGridCellSize of the YansWifiChannel
+    double interferenceFloor;    ///< the InterferenceFloor of the spectrum channel in dBm
+    double spectrumGridCellSize; ///< the ReceiverGridCellSize of the spectrum channel
+    std::string abstraction;     ///< the Abstraction of the PHYs
+    std::string muScheduler;     ///< the type of the multi-user scheduler of the APs
+};
+
+/**
+ * Activity of the layers in the measured period
+ */
+struct Counters
+{
+    uint64_t phyTx{0};      ///< PSDUs transmitted by the PHY
+    uint64_t phyRxBegin{0}; ///< PPDUs whose reception started
+    uint64_t phyRxEnd{0};   ///< PSDUs received successfully by the PHY
+    uint64_t phyRxDrop{0};  ///< PSDUs dropped by the PHY
+    uint64_t macTx{0};      ///< MSDUs transmitted by the MAC
+    uint64_t macRx{0};      ///< MSDUs received by the MAC
+    uint64_t appRxBytes{0}; ///< bytes received by the applications
+};
+
+/**
+ * Results of a scenario
+ */
+struct Results
+{
+    int64_t setupMs{0};     ///< wall clock time spent to set up the scenario
+    int64_t runMs{0};       ///< wall clock time spent to run the measured period
+    int64_t cpuUserMs{0};   ///< user CPU time of the measured period
+    int64_t cpuSystemMs{0}; ///< system CPU time of the measured period
+    uint64_t events{0};     ///< events executed in the measured period
+    int64_t peakRssKb{0};   ///< peak resident set size of the process
+    Counters counters;      ///< activity of the layers in the measured period
+};
+
+/// Activity of the layers in the current scenario
+static Counters g_counters;
+
+/**
+ * Count a PSDU transmitted by the PHY.
+ *
+ * \param p the packet
+ * \param txPowerW the transmit power in Watts
+ */
+static void
+PhyTxBegin(Ptr<const Packet> p, double txPowerW)
+{
+    g_counters.phyTx++;
+}
+
+/**
+ * Count a PPDU whose reception started.
+ *
+ * \param p the packet
+ * \param rxPowersW the received power per band in Watts
+ */
+static void
+PhyRxBegin(Ptr<const Packet> p, RxPowerWattPerChannelBand rxPowersW)
+{
+    g_counters.phyRxBegin++;
+}
+
+/**
+ * Count a PSDU received successfully by the PHY.
+ *
+ * \param p the packet
+ */
+static void
+PhyRxEnd(Ptr<const Packet> p)
+{
+    g_counters.phyRxEnd++;
+}
+
+/**
+ * Count a PSDU dropped by the PHY.
+ *
+ * \param p the packet
+ * \param reason the reason of the drop
+ */
+static void
+PhyRxDrop(Ptr<const Packet> p, WifiPhyRxfailureReason reason)
+{
+    g_counters.phyRxDrop++;
+}
+
+/**
+ * Count a MSDU transmitted by the MAC.
+ *
+ * \param p the packet
+ */
+static void
+MacTx(Ptr<const Packet> p)
+{
+    g_counters.macTx++;
+}
+
+/**
+ * Count a MSDU received by the MAC.
+ *
+ * \param p the packet
+ */
+static void
+MacRx(Ptr<const Packet> p)
+{
+    g_counters.macRx++;
+}
+
+/**
+ * Count the bytes received by an application.
+ *
+ * \param p the packet
+ * \param from the address of the sender
+ */
+static void
+AppRx(Ptr<const Packet> p, const Address& from)
+{
+    g_counters.appRxBytes += p->GetSize();
+}
+
+/**
+ * \return the peak resident set size (kB) of the process, or zero if unknown
+ */
+static int64_t
+GetPeakRssKb()
+{
+#ifdef __WIN32__
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024; // bytes on macOS
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+/**
+ * \return the user and system CPU times (ms) of the process, or zero if unknown
+ */
+static std::pair<int64_t, int64_t>
+GetCpuTimesMs()
+{
+#ifdef __WIN32__
+    return {0, 0};
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return {0, 0};
+    }
+    return {usage.ru_utime.tv_sec * 1000 + usage.ru_utime.tv_usec / 1000,
+            usage.ru_stime.tv_sec * 1000 + usage.ru_stime.tv_usec / 1000};
+#endif
+}
+
+/**
+ * Start measuring at the end of the warmup period.
+ *
+ * \param timer the timer measuring the measured period
+ * \param events the number of events executed before the measured period
+ * \param cpuTimes the CPU times of the process before the measured period
+ */
+static void
+StartMeasurement(SystemWallClockMs* timer,
+                 uint64_t* events,
+                 std::pair<int64_t, int64_t>* cpuTimes)
+{
+    g_counters = Counters();
+    *events = Simulator::GetEventCount();
+    *cpuTimes = GetCpuTimesMs();
+    timer->Start();
+}
+
+/**
+ * \param scenario the parameters of the scenario
+ * \return the identifier of the scenario
+ */
+static std::string
+GetScenarioId(const Scenario& scenario)
+{
+    std::ostringstream oss;
+    oss << scenario.phy << "-bss" << scenario.nBss << "-sta" << scenario.nStations << "-w"
+        << scenario.channelWidth << "-ampdu" << scenario.maxAmpduSize << "-" << scenario.direction
+        << (scenario.ofdma ? "-ofdma" : "");
+    return oss.str();
+}
+
+/**
+ * Set up and run a scenario.
+ *
+ * \param scenario the parameters of the scenario
+ * \return the results of the scenario
+ */
+static Results
+RunScenario(const Scenario& scenario)
+{
+    Results results;
+    SystemWallClockMs setupTimer;
+    setupTimer.Start();
+
+    NodeContainer apNodes;
+    apNodes.Create(scenario.nBss);
+    std::vector<NodeContainer> staNodes(scenario.nBss);
+
+    // place the APs on a line and the stations on a circle around their AP
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    for (uint32_t i = 0; i < scenario.nBss; i++)
+    {
+        positionAlloc->Add(Vector(10.0 * i, 0.0, 0.0));
+    }
+    for (uint32_t i = 0; i < scenario.nBss; i++)
+    {
+        staNodes[i].Create(scenario.nStations);
+        for (uint32_t j = 0; j < scenario.nStations; j++)
+        {
+            double angle = 2 * M_PI * j / scenario.nStations;
+            positionAlloc->Add(
+                Vector(10.0 * i + 5.0 * std::cos(angle), 5.0 * std::sin(angle), 0.0));
+        }
+    }
+
+    YansWifiPhyHelper yansPhy;
+    SpectrumWifiPhyHelper spectrumPhy;
+    WifiPhyHelper* phy = nullptr;
+    if (scenario.phy == "yans")
+    {
+        YansWifiChannelHelper channelHelper = YansWifiChannelHelper::Default();
+        Ptr<YansWifiChannel> channel = channelHelper.Create();
+        channel->SetAttribute("ReceiverGridCellSize", DoubleValue(scenario.yansGridCellSize));
+        yansPhy.SetChannel(channel);
+        phy = &yansPhy;
+    }
+    else if (scenario.phy == "spectrum")
+    {
+        Ptr<MultiModelSpectrumChannel> channel = CreateObject<MultiModelSpectrumChannel>();
+        channel->SetAttribute("InterferenceFloor", DoubleValue(scenario.interferenceFloor));
+        channel->SetAttribute("ReceiverGridCellSize", DoubleValue(scenario.spectrumGridCellSize));
+        channel->AddPropagationLossModel(CreateObject<LogDistancePropagationLossModel>());
+        channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+        spectrumPhy.SetChannel(channel);
+        phy = &spectrumPhy;
+    }
+    else
+    {
+        NS_FATAL_ERROR("Unsupported PHY model: " << scenario.phy);
+    }
+    phy->Set("ChannelSettings",
+             StringValue("{0, " + std::to_string(scenario.channelWidth) + ", BAND_5GHZ, 0}"));
+    phy->Set("Abstraction", StringValue(scenario.abstraction));
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211ax);
+    std::string mode = "HeMcs" + std::to_string(scenario.mcs);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue(mode),
+                                 "ControlMode",
+                                 StringValue(mode));
+
+    NetDeviceContainer apDevices;
+    std::vector<NetDeviceContainer> staDevices(scenario.nBss);
+    WifiMacHelper mac;
+    bool uplink = (scenario.direction == "ul");
+    NS_ABORT_MSG_IF(!uplink && scenario.direction != "dl",
+                    "Unsupported direction: " << scenario.direction);
+    if (scenario.ofdma)
+    {
+        Config::SetDefault("ns3::RrMultiUserScheduler::EnableUlOfdma", BooleanValue(uplink));
+        Config::SetDefault("ns3::RrMultiUserScheduler::EnableBsrp", BooleanValue(uplink));
+        // without downlink traffic, the APs have to request channel access to
+        // solicit TB PPDUs
+        mac.SetMultiUserScheduler(scenario.muScheduler,
+                                  "AccessReqInterval",
+                                  TimeValue(uplink ? MilliSeconds(1) : Seconds(0)));
+    }
+    int64_t streamNumber = 100;
+    for (uint32_t i = 0; i < scenario.nBss; i++)
+    {
+        Ssid ssid("bench-" + std::to_string(i));
+        mac.SetType("ns3::ApWifiMac",
+                    "Ssid",
+                    SsidValue(ssid),
+                    "BE_MaxAmpduSize",
+                    UintegerValue(scenario.maxAmpduSize));
+        apDevices.Add(wifi.Install(*phy, mac, apNodes.Get(i)));
+        // the multi-user scheduler is only installed on APs
+        mac.SetType("ns3::StaWifiMac",
+                    "Ssid",
+                    SsidValue(ssid),
+                    "BE_MaxAmpduSize",
+                    UintegerValue(scenario.maxAmpduSize));
+        staDevices[i] = wifi.Install(*phy, mac, staNodes[i]);
+    }
+    streamNumber += wifi.AssignStreams(apDevices, streamNumber);
+    for (const auto& devices : staDevices)
+    {
+        streamNumber += wifi.AssignStreams(devices, streamNumber);
+    }
+
+    MobilityHelper mobility;
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(apNodes);
+    for (const auto& nodes : staNodes)
+    {
+        mobility.Install(nodes);
+    }
+
+    // a flow between every station and its AP
+    PacketSocketHelper packetSocket;
+    packetSocket.Install(apNodes);
+    Time stopTime = scenario.warmup + scenario.simulationTime;
+    Time interval =
+        Seconds(scenario.payloadSize * 8.0 * scenario.nStations / (scenario.offeredLoad * 1e6));
+    for (uint32_t i = 0; i < scenario.nBss; i++)
+    {
+        packetSocket.Install(staNodes[i]);
+
+        for (uint32_t j = 0; j < scenario.nStations; j++)
+        {
+            Ptr<Node> txNode = (uplink ? staNodes[i].Get(j) : apNodes.Get(i));
+            Ptr<Node> rxNode = (uplink ? apNodes.Get(i) : staNodes[i].Get(j));
+            Ptr<NetDevice> rxDevice = (uplink ? apDevices.Get(i) : staDevices[i].Get(j));
+
+            PacketSocketAddress socket;
+            socket.SetAllDevices();
+            socket.SetPhysicalAddress(rxDevice->GetAddress());
+            socket.SetProtocol(1);
+
+            Ptr<PacketSocketClient> client = CreateObject<PacketSocketClient>();
+            client->SetAttribute("PacketSize", UintegerValue(scenario.payloadSize));
+            client->SetAttribute("MaxPackets", UintegerValue(0));
+            client->SetAttribute("Interval", TimeValue(interval));
+            client->SetRemote(socket);
+            txNode->AddApplication(client);
+            client->SetStartTime(scenario.warmup);
+            client->SetStopTime(stopTime);
+
+            // in uplink, a single server per AP receives the flows of all its stations
+            if (!uplink || j == 0)
+            {
+                Ptr<PacketSocketServer> server = CreateObject<PacketSocketServer>();
+                server->SetLocal(socket);
+                server->TraceConnectWithoutContext("Rx", MakeCallback(&AppRx));
+                rxNode->AddApplication(server);
+                server->SetStartTime(Seconds(0));
+                server->SetStopTime(stopTime);
+            }
+        }
+    }
+
+    std::string devicePath = "/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/";
+    Config::ConnectWithoutContext(devicePath + "Phy/PhyTxBegin", MakeCallback(&PhyTxBegin));
+    Config::ConnectWithoutContext(devicePath + "Phy/PhyRxBegin", MakeCallback(&PhyRxBegin));
+    Config::ConnectWithoutContext(devicePath + "Phy/PhyRxEnd", MakeCallback(&PhyRxEnd));
+    Config::ConnectWithoutContext(devicePath + "Phy/PhyRxDrop", MakeCallback(&PhyRxDrop));
+    Config::ConnectWithoutContext(devicePath + "Mac/MacTx", MakeCallback(&MacTx));
+    Config::ConnectWithoutContext(devicePath + "Mac/MacRx", MakeCallback(&MacRx));
+
+    SystemWallClockMs runTimer;
+    uint64_t events = 0;
+    std::pair<int64_t, int64_t> cpuTimes;
+    Simulator::Schedule(scenario.warmup, &StartMeasurement, &runTimer, &events, &cpuTimes);
+    Simulator::Stop(stopTime);
+    results.setupMs = setupTimer.End();
+
+    Simulator::Run();
+
+    results.runMs = runTimer.End();
+    auto [cpuUserMs, cpuSystemMs] = GetCpuTimesMs();
+    results.cpuUserMs = cpuUserMs - cpuTimes.first;
+    results.cpuSystemMs = cpuSystemMs - cpuTimes.second;
+    results.events = Simulator::GetEventCount() - events;
+    results.counters = g_counters;
+    Simulator::Destroy();
+    results.peakRssKb = GetPeakRssKb();
+
+    return results;
+}
+
+/**
+ * Parse a comma-separated list of values.
+ *
+ * \tparam T \deduced the type of the values
+ * \param str the comma-separated list of values
+ * \param values the parsed values
+ */
+template <class T>
+static void
+ParseList(const std::string& str, std::vector<T>& values)
+{
+    values.clear();
+    std::istringstream iss(str);
+    std::string token;
+    while (std::getline(iss, token, ','))
+    {
+        std::istringstream tokenIss(token);
+        T value;
+        tokenIss >> value;
+        NS_ABORT_MSG_IF(tokenIss.fail(), "Cannot parse '" << token << "' in '" << str << "'");
+        values.push_back(value);
+    }
+    NS_ABORT_MSG_IF(values.empty(), "No value in '" << str << "'");
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string nStationsStr = "1,8,32";
+    std::string nBssStr = "1,2";
+    std::string channelWidthStr = "20,80";
+    std::string maxAmpduSizeStr = "65535";
+    std::string phyStr = "yans,spectrum";
+    std::string directionStr = "ul";
+    std::string ofdmaStr = "0";
+    double yansGridCellSize = 0;
+    double interferenceFloor = -1e9;
+    double spectrumGridCellSize = 0;
+    std::string abstraction = "None";
+    std::string muScheduler = "ns3::RrMultiUserScheduler";
+    uint32_t mcs = 7;
+    uint32_t payloadSize = 1000;
+    double offeredLoad = 100;
+    double warmup = 1;
+    double simulationTime = 1;
+    std::string outputFile;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the simulation of Wi-Fi networks of increasing size");
+    cmd.AddValue("nStations", "Comma-separated numbers of stations per BSS", nStationsStr);
+    cmd.AddValue("nBss", "Comma-separated numbers of overlapping BSSs", nBssStr);
+    cmd.AddValue("channelWidth", "Comma-separated channel widths (MHz)", channelWidthStr);
+    cmd.AddValue("maxAmpduSize",
+                 "Comma-separated maximum A-MPDU sizes (bytes, 0 to disable A-MPDU)",
+                 maxAmpduSizeStr);
+    cmd.AddValue("phy", "Comma-separated PHY models (yans, spectrum)", phyStr);
+    cmd.AddValue("direction", "Comma-separated directions of the flows (ul, dl)", directionStr);
+    cmd.AddValue("ofdma",
+                 "Comma-separated flags (0, 1) enabling the round robin multi-user scheduler",
+                 ofdmaStr);
+    cmd.AddValue("yansGridCellSize",
+                 "The size of the cells of the receiver grid of the YansWifiChannel (m, 0 to "
+                 "disable the grid)",
+                 yansGridCellSize);
+    cmd.AddValue("interferenceFloor",
+                 "The received power below which the spectrum channel does not propagate "
+                 "signals (dBm)",
+                 interferenceFloor);
+    cmd.AddValue("spectrumGridCellSize",
+                 "The size of the cells of the receiver grid of the spectrum channel (m, 0 to "
+                 "disable the grid)",
+                 spectrumGridCellSize);
+    cmd.AddValue("abstraction", "The PHY abstraction (None, Eesm, Miesm)", abstraction);
+    cmd.AddValue("muScheduler",
+                 "The type of the multi-user scheduler of the APs in the OFDMA scenarios",
+                 muScheduler);
+    cmd.AddValue("mcs", "The HE MCS used by all the devices", mcs);
+    cmd.AddValue("payloadSize", "The size of the packets (bytes)", payloadSize);
+    cmd.AddValue("offeredLoad", "The offered load per BSS (Mbps)", offeredLoad);
+    cmd.AddValue("warmup", "The duration of the warmup period (s)", warmup);
+    cmd.AddValue("simulationTime", "The duration of the measured period (s)", simulationTime);
+    cmd.AddValue("output", "The output file (standard output if empty)", outputFile);
+    cmd.Parse(argc, argv);
+
+    std::vector<uint32_t> nStationsList;
+    std::vector<uint32_t> nBssList;
+    std::vector<uint16_t> channelWidthList;
+    std::vector<uint32_t> maxAmpduSizeList;
+    std::vector<std::string> phyList;
+    std::vector<std::string> directionList;
+    std::vector<bool> ofdmaList;
+    ParseList(nStationsStr, nStationsList);
+    ParseList(nBssStr, nBssList);
+    ParseList(channelWidthStr, channelWidthList);
+    ParseList(maxAmpduSizeStr, maxAmpduSizeList);
+    ParseList(phyStr, phyList);
+    ParseList(directionStr, directionList);
+    ParseList(ofdmaStr, ofdmaList);
+    NS_ABORT_MSG_IF(mcs > 11, "Invalid HE MCS: " << mcs);
+    NS_ABORT_MSG_IF(offeredLoad <= 0, "The offered load must be positive");
+    NS_ABORT_MSG_IF(simulationTime <= 0, "The duration of the measured period must be positive");
+
+    std::ofstream ofs;
+    if (!outputFile.empty())
+    {
+        ofs.open(outputFile);
+        NS_ABORT_MSG_IF(!ofs.is_open(), "Cannot open " << outputFile);
+    }
+    std::ostream& os = (outputFile.empty() ? std::cout : ofs);
+
+    os << "scenario,phy,nBss,nStations,channelWidth,maxAmpduSize,direction,ofdma,setupMs,runMs,"
+          "events,eventsPerSecond,wallMsPerSimSecond,cpuUserMs,cpuSystemMs,peakRssKb,phyTx,"
+          "phyRxBegin,phyRxEnd,phyRxDrop,macTx,macRx,appRxBytes,throughputMbps"
+       << std::endl;
+
+    std::vector<Scenario> scenarios;
+    for (const auto& phy : phyList)
+    {
+        for (auto nBss : nBssList)
+        {
+            for (auto nStations : nStationsList)
+            {
+                for (auto channelWidth : channelWidthList)
+                {
+                    for (auto maxAmpduSize : maxAmpduSizeList)
+                    {
+                        for (const auto& direction : directionList)
+                        {
+                            for (auto ofdma : ofdmaList)
+                            {
+                                if (ofdma && phy != "spectrum")
+                                {
+                                    // OFDMA is only supported by the spectrum PHY model
+                                    continue;
+                                }
+                                scenarios.push_back({phy,
+                                                     nBss,
+                                                     nStations,
+                                                     channelWidth,
+                                                     maxAmpduSize,
+                                                     direction,
+                                                     ofdma,
+                                                     static_cast<uint8_t>(mcs),
+                                                     payloadSize,
+                                                     offeredLoad,
+                                                     Seconds(warmup),
+                                                     Seconds(simulationTime),
+                                                     yansGridCellSize,
+                                                     interferenceFloor,
+                                                     spectrumGridCellSize,
+                                                     abstraction,
+                                                     muScheduler});
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (const auto& scenario : scenarios)
+    {
+        Results results = RunScenario(scenario);
+
+        double runSeconds = std::max<int64_t>(results.runMs, 1) / 1000.0;
+        os << GetScenarioId(scenario) << "," << scenario.phy << "," << scenario.nBss << ","
+           << scenario.nStations << "," << scenario.channelWidth << "," << scenario.maxAmpduSize
+           << "," << scenario.direction << "," << scenario.ofdma << "," << results.setupMs << ","
+           << results.runMs << "," << results.events << "," << results.events / runSeconds << ","
+           << results.runMs / simulationTime << "," << results.cpuUserMs << ","
+           << results.cpuSystemMs << "," << results.peakRssKb << "," << results.counters.phyTx
+           << "," << results.counters.phyRxBegin << "," << results.counters.phyRxEnd << ","
+           << results.counters.phyRxDrop << "," << results.counters.macTx << ","
+           << results.counters.macRx << "," << results.counters.appRxBytes << ","
+           << results.counters.appRxBytes * 8 / simulationTime / 1e6 << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,236 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "effective-snr-mapping.h"
+
+#include "wifi-utils.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("EffectiveSnrMapping");
+
+/// Smallest SNR (in dB) of the mutual information tables
+static const double MUTUAL_INFORMATION_MIN_SNR = -20;
+/// Largest SNR (in dB) of the mutual information tables
+static const double MUTUAL_INFORMATION_MAX_SNR = 60;
+/// Step (in dB) between two SNRs of the mutual information tables
+static const double MUTUAL_INFORMATION_SNR_STEP = 0.25;
+
+double
+EffectiveSnrMapping::Eesm(const Chunks& chunks, uint16_t constellationSize)
+{
+    auto [minSnr, maxSnr] = GetSnrRange(chunks);
+    if (minSnr == maxSnr)
+    {
+        return minSnr;
+    }
+    double beta = GetEesmBeta(constellationSize);
+    double sum = 0;
+    double duration = 0;
+    for (const auto& [snr, chunkDuration] : chunks)
+    {
+        // factor exp(-minSnr / beta) out of the sum, so that it does not underflow
+        sum += chunkDuration.GetSeconds() * std::exp(-(snr - minSnr) / beta);
+        duration += chunkDuration.GetSeconds();
+    }
+    if (duration == 0)
+    {
+        return minSnr;
+    }
+    return std::clamp(minSnr - beta * std::log(sum / duration), minSnr, maxSnr);
+}
+
+double
+EffectiveSnrMapping::Miesm(const Chunks& chunks, uint16_t constellationSize)
+{
+    auto [minSnr, maxSnr] = GetSnrRange(chunks);
+    if (minSnr == maxSnr)
+    {
+        return minSnr;
+    }
+    double sum = 0;
+    double duration = 0;
+    for (const auto& [snr, chunkDuration] : chunks)
+    {
+        sum += chunkDuration.GetSeconds() * GetMutualInformation(snr, constellationSize);
+        duration += chunkDuration.GetSeconds();
+    }
+    if (duration == 0)
+    {
+        return minSnr;
+    }
+    double mutualInformation = sum / duration;
+
+    // invert the tabulated mutual information
+    const auto& table = GetMutualInformationTable(constellationSize);
+    auto it = std::lower_bound(table.begin(), table.end(), mutualInformation);
+    double position = 0;
+    if (it == table.end())
+    {
+        position = table.size() - 1;
+    }
+    else if (it != table.begin())
+    {
+        double previous = *std::prev(it);
+        double fraction = (*it > previous) ? (mutualInformation - previous) / (*it - previous) : 0;
+        position = std::distance(table.begin(), it) - 1 + fraction;
+    }
+    double snr = DbToRatio(MUTUAL_INFORMATION_MIN_SNR + position * MUTUAL_INFORMATION_SNR_STEP);
+    return std::clamp(snr, minSnr, maxSnr);
+}
+
+double
+EffectiveSnrMapping::GetEesmBeta(uint16_t constellationSize)
+{
+    NS_ASSERT(constellationSize >= 2);
+    if (constellationSize == 2)
+    {
+        return 1;
+    }
+    return 2.0 * (constellationSize - 1) / 3;
+}
+
+double
+EffectiveSnrMapping::GetMutualInformation(double snr, uint16_t constellationSize)
+{
+    const auto& table = GetMutualInformationTable(constellationSize);
+    double position =
+        (RatioToDb(snr) - MUTUAL_INFORMATION_MIN_SNR) / MUTUAL_INFORMATION_SNR_STEP;
+    if (!(position > 0))
+    {
+        return table.front();
+    }
+    if (position >= table.size() - 1)
+    {
+        return table.back();
+    }
+    auto i = static_cast<std::size_t>(position);
+    double fraction = position - i;
+    return (1 - fraction) * table[i] + fraction * table[i + 1];
+}
+
+std::pair<double, double>
+EffectiveSnrMapping::GetSnrRange(const Chunks& chunks)
+{
+    NS_ASSERT(!chunks.empty());
+    auto [min, max] = std::minmax_element(chunks.begin(), chunks.end());
+    return {min->first, max->first};
+}
+
+const std::vector<double>&
+EffectiveSnrMapping::GetMutualInformationTable(uint16_t constellationSize)
+{
+    static std::map<uint16_t, std::vector<double>> tables;
+    auto it = tables.find(constellationSize);
+    if (it != tables.end())
+    {
+        return it->second;
+    }
+
+    // A square QAM constellation is made of two PAM constellations, each of
+    // which carries half of the energy and sees half of the noise. BPSK is a
+    // PAM constellation which carries all the energy.
+    uint16_t nPamPoints = 2;
+    double snrFactor = 2;
+    if (constellationSize > 2)
+    {
+        nPamPoints = static_cast<uint16_t>(std::lround(std::sqrt(constellationSize)));
+        NS_ASSERT_MSG(nPamPoints * nPamPoints == constellationSize,
+                      "Constellation of " << constellationSize << " points is not a square QAM");
+        snrFactor = 1;
+    }
+    auto nSnrs = static_cast<std::size_t>(
+        std::lround((MUTUAL_INFORMATION_MAX_SNR - MUTUAL_INFORMATION_MIN_SNR) /
+                    MUTUAL_INFORMATION_SNR_STEP));
+    std::vector<double> table;
+    table.reserve(nSnrs + 1);
+    for (std::size_t i = 0; i <= nSnrs; i++)
+    {
+        double snr = DbToRatio(MUTUAL_INFORMATION_MIN_SNR + i * MUTUAL_INFORMATION_SNR_STEP);
+        table.push_back(ComputePamMutualInformation(nPamPoints, snrFactor * snr));
+    }
+    NS_LOG_DEBUG("Mutual information of " << constellationSize << " points tabulated");
+    return tables.emplace(constellationSize, std::move(table)).first->second;
+}
+
+double
+EffectiveSnrMapping::ComputePamMutualInformation(uint16_t nPoints, double snr)
+{
+    uint8_t nBits = 0;
+    while ((1 << nBits) < nPoints)
+    {
+        nBits++;
+    }
+    NS_ASSERT_MSG((1 << nBits) == nPoints, "PAM constellation of " << nPoints << " points");
+
+    // points of unit noise variance, with Gray labels
+    double distance = std::sqrt(3 * snr / (nPoints * nPoints - 1));
+    std::vector<double> points(nPoints);
+    std::vector<uint16_t> labels(nPoints);
+    for (uint16_t k = 0; k < nPoints; k++)
+    {
+        points[k] = distance * (2 * k - nPoints + 1);
+        labels[k] = k ^ (k >> 1);
+    }
+
+    // The expectation over the noise is computed with the trapezoidal rule
+    // over [-7, 7] standard deviations, which is accurate for the smooth
+    // integrands involved. By symmetry, only half of the points are sent.
+    double loss = 0; // expected value of the sum of log2 (p(y) / p(y | bit)) over the bits
+    double weightSum = 0;
+    std::vector<double> likelihoods(nPoints);
+    for (int q = -28; q <= 28; q++)
+    {
+        double noise = q * 0.25;
+        double weight = std::exp(-noise * noise / 2);
+        weightSum += weight;
+        for (uint16_t j = 0; j < nPoints / 2; j++)
+        {
+            double y = points[j] + noise;
+            double total = 0;
+            for (uint16_t k = 0; k < nPoints; k++)
+            {
+                // likelihoods relative to the one of the point sent
+                double dy = y - points[k];
+                likelihoods[k] = std::exp(-(dy * dy - noise * noise) / 2);
+                total += likelihoods[k];
+            }
+            for (uint8_t b = 0; b < nBits; b++)
+            {
+                double same = 0;
+                for (uint16_t k = 0; k < nPoints; k++)
+                {
+                    if (((labels[k] ^ labels[j]) & (1 << b)) == 0)
+                    {
+                        same += likelihoods[k];
+                    }
+                }
+                loss += weight * std::log2(total / same);
+            }
+        }
+    }
+    loss /= weightSum * (nPoints / 2);
+    return std::clamp(1 - loss / nBits, 0.0, 1.0);
+}
+
+} // namespace ns3
@@ -0,0 +1,108 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EFFECTIVE_SNR_MAPPING_H
+#define EFFECTIVE_SNR_MAPPING_H
+
+#include "ns3/nstime.h"
+
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup wifi
+ * \brief Effective SNR mappings
+ *
+ * An effective SNR mapping compresses the SNRs of the chunks of a signal into
+ * a single SNR, which yields the same error rate in an AWGN channel as the
+ * chunks. Each chunk is weighted by its duration.
+ *
+ * The Exponential Effective SNR Mapping (EESM) averages exp(-snr / beta). The
+ * calibration factor beta of a constellation of M points is derived from the
+ * Chernoff bound of its symbol error probability, exp(-3 snr / (2 (M - 1))),
+ * i.e., beta is 1 for BPSK and 2 (M - 1) / 3 for M-QAM.
+ *
+ * The Mutual Information Effective SNR Mapping (MIESM) averages the
+ * mutual information per coded bit of the constellation, computed for a
+ * Gray-mapped constellation with bit-interleaved coded modulation and
+ * tabulated once per constellation.
+ */
+class EffectiveSnrMapping
+{
+  public:
+    /// SNR (linear scale) and duration of each chunk
+    typedef std::vector<std::pair<double, Time>> Chunks;
+
+    /**
+     * \param chunks the SNRs and durations of the chunks
+     * \param constellationSize the number of points of the constellation
+     * \return the EESM effective SNR (linear scale)
+     */
+    static double Eesm(const Chunks& chunks, uint16_t constellationSize);
+
+    /**
+     * \param chunks the SNRs and durations of the chunks
+     * \param constellationSize the number of points of the constellation
+     * \return the MIESM effective SNR (linear scale)
+     */
+    static double Miesm(const Chunks& chunks, uint16_t constellationSize);
+
+    /**
+     * \param constellationSize the number of points of the constellation
+     * \return the EESM calibration factor of the constellation
+     */
+    static double GetEesmBeta(uint16_t constellationSize);
+
+    /**
+     * \param snr the SNR (linear scale)
+     * \param constellationSize the number of points of the constellation
+     * \return the mutual information per coded bit, between 0 and 1
+     */
+    static double GetMutualInformation(double snr, uint16_t constellationSize);
+
+  private:
+    /**
+     * Get the smallest and the largest SNR of the chunks, which bound any
+     * effective SNR.
+     *
+     * \param chunks the SNRs and durations of the chunks
+     * \return the smallest and the largest SNR
+     */
+    static std::pair<double, double> GetSnrRange(const Chunks& chunks);
+
+    /**
+     * \param constellationSize the number of points of the constellation
+     * \return the mutual information per coded bit at each SNR of the grid
+     */
+    static const std::vector<double>& GetMutualInformationTable(uint16_t constellationSize);
+
+    /**
+     * Compute the mutual information per coded bit of a Gray-mapped PAM
+     * constellation in a real AWGN channel.
+     *
+     * \param nPoints the number of points of the constellation
+     * \param snr the ratio of the average energy of the points to the noise
+     *        variance (linear scale)
+     * \return the mutual information per coded bit, between 0 and 1
+     */
+    static double ComputePamMutualInformation(uint16_t nPoints, double snr);
+};
+
+} // namespace ns3
+
+#endif /* EFFECTIVE_SNR_MAPPING_H */
@@ -0,0 +1,133 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "error-rate-lookup-table.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ErrorRateLookupTable");
+
+/// Smallest step between two samples (in dB)
+static const double ERROR_RATE_LOOKUP_TABLE_MIN_STEP = 1.0 / 1024;
+
+ErrorRateLookupTable::ErrorRateLookupTable(const ErrorFunction& error,
+                                           double minSnr,
+                                           double maxSnr,
+                                           double maxRelativeError,
+                                           double maxAbsoluteError)
+    : m_minSnr(minSnr),
+      m_step(1)
+{
+    NS_LOG_FUNCTION(this << minSnr << maxSnr << maxRelativeError << maxAbsoluteError);
+    NS_ASSERT(minSnr < maxSnr);
+
+    auto logError = [&error](double snr) {
+        double pe = error(snr);
+        NS_ASSERT_MSG(pe >= 0, "Negative error probability at SNR " << snr << " dB");
+        return std::log(pe);
+    };
+
+    std::size_t nIntervals = static_cast<std::size_t>(std::ceil((maxSnr - minSnr) / m_step));
+    for (std::size_t i = 0; i <= nIntervals; i++)
+    {
+        m_logPe.push_back(logError(minSnr + i * m_step));
+    }
+
+    while (true)
+    {
+        // the values in the middle of the intervals, which become the new
+        // samples if the step is halved
+        std::vector<double> middles(nIntervals);
+        bool accurate = true;
+        for (std::size_t i = 0; i < nIntervals; i++)
+        {
+            middles[i] = logError(minSnr + (i + 0.5) * m_step);
+            double exact = std::exp(middles[i]);
+            double interpolated = Interpolate(m_logPe[i], m_logPe[i + 1], 0.5);
+            if (std::abs(interpolated - exact) >
+                std::max(maxRelativeError * exact, maxAbsoluteError))
+            {
+                accurate = false;
+            }
+        }
+        if (accurate)
+        {
+            break;
+        }
+        if (m_step <= ERROR_RATE_LOOKUP_TABLE_MIN_STEP)
+        {
+            NS_LOG_WARN("Maximum error not reached with a step of " << m_step << " dB");
+            break;
+        }
+        std::vector<double> samples;
+        samples.reserve(2 * nIntervals + 1);
+        for (std::size_t i = 0; i < nIntervals; i++)
+        {
+            samples.push_back(m_logPe[i]);
+            samples.push_back(middles[i]);
+        }
+        samples.push_back(m_logPe.back());
+        m_logPe.swap(samples);
+        nIntervals *= 2;
+        m_step /= 2;
+    }
+    NS_LOG_DEBUG("Step " << m_step << " dB, " << m_logPe.size() << " samples");
+}
+
+std::optional<double>
+ErrorRateLookupTable::Lookup(double snr) const
+{
+    double position = (snr - m_minSnr) / m_step;
+    if (!(position >= 0) || position >= m_logPe.size() - 1)
+    {
+        return std::nullopt;
+    }
+    auto i = static_cast<std::size_t>(position);
+    return Interpolate(m_logPe[i], m_logPe[i + 1], position - i);
+}
+
+double
+ErrorRateLookupTable::GetStep() const
+{
+    return m_step;
+}
+
+std::size_t
+ErrorRateLookupTable::GetSize() const
+{
+    return m_logPe.size();
+}
+
+double
+ErrorRateLookupTable::Interpolate(double first, double second, double fraction)
+{
+    if (first == -std::numeric_limits<double>::infinity() ||
+        second == -std::numeric_limits<double>::infinity())
+    {
+        // null error probability at one end, interpolate linearly
+        return (1 - fraction) * std::exp(first) + fraction * std::exp(second);
+    }
+    return std::exp(first + fraction * (second - first));
+}
+
+} // namespace ns3
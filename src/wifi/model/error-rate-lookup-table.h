@@ -0,0 +1,96 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef ERROR_RATE_LOOKUP_TABLE_H
+#define ERROR_RATE_LOOKUP_TABLE_H
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup wifi
+ * \brief Tabulated error probability as a function of the SNR (in dB)
+ *
+ * The logarithm of the error probability is sampled at evenly spaced SNRs and
+ * linearly interpolated between the samples.  The sampling step starts at
+ * 1 dB and is halved until the interpolated value at the middle of every
+ * interval is within the requested relative error of the exact value, or
+ * within the requested absolute error (which accounts for the values close
+ * to zero, whose logarithm is not bounded).  The step is not refined below
+ * 1/1024 dB.
+ *
+ * The interpolation assumes a smooth function: an error probability bounded
+ * by 1 should be tabulated before being bounded.
+ */
+class ErrorRateLookupTable
+{
+  public:
+    /// Error probability as a function of the SNR (in dB)
+    typedef std::function<double(double)> ErrorFunction;
+
+    /**
+     * Create the table of the given function.
+     *
+     * \param error the error probability, as a function of the SNR (in dB)
+     * \param minSnr the smallest SNR (in dB) of the table
+     * \param maxSnr the largest SNR (in dB) of the table
+     * \param maxRelativeError the maximum relative error of the interpolation
+     * \param maxAbsoluteError the maximum absolute error of the interpolation (the
+     *        default value is negligible with respect to 1)
+     */
+    ErrorRateLookupTable(const ErrorFunction& error,
+                         double minSnr,
+                         double maxSnr,
+                         double maxRelativeError,
+                         double maxAbsoluteError = 1e-20);
+
+    /**
+     * \param snr the SNR (in dB)
+     * \return the interpolated error probability, or nothing if the SNR is
+     *         outside the table
+     */
+    std::optional<double> Lookup(double snr) const;
+
+    /**
+     * \return the step between two samples (in dB)
+     */
+    double GetStep() const;
+
+    /**
+     * \return the number of samples
+     */
+    std::size_t GetSize() const;
+
+  private:
+    /**
+     * \param first the logarithm of the error probability at the start of an interval
+     * \param second the logarithm of the error probability at the end of the interval
+     * \param fraction the position in the interval, between 0 and 1
+     * \return the interpolated error probability
+     */
+    static double Interpolate(double first, double second, double fraction);
+
+    double m_minSnr;             //!< SNR of the first sample (in dB)
+    double m_step;               //!< Step between two samples (in dB)
+    std::vector<double> m_logPe; //!< Logarithm of the error probability at each sample
+};
+
+} // namespace ns3
+
+#endif /* ERROR_RATE_LOOKUP_TABLE_H */
@@ -21,6 +21,8 @@
 
 #include "wifi-tx-vector.h"
 
+#include "ns3/boolean.h"
+#include "ns3/double.h"
 #include "ns3/dsss-error-rate-model.h"
 
 namespace ns3
@@ -31,10 +33,37 @@ NS_OBJECT_ENSURE_REGISTERED(ErrorRateModel);
 TypeId
 ErrorRateModel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::ErrorRateModel").SetParent<Object>().SetGroupName("Wifi");
+    static TypeId tid =
+        TypeId("ns3::ErrorRateModel")
+            .SetParent<Object>()
+            .SetGroupName("Wifi")
+            .AddAttribute("LookupTables",
+                          "If true, the models evaluating closed-form error probabilities "
+                          "(e.g., NistErrorRateModel and YansErrorRateModel) interpolate them "
+                          "in tables computed once per modulation and coding rate",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&ErrorRateModel::m_lookupTables),
+                          MakeBooleanChecker())
+            .AddAttribute("LookupTableMaxError",
+                          "The maximum relative error of the interpolated error probabilities",
+                          DoubleValue(1e-3),
+                          MakeDoubleAccessor(&ErrorRateModel::m_lookupTableMaxError),
+                          MakeDoubleChecker<double>(0));
     return tid;
 }
 
+bool
+ErrorRateModel::IsLookupTableEnabled() const
+{
+    return m_lookupTables;
+}
+
+double
+ErrorRateModel::GetLookupTableMaxError() const
+{
+    return m_lookupTableMaxError;
+}
+
 double
 ErrorRateModel::CalculateSnr(const WifiTxVector& txVector, double ber) const
 {
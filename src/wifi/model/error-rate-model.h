@@ -102,6 +102,18 @@ class ErrorRateModel : public Object
      */
     virtual int64_t AssignStreams(int64_t stream);
 
+  protected:
+    /**
+     * \return true if the subclass should use tabulated error probabilities
+     *         (see ErrorRateLookupTable) instead of evaluating them
+     */
+    bool IsLookupTableEnabled() const;
+
+    /**
+     * \return the maximum relative error of the tabulated error probabilities
+     */
+    double GetLookupTableMaxError() const;
+
   private:
     /**
      * A pure virtual method that must be implemented in the subclass.
@@ -123,6 +135,9 @@ class ErrorRateModel : public Object
                                          uint8_t numRxAntennas,
                                          WifiPpduField field,
                                          uint16_t staId) const = 0;
+
+    bool m_lookupTables;          //!< Whether to use tabulated error probabilities
+    double m_lookupTableMaxError; //!< Maximum relative error of the tabulated error probabilities
 };
 
 } // namespace ns3
@@ -488,39 +488,56 @@ HeRu::GetNRus(uint16_t bw, RuType ruType)
     return (bw == 160 ? 2 : 1) * it->second.size();
 }
 
-std::vector<HeRu::RuSpec>
+const std::vector<HeRu::RuSpec>&
 HeRu::GetRusOfType(uint16_t bw, HeRu::RuType ruType)
 {
+    static std::map<std::pair<uint16_t, RuType>, std::vector<RuSpec>> rusOfType;
+    auto it = rusOfType.find({bw, ruType});
+    if (it != rusOfType.end())
+    {
+        return it->second;
+    }
+
+    std::vector<HeRu::RuSpec> ret;
+
     if (ruType == HeRu::RU_2x996_TONE)
     {
         NS_ASSERT(bw >= 160);
-        return {{ruType, 1, true}};
+        ret.emplace_back(ruType, 1, true);
+        return rusOfType.emplace(std::make_pair(bw, ruType), std::move(ret)).first->second;
     }
 
-    std::vector<HeRu::RuSpec> ret;
     std::vector<bool> primary80MHzSet{true};
+    uint16_t width = bw;
 
-    if (bw == 160)
+    if (width == 160)
     {
         primary80MHzSet.push_back(false);
-        bw = 80;
+        width = 80;
     }
 
     for (auto primary80MHz : primary80MHzSet)
     {
         for (std::size_t ruIndex = 1;
-             ruIndex <= HeRu::m_heRuSubcarrierGroups.at({bw, ruType}).size();
+             ruIndex <= HeRu::m_heRuSubcarrierGroups.at({width, ruType}).size();
              ruIndex++)
         {
             ret.emplace_back(ruType, ruIndex, primary80MHz);
         }
     }
-    return ret;
+    return rusOfType.emplace(std::make_pair(bw, ruType), std::move(ret)).first->second;
 }
 
-std::vector<HeRu::RuSpec>
+const std::vector<HeRu::RuSpec>&
 HeRu::GetCentral26TonesRus(uint16_t bw, HeRu::RuType ruType)
 {
+    static std::map<std::pair<uint16_t, RuType>, std::vector<RuSpec>> central26TonesRus;
+    auto it = central26TonesRus.find({bw, ruType});
+    if (it != central26TonesRus.end())
+    {
+        return it->second;
+    }
+
     std::vector<std::size_t> indices;
 
     if (ruType == HeRu::RU_52_TONE || ruType == HeRu::RU_106_TONE)
@@ -561,7 +578,7 @@ HeRu::GetCentral26TonesRus(uint16_t bw, HeRu::RuType ruType)
             ret.emplace_back(HeRu::RU_26_TONE, index, primary80MHz);
         }
     }
-    return ret;
+    return central26TonesRus.emplace(std::make_pair(bw, ruType), std::move(ret)).first->second;
 }
 
 HeRu::SubcarrierGroup
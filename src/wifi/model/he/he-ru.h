@@ -141,21 +141,26 @@ class HeRu
      * Get the set of distinct RUs of the given type (number of tones)
      * available in a HE PPDU of the given bandwidth.
      *
+     * The set is computed once per (bandwidth, RU type) pair and then cached.
+     *
      * \param bw the bandwidth (MHz) of the HE PPDU (20, 40, 80, 160)
      * \param ruType the RU type (number of tones)
      * \return the set of distinct RUs available
      */
-    static std::vector<HeRu::RuSpec> GetRusOfType(uint16_t bw, HeRu::RuType ruType);
+    static const std::vector<HeRu::RuSpec>& GetRusOfType(uint16_t bw, HeRu::RuType ruType);
 
     /**
      * Get the set of 26-tone RUs that can be additionally allocated if the given
      * bandwidth is split in RUs of the given type.
      *
+     * The set is computed once per (bandwidth, RU type) pair and then cached.
+     *
      * \param bw the bandwidth (MHz) of the HE PPDU (20, 40, 80, 160)
      * \param ruType the RU type (number of tones)
      * \return the set of 26-tone RUs that can be additionally allocated
      */
-    static std::vector<HeRu::RuSpec> GetCentral26TonesRus(uint16_t bw, HeRu::RuType ruType);
+    static const std::vector<HeRu::RuSpec>& GetCentral26TonesRus(uint16_t bw,
+                                                                 HeRu::RuType ruType);
 
     /**
      * Get the subcarrier group of the RU having the given PHY index among all the
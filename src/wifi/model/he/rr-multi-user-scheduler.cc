@@ -131,7 +131,7 @@ RrMultiUserScheduler::DoDispose()
 {
     NS_LOG_FUNCTION(this);
     m_staListDl.clear();
-    m_staListUl.clear();
+    m_staListUl = StaList();
     m_candidates.clear();
     m_txParams.Clear();
     m_apMac->TraceDisconnectWithoutContext(
@@ -185,7 +185,7 @@ RrMultiUserScheduler::GetTxVectorForUlMu(Func canbeSolicited)
     NS_LOG_FUNCTION(this);
 
     // determine RUs to allocate to stations
-    auto count = std::min<std::size_t>(m_nStations, m_staListUl.size());
+    auto count = std::min<std::size_t>(m_nStations, m_staListUl.stas.size());
     std::size_t nCentral26TonesRus;
     HeRu::GetEqualSizedRusForStations(m_allowedWidth, count, nCentral26TonesRus);
     NS_ASSERT(count >= 1);
@@ -205,16 +205,17 @@ RrMultiUserScheduler::GetTxVectorForUlMu(Func canbeSolicited)
     txVector.SetBssColor(heConfiguration->GetBssColor());
 
     // iterate over the associated stations until an enough number of stations is identified
-    auto staIt = m_staListUl.begin();
+    auto staIt = m_staListUl.stas.begin();
     m_candidates.clear();
 
-    while (staIt != m_staListUl.end() &&
+    while (staIt != m_staListUl.stas.end() &&
            txVector.GetHeMuUserInfoMap().size() <
                std::min<std::size_t>(m_nStations, count + nCentral26TonesRus))
     {
-        NS_LOG_DEBUG("Next candidate STA (MAC=" << staIt->address << ", AID=" << staIt->aid << ")");
+        NS_LOG_DEBUG("Next candidate STA (MAC=" << staIt->second.address
+                                                << ", AID=" << staIt->second.aid << ")");
 
-        if (!canbeSolicited(*staIt))
+        if (!canbeSolicited(staIt->second))
         {
             NS_LOG_DEBUG("Skipping station based on provided function object");
             staIt++;
@@ -226,7 +227,7 @@ RrMultiUserScheduler::GetTxVectorForUlMu(Func canbeSolicited)
         {
             // check that a BA agreement is established with the receiver for the
             // considered TID, since ack sequences for UL MU require block ack
-            if (m_heFem->GetBaAgreementEstablished(staIt->address, tid))
+            if (m_heFem->GetBaAgreementEstablished(staIt->second.address, tid))
             {
                 break;
             }
@@ -234,7 +235,7 @@ RrMultiUserScheduler::GetTxVectorForUlMu(Func canbeSolicited)
         }
         if (tid == 8)
         {
-            NS_LOG_DEBUG("No Block Ack agreement established with " << staIt->address);
+            NS_LOG_DEBUG("No Block Ack agreement established with " << staIt->second.address);
             staIt++;
             continue;
         }
@@ -242,11 +243,11 @@ RrMultiUserScheduler::GetTxVectorForUlMu(Func canbeSolicited)
         // prepare the MAC header of a frame that would be sent to the candidate station,
         // just for the purpose of retrieving the TXVECTOR used to transmit to that station
         WifiMacHeader hdr(WIFI_MAC_QOSDATA);
-        hdr.SetAddr1(staIt->address);
+        hdr.SetAddr1(staIt->second.address);
         hdr.SetAddr2(m_apMac->GetAddress());
         WifiTxVector suTxVector =
             GetWifiRemoteStationManager()->GetDataTxVector(hdr, m_allowedWidth);
-        txVector.SetHeMuUserInfo(staIt->aid,
+        txVector.SetHeMuUserInfo(staIt->second.aid,
                                  {HeRu::RuSpec(), // assigned later by FinalizeTxVector
                                   suTxVector.GetMode(),
                                   suTxVector.GetNss()});
@@ -271,7 +272,7 @@ RrMultiUserScheduler::TrySendingBsrpTf()
 {
     NS_LOG_FUNCTION(this);
 
-    if (m_staListUl.empty())
+    if (m_staListUl.stas.empty())
     {
         NS_LOG_DEBUG("No HE stations associated: return SU_TX");
         return TxFormat::SU_TX;
@@ -350,7 +351,7 @@ RrMultiUserScheduler::TrySendingBasicTf()
 {
     NS_LOG_FUNCTION(this);
 
-    if (m_staListUl.empty())
+    if (m_staListUl.stas.empty())
     {
         NS_LOG_DEBUG("No HE stations associated: return SU_TX");
         return TxFormat::SU_TX;
@@ -508,11 +509,12 @@ RrMultiUserScheduler::NotifyStationAssociated(uint16_t aid, Mac48Address address
 
     if (GetWifiRemoteStationManager()->GetHeSupported(address))
     {
+        // new stations start with no credits
         for (auto& staList : m_staListDl)
         {
-            staList.second.push_back(MasterInfo{aid, address, 0.0});
+            staList.second.stas.emplace(-staList.second.offset, MasterInfo{aid, address});
         }
-        m_staListUl.push_back(MasterInfo{aid, address, 0.0});
+        m_staListUl.stas.emplace(-m_staListUl.offset, MasterInfo{aid, address});
     }
 }
 
@@ -523,15 +525,24 @@ RrMultiUserScheduler::NotifyStationDeassociated(uint16_t aid, Mac48Address addre
 
     if (GetWifiRemoteStationManager()->GetHeSupported(address))
     {
+        auto removeSta = [&aid, &address](StaList& staList) {
+            for (auto it = staList.stas.begin(); it != staList.stas.end();)
+            {
+                if (it->second.aid == aid && it->second.address == address)
+                {
+                    it = staList.stas.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        };
         for (auto& staList : m_staListDl)
         {
-            staList.second.remove_if([&aid, &address](const MasterInfo& info) {
-                return info.aid == aid && info.address == address;
-            });
+            removeSta(staList.second);
         }
-        m_staListUl.remove_if([&aid, &address](const MasterInfo& info) {
-            return info.aid == aid && info.address == address;
-        });
+        removeSta(m_staListUl);
     }
 }
 
@@ -542,14 +553,14 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
 
     AcIndex primaryAc = m_edca->GetAccessCategory();
 
-    if (m_staListDl[primaryAc].empty())
+    if (m_staListDl[primaryAc].stas.empty())
     {
         NS_LOG_DEBUG("No HE stations associated: return SU_TX");
         return TxFormat::SU_TX;
     }
 
     std::size_t count =
-        std::min(static_cast<std::size_t>(m_nStations), m_staListDl[primaryAc].size());
+        std::min(static_cast<std::size_t>(m_nStations), m_staListDl[primaryAc].stas.size());
     std::size_t nCentral26TonesRus;
     HeRu::RuType ruType =
         HeRu::GetEqualSizedRusForStations(m_allowedWidth, count, nCentral26TonesRus);
@@ -602,7 +613,7 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
     Time actualAvailableTime = (m_initialFrame ? Time::Min() : m_availableTime);
 
     // iterate over the associated stations until an enough number of stations is identified
-    auto staIt = m_staListDl[primaryAc].begin();
+    auto staIt = m_staListDl[primaryAc].stas.begin();
     m_candidates.clear();
 
     std::vector<uint8_t> ruAllocations;
@@ -610,11 +621,12 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
     ruAllocations.resize(numRuAllocs);
     NS_ASSERT((m_candidates.size() % numRuAllocs) == 0);
 
-    while (staIt != m_staListDl[primaryAc].end() &&
+    while (staIt != m_staListDl[primaryAc].stas.end() &&
            m_candidates.size() <
                std::min(static_cast<std::size_t>(m_nStations), count + nCentral26TonesRus))
     {
-        NS_LOG_DEBUG("Next candidate STA (MAC=" << staIt->address << ", AID=" << staIt->aid << ")");
+        NS_LOG_DEBUG("Next candidate STA (MAC=" << staIt->second.address
+                                                << ", AID=" << staIt->second.aid << ")");
 
         HeRu::RuType currRuType = (m_candidates.size() < count ? ruType : HeRu::RU_26_TONE);
 
@@ -625,10 +637,11 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
             NS_ASSERT(ac >= primaryAc);
             // check that a BA agreement is established with the receiver for the
             // considered TID, since ack sequences for DL MU PPDUs require block ack
-            if (m_apMac->GetQosTxop(ac)->GetBaAgreementEstablished(staIt->address, tid))
+            if (m_apMac->GetQosTxop(ac)->GetBaAgreementEstablished(staIt->second.address, tid))
             {
-                mpdu =
-                    m_apMac->GetQosTxop(ac)->PeekNextMpdu(SINGLE_LINK_OP_ID, tid, staIt->address);
+                mpdu = m_apMac->GetQosTxop(ac)->PeekNextMpdu(SINGLE_LINK_OP_ID,
+                                                             tid,
+                                                             staIt->second.address);
 
                 // we only check if the first frame of the current TID meets the size
                 // and duration constraints. We do not explore the queues further.
@@ -644,7 +657,7 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
                     WifiTxVector txVectorCopy = m_txParams.m_txVector;
 
                     m_txParams.m_txVector.SetHeMuUserInfo(
-                        staIt->aid,
+                        staIt->second.aid,
                         {{currRuType, 1, true}, suTxVector.GetMode(), suTxVector.GetNss()});
 
                     if (!m_heFem->TryAddMpdu(mpdu, m_txParams, actualAvailableTime))
@@ -655,8 +668,8 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
                     else
                     {
                         // the frame meets the constraints
-                        NS_LOG_DEBUG("Adding candidate STA (MAC=" << staIt->address
-                                                                  << ", AID=" << staIt->aid
+                        NS_LOG_DEBUG("Adding candidate STA (MAC=" << staIt->second.address
+                                                                  << ", AID=" << staIt->second.aid
                                                                   << ") TID=" << +tid);
                         m_candidates.emplace_back(staIt, mpdu);
                         break; // terminate the for loop
@@ -664,7 +677,8 @@ RrMultiUserScheduler::TrySendingDlMuPpdu()
                 }
                 else
                 {
-                    NS_LOG_DEBUG("No frames to send to " << staIt->address << " with TID=" << +tid);
+                    NS_LOG_DEBUG("No frames to send to " << staIt->second.address
+                                                         << " with TID=" << +tid);
                 }
             }
         }
@@ -718,15 +732,15 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
     std::swap(heMuUserInfoMap, txVector.GetHeMuUserInfoMap());
 
     auto candidateIt = m_candidates.begin(); // iterator over the list of candidate receivers
-    auto ruSet = HeRu::GetRusOfType(m_allowedWidth, ruType);
+    const auto& ruSet = HeRu::GetRusOfType(m_allowedWidth, ruType);
     auto ruSetIt = ruSet.begin();
-    auto central26TonesRus = HeRu::GetCentral26TonesRus(m_allowedWidth, ruType);
+    const auto& central26TonesRus = HeRu::GetCentral26TonesRus(m_allowedWidth, ruType);
     auto central26TonesRusIt = central26TonesRus.begin();
 
     for (std::size_t i = 0; i < nRusAssigned + nCentral26TonesRus; i++)
     {
         NS_ASSERT(candidateIt != m_candidates.end());
-        auto mapIt = heMuUserInfoMap.find(candidateIt->first->aid);
+        auto mapIt = heMuUserInfoMap.find(candidateIt->first->second.aid);
         NS_ASSERT(mapIt != heMuUserInfoMap.end());
 
         txVector.SetHeMuUserInfo(mapIt->first,
@@ -740,10 +754,15 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
     m_candidates.erase(candidateIt, m_candidates.end());
 }
 
+double
+RrMultiUserScheduler::GetCredits(const StaList& staList,
+                                 StaList::StaMap::const_iterator staIt) const
+{
+    return std::min(staIt->first + staList.offset, m_maxCredits.ToDouble(Time::US));
+}
+
 void
-RrMultiUserScheduler::UpdateCredits(std::list<MasterInfo>& staList,
-                                    Time txDuration,
-                                    const WifiTxVector& txVector)
+RrMultiUserScheduler::UpdateCredits(StaList& staList, Time txDuration, const WifiTxVector& txVector)
 {
     NS_LOG_FUNCTION(this << txDuration.As(Time::US) << txVector);
 
@@ -756,7 +775,7 @@ RrMultiUserScheduler::UpdateCredits(std::list<MasterInfo>& staList,
 
     // The amount of credits received by each station equals the TX duration (in
     // microseconds) divided by the number of stations.
-    double creditsPerSta = txDuration.ToDouble(Time::US) / staList.size();
+    double creditsPerSta = txDuration.ToDouble(Time::US) / staList.stas.size();
     // Transmitting stations have to pay a number of credits equal to the TX duration
     // (in microseconds) times the allocated bandwidth share.
     double debitsPerMhz =
@@ -765,24 +784,23 @@ RrMultiUserScheduler::UpdateCredits(std::list<MasterInfo>& staList,
             return sum + pair.second * HeRu::GetBandwidth(pair.first);
         });
 
-    // assign credits to all stations
-    for (auto& sta : staList)
-    {
-        sta.credits += creditsPerSta;
-        sta.credits = std::min(sta.credits, m_maxCredits.ToDouble(Time::US));
-    }
+    // assign credits to all stations (credits exceeding the maximum are discarded
+    // when the credits of a station are read)
+    staList.offset += creditsPerSta;
 
-    // subtract debits to the selected stations
+    // subtract debits to the selected stations and move them to their new position
+    // in the list, which keeps the list sorted in decreasing order of credits
     for (auto& candidate : m_candidates)
     {
-        auto mapIt = txVector.GetHeMuUserInfoMap().find(candidate.first->aid);
+        auto mapIt = txVector.GetHeMuUserInfoMap().find(candidate.first->second.aid);
         NS_ASSERT(mapIt != txVector.GetHeMuUserInfoMap().end());
 
-        candidate.first->credits -= debitsPerMhz * HeRu::GetBandwidth(mapIt->second.ru.GetRuType());
+        double credits = GetCredits(staList, candidate.first) -
+                         debitsPerMhz * HeRu::GetBandwidth(mapIt->second.ru.GetRuType());
+        MasterInfo info = candidate.first->second;
+        staList.stas.erase(candidate.first);
+        candidate.first = staList.stas.emplace(credits - staList.offset, info);
     }
-
-    // sort the list in decreasing order of credits
-    staList.sort([](const MasterInfo& a, const MasterInfo& b) { return a.credits > b.credits; });
 }
 
 MultiUserScheduler::DlMuInfo
@@ -828,7 +846,7 @@ RrMultiUserScheduler::ComputeDlMuInfo()
         NS_ASSERT(mpdu);
         uint8_t tid = mpdu->GetHeader().GetQosTid();
         receiver = mpdu->GetHeader().GetAddr1();
-        NS_ASSERT(receiver == candidate.first->address);
+        NS_ASSERT(receiver == candidate.first->second.address);
 
         NS_ASSERT(mpdu->IsQueued());
         Ptr<WifiMpdu> item = mpdu;
@@ -856,11 +874,11 @@ RrMultiUserScheduler::ComputeDlMuInfo()
         if (mpduList.size() > 1)
         {
             // A-MPDU aggregation succeeded, update psduMap
-            dlMuInfo.psduMap[candidate.first->aid] = Create<WifiPsdu>(std::move(mpduList));
+            dlMuInfo.psduMap[candidate.first->second.aid] = Create<WifiPsdu>(std::move(mpduList));
         }
         else
         {
-            dlMuInfo.psduMap[candidate.first->aid] = Create<WifiPsdu>(item, true);
+            dlMuInfo.psduMap[candidate.first->second.aid] = Create<WifiPsdu>(item, true);
         }
     }
 
@@ -869,7 +887,8 @@ RrMultiUserScheduler::ComputeDlMuInfo()
                   dlMuInfo.txParams.m_txDuration,
                   dlMuInfo.txParams.m_txVector);
 
-    NS_LOG_DEBUG("Next station to serve has AID=" << m_staListDl[primaryAc].front().aid);
+    NS_LOG_DEBUG("Next station to serve has AID="
+                 << m_staListDl[primaryAc].stas.begin()->second.aid);
 
     return dlMuInfo;
 }
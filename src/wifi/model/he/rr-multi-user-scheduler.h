@@ -22,7 +22,9 @@
 
 #include "multi-user-scheduler.h"
 
+#include <functional>
 #include <list>
+#include <map>
 
 namespace ns3
 {
@@ -122,9 +124,36 @@ class RrMultiUserScheduler : public MultiUserScheduler
     {
         uint16_t aid;         //!< station's AID
         Mac48Address address; //!< station's MAC Address
-        double credits;       //!< credits accumulated by the station
     };
 
+    /**
+     * Stations sorted in decreasing order of credits (next to serve first).
+     *
+     * The credits given to all the stations after a transmission are accumulated
+     * in an offset common to all the stations, hence only the stations that are
+     * debited need to be moved. Stations are indexed by their credits minus the
+     * offset, and stations with the same index are kept in insertion order. The
+     * credits of a station are capped at the maximum amount of credits when read,
+     * which yields the same value as capping them after every transmission.
+     */
+    struct StaList
+    {
+        /// type of the container of the stations
+        typedef std::multimap<double, MasterInfo, std::greater<>> StaMap;
+
+        StaMap stas;      //!< stations indexed by their credits minus the offset
+        double offset{0}; //!< credits given to all the stations of the list
+    };
+
+    /**
+     * Get the credits of the given station of the given list.
+     *
+     * \param staList the list of stations
+     * \param staIt an iterator pointing to the station
+     * \return the credits of the station
+     */
+    double GetCredits(const StaList& staList, StaList::StaMap::const_iterator staIt) const;
+
     /**
      * Finalize the given TXVECTOR by only including the largest subset of the
      * current set of candidate stations that can be allocated equal-sized RUs
@@ -145,14 +174,12 @@ class RrMultiUserScheduler : public MultiUserScheduler
      * \param txDuration the TX duration of the PPDU being transmitted or solicited
      * \param txVector the TXVECTOR for the PPDU being transmitted or solicited
      */
-    void UpdateCredits(std::list<MasterInfo>& staList,
-                       Time txDuration,
-                       const WifiTxVector& txVector);
+    void UpdateCredits(StaList& staList, Time txDuration, const WifiTxVector& txVector);
 
     /**
      * Information stored for candidate stations
      */
-    typedef std::pair<std::list<MasterInfo>::iterator, Ptr<WifiMpdu>> CandidateInfo;
+    typedef std::pair<StaList::StaMap::iterator, Ptr<WifiMpdu>> CandidateInfo;
 
     uint8_t m_nStations;         //!< Number of stations/slots to fill
     bool m_enableTxopSharing;    //!< allow A-MPDUs of different TIDs in a DL MU PPDU
@@ -161,9 +188,9 @@ class RrMultiUserScheduler : public MultiUserScheduler
     bool m_enableBsrp;           //!< send a BSRP before an UL MU transmission
     bool m_useCentral26TonesRus; //!< whether to allocate central 26-tone RUs
     uint32_t m_ulPsduSize;       //!< the size in byte of the solicited PSDU
-    std::map<AcIndex, std::list<MasterInfo>>
+    std::map<AcIndex, StaList>
         m_staListDl;                       //!< Per-AC list of stations (next to serve for DL first)
-    std::list<MasterInfo> m_staListUl;     //!< List of stations to serve for UL
+    StaList m_staListUl;                   //!< List of stations to serve for UL
     std::list<CandidateInfo> m_candidates; //!< Candidate stations for MU TX
     Time m_maxCredits;                     //!< Max amount of credits a station can have
     CtrlTriggerHeader m_trigger;           //!< Trigger Frame to send
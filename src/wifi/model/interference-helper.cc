@@ -20,6 +20,7 @@
 
 #include "interference-helper.h"
 
+#include "effective-snr-mapping.h"
 #include "error-rate-model.h"
 #include "wifi-phy.h"
 #include "wifi-psdu.h"
@@ -148,33 +149,100 @@ operator<<(std::ostream& os, const Event& event)
  *       short period of time.
  ****************************************************************/
 
-InterferenceHelper::NiChange::NiChange(double power, Ptr<Event> event)
-    : m_power(power),
-      m_event(event)
+std::size_t
+InterferenceHelper::NiChanges::GetSize() const
 {
+    return m_times.size();
 }
 
-InterferenceHelper::NiChange::~NiChange()
+Time
+InterferenceHelper::NiChanges::GetTime(std::size_t i) const
 {
-    m_event = nullptr;
+    return m_times[i];
 }
 
 double
-InterferenceHelper::NiChange::GetPower() const
+InterferenceHelper::NiChanges::GetPower(std::size_t i) const
+{
+    return m_powers[i];
+}
+
+Ptr<Event>
+InterferenceHelper::NiChanges::GetEvent(std::size_t i) const
+{
+    return m_events[i];
+}
+
+std::size_t
+InterferenceHelper::NiChanges::GetNextPosition(Time moment) const
+{
+    return std::upper_bound(m_times.begin(), m_times.end(), moment) - m_times.begin();
+}
+
+std::size_t
+InterferenceHelper::NiChanges::GetPreviousPosition(Time moment) const
+{
+    std::size_t i = GetNextPosition(moment);
+    // This is safe since there is always an NiChange at time 0,
+    // before moment.
+    NS_ASSERT(i > 0);
+    return i - 1;
+}
+
+std::size_t
+InterferenceHelper::NiChanges::Find(Time moment) const
+{
+    auto it = std::lower_bound(m_times.begin(), m_times.end(), moment);
+    if (it == m_times.end() || *it != moment)
+    {
+        return m_times.size();
+    }
+    return it - m_times.begin();
+}
+
+std::size_t
+InterferenceHelper::NiChanges::Insert(Time moment, double power, Ptr<Event> event)
 {
-    return m_power;
+    std::size_t i = GetNextPosition(moment);
+    m_times.insert(m_times.begin() + i, moment);
+    m_powers.insert(m_powers.begin() + i, power);
+    m_events.insert(m_events.begin() + i, event);
+    return i;
 }
 
 void
-InterferenceHelper::NiChange::AddPower(double power)
+InterferenceHelper::NiChanges::Append(Time moment, double power, Ptr<Event> event)
 {
-    m_power += power;
+    NS_ASSERT(m_times.empty() || m_times.back() <= moment);
+    m_times.push_back(moment);
+    m_powers.push_back(power);
+    m_events.push_back(event);
 }
 
-Ptr<Event>
-InterferenceHelper::NiChange::GetEvent() const
+void
+InterferenceHelper::NiChanges::AddPower(std::size_t first, std::size_t last, double power)
+{
+    double* powers = m_powers.data();
+    for (std::size_t i = first; i < last; ++i)
+    {
+        powers[i] += power;
+    }
+}
+
+void
+InterferenceHelper::NiChanges::Erase(std::size_t first, std::size_t last)
 {
-    return m_event;
+    m_times.erase(m_times.begin() + first, m_times.begin() + last);
+    m_powers.erase(m_powers.begin() + first, m_powers.begin() + last);
+    m_events.erase(m_events.begin() + first, m_events.begin() + last);
+}
+
+void
+InterferenceHelper::NiChanges::Clear()
+{
+    m_times.clear();
+    m_powers.clear();
+    m_events.clear();
 }
 
 /****************************************************************
@@ -241,10 +309,6 @@ void
 InterferenceHelper::RemoveBands()
 {
     NS_LOG_FUNCTION(this);
-    for (auto it : m_niChangesPerBand)
-    {
-        it.second.clear();
-    }
     m_niChangesPerBand.clear();
     m_firstPowerPerBand.clear();
 }
@@ -254,11 +318,10 @@ InterferenceHelper::AddBand(WifiSpectrumBand band)
 {
     NS_LOG_FUNCTION(this << band.first << band.second);
     NS_ASSERT(m_niChangesPerBand.find(band) == m_niChangesPerBand.end());
-    NiChanges niChanges;
-    auto result = m_niChangesPerBand.insert({band, niChanges});
+    auto result = m_niChangesPerBand.insert({band, NiChanges()});
     NS_ASSERT(result.second);
     // Always have a zero power noise event in the list
-    AddNiChangeEvent(Time(0), NiChange(0.0, nullptr), result.first);
+    result.first->second.Append(Time(0), 0.0, nullptr);
     m_firstPowerPerBand.insert({band, 0.0});
 }
 
@@ -292,12 +355,13 @@ InterferenceHelper::GetEnergyDuration(double energyW, WifiSpectrumBand band)
     Time now = Simulator::Now();
     auto niIt = m_niChangesPerBand.find(band);
     NS_ASSERT(niIt != m_niChangesPerBand.end());
-    auto i = GetPreviousPosition(now, niIt);
-    Time end = i->first;
-    for (; i != niIt->second.end(); ++i)
+    const NiChanges& niChanges = niIt->second;
+    std::size_t i = niChanges.GetPreviousPosition(now);
+    Time end = niChanges.GetTime(i);
+    for (; i < niChanges.GetSize(); ++i)
     {
-        double noiseInterferenceW = i->second.GetPower();
-        end = i->first;
+        double noiseInterferenceW = niChanges.GetPower(i);
+        end = niChanges.GetTime(i);
         if (noiseInterferenceW < energyW)
         {
             break;
@@ -315,16 +379,17 @@ InterferenceHelper::AppendEvent(Ptr<Event> event, bool isStartOfdmaRxing)
         WifiSpectrumBand band = it.first;
         auto niIt = m_niChangesPerBand.find(band);
         NS_ASSERT(niIt != m_niChangesPerBand.end());
+        NiChanges& niChanges = niIt->second;
         double previousPowerStart = 0;
         double previousPowerEnd = 0;
-        auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), niIt);
-        previousPowerStart = previousPowerPosition->second.GetPower();
-        previousPowerEnd = GetPreviousPosition(event->GetEndTime(), niIt)->second.GetPower();
+        std::size_t previousPowerPosition = niChanges.GetPreviousPosition(event->GetStartTime());
+        previousPowerStart = niChanges.GetPower(previousPowerPosition);
+        previousPowerEnd = niChanges.GetPower(niChanges.GetPreviousPosition(event->GetEndTime()));
         if (!m_rxing)
         {
             m_firstPowerPerBand.find(band)->second = previousPowerStart;
             // Always leave the first zero power noise event in the list
-            niIt->second.erase(++(niIt->second.begin()), ++previousPowerPosition);
+            niChanges.Erase(1, previousPowerPosition + 1);
         }
         else if (isStartOfdmaRxing)
         {
@@ -333,13 +398,9 @@ InterferenceHelper::AppendEvent(Ptr<Event> event, bool isStartOfdmaRxing)
             // UL MU transmission and the start of UL-OFDMA payload.
             m_firstPowerPerBand.find(band)->second = previousPowerStart;
         }
-        auto first =
-            AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt);
-        auto last = AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), niIt);
-        for (auto i = first; i != last; ++i)
-        {
-            i->second.AddPower(it.second);
-        }
+        std::size_t first = niChanges.Insert(event->GetStartTime(), previousPowerStart, event);
+        std::size_t last = niChanges.Insert(event->GetEndTime(), previousPowerEnd, event);
+        niChanges.AddPower(first, last, it.second);
     }
 }
 
@@ -353,12 +414,10 @@ InterferenceHelper::UpdateEvent(Ptr<Event> event, const RxPowerWattPerChannelBan
         WifiSpectrumBand band = it.first;
         auto niIt = m_niChangesPerBand.find(band);
         NS_ASSERT(niIt != m_niChangesPerBand.end());
-        auto first = GetPreviousPosition(event->GetStartTime(), niIt);
-        auto last = GetPreviousPosition(event->GetEndTime(), niIt);
-        for (auto i = first; i != last; ++i)
-        {
-            i->second.AddPower(it.second);
-        }
+        NiChanges& niChanges = niIt->second;
+        std::size_t first = niChanges.GetPreviousPosition(event->GetStartTime());
+        std::size_t last = niChanges.GetPreviousPosition(event->GetEndTime());
+        niChanges.AddPower(first, last, it.second);
     }
     event->UpdateRxPowerW(rxPower);
 }
@@ -397,7 +456,7 @@ InterferenceHelper::CalculateSnr(double signal,
 
 double
 InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
-                                                NiChangesPerBand* nis,
+                                                NiChanges* nis,
                                                 WifiSpectrumBand band) const
 {
     NS_LOG_FUNCTION(this << band.first << band.second);
@@ -406,25 +465,26 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
     double noiseInterferenceW = firstPower_it->second;
     auto niIt = m_niChangesPerBand.find(band);
     NS_ASSERT(niIt != m_niChangesPerBand.end());
-    auto it = niIt->second.find(event->GetStartTime());
-    for (; it != niIt->second.end() && it->first < Simulator::Now(); ++it)
+    const NiChanges& niChanges = niIt->second;
+    double rxPowerW = event->GetRxPowerW(band);
+    std::size_t i = niChanges.Find(event->GetStartTime());
+    for (; i < niChanges.GetSize() && niChanges.GetTime(i) < Simulator::Now(); ++i)
     {
-        noiseInterferenceW = it->second.GetPower() - event->GetRxPowerW(band);
+        noiseInterferenceW = niChanges.GetPower(i) - rxPowerW;
     }
-    it = niIt->second.find(event->GetStartTime());
-    NS_ASSERT(it != niIt->second.end());
-    for (; it != niIt->second.end() && it->second.GetEvent() != event; ++it)
+    i = niChanges.Find(event->GetStartTime());
+    NS_ASSERT(i < niChanges.GetSize());
+    for (; i < niChanges.GetSize() && niChanges.GetEvent(i) != event; ++i)
     {
         ;
     }
-    NiChanges ni;
-    ni.emplace(event->GetStartTime(), NiChange(0, event));
-    while (++it != niIt->second.end() && it->second.GetEvent() != event)
+    nis->Clear();
+    nis->Append(event->GetStartTime(), 0, event);
+    while (++i < niChanges.GetSize() && niChanges.GetEvent(i) != event)
     {
-        ni.insert(*it);
+        nis->Append(niChanges.GetTime(i), niChanges.GetPower(i), niChanges.GetEvent(i));
     }
-    ni.emplace(event->GetEndTime(), NiChange(0, event));
-    nis->insert({band, ni});
+    nis->Append(event->GetEndTime(), 0, event);
     NS_ASSERT_MSG(noiseInterferenceW >= 0,
                   "CalculateNoiseInterferenceW returns negative value " << noiseInterferenceW);
     return noiseInterferenceW;
@@ -476,7 +536,7 @@ InterferenceHelper::CalculatePayloadChunkSuccessRate(double snir,
 double
 InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
                                         uint16_t channelWidth,
-                                        NiChangesPerBand* nis,
+                                        const NiChanges& nis,
                                         WifiSpectrumBand band,
                                         uint16_t staId,
                                         std::pair<Time, Time> window) const
@@ -484,25 +544,24 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
     NS_LOG_FUNCTION(this << channelWidth << band.first << band.second << staId << window.first
                          << window.second);
     double psr = 1.0; /* Packet Success Rate */
-    const auto& niIt = nis->find(band)->second;
-    auto j = niIt.cbegin();
-    Time previous = j->first;
+    std::size_t j = 0;
+    Time previous = nis.GetTime(j);
     WifiMode payloadMode = event->GetTxVector().GetMode(staId);
-    Time phyPayloadStart = j->first;
+    Time phyPayloadStart = nis.GetTime(j);
     if (event->GetPpdu()->GetType() != WIFI_PPDU_TYPE_UL_MU &&
         event->GetPpdu()->GetType() !=
-            WIFI_PPDU_TYPE_DL_MU) // j->first corresponds to the start of the OFDMA payload
+            WIFI_PPDU_TYPE_DL_MU) // the first change corresponds to the start of the OFDMA payload
     {
         phyPayloadStart =
-            j->first + WifiPhy::CalculatePhyPreambleAndHeaderDuration(event->GetTxVector());
+            nis.GetTime(j) + WifiPhy::CalculatePhyPreambleAndHeaderDuration(event->GetTxVector());
     }
     Time windowStart = phyPayloadStart + window.first;
     Time windowEnd = phyPayloadStart + window.second;
     double noiseInterferenceW = m_firstPowerPerBand.find(band)->second;
     double powerW = event->GetRxPowerW(band);
-    while (++j != niIt.cend())
+    while (++j < nis.GetSize())
     {
-        Time current = j->first;
+        Time current = nis.GetTime(j);
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
         double snr = CalculateSnr(powerW,
@@ -530,8 +589,8 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
                 "previous is before windowed payload and current is in the windowed payload: mode="
                 << payloadMode << ", psr=" << psr);
         }
-        noiseInterferenceW = j->second.GetPower() - powerW;
-        previous = j->first;
+        noiseInterferenceW = nis.GetPower(j) - powerW;
+        previous = nis.GetTime(j);
         if (previous > windowEnd)
         {
             NS_LOG_DEBUG("Stop: new previous=" << previous
@@ -546,15 +605,14 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
 double
 InterferenceHelper::CalculatePhyHeaderSectionPsr(
     Ptr<const Event> event,
-    NiChangesPerBand* nis,
+    const NiChanges& nis,
     uint16_t channelWidth,
     WifiSpectrumBand band,
     PhyEntity::PhyHeaderSections phyHeaderSections) const
 {
     NS_LOG_FUNCTION(this << band.first << band.second);
     double psr = 1.0; /* Packet Success Rate */
-    auto niIt = nis->find(band)->second;
-    auto j = niIt.begin();
+    std::size_t j = 0;
 
     NS_ASSERT(!phyHeaderSections.empty());
     Time stopLastSection = Seconds(0);
@@ -563,12 +621,12 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
         stopLastSection = Max(stopLastSection, section.second.first.second);
     }
 
-    Time previous = j->first;
+    Time previous = nis.GetTime(j);
     double noiseInterferenceW = m_firstPowerPerBand.find(band)->second;
     double powerW = event->GetRxPowerW(band);
-    while (++j != niIt.end())
+    while (++j < nis.GetSize())
     {
-        Time current = j->first;
+        Time current = nis.GetTime(j);
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
         double snr = CalculateSnr(powerW, noiseInterferenceW, channelWidth, 1);
@@ -594,8 +652,8 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
                 }
             }
         }
-        noiseInterferenceW = j->second.GetPower() - powerW;
-        previous = j->first;
+        noiseInterferenceW = nis.GetPower(j) - powerW;
+        previous = nis.GetTime(j);
         if (previous > stopLastSection)
         {
             NS_LOG_DEBUG("Stop: new previous=" << previous << " after stop of last section="
@@ -608,18 +666,17 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
 
 double
 InterferenceHelper::CalculatePhyHeaderPer(Ptr<const Event> event,
-                                          NiChangesPerBand* nis,
+                                          const NiChanges& nis,
                                           uint16_t channelWidth,
                                           WifiSpectrumBand band,
                                           WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band.first << band.second << header);
-    auto niIt = nis->find(band)->second;
     auto phyEntity = WifiPhy::GetStaticPhyEntity(event->GetTxVector().GetModulationClass());
 
     PhyEntity::PhyHeaderSections sections;
     for (const auto& section :
-         phyEntity->GetPhyHeaderSections(event->GetTxVector(), niIt.begin()->first))
+         phyEntity->GetPhyHeaderSections(event->GetTxVector(), nis.GetTime(0)))
     {
         if (section.first == header)
         {
@@ -644,7 +701,7 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
 {
     NS_LOG_FUNCTION(this << channelWidth << band.first << band.second << staId
                          << relativeMpduStartStop.first << relativeMpduStartStop.second);
-    NiChangesPerBand ni;
+    NiChanges ni;
     double noiseInterferenceW = CalculateNoiseInterferenceW(event, &ni, band);
     double snr = CalculateSnr(event->GetRxPowerW(band),
                               noiseInterferenceW,
@@ -654,18 +711,76 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
     /* calculate the SNIR at the start of the MPDU (located through windowing) and accumulate
      * all SNIR changes in the SNIR vector.
      */
-    double per = CalculatePayloadPer(event, channelWidth, &ni, band, staId, relativeMpduStartStop);
+    double per = CalculatePayloadPer(event, channelWidth, ni, band, staId, relativeMpduStartStop);
 
     return PhyEntity::SnrPer(snr, per);
 }
 
+double
+InterferenceHelper::CalculatePayloadEffectiveSnr(Ptr<Event> event,
+                                                 uint16_t channelWidth,
+                                                 WifiSpectrumBand band,
+                                                 uint16_t staId,
+                                                 WifiPhyAbstraction abstraction) const
+{
+    NS_LOG_FUNCTION(this << channelWidth << band.first << band.second << staId << abstraction);
+    NS_ASSERT(event->GetPpdu()->GetType() == WIFI_PPDU_TYPE_SU);
+    NiChanges ni;
+    CalculateNoiseInterferenceW(event, &ni, band);
+    const WifiTxVector& txVector = event->GetTxVector();
+    uint8_t nss = txVector.GetNss(staId);
+    Time previous = ni.GetTime(0);
+    Time payloadStart = previous + WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector);
+    double noiseInterferenceW = m_firstPowerPerBand.find(band)->second;
+    double powerW = event->GetRxPowerW(band);
+    EffectiveSnrMapping::Chunks chunks;
+    for (std::size_t j = 1; j < ni.GetSize(); j++)
+    {
+        Time current = ni.GetTime(j);
+        Time start = Max(previous, payloadStart);
+        if (current > start)
+        {
+            chunks.emplace_back(CalculateSnr(powerW, noiseInterferenceW, channelWidth, nss),
+                                current - start);
+        }
+        noiseInterferenceW = ni.GetPower(j) - powerW;
+        previous = current;
+    }
+    if (chunks.empty())
+    {
+        // null payload
+        return CalculateSnr(powerW, noiseInterferenceW, channelWidth, nss);
+    }
+    uint16_t constellationSize = txVector.GetMode(staId).GetConstellationSize();
+    switch (abstraction)
+    {
+    case WIFI_PHY_ABSTRACTION_EESM:
+        return EffectiveSnrMapping::Eesm(chunks, constellationSize);
+    case WIFI_PHY_ABSTRACTION_MIESM:
+        return EffectiveSnrMapping::Miesm(chunks, constellationSize);
+    default:
+        NS_FATAL_ERROR("No effective SNR mapping for PHY abstraction " << abstraction);
+        return 0;
+    }
+}
+
+double
+InterferenceHelper::CalculateMpduPer(double snr,
+                                     Time mpduDuration,
+                                     const WifiTxVector& txVector,
+                                     uint16_t staId) const
+{
+    NS_LOG_FUNCTION(this << snr << mpduDuration << txVector << staId);
+    return 1 - CalculatePayloadChunkSuccessRate(snr, mpduDuration, txVector, staId);
+}
+
 double
 InterferenceHelper::CalculateSnr(Ptr<Event> event,
                                  uint16_t channelWidth,
                                  uint8_t nss,
                                  WifiSpectrumBand band) const
 {
-    NiChangesPerBand ni;
+    NiChanges ni;
     double noiseInterferenceW = CalculateNoiseInterferenceW(event, &ni, band);
     double snr = CalculateSnr(event->GetRxPowerW(band), noiseInterferenceW, channelWidth, nss);
     return snr;
@@ -678,14 +793,14 @@ InterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
                                              WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band.first << band.second << header);
-    NiChangesPerBand ni;
+    NiChanges ni;
     double noiseInterferenceW = CalculateNoiseInterferenceW(event, &ni, band);
     double snr = CalculateSnr(event->GetRxPowerW(band), noiseInterferenceW, channelWidth, 1);
 
     /* calculate the SNIR at the start of the PHY header and accumulate
      * all SNIR changes in the SNIR vector.
      */
-    double per = CalculatePhyHeaderPer(event, &ni, channelWidth, band, header);
+    double per = CalculatePhyHeaderPer(event, ni, channelWidth, band, header);
 
     return PhyEntity::SnrPer(snr, per);
 }
@@ -695,36 +810,14 @@ InterferenceHelper::EraseEvents()
 {
     for (auto niIt = m_niChangesPerBand.begin(); niIt != m_niChangesPerBand.end(); ++niIt)
     {
-        niIt->second.clear();
+        niIt->second.Clear();
         // Always have a zero power noise event in the list
-        AddNiChangeEvent(Time(0), NiChange(0.0, nullptr), niIt);
+        niIt->second.Append(Time(0), 0.0, nullptr);
         m_firstPowerPerBand.at(niIt->first) = 0.0;
     }
     m_rxing = false;
 }
 
-InterferenceHelper::NiChanges::iterator
-InterferenceHelper::GetNextPosition(Time moment, NiChangesPerBand::iterator niIt)
-{
-    return niIt->second.upper_bound(moment);
-}
-
-InterferenceHelper::NiChanges::iterator
-InterferenceHelper::GetPreviousPosition(Time moment, NiChangesPerBand::iterator niIt)
-{
-    auto it = GetNextPosition(moment, niIt);
-    // This is safe since there is always an NiChange at time 0,
-    // before moment.
-    --it;
-    return it;
-}
-
-InterferenceHelper::NiChanges::iterator
-InterferenceHelper::AddNiChangeEvent(Time moment, NiChange change, NiChangesPerBand::iterator niIt)
-{
-    return niIt->second.insert(GetNextPosition(moment, niIt), std::make_pair(moment, change));
-}
-
 void
 InterferenceHelper::NotifyRxStart()
 {
@@ -740,10 +833,10 @@ InterferenceHelper::NotifyRxEnd(Time endTime)
     // Update m_firstPowerPerBand for frame capture
     for (auto niIt = m_niChangesPerBand.begin(); niIt != m_niChangesPerBand.end(); ++niIt)
     {
-        NS_ASSERT(niIt->second.size() > 1);
-        auto it = GetPreviousPosition(endTime, niIt);
-        it--;
-        m_firstPowerPerBand.find(niIt->first)->second = it->second.GetPower();
+        NS_ASSERT(niIt->second.GetSize() > 1);
+        std::size_t i = niIt->second.GetPreviousPosition(endTime);
+        NS_ASSERT(i > 0);
+        m_firstPowerPerBand.find(niIt->first)->second = niIt->second.GetPower(i - 1);
     }
 }
 
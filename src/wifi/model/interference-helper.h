@@ -240,6 +240,38 @@ class InterferenceHelper : public Object
         WifiSpectrumBand band,
         uint16_t staId,
         std::pair<Time, Time> relativeMpduStartStop) const;
+    /**
+     * Calculate the effective SNR of the payload of the given SU event, which
+     * compresses the SNRs of the payload chunks with the effective SNR mapping
+     * of the given PHY abstraction.
+     *
+     * \param event the event corresponding to the first time the corresponding PPDU arrives
+     * \param channelWidth the channel width (in MHz)
+     * \param band identify the band used by the PSDU
+     * \param staId the station ID of the PSDU
+     * \param abstraction the PHY abstraction
+     *
+     * \return the effective SNR of the payload in linear scale
+     */
+    double CalculatePayloadEffectiveSnr(Ptr<Event> event,
+                                        uint16_t channelWidth,
+                                        WifiSpectrumBand band,
+                                        uint16_t staId,
+                                        WifiPhyAbstraction abstraction) const;
+    /**
+     * Calculate the PER of an MPDU received with the given SNR.
+     *
+     * \param snr the SNR (typically an effective SNR) in linear scale
+     * \param mpduDuration the duration of the MPDU
+     * \param txVector the TXVECTOR
+     * \param staId the station ID of the PSDU
+     *
+     * \return the PER
+     */
+    double CalculateMpduPer(double snr,
+                            Time mpduDuration,
+                            const WifiTxVector& txVector,
+                            uint16_t staId) const;
     /**
      * Calculate the SNIR for the event (starting from now until the event end).
      *
@@ -346,48 +378,94 @@ class InterferenceHelper : public Object
 
   private:
     /**
-     * Noise and Interference (thus Ni) event.
+     * Noise and Interference (thus Ni) changes of a band, in increasing order
+     * of time.  Each change records the time at which an event starts or ends,
+     * that event and the total power received in the band from that time until
+     * the next change.  The changes are stored in contiguous arrays, so that
+     * the lookups are binary searches and adding the power of an event to the
+     * changes it overlaps is a loop over an array.
      */
-    class NiChange
+    class NiChanges
     {
       public:
         /**
-         * Create a NiChange at the given time and the amount of NI change.
+         * \return the number of changes
+         */
+        std::size_t GetSize() const;
+        /**
+         * \param i the index of a change
+         * \return the time of the change
+         */
+        Time GetTime(std::size_t i) const;
+        /**
+         * \param i the index of a change
+         * \return the power in watts from the change to the next one
+         */
+        double GetPower(std::size_t i) const;
+        /**
+         * \param i the index of a change
+         * \return the event which causes the change
+         */
+        Ptr<Event> GetEvent(std::size_t i) const;
+        /**
+         * \param moment time to check from
+         * \return the index of the first change later than moment
+         */
+        std::size_t GetNextPosition(Time moment) const;
+        /**
+         * \param moment time to check from
+         * \return the index of the last change not later than moment
+         */
+        std::size_t GetPreviousPosition(Time moment) const;
+        /**
+         * \param moment the time of the change
+         * \return the index of the first change at the given time, or the
+         *         number of changes if there is none
+         */
+        std::size_t Find(Time moment) const;
+        /**
+         * Insert a change after the changes not later than its time.
          *
-         * \param power the power in watts
-         * \param event causes this NI change
+         * \param moment the time of the change
+         * \param power the power in watts from the change to the next one
+         * \param event the event which causes the change
+         * \return the index of the new change
          */
-        NiChange(double power, Ptr<Event> event);
-        ~NiChange();
+        std::size_t Insert(Time moment, double power, Ptr<Event> event);
         /**
-         * Return the power
+         * Add a change after all the changes.
          *
-         * \return the power in watts
+         * \param moment the time of the change, not earlier than the last one
+         * \param power the power in watts from the change to the next one
+         * \param event the event which causes the change
          */
-        double GetPower() const;
+        void Append(Time moment, double power, Ptr<Event> event);
         /**
-         * Add a given amount of power.
+         * Add a given amount of power to a range of changes.
          *
-         * \param power the power to be added to the existing value in watts
+         * \param first the index of the first change
+         * \param last the index following the last change
+         * \param power the power to be added in watts
          */
-        void AddPower(double power);
+        void AddPower(std::size_t first, std::size_t last, double power);
         /**
-         * Return the event causes the corresponding NI change
+         * Remove a range of changes.
          *
-         * \return the event
+         * \param first the index of the first change
+         * \param last the index following the last change
          */
-        Ptr<Event> GetEvent() const;
+        void Erase(std::size_t first, std::size_t last);
+        /**
+         * Remove all the changes.
+         */
+        void Clear();
 
       private:
-        double m_power;     ///< power in watts
-        Ptr<Event> m_event; ///< event
+        std::vector<Time> m_times;        ///< time of the changes
+        std::vector<double> m_powers;     ///< power in watts from each change to the next one
+        std::vector<Ptr<Event>> m_events; ///< event which causes each change
     };
 
-    /**
-     * typedef for a multimap of NiChange
-     */
-    typedef std::multimap<Time, NiChange> NiChanges;
-
     /**
      * Map of NiChanges per band
      */
@@ -412,7 +490,7 @@ class InterferenceHelper : public Object
      * \return noise and interference power
      */
     double CalculateNoiseInterferenceW(Ptr<Event> event,
-                                       NiChangesPerBand* nis,
+                                       NiChanges* nis,
                                        WifiSpectrumBand band) const;
     /**
      * Calculate the error rate of the given PHY payload only in the provided time
@@ -430,7 +508,7 @@ class InterferenceHelper : public Object
      */
     double CalculatePayloadPer(Ptr<const Event> event,
                                uint16_t channelWidth,
-                               NiChangesPerBand* nis,
+                               const NiChanges& nis,
                                WifiSpectrumBand band,
                                uint16_t staId,
                                std::pair<Time, Time> window) const;
@@ -447,7 +525,7 @@ class InterferenceHelper : public Object
      * \return the error rate of the HT PHY header
      */
     double CalculatePhyHeaderPer(Ptr<const Event> event,
-                                 NiChangesPerBand* nis,
+                                 const NiChanges& nis,
                                  uint16_t channelWidth,
                                  WifiSpectrumBand band,
                                  WifiPpduField header) const;
@@ -463,7 +541,7 @@ class InterferenceHelper : public Object
      * \return the success rate of the PHY header sections
      */
     double CalculatePhyHeaderSectionPsr(Ptr<const Event> event,
-                                        NiChangesPerBand* nis,
+                                        const NiChanges& nis,
                                         uint16_t channelWidth,
                                         WifiSpectrumBand band,
                                         PhyEntity::PhyHeaderSections phyHeaderSections) const;
@@ -474,36 +552,6 @@ class InterferenceHelper : public Object
     NiChangesPerBand m_niChangesPerBand;                    //!< NI Changes for each band
     std::map<WifiSpectrumBand, double> m_firstPowerPerBand; //!< first power of each band in watts
     bool m_rxing; //!< flag whether it is in receiving state
-
-    /**
-     * Returns an iterator to the first NiChange that is later than moment
-     *
-     * \param moment time to check from
-     * \param niIt iterator of the band to check
-     * \returns an iterator to the list of NiChanges
-     */
-    NiChanges::iterator GetNextPosition(Time moment, NiChangesPerBand::iterator niIt);
-    /**
-     * Returns an iterator to the last NiChange that is before than moment
-     *
-     * \param moment time to check from
-     * \param niIt iterator of the band to check
-     * \returns an iterator to the list of NiChanges
-     */
-    NiChanges::iterator GetPreviousPosition(Time moment, NiChangesPerBand::iterator niIt);
-
-    /**
-     * Add NiChange to the list at the appropriate position and
-     * return the iterator of the new event.
-     *
-     * \param moment time to check from
-     * \param change the NiChange to add
-     * \param niIt iterator of the band to check
-     * \returns the iterator of the new event
-     */
-    NiChanges::iterator AddNiChangeEvent(Time moment,
-                                         NiChange change,
-                                         NiChangesPerBand::iterator niIt);
 };
 
 } // namespace ns3
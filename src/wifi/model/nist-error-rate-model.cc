@@ -20,12 +20,16 @@
 
 #include "nist-error-rate-model.h"
 
+#include "error-rate-lookup-table.h"
 #include "wifi-tx-vector.h"
+#include "wifi-utils.h"
 
 #include "ns3/log.h"
 
 #include <bitset>
 #include <cmath>
+#include <map>
+#include <tuple>
 
 namespace ns3
 {
@@ -180,6 +184,49 @@ NistErrorRateModel::GetFecQamBer(uint16_t constellationSize,
     return pms;
 }
 
+double
+NistErrorRateModel::GetPe(uint16_t constellationSize, double snr, uint8_t bValue) const
+{
+    double ber;
+    if (constellationSize == 2)
+    {
+        ber = GetBpskBer(snr);
+    }
+    else if (constellationSize == 4)
+    {
+        ber = GetQpskBer(snr);
+    }
+    else
+    {
+        ber = GetQamBer(constellationSize, snr);
+    }
+    if (ber == 0.0)
+    {
+        return 0.0;
+    }
+    return CalculatePe(ber, bValue);
+}
+
+std::optional<double>
+NistErrorRateModel::LookupPe(uint16_t constellationSize, double snr, uint8_t bValue) const
+{
+    // the tables only depend on their key, hence they are shared by all the models
+    static std::map<std::tuple<uint16_t, uint8_t, double>, ErrorRateLookupTable> tables;
+    double maxError = GetLookupTableMaxError();
+    auto key = std::make_tuple(constellationSize, bValue, maxError);
+    auto it = tables.find(key);
+    if (it == tables.end())
+    {
+        NS_LOG_DEBUG("Create the table of the " << constellationSize << "-point constellation"
+                                                << " with bValue " << +bValue);
+        auto pe = [this, constellationSize, bValue](double snrDb) {
+            return GetPe(constellationSize, DbToRatio(snrDb), bValue);
+        };
+        it = tables.emplace(key, ErrorRateLookupTable(pe, -30, 100, maxError)).first;
+    }
+    return it->second.Lookup(RatioToDb(snr));
+}
+
 uint8_t
 NistErrorRateModel::GetBValue(WifiCodeRate codeRate) const
 {
@@ -213,6 +260,15 @@ NistErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
     NS_LOG_FUNCTION(this << mode << snr << nbits << +numRxAntennas << field << staId);
     if (mode.GetModulationClass() >= WIFI_MOD_CLASS_ERP_OFDM)
     {
+        if (IsLookupTableEnabled())
+        {
+            std::optional<double> pe =
+                LookupPe(mode.GetConstellationSize(), snr, GetBValue(mode.GetCodeRate()));
+            if (pe.has_value())
+            {
+                return std::pow(1 - std::min(pe.value(), 1.0), nbits);
+            }
+        }
         if (mode.GetConstellationSize() == 2)
         {
             return GetFecBpskBer(snr, nbits, GetBValue(mode.GetCodeRate()));
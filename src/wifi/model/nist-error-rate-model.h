@@ -23,6 +23,8 @@
 #include "error-rate-model.h"
 #include "wifi-mode.h"
 
+#include <optional>
+
 namespace ns3
 {
 
@@ -70,6 +72,29 @@ class NistErrorRateModel : public ErrorRateModel
      * \return the coded BER
      */
     double CalculatePe(double p, uint8_t bValue) const;
+    /**
+     * Return the coded BER for the given constellation size, SNR and bValue.
+     * The BER is not bounded by 1, so that it is smooth enough to be
+     * interpolated.
+     *
+     * \param constellationSize the size of the constellation
+     * \param snr the SNR ratio (in linear scale)
+     * \param bValue such that coding rate = bValue / (bValue + 1)
+     *
+     * \return the coded BER
+     */
+    double GetPe(uint16_t constellationSize, double snr, uint8_t bValue) const;
+    /**
+     * Return the coded BER for the given constellation size, SNR and bValue,
+     * interpolated in a table shared by all the models.
+     *
+     * \param constellationSize the size of the constellation
+     * \param snr the SNR ratio (in linear scale)
+     * \param bValue such that coding rate = bValue / (bValue + 1)
+     *
+     * \return the coded BER, or nothing if the SNR is outside the table
+     */
+    std::optional<double> LookupPe(uint16_t constellationSize, double snr, uint8_t bValue) const;
     /**
      * Return BER of BPSK at the given SNR.
      *
@@ -456,7 +456,10 @@ PhyEntity::StartReceivePreamble(Ptr<const WifiPpdu> ppdu,
         DropPreambleEvent(ppdu, CHANNEL_SWITCHING, endRx);
         break;
     case WifiPhyState::RX:
+        // with the PHY abstraction, the PHY is in RX state from the start of the PPDU, and
+        // the PPDU being received cannot be switched for another one
         if (m_wifiPhy->m_frameCaptureModel &&
+            m_wifiPhy->GetAbstraction() == WIFI_PHY_ABSTRACTION_NONE &&
             m_wifiPhy->m_frameCaptureModel->IsInCaptureWindow(
                 m_wifiPhy->m_timeLastPreambleDetected) &&
             m_wifiPhy->m_frameCaptureModel->CaptureNewFrame(m_wifiPhy->m_currentEvent, event))
@@ -606,11 +609,32 @@ void
 PhyEntity::ScheduleEndOfMpdus(Ptr<Event> event)
 {
     NS_LOG_FUNCTION(this << *event);
-    Ptr<const WifiPpdu> ppdu = event->GetPpdu();
+    Ptr<const WifiPsdu> psdu = GetAddressedPsduInPpdu(event->GetPpdu());
+    auto mpdu = psdu->begin();
+    size_t i = 0;
+    for (const auto& [relativeStart, mpduDuration] : GetMpduWindows(event->GetPpdu()))
+    {
+        m_endOfMpduEvents.push_back(Simulator::Schedule(relativeStart + mpduDuration,
+                                                        &PhyEntity::EndOfMpdu,
+                                                        this,
+                                                        event,
+                                                        Create<WifiPsdu>(*mpdu, false),
+                                                        i,
+                                                        relativeStart,
+                                                        mpduDuration));
+        ++mpdu;
+        ++i;
+    }
+}
+
+std::vector<std::pair<Time, Time>>
+PhyEntity::GetMpduWindows(Ptr<const WifiPpdu> ppdu) const
+{
+    NS_LOG_FUNCTION(this << ppdu);
     Ptr<const WifiPsdu> psdu = GetAddressedPsduInPpdu(ppdu);
-    const WifiTxVector& txVector = event->GetTxVector();
+    const WifiTxVector& txVector = ppdu->GetTxVector();
     uint16_t staId = GetStaId(ppdu);
-    Time endOfMpduDuration = NanoSeconds(0);
+    std::vector<std::pair<Time, Time>> mpduWindows;
     Time relativeStart = NanoSeconds(0);
     Time psduDuration = ppdu->GetTxDuration() - CalculatePhyPreambleAndHeaderDuration(txVector);
     Time remainingAmpduDuration = psduDuration;
@@ -643,25 +667,19 @@ PhyEntity::ScheduleEndOfMpdus(Ptr<Event> event)
             }
         }
 
-        endOfMpduDuration += mpduDuration;
-        NS_LOG_INFO("Schedule end of MPDU #"
-                    << i << " in " << endOfMpduDuration.As(Time::NS) << " (relativeStart="
-                    << relativeStart.As(Time::NS) << ", mpduDuration=" << mpduDuration.As(Time::NS)
-                    << ", remainingAmdpuDuration=" << remainingAmpduDuration.As(Time::NS) << ")");
-        m_endOfMpduEvents.push_back(Simulator::Schedule(endOfMpduDuration,
-                                                        &PhyEntity::EndOfMpdu,
-                                                        this,
-                                                        event,
-                                                        Create<WifiPsdu>(*mpdu, false),
-                                                        i,
-                                                        relativeStart,
-                                                        mpduDuration));
+        NS_LOG_INFO("End of MPDU #"
+                    << i << " in " << (relativeStart + mpduDuration).As(Time::NS)
+                    << " (relativeStart=" << relativeStart.As(Time::NS) << ", mpduDuration="
+                    << mpduDuration.As(Time::NS) << ", remainingAmdpuDuration="
+                    << remainingAmpduDuration.As(Time::NS) << ")");
+        mpduWindows.emplace_back(relativeStart, mpduDuration);
 
         // Prepare next iteration
         ++i;
         relativeStart += mpduDuration;
         mpduType = (i == (nMpdus - 1)) ? LAST_MPDU_IN_AGGREGATE : MIDDLE_MPDU_IN_AGGREGATE;
     }
+    return mpduWindows;
 }
 
 void
@@ -716,27 +734,40 @@ PhyEntity::EndReceivePayload(Ptr<Event> event)
                                                          txVector.GetNss(staId),
                                                          channelWidthAndBand.second);
 
-    Ptr<const WifiPsdu> psdu = GetAddressedPsduInPpdu(ppdu);
-    m_wifiPhy->NotifyRxEnd(psdu);
-
     auto signalNoiseIt = m_signalNoiseMap.find(std::make_pair(ppdu->GetUid(), staId));
     NS_ASSERT(signalNoiseIt != m_signalNoiseMap.end());
     auto statusPerMpduIt = m_statusPerMpduMap.find(std::make_pair(ppdu->GetUid(), staId));
     NS_ASSERT(statusPerMpduIt != m_statusPerMpduMap.end());
 
-    if (std::count(statusPerMpduIt->second.begin(), statusPerMpduIt->second.end(), true))
+    EndReceivePsdu(event, snr, signalNoiseIt->second, statusPerMpduIt->second);
+}
+
+void
+PhyEntity::EndReceivePsdu(Ptr<Event> event,
+                          double snr,
+                          const SignalNoiseDbm& signalNoise,
+                          const std::vector<bool>& statusPerMpdu)
+{
+    NS_LOG_FUNCTION(this << *event << snr);
+    Ptr<const WifiPpdu> ppdu = event->GetPpdu();
+    WifiTxVector txVector = event->GetTxVector();
+    uint16_t staId = GetStaId(ppdu);
+    Ptr<const WifiPsdu> psdu = GetAddressedPsduInPpdu(ppdu);
+    m_wifiPhy->NotifyRxEnd(psdu);
+
+    if (std::count(statusPerMpdu.begin(), statusPerMpdu.end(), true))
     {
         // At least one MPDU has been successfully received
         m_wifiPhy->NotifyMonitorSniffRx(psdu,
                                         m_wifiPhy->GetFrequency(),
                                         txVector,
-                                        signalNoiseIt->second,
-                                        statusPerMpduIt->second,
+                                        signalNoise,
+                                        statusPerMpdu,
                                         staId);
         RxSignalInfo rxSignalInfo;
         rxSignalInfo.snr = snr;
-        rxSignalInfo.rssi = signalNoiseIt->second.signal; // same information for all MPDUs
-        RxPayloadSucceeded(psdu, rxSignalInfo, txVector, staId, statusPerMpduIt->second);
+        rxSignalInfo.rssi = signalNoise.signal; // same information for all MPDUs
+        RxPayloadSucceeded(psdu, rxSignalInfo, txVector, staId, statusPerMpdu);
         m_wifiPhy->m_previouslyRxPpduUid =
             ppdu->GetUid(); // store UID only if reception is successful (because otherwise trigger
                             // won't be read by MAC layer)
@@ -913,6 +944,12 @@ PhyEntity::StartPreambleDetectionPeriod(Ptr<Event> event)
     NS_LOG_DEBUG("Sync to signal (power=" << WToDbm(GetRxPowerWForPpdu(event)) << "dBm)");
     m_wifiPhy->m_interference
         ->NotifyRxStart(); // We need to notify it now so that it starts recording events
+    if (UseAbstraction(event->GetPpdu()) && m_wifiPhy->m_currentPreambleEvents.size() == 1)
+    {
+        // no other preamble is being detected
+        StartReceiveAbstracted(event);
+        return;
+    }
     m_endPreambleDetectionEvents.push_back(
         Simulator::Schedule(m_wifiPhy->GetPreambleDetectionDuration(),
                             &PhyEntity::EndPreambleDetectionPeriod,
@@ -1052,6 +1089,114 @@ PhyEntity::EndPreambleDetectionPeriod(Ptr<Event> event)
     }
 }
 
+bool
+PhyEntity::UseAbstraction(Ptr<const WifiPpdu> ppdu) const
+{
+    return m_wifiPhy->GetAbstraction() != WIFI_PHY_ABSTRACTION_NONE &&
+           ppdu->GetType() == WIFI_PPDU_TYPE_SU;
+}
+
+void
+PhyEntity::StartReceiveAbstracted(Ptr<Event> event)
+{
+    NS_LOG_FUNCTION(this << *event);
+    NS_ASSERT(!m_wifiPhy->IsStateRx());
+    Ptr<const WifiPpdu> ppdu = event->GetPpdu();
+    uint16_t measurementChannelWidth = GetMeasurementChannelWidth(ppdu);
+    auto measurementBand = GetPrimaryBand(measurementChannelWidth);
+    double rxPowerW = event->GetRxPowerW(measurementBand);
+    double snr =
+        m_wifiPhy->m_interference->CalculateSnr(event, measurementChannelWidth, 1, measurementBand);
+    NS_LOG_DEBUG("SNR(dB)=" << RatioToDb(snr) << " at start of PPDU");
+
+    if ((!m_wifiPhy->m_preambleDetectionModel && rxPowerW <= 0.0) ||
+        (m_wifiPhy->m_preambleDetectionModel &&
+         !m_wifiPhy->m_preambleDetectionModel->IsPreambleDetected(rxPowerW,
+                                                                  snr,
+                                                                  measurementChannelWidth)))
+    {
+        NS_LOG_DEBUG("Drop packet because PHY preamble detection failed");
+        DropPreambleEvent(ppdu, PREAMBLE_DETECT_FAILURE, event->GetEndTime());
+        m_wifiPhy->m_interference->NotifyRxEnd(Simulator::Now());
+        return;
+    }
+
+    m_wifiPhy->m_currentEvent = event;
+    m_wifiPhy->NotifyRxBegin(GetAddressedPsduInPpdu(ppdu), event->GetRxPowerWPerBand());
+    m_wifiPhy->m_timeLastPreambleDetected = Simulator::Now();
+
+    const WifiTxVector& txVector = event->GetTxVector();
+    Time rxDuration = event->GetEndTime() - Simulator::Now();
+    uint16_t channelWidth = txVector.GetChannelWidth();
+    if ((channelWidth >= 40 && channelWidth > m_wifiPhy->GetChannelWidth()) ||
+        !IsConfigSupported(ppdu))
+    {
+        NS_LOG_DEBUG("Drop packet because of unsupported settings");
+        m_wifiPhy->NotifyRxDrop(GetAddressedPsduInPpdu(ppdu), UNSUPPORTED_SETTINGS);
+        m_wifiPhy->NotifyCcaBusy(ppdu, rxDuration);
+        m_endRxPayloadEvents.push_back(
+            Simulator::Schedule(rxDuration, &PhyEntity::ResetReceive, this, event));
+        return;
+    }
+
+    // PHY-RXSTART is indicated at the start of the PPDU, hence the MAC waits
+    // for the whole PPDU
+    NotifyPayloadBegin(txVector, rxDuration);
+    m_endRxPayloadEvents.push_back(
+        Simulator::Schedule(rxDuration, &PhyEntity::EndReceiveAbstracted, this, event));
+    m_state->SwitchToRx(rxDuration);
+}
+
+void
+PhyEntity::EndReceiveAbstracted(Ptr<Event> event)
+{
+    NS_LOG_FUNCTION(this << *event);
+    NS_ASSERT(event->GetEndTime() == Simulator::Now());
+    Ptr<const WifiPpdu> ppdu = event->GetPpdu();
+    WifiTxVector txVector = event->GetTxVector();
+    uint16_t staId = GetStaId(ppdu);
+    const auto& channelWidthAndBand = GetChannelWidthAndBand(txVector, staId);
+    double snr = m_wifiPhy->m_interference->CalculatePayloadEffectiveSnr(
+        event,
+        channelWidthAndBand.first,
+        channelWidthAndBand.second,
+        staId,
+        m_wifiPhy->GetAbstraction());
+    NS_LOG_DEBUG("Effective SNR(dB)=" << RatioToDb(snr));
+
+    double rxPowerW = event->GetRxPowerW(channelWidthAndBand.second);
+    SignalNoiseDbm signalNoise;
+    signalNoise.signal = WToDbm(rxPowerW);
+    signalNoise.noise = WToDbm(rxPowerW / snr);
+    RxSignalInfo rxSignalInfo;
+    rxSignalInfo.snr = snr;
+    rxSignalInfo.rssi = signalNoise.signal;
+
+    Ptr<const WifiPsdu> psdu = GetAddressedPsduInPpdu(ppdu);
+    std::vector<bool> statusPerMpdu;
+    auto mpdu = psdu->begin();
+    for (const auto& [relativeStart, mpduDuration] : GetMpduWindows(ppdu))
+    {
+        Ptr<const WifiPsdu> mpduPsdu = Create<WifiPsdu>(*mpdu++, false);
+        double per =
+            m_wifiPhy->m_interference->CalculateMpduPer(snr, mpduDuration, txVector, staId);
+        bool success = GetRandomValue() > per &&
+                       !(m_wifiPhy->m_postReceptionErrorModel &&
+                         m_wifiPhy->m_postReceptionErrorModel->IsCorrupt(
+                             mpduPsdu->GetPacket()->Copy()));
+        NS_LOG_DEBUG("MPDU starting at " << relativeStart.As(Time::NS) << ": PER=" << per
+                                         << ", correct reception: " << success);
+        statusPerMpdu.push_back(success);
+        if (success && psdu->GetNMpdus() > 1)
+        {
+            // only done for correct MPDU that is part of an A-MPDU
+            m_state->NotifyRxMpdu(mpduPsdu, rxSignalInfo, txVector);
+        }
+    }
+
+    EndReceivePsdu(event, snr, signalNoise, statusPerMpdu);
+}
+
 bool
 PhyEntity::IsConfigSupported(Ptr<const WifiPpdu> ppdu) const
 {
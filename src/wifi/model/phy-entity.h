@@ -38,6 +38,7 @@
 #include <optional>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 /**
  * \file
@@ -596,6 +597,42 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
      */
     void EndPreambleDetectionPeriod(Ptr<Event> event);
 
+    /**
+     * \param ppdu the received PPDU
+     * \return whether the PPDU can be received with the PHY abstraction, i.e.,
+     *         whether an abstraction is set and the PPDU is an SU PPDU
+     */
+    bool UseAbstraction(Ptr<const WifiPpdu> ppdu) const;
+    /**
+     * Start receiving a PPDU with the PHY abstraction. The preamble detection
+     * is performed right away, and the PHY header fields are not processed:
+     * if the preamble is detected and the configuration of the PPDU is
+     * supported, the PHY switches to RX until the end of the PPDU.
+     *
+     * \param event the event holding incoming PPDU's information
+     */
+    void StartReceiveAbstracted(Ptr<Event> event);
+    /**
+     * The last symbol of a PPDU received with the PHY abstraction has arrived.
+     * The MPDUs are decoded with the effective SNR of the payload.
+     *
+     * \param event the event holding incoming PPDU's information
+     */
+    void EndReceiveAbstracted(Ptr<Event> event);
+    /**
+     * Notify the end of the reception of the PSDU, with the outcome of the
+     * reception of its MPDUs, and reset the reception.
+     *
+     * \param event the event holding incoming PPDU's information
+     * \param snr the SNR of the PSDU in linear scale
+     * \param signalNoise the signal power and noise power of the PSDU in dBm
+     * \param statusPerMpdu reception status per MPDU
+     */
+    void EndReceivePsdu(Ptr<Event> event,
+                        double snr,
+                        const SignalNoiseDbm& signalNoise,
+                        const std::vector<bool>& statusPerMpdu);
+
     /**
      * Start receiving the PSDU (i.e. the first symbol of the PSDU has arrived).
      *
@@ -695,6 +732,15 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
      */
     void ScheduleEndOfMpdus(Ptr<Event> event);
 
+    /**
+     * Get the start time, relative to the start of the payload, and the
+     * duration of each MPDU of the PSDU addressed to this PHY in the PPDU.
+     *
+     * \param ppdu the received PPDU
+     * \return the relative start time and the duration of each MPDU
+     */
+    std::vector<std::pair<Time, Time>> GetMpduWindows(Ptr<const WifiPpdu> ppdu) const;
+
     /**
      * Perform amendment-specific actions when the payload is successfully received.
      *
@@ -42,6 +42,7 @@
 #include "ns3/wifi-mac.h"
 #include "ns3/wifi-phy.h"
 
+#include <cmath>
 #include <iomanip>
 
 #define Min(a, b) ((a < b) ? a : b)
@@ -52,28 +53,25 @@ NS_LOG_COMPONENT_DEFINE("MinstrelHtWifiManager");
 namespace ns3
 {
 
-/// MinstrelHtWifiRemoteStation structure
-struct MinstrelHtWifiRemoteStation : MinstrelWifiRemoteStation
-{
-    uint8_t m_sampleGroup; //!< The group that the sample rate belongs to.
-
-    uint32_t m_sampleWait;     //!< How many transmission attempts to wait until a new sample.
-    uint32_t m_sampleTries;    //!< Number of sample tries after waiting sampleWait.
-    uint32_t m_sampleCount;    //!< Max number of samples per update interval.
-    uint32_t m_numSamplesSlow; //!< Number of times a slow rate was sampled.
-
-    uint32_t m_avgAmpduLen;      //!< Average number of MPDUs in an A-MPDU.
-    uint32_t m_ampduLen;         //!< Number of MPDUs in an A-MPDU.
-    uint32_t m_ampduPacketCount; //!< Number of A-MPDUs transmitted.
-
-    McsGroupData m_groupsTable; //!< Table of groups with stats.
-    bool m_isHt;                //!< If the station is HT capable.
-
-    std::ofstream m_statsFile; //!< File where statistics table is written.
-};
-
 NS_OBJECT_ENSURE_REGISTERED(MinstrelHtWifiManager);
 
+void
+MinstrelHtRateStats::Resize(std::size_t numRates)
+{
+    perfectTxTime.assign(numRates, 0);
+    numRateAttempt.assign(numRates, 0);
+    numRateSuccess.assign(numRates, 0);
+    prob.assign(numRates, 0);
+    ewmaProb.assign(numRates, 0);
+    ewmsdProb.assign(numRates, 0);
+    prevNumRateAttempt.assign(numRates, 0);
+    prevNumRateSuccess.assign(numRates, 0);
+    numSamplesSkipped.assign(numRates, 0);
+    successHist.assign(numRates, 0);
+    attemptHist.assign(numRates, 0);
+    throughput.assign(numRates, 0);
+}
+
 TypeId
 MinstrelHtWifiManager::GetTypeId()
 {
@@ -132,6 +130,7 @@ MinstrelHtWifiManager::GetTypeId()
 MinstrelHtWifiManager::MinstrelHtWifiManager()
     : m_numGroups(0),
       m_numRates(0),
+      m_nStations(0),
       m_currentRate(0)
 {
     NS_LOG_FUNCTION(this);
@@ -640,8 +639,7 @@ MinstrelHtWifiManager::DoReportDataFailed(WifiRemoteStation* st)
         uint8_t rateId = GetRateId(station->m_txrate);
         uint8_t groupId = GetGroupId(station->m_txrate);
         station->m_groupsTable[groupId]
-            .m_ratesTable[rateId]
-            .numRateAttempt++; // Increment the attempts counter for the rate used.
+            .m_stats.numRateAttempt[rateId]++; // Increment the attempts counter for the rate used.
         UpdateRate(station);
     }
 }
@@ -694,8 +692,8 @@ MinstrelHtWifiManager::DoReportDataOk(WifiRemoteStation* st,
     {
         uint8_t rateId = GetRateId(station->m_txrate);
         uint8_t groupId = GetGroupId(station->m_txrate);
-        station->m_groupsTable[groupId].m_ratesTable[rateId].numRateSuccess++;
-        station->m_groupsTable[groupId].m_ratesTable[rateId].numRateAttempt++;
+        station->m_groupsTable[groupId].m_stats.numRateSuccess[rateId]++;
+        station->m_groupsTable[groupId].m_stats.numRateAttempt[rateId]++;
 
         UpdatePacketCounters(station, 1, 0);
 
@@ -802,8 +800,8 @@ MinstrelHtWifiManager::DoReportAmpduTxStatus(WifiRemoteStation* st,
 
     uint8_t rateId = GetRateId(station->m_txrate);
     uint8_t groupId = GetGroupId(station->m_txrate);
-    station->m_groupsTable[groupId].m_ratesTable[rateId].numRateSuccess += nSuccessfulMpdus;
-    station->m_groupsTable[groupId].m_ratesTable[rateId].numRateAttempt +=
+    station->m_groupsTable[groupId].m_stats.numRateSuccess[rateId] += nSuccessfulMpdus;
+    station->m_groupsTable[groupId].m_stats.numRateAttempt[rateId] +=
         nSuccessfulMpdus + nFailedMpdus;
 
     if (nSuccessfulMpdus == 0 && station->m_longRetry < CountRetries(station))
@@ -1329,16 +1327,15 @@ MinstrelHtWifiManager::FindRate(MinstrelHtWifiRemoteStation* station)
              * Also do not sample if the probability is already higher than 95%
              * to avoid wasting airtime.
              */
-            MinstrelHtRateInfo sampleRateInfo =
-                station->m_groupsTable[sampleGroupId].m_ratesTable[sampleRateId];
+            const MinstrelHtRateStats& sampleStats = station->m_groupsTable[sampleGroupId].m_stats;
 
             NS_LOG_DEBUG("Use sample rate? MaxTpRate= "
                          << station->m_maxTpRate << " CurrentRate= " << station->m_txrate
                          << " SampleRate= " << sampleIdx
-                         << " SampleProb= " << sampleRateInfo.ewmaProb);
+                         << " SampleProb= " << sampleStats.ewmaProb[sampleRateId]);
 
             if (sampleIdx != station->m_maxTpRate && sampleIdx != station->m_maxTpRate2 &&
-                sampleIdx != station->m_maxProbRate && sampleRateInfo.ewmaProb <= 95)
+                sampleIdx != station->m_maxProbRate && sampleStats.ewmaProb[sampleRateId] <= 95)
             {
                 /**
                  * Make sure that lower rates get sampled only occasionally,
@@ -1354,12 +1351,11 @@ MinstrelHtWifiManager::FindRate(MinstrelHtWifiRemoteStation* station)
                 uint8_t maxTpStreams = m_minstrelGroups[maxTpGroupId].streams;
                 uint8_t sampleStreams = m_minstrelGroups[sampleGroupId].streams;
 
-                Time sampleDuration = sampleRateInfo.perfectTxTime;
-                Time maxTp2Duration =
-                    station->m_groupsTable[maxTp2GroupId].m_ratesTable[maxTp2RateId].perfectTxTime;
-                Time maxProbDuration = station->m_groupsTable[maxProbGroupId]
-                                           .m_ratesTable[maxProbRateId]
-                                           .perfectTxTime;
+                double sampleDuration = sampleStats.perfectTxTime[sampleRateId];
+                double maxTp2Duration =
+                    station->m_groupsTable[maxTp2GroupId].m_stats.perfectTxTime[maxTp2RateId];
+                double maxProbDuration =
+                    station->m_groupsTable[maxProbGroupId].m_stats.perfectTxTime[maxProbRateId];
 
                 NS_LOG_DEBUG("Use sample rate? SampleDuration= "
                              << sampleDuration << " maxTp2Duration= " << maxTp2Duration
@@ -1382,7 +1378,8 @@ MinstrelHtWifiManager::FindRate(MinstrelHtWifiRemoteStation* station)
                 else
                 {
                     station->m_numSamplesSlow++;
-                    if (sampleRateInfo.numSamplesSkipped >= 20 && station->m_numSamplesSlow <= 2)
+                    if (sampleStats.numSamplesSkipped[sampleRateId] >= 20 &&
+                        station->m_numSamplesSlow <= 2)
                     {
                         /// Set flag that we are currently sampling.
                         station->m_isSampling = true;
@@ -1421,8 +1418,6 @@ MinstrelHtWifiManager::UpdateStats(MinstrelHtWifiRemoteStation* station)
     station->m_numSamplesSlow = 0;
     station->m_sampleCount = 0;
 
-    double tempProb;
-
     if (station->m_ampduPacketCount > 0)
     {
         uint32_t newLen = station->m_ampduLen / station->m_ampduPacketCount;
@@ -1438,92 +1433,39 @@ MinstrelHtWifiManager::UpdateStats(MinstrelHtWifiRemoteStation* station)
     station->m_maxProbRate = GetLowestIndex(station);
 
     /// Update throughput and EWMA for each rate inside each group.
-    for (uint8_t j = 0; j < m_numGroups; j++)
+    for (uint8_t j : station->m_supportedGroups)
     {
-        if (station->m_groupsTable[j].m_supported)
-        {
-            station->m_sampleCount++;
+        station->m_sampleCount++;
 
-            /* (re)Initialize group rate indexes */
-            station->m_groupsTable[j].m_maxTpRate = GetLowestIndex(station, j);
-            station->m_groupsTable[j].m_maxTpRate2 = GetLowestIndex(station, j);
-            station->m_groupsTable[j].m_maxProbRate = GetLowestIndex(station, j);
+        /* (re)Initialize group rate indexes */
+        station->m_groupsTable[j].m_maxTpRate = GetLowestIndex(station, j);
+        station->m_groupsTable[j].m_maxTpRate2 = GetLowestIndex(station, j);
+        station->m_groupsTable[j].m_maxProbRate = GetLowestIndex(station, j);
 
-            for (uint8_t i = 0; i < m_numRates; i++)
-            {
-                if (station->m_groupsTable[j].m_ratesTable[i].supported)
-                {
-                    station->m_groupsTable[j].m_ratesTable[i].retryUpdated = false;
-
-                    NS_LOG_DEBUG(
-                        +i << " "
-                           << GetMcsSupported(station,
-                                              station->m_groupsTable[j].m_ratesTable[i].mcsIndex)
-                           << "\t attempt="
-                           << station->m_groupsTable[j].m_ratesTable[i].numRateAttempt
-                           << "\t success="
-                           << station->m_groupsTable[j].m_ratesTable[i].numRateSuccess);
-
-                    /// If we've attempted something.
-                    if (station->m_groupsTable[j].m_ratesTable[i].numRateAttempt > 0)
-                    {
-                        station->m_groupsTable[j].m_ratesTable[i].numSamplesSkipped = 0;
-                        /**
-                         * Calculate the probability of success.
-                         * Assume probability scales from 0 to 100.
-                         */
-                        tempProb =
-                            (100 * station->m_groupsTable[j].m_ratesTable[i].numRateSuccess) /
-                            station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-
-                        /// Bookkeeping.
-                        station->m_groupsTable[j].m_ratesTable[i].prob = tempProb;
-
-                        if (station->m_groupsTable[j].m_ratesTable[i].successHist == 0)
-                        {
-                            station->m_groupsTable[j].m_ratesTable[i].ewmaProb = tempProb;
-                        }
-                        else
-                        {
-                            station->m_groupsTable[j].m_ratesTable[i].ewmsdProb =
-                                CalculateEwmsd(station->m_groupsTable[j].m_ratesTable[i].ewmsdProb,
-                                               tempProb,
-                                               station->m_groupsTable[j].m_ratesTable[i].ewmaProb,
-                                               m_ewmaLevel);
-                            /// EWMA probability
-                            tempProb =
-                                (tempProb * (100 - m_ewmaLevel) +
-                                 station->m_groupsTable[j].m_ratesTable[i].ewmaProb * m_ewmaLevel) /
-                                100;
-                            station->m_groupsTable[j].m_ratesTable[i].ewmaProb = tempProb;
-                        }
-
-                        station->m_groupsTable[j].m_ratesTable[i].throughput =
-                            CalculateThroughput(station, j, i, tempProb);
+        UpdateGroupStats(station, j);
 
-                        station->m_groupsTable[j].m_ratesTable[i].successHist +=
-                            station->m_groupsTable[j].m_ratesTable[i].numRateSuccess;
-                        station->m_groupsTable[j].m_ratesTable[i].attemptHist +=
-                            station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-                    }
-                    else
-                    {
-                        station->m_groupsTable[j].m_ratesTable[i].numSamplesSkipped++;
-                    }
+        /*
+         * The best rates are only compared with rates of lower index or with the lowest
+         * rates, hence with rates whose statistics are already updated.
+         */
+        for (uint8_t i = 0; i < m_numRates; i++)
+        {
+            if (station->m_groupsTable[j].m_ratesTable[i].supported)
+            {
+                station->m_groupsTable[j].m_ratesTable[i].retryUpdated = false;
 
-                    /// Bookkeeping.
-                    station->m_groupsTable[j].m_ratesTable[i].prevNumRateSuccess =
-                        station->m_groupsTable[j].m_ratesTable[i].numRateSuccess;
-                    station->m_groupsTable[j].m_ratesTable[i].prevNumRateAttempt =
-                        station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-                    station->m_groupsTable[j].m_ratesTable[i].numRateSuccess = 0;
-                    station->m_groupsTable[j].m_ratesTable[i].numRateAttempt = 0;
+                NS_LOG_DEBUG(
+                    +i << " "
+                       << GetMcsSupported(station,
+                                          station->m_groupsTable[j].m_ratesTable[i].mcsIndex)
+                       << "\t attempt=" << station->m_groupsTable[j].m_stats.prevNumRateAttempt[i]
+                       << "\t success="
+                       << station->m_groupsTable[j].m_stats.prevNumRateSuccess[i]);
 
-                    if (station->m_groupsTable[j].m_ratesTable[i].throughput != 0)
-                    {
-                        SetBestStationThRates(station, GetIndex(j, i));
-                        SetBestProbabilityRate(station, GetIndex(j, i));
-                    }
+                if (station->m_groupsTable[j].m_stats.throughput[i] != 0)
+                {
+                    SetBestStationThRates(station, GetIndex(j, i));
+                    SetBestProbabilityRate(station, GetIndex(j, i));
                 }
             }
         }
@@ -1545,6 +1487,64 @@ MinstrelHtWifiManager::UpdateStats(MinstrelHtWifiRemoteStation* station)
     }
 }
 
+void
+MinstrelHtWifiManager::UpdateGroupStats(MinstrelHtWifiRemoteStation* station, uint8_t groupId)
+{
+    NS_LOG_FUNCTION(this << station << +groupId);
+    MinstrelHtRateStats& stats = station->m_groupsTable[groupId].m_stats;
+
+    /*
+     * The statistics of the rates that are not supported are never attempted, hence they are
+     * updated along with the others rather than skipped, so that the loop runs over
+     * contiguous arrays.
+     */
+    for (uint8_t i = 0; i < m_numRates; i++)
+    {
+        /// If we've attempted something.
+        if (stats.numRateAttempt[i] > 0)
+        {
+            stats.numSamplesSkipped[i] = 0;
+            /**
+             * Calculate the probability of success.
+             * Assume probability scales from 0 to 100.
+             */
+            double tempProb = (100 * stats.numRateSuccess[i]) / stats.numRateAttempt[i];
+
+            /// Bookkeeping.
+            stats.prob[i] = tempProb;
+
+            if (stats.successHist[i] == 0)
+            {
+                stats.ewmaProb[i] = tempProb;
+            }
+            else
+            {
+                stats.ewmsdProb[i] =
+                    CalculateEwmsd(stats.ewmsdProb[i], tempProb, stats.ewmaProb[i], m_ewmaLevel);
+                /// EWMA probability
+                tempProb =
+                    (tempProb * (100 - m_ewmaLevel) + stats.ewmaProb[i] * m_ewmaLevel) / 100;
+                stats.ewmaProb[i] = tempProb;
+            }
+
+            stats.throughput[i] = CalculateThroughput(station, groupId, i, tempProb);
+
+            stats.successHist[i] += stats.numRateSuccess[i];
+            stats.attemptHist[i] += stats.numRateAttempt[i];
+        }
+        else
+        {
+            stats.numSamplesSkipped[i]++;
+        }
+
+        /// Bookkeeping.
+        stats.prevNumRateSuccess[i] = stats.numRateSuccess[i];
+        stats.prevNumRateAttempt[i] = stats.numRateAttempt[i];
+        stats.numRateSuccess[i] = 0;
+        stats.numRateAttempt[i] = 0;
+    }
+}
+
 double
 MinstrelHtWifiManager::CalculateThroughput(MinstrelHtWifiRemoteStation* station,
                                            uint8_t groupId,
@@ -1566,14 +1566,14 @@ MinstrelHtWifiManager::CalculateThroughput(MinstrelHtWifiRemoteStation* station,
          * For the throughput calculation, limit the probability value to 90% to
          * account for collision related packet error rate fluctuation.
          */
-        Time txTime = station->m_groupsTable[groupId].m_ratesTable[rateId].perfectTxTime;
+        double txTime = station->m_groupsTable[groupId].m_stats.perfectTxTime[rateId];
         if (ewmaProb > 90)
         {
-            return 90 / txTime.GetSeconds();
+            return 90 / txTime;
         }
         else
         {
-            return ewmaProb / txTime.GetSeconds();
+            return ewmaProb / txTime;
         }
     }
 }
@@ -1582,7 +1582,7 @@ void
 MinstrelHtWifiManager::SetBestProbabilityRate(MinstrelHtWifiRemoteStation* station, uint16_t index)
 {
     GroupInfo* group;
-    MinstrelHtRateInfo rate;
+    double prob;
     uint8_t tmpGroupId;
     uint8_t tmpRateId;
     double tmpTh;
@@ -1598,16 +1598,16 @@ MinstrelHtWifiManager::SetBestProbabilityRate(MinstrelHtWifiRemoteStation* stati
     groupId = GetGroupId(index);
     rateId = GetRateId(index);
     group = &station->m_groupsTable[groupId];
-    rate = group->m_ratesTable[rateId];
+    prob = group->m_stats.ewmaProb[rateId];
 
     tmpGroupId = GetGroupId(station->m_maxProbRate);
     tmpRateId = GetRateId(station->m_maxProbRate);
-    tmpProb = station->m_groupsTable[tmpGroupId].m_ratesTable[tmpRateId].ewmaProb;
-    tmpTh = station->m_groupsTable[tmpGroupId].m_ratesTable[tmpRateId].throughput;
+    tmpProb = station->m_groupsTable[tmpGroupId].m_stats.ewmaProb[tmpRateId];
+    tmpTh = station->m_groupsTable[tmpGroupId].m_stats.throughput[tmpRateId];
 
-    if (rate.ewmaProb > 75)
+    if (prob > 75)
     {
-        currentTh = station->m_groupsTable[groupId].m_ratesTable[rateId].throughput;
+        currentTh = station->m_groupsTable[groupId].m_stats.throughput[rateId];
         if (currentTh > tmpTh)
         {
             station->m_maxProbRate = index;
@@ -1615,7 +1615,7 @@ MinstrelHtWifiManager::SetBestProbabilityRate(MinstrelHtWifiRemoteStation* stati
 
         maxGPGroupId = GetGroupId(group->m_maxProbRate);
         maxGPRateId = GetRateId(group->m_maxProbRate);
-        maxGPTh = station->m_groupsTable[maxGPGroupId].m_ratesTable[maxGPRateId].throughput;
+        maxGPTh = station->m_groupsTable[maxGPGroupId].m_stats.throughput[maxGPRateId];
 
         if (currentTh > maxGPTh)
         {
@@ -1624,12 +1624,12 @@ MinstrelHtWifiManager::SetBestProbabilityRate(MinstrelHtWifiRemoteStation* stati
     }
     else
     {
-        if (rate.ewmaProb > tmpProb)
+        if (prob > tmpProb)
         {
             station->m_maxProbRate = index;
         }
         maxGPRateId = GetRateId(group->m_maxProbRate);
-        if (rate.ewmaProb > group->m_ratesTable[maxGPRateId].ewmaProb)
+        if (prob > group->m_stats.ewmaProb[maxGPRateId])
         {
             group->m_maxProbRate = index;
         }
@@ -1661,18 +1661,18 @@ MinstrelHtWifiManager::SetBestStationThRates(MinstrelHtWifiRemoteStation* statio
 
     groupId = GetGroupId(index);
     rateId = GetRateId(index);
-    prob = station->m_groupsTable[groupId].m_ratesTable[rateId].ewmaProb;
-    th = station->m_groupsTable[groupId].m_ratesTable[rateId].throughput;
+    prob = station->m_groupsTable[groupId].m_stats.ewmaProb[rateId];
+    th = station->m_groupsTable[groupId].m_stats.throughput[rateId];
 
     maxTpGroupId = GetGroupId(station->m_maxTpRate);
     maxTpRateId = GetRateId(station->m_maxTpRate);
-    maxTpProb = station->m_groupsTable[maxTpGroupId].m_ratesTable[maxTpRateId].ewmaProb;
-    maxTpTh = station->m_groupsTable[maxTpGroupId].m_ratesTable[maxTpRateId].throughput;
+    maxTpProb = station->m_groupsTable[maxTpGroupId].m_stats.ewmaProb[maxTpRateId];
+    maxTpTh = station->m_groupsTable[maxTpGroupId].m_stats.throughput[maxTpRateId];
 
     maxTp2GroupId = GetGroupId(station->m_maxTpRate2);
     maxTp2RateId = GetRateId(station->m_maxTpRate2);
-    maxTp2Prob = station->m_groupsTable[maxTp2GroupId].m_ratesTable[maxTp2RateId].ewmaProb;
-    maxTp2Th = station->m_groupsTable[maxTp2GroupId].m_ratesTable[maxTp2RateId].throughput;
+    maxTp2Prob = station->m_groupsTable[maxTp2GroupId].m_stats.ewmaProb[maxTp2RateId];
+    maxTp2Th = station->m_groupsTable[maxTp2GroupId].m_stats.throughput[maxTp2RateId];
 
     if (th > maxTpTh || (th == maxTpTh && prob > maxTpProb))
     {
@@ -1689,13 +1689,13 @@ MinstrelHtWifiManager::SetBestStationThRates(MinstrelHtWifiRemoteStation* statio
     GroupInfo* group = &station->m_groupsTable[groupId];
     maxTpGroupId = GetGroupId(group->m_maxTpRate);
     maxTpRateId = GetRateId(group->m_maxTpRate);
-    maxTpProb = group->m_ratesTable[maxTpRateId].ewmaProb;
-    maxTpTh = station->m_groupsTable[maxTpGroupId].m_ratesTable[maxTpRateId].throughput;
+    maxTpProb = group->m_stats.ewmaProb[maxTpRateId];
+    maxTpTh = station->m_groupsTable[maxTpGroupId].m_stats.throughput[maxTpRateId];
 
     maxTp2GroupId = GetGroupId(group->m_maxTpRate2);
     maxTp2RateId = GetRateId(group->m_maxTpRate2);
-    maxTp2Prob = group->m_ratesTable[maxTp2RateId].ewmaProb;
-    maxTp2Th = station->m_groupsTable[maxTp2GroupId].m_ratesTable[maxTp2RateId].throughput;
+    maxTp2Prob = group->m_stats.ewmaProb[maxTp2RateId];
+    maxTp2Th = station->m_groupsTable[maxTp2GroupId].m_stats.throughput[maxTp2RateId];
 
     if (th > maxTpTh || (th == maxTpTh && prob > maxTpProb))
     {
@@ -1714,6 +1714,7 @@ MinstrelHtWifiManager::RateInit(MinstrelHtWifiRemoteStation* station)
     NS_LOG_FUNCTION(this << station);
 
     station->m_groupsTable = McsGroupData(m_numGroups);
+    station->m_supportedGroups.clear();
 
     /**
      * Initialize groups supported by the receiver.
@@ -1789,6 +1790,8 @@ MinstrelHtWifiManager::RateInit(MinstrelHtWifiRemoteStation* station)
 
             station->m_groupsTable[groupId].m_ratesTable =
                 MinstrelHtRate(m_numRates); /// Create the rate list for the group.
+            station->m_groupsTable[groupId].m_stats.Resize(m_numRates);
+            station->m_supportedGroups.push_back(groupId);
             for (uint8_t i = 0; i < m_numRates; i++)
             {
                 station->m_groupsTable[groupId].m_ratesTable[i].supported = false;
@@ -1835,18 +1838,8 @@ MinstrelHtWifiManager::RateInit(MinstrelHtWifiRemoteStation* station)
                     station->m_groupsTable[groupId].m_ratesTable[rateId].supported = true;
                     station->m_groupsTable[groupId].m_ratesTable[rateId].mcsIndex =
                         i; /// Mapping between rateId and operationalMcsSet
-                    station->m_groupsTable[groupId].m_ratesTable[rateId].numRateAttempt = 0;
-                    station->m_groupsTable[groupId].m_ratesTable[rateId].numRateSuccess = 0;
-                    station->m_groupsTable[groupId].m_ratesTable[rateId].prob = 0;
-                    station->m_groupsTable[groupId].m_ratesTable[rateId].ewmaProb = 0;
-                    station->m_groupsTable[groupId].m_ratesTable[rateId].prevNumRateAttempt = 0;
-                    station->m_groupsTable[groupId].m_ratesTable[rateId].prevNumRateSuccess = 0;
-                    station->m_groupsTable[groupId].m_ratesTable[rateId].numSamplesSkipped = 0;
-                    station->m_groupsTable[groupId].m_ratesTable[rateId].successHist = 0;
-                    station->m_groupsTable[groupId].m_ratesTable[rateId].attemptHist = 0;
-                    station->m_groupsTable[groupId].m_ratesTable[rateId].throughput = 0;
-                    station->m_groupsTable[groupId].m_ratesTable[rateId].perfectTxTime =
-                        GetFirstMpduTxTime(groupId, GetMcsSupported(station, i));
+                    station->m_groupsTable[groupId].m_stats.perfectTxTime[rateId] =
+                        GetFirstMpduTxTime(groupId, GetMcsSupported(station, i)).GetSeconds();
                     station->m_groupsTable[groupId].m_ratesTable[rateId].retryCount = 0;
                     station->m_groupsTable[groupId].m_ratesTable[rateId].adjustedRetryCount = 0;
                     CalculateRetransmits(station, groupId, rateId);
@@ -1863,6 +1856,12 @@ MinstrelHtWifiManager::RateInit(MinstrelHtWifiRemoteStation* station)
     SetNextSample(station);                /// Select the initial sample index.
     UpdateStats(station);                  /// Calculate the initial high throughput rates.
     station->m_txrate = FindRate(station); /// Select the rate to use.
+
+    // Stagger the next update of the statistics over an update interval, so that the stations
+    // initialized at the same time do not update their statistics at the same time. The offsets
+    // follow a golden ratio sequence, which spreads them evenly whatever the number of stations.
+    station->m_nextStatsUpdate +=
+        m_updateStats * std::fmod(m_nStations++ * 0.618033988749895, 1.0);
 }
 
 void
@@ -1892,7 +1891,7 @@ MinstrelHtWifiManager::CalculateRetransmits(MinstrelHtWifiRemoteStation* station
     Time slotTime = GetPhy()->GetSlot();
     Time ackTime = GetPhy()->GetSifs() + GetPhy()->GetBlockAckTxTime();
 
-    if (station->m_groupsTable[groupId].m_ratesTable[rateId].ewmaProb < 1)
+    if (station->m_groupsTable[groupId].m_stats.ewmaProb[rateId] < 1)
     {
         station->m_groupsTable[groupId].m_ratesTable[rateId].retryCount = 1;
     }
@@ -2079,17 +2078,17 @@ MinstrelHtWifiManager::StatsDump(MinstrelHtWifiRemoteStation* station,
             of << std::setw(6) << txTime.GetMicroSeconds() << "  ";
 
             of << std::setw(7) << CalculateThroughput(station, groupId, i, 100) / 100 << "   "
-               << std::setw(7) << station->m_groupsTable[groupId].m_ratesTable[i].throughput / 100
-               << "   " << std::setw(7) << station->m_groupsTable[groupId].m_ratesTable[i].ewmaProb
-               << "  " << std::setw(7) << station->m_groupsTable[groupId].m_ratesTable[i].ewmsdProb
-               << "  " << std::setw(7) << station->m_groupsTable[groupId].m_ratesTable[i].prob
+               << std::setw(7) << station->m_groupsTable[groupId].m_stats.throughput[i] / 100
+               << "   " << std::setw(7) << station->m_groupsTable[groupId].m_stats.ewmaProb[i]
+               << "  " << std::setw(7) << station->m_groupsTable[groupId].m_stats.ewmsdProb[i]
+               << "  " << std::setw(7) << station->m_groupsTable[groupId].m_stats.prob[i]
                << "  " << std::setw(2) << station->m_groupsTable[groupId].m_ratesTable[i].retryCount
                << "   " << std::setw(3)
-               << station->m_groupsTable[groupId].m_ratesTable[i].prevNumRateSuccess << "  "
-               << std::setw(3) << station->m_groupsTable[groupId].m_ratesTable[i].prevNumRateAttempt
+               << station->m_groupsTable[groupId].m_stats.prevNumRateSuccess[i] << "  "
+               << std::setw(3) << station->m_groupsTable[groupId].m_stats.prevNumRateAttempt[i]
                << "   " << std::setw(9)
-               << station->m_groupsTable[groupId].m_ratesTable[i].successHist << "   "
-               << std::setw(9) << station->m_groupsTable[groupId].m_ratesTable[i].attemptHist
+               << station->m_groupsTable[groupId].m_stats.successHist[i] << "   "
+               << std::setw(9) << station->m_groupsTable[groupId].m_stats.attemptHist[i]
                << "\n";
         }
     }
@@ -30,6 +30,8 @@
 #include "ns3/wifi-mpdu-type.h"
 #include "ns3/wifi-remote-station-manager.h"
 
+class MinstrelHtStatsTest;
+
 namespace ns3
 {
 
@@ -100,38 +102,15 @@ typedef std::vector<McsGroup> MinstrelMcsGroups;
 struct MinstrelHtWifiRemoteStation;
 
 /**
- * A struct to contain all statistics information related to a data rate.
+ * A struct to contain the information related to a data rate, other than its statistics.
  */
 struct MinstrelHtRateInfo
 {
-    /**
-     * Perfect transmission time calculation, or frame calculation.
-     * Given a bit rate and a packet length n bytes.
-     */
-    Time perfectTxTime;
     bool supported;      //!< If the rate is supported.
     uint8_t mcsIndex;    //!< The index in the operationalMcsSet of the WifiRemoteStationManager.
     uint32_t retryCount; //!< Retry limit.
     uint32_t adjustedRetryCount; //!< Adjust the retry limit for this rate.
-    uint32_t numRateAttempt;     //!< Number of transmission attempts so far.
-    uint32_t numRateSuccess;     //!< Number of successful frames transmitted so far.
-    double prob; //!< Current probability within last time interval. (# frame success )/(# total
-                 //!< frames)
-    bool retryUpdated; //!< If number of retries was updated already.
-    /**
-     * Exponential weighted moving average of probability.
-     * EWMA calculation:
-     * ewma_prob =[prob *(100 - ewma_level) + (ewma_prob_old * ewma_level)]/100
-     */
-    double ewmaProb;
-    double ewmsdProb;            //!< Exponential weighted moving standard deviation of probability.
-    uint32_t prevNumRateAttempt; //!< Number of transmission attempts with previous rate.
-    uint32_t prevNumRateSuccess; //!< Number of successful frames transmitted with previous rate.
-    uint32_t numSamplesSkipped;  //!< Number of times this rate statistics were not updated because
-                                 //!< no attempts have been made.
-    uint64_t successHist;        //!< Aggregate of all transmission successes.
-    uint64_t attemptHist;        //!< Aggregate of all transmission attempts.
-    double throughput;           //!< Throughput of this rate (in packets per second).
+    bool retryUpdated;           //!< If number of retries was updated already.
 };
 
 /**
@@ -140,6 +119,48 @@ struct MinstrelHtRateInfo
  */
 typedef std::vector<MinstrelHtRateInfo> MinstrelHtRate;
 
+/**
+ * A struct to contain all statistics information related to the data rates of a group.
+ * The statistics are stored as a structure of arrays indexed by the rate identifier,
+ * so that the statistics of all the rates of a group are updated by a loop over
+ * contiguous arrays.
+ */
+struct MinstrelHtRateStats
+{
+    /**
+     * Resize the arrays, initializing the statistics to zero.
+     *
+     * \param numRates the number of rates of the group
+     */
+    void Resize(std::size_t numRates);
+
+    /**
+     * Perfect transmission time calculation (in seconds), or frame calculation.
+     * Given a bit rate and a packet length n bytes.
+     */
+    std::vector<double> perfectTxTime;
+    std::vector<uint32_t> numRateAttempt; //!< Number of transmission attempts so far.
+    std::vector<uint32_t> numRateSuccess; //!< Number of successful frames transmitted so far.
+    std::vector<double> prob;             //!< Current probability within last time interval.
+    /**
+     * Exponential weighted moving average of probability.
+     * EWMA calculation:
+     * ewma_prob =[prob *(100 - ewma_level) + (ewma_prob_old * ewma_level)]/100
+     */
+    std::vector<double> ewmaProb;
+    std::vector<double> ewmsdProb; //!< Exponential weighted moving standard deviation of
+                                   //!< probability.
+    std::vector<uint32_t> prevNumRateAttempt; //!< Number of transmission attempts with previous
+                                              //!< rate.
+    std::vector<uint32_t> prevNumRateSuccess; //!< Number of successful frames transmitted with
+                                              //!< previous rate.
+    std::vector<uint32_t> numSamplesSkipped;  //!< Number of times this rate statistics were not
+                                              //!< updated because no attempts have been made.
+    std::vector<uint64_t> successHist;        //!< Aggregate of all transmission successes.
+    std::vector<uint64_t> attemptHist;        //!< Aggregate of all transmission attempts.
+    std::vector<double> throughput;           //!< Throughput of this rate (in packets per second).
+};
+
 /**
  * A struct to contain information of a group.
  */
@@ -155,6 +176,7 @@ struct GroupInfo
     uint16_t m_maxTpRate2;       //!< The second max throughput rate of this group in bps.
     uint16_t m_maxProbRate;      //!< The highest success probability rate of this group in bps.
     MinstrelHtRate m_ratesTable; //!< Information about rates of this group.
+    MinstrelHtRateStats m_stats; //!< Statistics of the rates of this group.
 };
 
 /**
@@ -163,6 +185,27 @@ struct GroupInfo
  */
 typedef std::vector<struct GroupInfo> McsGroupData;
 
+/// MinstrelHtWifiRemoteStation structure
+struct MinstrelHtWifiRemoteStation : MinstrelWifiRemoteStation
+{
+    uint8_t m_sampleGroup; //!< The group that the sample rate belongs to.
+
+    uint32_t m_sampleWait;     //!< How many transmission attempts to wait until a new sample.
+    uint32_t m_sampleTries;    //!< Number of sample tries after waiting sampleWait.
+    uint32_t m_sampleCount;    //!< Max number of samples per update interval.
+    uint32_t m_numSamplesSlow; //!< Number of times a slow rate was sampled.
+
+    uint32_t m_avgAmpduLen;      //!< Average number of MPDUs in an A-MPDU.
+    uint32_t m_ampduLen;         //!< Number of MPDUs in an A-MPDU.
+    uint32_t m_ampduPacketCount; //!< Number of A-MPDUs transmitted.
+
+    McsGroupData m_groupsTable;             //!< Table of groups with stats.
+    std::vector<uint8_t> m_supportedGroups; //!< IDs of the groups supported by the station.
+    bool m_isHt;                            //!< If the station is HT capable.
+
+    std::ofstream m_statsFile; //!< File where statistics table is written.
+};
+
 /**
  * Constants for maximum values.
  */
@@ -236,6 +279,9 @@ static const uint8_t MAX_HE_WIDTH = 160;       //!< Maximal channel width in MHz
 class MinstrelHtWifiManager : public WifiRemoteStationManager
 {
   public:
+    /// allow MinstrelHtStatsTest class access
+    friend class ::MinstrelHtStatsTest;
+
     /**
      * \brief Get the type ID.
      * \return the object TypeId
@@ -400,6 +446,15 @@ class MinstrelHtWifiManager : public WifiRemoteStationManager
      */
     void UpdateStats(MinstrelHtWifiRemoteStation* station);
 
+    /**
+     * Update the probability, EWMA and throughput statistics of the rates of a group, and
+     * start a new interval.
+     *
+     * \param station the Minstrel-HT wifi remote station
+     * \param groupId the group ID
+     */
+    void UpdateGroupStats(MinstrelHtWifiRemoteStation* station, uint8_t groupId);
+
     /**
      * Initialize Minstrel Table.
      *
@@ -674,6 +729,8 @@ class MinstrelHtWifiManager : public WifiRemoteStationManager
 
     Ptr<UniformRandomVariable> m_uniformRandomVariable; //!< Provides uniform random variables.
 
+    uint32_t m_nStations; //!< Number of stations initialized, to stagger their updates
+
     TracedValue<uint64_t> m_currentRate; //!< Trace rate changes
 };
 
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
 
 namespace ns3
 {
@@ -187,51 +188,33 @@ TableBasedErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
     auto errorTable = (ldpc ? AwgnErrorTableLdpc1458
                             : (size < m_threshold ? AwgnErrorTableBcc32 : AwgnErrorTableBcc1458));
     const auto& itVector = errorTable[mcs];
-    auto itTable = std::find_if(itVector.cbegin(),
-                                itVector.cend(),
-                                [&roundedSnr](const std::pair<double, double>& element) {
-                                    return element.first == roundedSnr;
-                                });
-    double minSnr = itVector.cbegin()->first;
-    double maxSnr = (--itVector.cend())->first;
+    // the tables are sorted by increasing SNR
+    auto itTable = std::lower_bound(itVector.cbegin(),
+                                    itVector.cend(),
+                                    roundedSnr,
+                                    [](const std::pair<double, double>& element, double snr) {
+                                        return element.first < snr;
+                                    });
     double per;
     if (itTable == itVector.cend())
     {
-        if (roundedSnr < minSnr)
-        {
-            per = 1.0;
-        }
-        else if (roundedSnr > maxSnr)
-        {
-            per = 0.0;
-        }
-        else
-        {
-            double a = 0.0;
-            double b = 0.0;
-            double previousSnr = 0.0;
-            double nextSnr = 0.0;
-            for (auto i = itVector.cbegin(); i != itVector.cend(); ++i)
-            {
-                if (i->first < roundedSnr)
-                {
-                    previousSnr = i->first;
-                    a = i->second;
-                }
-                else
-                {
-                    nextSnr = i->first;
-                    b = i->second;
-                    break;
-                }
-            }
-            per = a + (roundedSnr - previousSnr) * (b - a) / (nextSnr - previousSnr);
-        }
+        per = 0.0;
     }
-    else
+    else if (itTable->first == roundedSnr)
     {
         per = itTable->second;
     }
+    else if (itTable == itVector.cbegin())
+    {
+        per = 1.0;
+    }
+    else
+    {
+        auto previous = std::prev(itTable);
+        per = previous->second + (roundedSnr - previous->first) *
+                                     (itTable->second - previous->second) /
+                                     (itTable->first - previous->first);
+    }
 
     uint16_t tableSize = (ldpc ? ERROR_TABLE_LDPC_FRAME_SIZE
                                : (size < m_threshold ? ERROR_TABLE_BCC_SMALL_FRAME_SIZE
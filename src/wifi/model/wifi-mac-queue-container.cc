@@ -33,20 +33,28 @@ WifiMacQueueContainer::clear()
     m_queues.clear();
     m_expiredQueue.clear();
     m_nBytesPerQueue.clear();
+    m_expiryIndex.clear();
+    m_indexedExpiry.clear();
 }
 
 WifiMacQueueContainer::iterator
 WifiMacQueueContainer::insert(const_iterator pos, Ptr<WifiMpdu> item)
 {
     WifiContainerQueueId queueId = GetQueueId(item);
+    auto& queue = m_queues[queueId];
 
-    NS_ABORT_MSG_UNLESS(pos == m_queues[queueId].cend() || GetQueueId(pos->mpdu) == queueId,
+    NS_ABORT_MSG_UNLESS(pos == queue.cend() || GetQueueId(pos->mpdu) == queueId,
                         "pos iterator does not point to the correct container queue");
 
     auto [it, ret] = m_nBytesPerQueue.insert({queueId, 0});
     it->second += item->GetSize();
 
-    return m_queues[queueId].emplace(pos, item);
+    auto elemIt = queue.emplace(pos, item);
+    if (elemIt == queue.begin())
+    {
+        UpdateExpiryIndex(queueId, queue);
+    }
+    return elemIt;
 }
 
 WifiMacQueueContainer::iterator
@@ -63,7 +71,14 @@ WifiMacQueueContainer::erase(const_iterator pos)
     NS_ASSERT(it->second >= pos->mpdu->GetSize());
     it->second -= pos->mpdu->GetSize();
 
-    return m_queues[queueId].erase(pos);
+    auto& queue = m_queues[queueId];
+    bool first = (pos == queue.cbegin());
+    auto nextIt = queue.erase(pos);
+    if (first)
+    {
+        UpdateExpiryIndex(queueId, queue);
+    }
+    return nextIt;
 }
 
 Ptr<WifiMpdu>
@@ -112,12 +127,13 @@ WifiMacQueueContainer::GetNBytes(const WifiContainerQueueId& queueId) const
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
 WifiMacQueueContainer::ExtractExpiredMpdus(const WifiContainerQueueId& queueId) const
 {
-    return DoExtractExpiredMpdus(m_queues[queueId]);
+    return DoExtractExpiredMpdus(queueId);
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
-WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
+WifiMacQueueContainer::DoExtractExpiredMpdus(const WifiContainerQueueId& queueId) const
 {
+    auto& queue = m_queues[queueId];
     iterator firstExpiredIt = queue.begin();
     iterator lastExpiredIt = firstExpiredIt;
     Time now = Simulator::Now();
@@ -129,7 +145,6 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
         lastExpiredIt->ac = AC_UNDEF;
         lastExpiredIt->deleter(lastExpiredIt->mpdu);
 
-        WifiContainerQueueId queueId = GetQueueId(lastExpiredIt->mpdu);
         auto it = m_nBytesPerQueue.find(queueId);
         NS_ASSERT(it != m_nBytesPerQueue.end());
         NS_ASSERT(it->second >= lastExpiredIt->mpdu->GetSize());
@@ -142,6 +157,7 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
     {
         // transfer MPDUs with expired lifetime to the tail of m_expiredQueue
         m_expiredQueue.splice(m_expiredQueue.end(), queue, firstExpiredIt, lastExpiredIt);
+        UpdateExpiryIndex(queueId, queue);
         return {firstExpiredIt, m_expiredQueue.end()};
     }
 
@@ -152,10 +168,18 @@ std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
 WifiMacQueueContainer::ExtractAllExpiredMpdus() const
 {
     iterator firstExpiredIt = m_expiredQueue.end();
+    Time now = Simulator::Now();
 
-    for (auto& queue : m_queues)
+    // only the container queues whose entry in the index is not later than now
+    // may contain MPDUs with expired lifetime
+    while (!m_expiryIndex.empty() && m_expiryIndex.begin()->first <= now)
     {
-        auto [firstIt, lastIt] = DoExtractExpiredMpdus(queue.second);
+        // copy the QueueId, because the entry is removed from the index
+        WifiContainerQueueId queueId = m_expiryIndex.begin()->second;
+        auto [firstIt, lastIt] = DoExtractExpiredMpdus(queueId);
+        // the entry may be earlier than the expiry time of the first MPDU, which
+        // has not expired; update the entry in any case
+        UpdateExpiryIndex(queueId, m_queues[queueId]);
 
         if (firstIt != lastIt && firstExpiredIt == m_expiredQueue.end())
         {
@@ -166,6 +190,28 @@ WifiMacQueueContainer::ExtractAllExpiredMpdus() const
     return {firstExpiredIt, m_expiredQueue.end()};
 }
 
+void
+WifiMacQueueContainer::UpdateExpiryIndex(const WifiContainerQueueId& queueId,
+                                         const ContainerQueue& queue) const
+{
+    auto [it, inserted] = m_indexedExpiry.insert({queueId, Time()});
+    if (!inserted)
+    {
+        if (!queue.empty() && it->second == queue.front().expiryTime)
+        {
+            return;
+        }
+        m_expiryIndex.erase({it->second, queueId});
+    }
+    if (queue.empty())
+    {
+        m_indexedExpiry.erase(it);
+        return;
+    }
+    it->second = queue.front().expiryTime;
+    m_expiryIndex.insert({it->second, queueId});
+}
+
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
 WifiMacQueueContainer::GetAllExpiredMpdus() const
 {
@@ -183,11 +229,15 @@ std::hash<ns3::WifiContainerQueueId>::operator()(ns3::WifiContainerQueueId queue
 {
     auto [type, address, tid] = queueId;
 
-    uint8_t buffer[8];
-    buffer[0] = type;
-    address.CopyTo(buffer + 1);
-    buffer[7] = tid;
+    uint8_t buffer[6];
+    address.CopyTo(buffer);
 
-    std::string s(buffer, buffer + 8);
-    return std::hash<std::string>{}(s);
+    // pack the tuple in a 64-bit integer to avoid building a string
+    uint64_t key = type;
+    for (auto byte : buffer)
+    {
+        key = (key << 8) | byte;
+    }
+    key = (key << 8) | tid;
+    return std::hash<uint64_t>{}(key);
 }
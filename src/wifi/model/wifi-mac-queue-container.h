@@ -25,6 +25,7 @@
 #include "ns3/mac48-address.h"
 
 #include <list>
+#include <set>
 #include <tuple>
 #include <unordered_map>
 
@@ -92,6 +93,12 @@ namespace ns3
  *
  * This container holds multiple container queues organized in an hash table
  * whose keys are WifiContainerQueueId tuples identifying the container queues.
+ *
+ * The container queues are lists, because WifiMpdu objects and the Queue base
+ * class keep iterators to the elements.  The container queues whose first MPDU
+ * may have an expired lifetime are found through an index sorted by the expiry
+ * time of the first MPDU, so that ExtractAllExpiredMpdus does not visit all the
+ * container queues.
  */
 class WifiMacQueueContainer
 {
@@ -196,13 +203,28 @@ class WifiMacQueueContainer
      * \return the range [first, last) of iterators pointing to the MPDUs transferred
      *         to the container queue storing MPDUs with expired lifetime
      */
-    std::pair<iterator, iterator> DoExtractExpiredMpdus(ContainerQueue& queue) const;
+    std::pair<iterator, iterator> DoExtractExpiredMpdus(const WifiContainerQueueId& queueId) const;
+
+    /**
+     * Update the entry of the given container queue in the expiry index after
+     * its first MPDU changed.  The expiry time of an MPDU is set after it is
+     * inserted, hence the entry of a container queue may be earlier than the
+     * expiry time of its first MPDU, but it is never later.
+     *
+     * \param queueId the QueueId identifying the container queue
+     * \param queue the container queue
+     */
+    void UpdateExpiryIndex(const WifiContainerQueueId& queueId, const ContainerQueue& queue) const;
 
     mutable std::unordered_map<WifiContainerQueueId, ContainerQueue>
         m_queues;                          //!< the container queues
     mutable ContainerQueue m_expiredQueue; //!< queue storing MPDUs with expired lifetime
     mutable std::unordered_map<WifiContainerQueueId, uint32_t>
         m_nBytesPerQueue; //!< size in bytes of the container queues
+    mutable std::set<std::pair<Time, WifiContainerQueueId>>
+        m_expiryIndex; //!< non-empty container queues sorted by expiry time of their first MPDU
+    mutable std::unordered_map<WifiContainerQueueId, Time>
+        m_indexedExpiry; //!< expiry time of the entry of the container queues in the index
 };
 
 } // namespace ns3
@@ -505,7 +505,13 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::NotifyDequeue(AcIndex ac,
 
     for (const auto& mpdu : mpdus)
     {
-        queueIds.push_back(WifiMacQueueContainer::GetQueueId(mpdu));
+        // MPDUs of the same container queue (e.g., in an A-MPDU) are consecutive
+        // in the list, check such container queue once
+        if (auto queueId = WifiMacQueueContainer::GetQueueId(mpdu);
+            queueIds.empty() || queueIds.back() != queueId)
+        {
+            queueIds.push_back(queueId);
+        }
     }
 
     for (const auto& queueId : queueIds)
@@ -539,7 +545,13 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::NotifyRemove(AcIndex ac,
 
     for (const auto& mpdu : mpdus)
     {
-        queueIds.push_back(WifiMacQueueContainer::GetQueueId(mpdu));
+        // MPDUs of the same container queue (e.g., in an A-MPDU) are consecutive
+        // in the list, check such container queue once
+        if (auto queueId = WifiMacQueueContainer::GetQueueId(mpdu);
+            queueIds.empty() || queueIds.back() != queueId)
+        {
+            queueIds.push_back(queueId);
+        }
     }
 
     for (const auto& queueId : queueIds)
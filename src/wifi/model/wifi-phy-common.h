@@ -442,6 +442,42 @@ operator<<(std::ostream& os, WifiChannelListType type)
     }
 }
 
+/**
+ * \ingroup wifi
+ * Enumeration of the PHY abstractions, i.e., of the effective SNR mappings
+ * used to receive a PPDU in a single event (see WifiPhy::SetAbstraction).
+ */
+enum WifiPhyAbstraction : uint8_t
+{
+    WIFI_PHY_ABSTRACTION_NONE = 0,
+    WIFI_PHY_ABSTRACTION_EESM,
+    WIFI_PHY_ABSTRACTION_MIESM
+};
+
+/**
+ * \brief Stream insertion operator.
+ *
+ * \param os the stream
+ * \param abstraction the PHY abstraction
+ * \returns a reference to the stream
+ */
+inline std::ostream&
+operator<<(std::ostream& os, WifiPhyAbstraction abstraction)
+{
+    switch (abstraction)
+    {
+    case WIFI_PHY_ABSTRACTION_NONE:
+        return (os << "NONE");
+    case WIFI_PHY_ABSTRACTION_EESM:
+        return (os << "EESM");
+    case WIFI_PHY_ABSTRACTION_MIESM:
+        return (os << "MIESM");
+    default:
+        NS_FATAL_ERROR("Unknown PHY abstraction");
+        return (os << "UNKNOWN");
+    }
+}
+
 /**
  * Convert the guard interval to nanoseconds based on the WifiMode.
  *
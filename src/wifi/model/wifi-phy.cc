@@ -33,6 +33,7 @@
 #include "ns3/channel.h"
 #include "ns3/dsss-phy.h"
 #include "ns3/eht-phy.h" //also includes OFDM, HT, VHT and HE
+#include "ns3/enum.h"
 #include "ns3/erp-ofdm-phy.h"
 #include "ns3/error-model.h"
 #include "ns3/ht-configuration.h"
@@ -247,6 +248,20 @@ WifiPhy::GetTypeId()
                           PointerValue(),
                           MakePointerAccessor(&WifiPhy::m_postReceptionErrorModel),
                           MakePointerChecker<ErrorModel>())
+            .AddAttribute("Abstraction",
+                          "The PHY abstraction. With EESM or MIESM, the SU PPDUs are received "
+                          "in two events, at the start and at the end of the PPDU, without "
+                          "processing the PHY header fields; the MPDUs are decoded at the end "
+                          "of the PPDU with the effective SNR over the payload given by the "
+                          "corresponding effective SNR mapping.",
+                          EnumValue(WIFI_PHY_ABSTRACTION_NONE),
+                          MakeEnumAccessor(&WifiPhy::SetAbstraction, &WifiPhy::GetAbstraction),
+                          MakeEnumChecker(WIFI_PHY_ABSTRACTION_NONE,
+                                          "None",
+                                          WIFI_PHY_ABSTRACTION_EESM,
+                                          "Eesm",
+                                          WIFI_PHY_ABSTRACTION_MIESM,
+                                          "Miesm"))
             .AddAttribute("Sifs",
                           "The duration of the Short Interframe Space. "
                           "NOTE that the default value is overwritten by the value defined "
@@ -351,6 +366,7 @@ WifiPhy::WifiPhy()
       m_txSpatialStreams(1),
       m_rxSpatialStreams(1),
       m_wifiRadioEnergyModel(nullptr),
+      m_abstraction(WIFI_PHY_ABSTRACTION_NONE),
       m_timeLastPreambleDetected(Seconds(0))
 {
     NS_LOG_FUNCTION(this);
@@ -636,6 +652,19 @@ WifiPhy::SetPreambleDetectionModel(const Ptr<PreambleDetectionModel> model)
     m_preambleDetectionModel = model;
 }
 
+void
+WifiPhy::SetAbstraction(WifiPhyAbstraction abstraction)
+{
+    NS_LOG_FUNCTION(this << abstraction);
+    m_abstraction = abstraction;
+}
+
+WifiPhyAbstraction
+WifiPhy::GetAbstraction() const
+{
+    return m_abstraction;
+}
+
 void
 WifiPhy::SetWifiRadioEnergyModel(const Ptr<WifiRadioEnergyModel> wifiRadioEnergyModel)
 {
@@ -727,7 +727,7 @@ class WifiPhy : public Object
      *
      * \param threshold the receive sensitivity threshold in dBm
      */
-    void SetRxSensitivity(double threshold);
+    virtual void SetRxSensitivity(double threshold);
     /**
      * Return the receive sensitivity threshold (dBm).
      *
@@ -821,7 +821,7 @@ class WifiPhy : public Object
      *
      * \param gain the reception gain in dB
      */
-    void SetRxGain(double gain);
+    virtual void SetRxGain(double gain);
     /**
      * Return the reception gain (dB).
      *
@@ -983,6 +983,21 @@ class WifiPhy : public Object
      * \param preambleDetectionModel the preamble detection model
      */
     void SetPreambleDetectionModel(const Ptr<PreambleDetectionModel> preambleDetectionModel);
+    /**
+     * Set the PHY abstraction. With an abstraction other than
+     * WIFI_PHY_ABSTRACTION_NONE, the SU PPDUs are received without processing
+     * their PHY header fields: the preamble is detected when the PPDU arrives,
+     * and the MPDUs are decoded when the PPDU ends, with a single effective SNR
+     * computed by the given effective SNR mapping over the payload (see
+     * EffectiveSnrMapping). MU PPDUs are always fully processed.
+     *
+     * \param abstraction the PHY abstraction
+     */
+    void SetAbstraction(WifiPhyAbstraction abstraction);
+    /**
+     * \return the PHY abstraction
+     */
+    WifiPhyAbstraction GetAbstraction() const;
     /**
      * Sets the wifi radio energy model.
      *
@@ -1461,6 +1476,7 @@ class WifiPhy : public Object
     Ptr<PreambleDetectionModel> m_preambleDetectionModel; //!< Preamble detection model
     Ptr<WifiRadioEnergyModel> m_wifiRadioEnergyModel;     //!< Wifi radio energy model
     Ptr<ErrorModel> m_postReceptionErrorModel;            //!< Error model for receive packet events
+    WifiPhyAbstraction m_abstraction;                     //!< PHY abstraction
     Time m_timeLastPreambleDetected; //!< Record the time the last preamble was detected
 
     Callback<void> m_capabilitiesChangedCallback; //!< Callback when PHY capabilities changed
@@ -655,7 +655,7 @@ WifiTxVector::DeriveRuAllocation() const
         const auto ruType = it->second.ru.GetRuType();
         const auto ruBw = HeRu::GetBandwidth(ruType);
         const auto isPrimary80MHz = it->second.ru.GetPrimary80MHz();
-        const auto rusPerSubchannel = HeRu::GetRusOfType(ruBw > 20 ? ruBw : 20, ruType);
+        const auto& rusPerSubchannel = HeRu::GetRusOfType(ruBw > 20 ? ruBw : 20, ruType);
         auto ruIndex = it->second.ru.GetIndex();
         if ((m_channelWidth >= 80) && (ruIndex > 19))
         {
@@ -20,12 +20,15 @@
 
 #include "yans-error-rate-model.h"
 
+#include "error-rate-lookup-table.h"
 #include "wifi-tx-vector.h"
 #include "wifi-utils.h"
 
 #include "ns3/log.h"
 
 #include <cmath>
+#include <map>
+#include <tuple>
 
 namespace ns3
 {
@@ -153,6 +156,14 @@ YansErrorRateModel::GetFecBpskBer(double snr,
                                   uint32_t adFree) const
 {
     NS_LOG_FUNCTION(this << snr << nbits << signalSpread << phyRate << dFree << adFree);
+    if (IsLookupTableEnabled())
+    {
+        std::optional<double> pmu = LookupPmu(snr * signalSpread / phyRate, 2, dFree, adFree, 0);
+        if (pmu.has_value())
+        {
+            return std::pow(1 - std::min(pmu.value(), 1.0), nbits);
+        }
+    }
     double ber = GetBpskBer(snr, signalSpread, phyRate);
     if (ber == 0.0)
     {
@@ -177,6 +188,15 @@ YansErrorRateModel::GetFecQamBer(double snr,
 {
     NS_LOG_FUNCTION(this << snr << nbits << signalSpread << phyRate << m << dFree << adFree
                          << adFreePlusOne);
+    if (IsLookupTableEnabled())
+    {
+        std::optional<double> pmu =
+            LookupPmu(snr * signalSpread / phyRate, m, dFree, adFree, adFreePlusOne);
+        if (pmu.has_value())
+        {
+            return std::pow(1 - std::min(pmu.value(), 1.0), nbits);
+        }
+    }
     double ber = GetQamBer(snr, m, signalSpread, phyRate);
     if (ber == 0.0)
     {
@@ -193,6 +213,53 @@ YansErrorRateModel::GetFecQamBer(double snr,
     return pms;
 }
 
+double
+YansErrorRateModel::GetPmu(double ebNo,
+                           uint32_t m,
+                           uint32_t dFree,
+                           uint32_t adFree,
+                           uint32_t adFreePlusOne) const
+{
+    double ber = (m == 2 ? GetBpskBer(ebNo, 1, 1) : GetQamBer(ebNo, m, 1, 1));
+    if (ber == 0.0)
+    {
+        return 0.0;
+    }
+    double pmu = adFree * CalculatePd(ber, dFree);
+    if (m != 2)
+    {
+        pmu += adFreePlusOne * CalculatePd(ber, dFree + 1);
+    }
+    return pmu;
+}
+
+std::optional<double>
+YansErrorRateModel::LookupPmu(double ebNo,
+                              uint32_t m,
+                              uint32_t dFree,
+                              uint32_t adFree,
+                              uint32_t adFreePlusOne) const
+{
+    // the tables only depend on their key, hence they are shared by all the models
+    static std::map<std::tuple<uint32_t, uint32_t, uint32_t, uint32_t, double>,
+                    ErrorRateLookupTable>
+        tables;
+    double maxError = GetLookupTableMaxError();
+    auto key = std::make_tuple(m, dFree, adFree, adFreePlusOne, maxError);
+    auto it = tables.find(key);
+    if (it == tables.end())
+    {
+        NS_LOG_DEBUG("Create the table of the " << m << "-point constellation with dFree "
+                                                << dFree << ", adFree " << adFree
+                                                << " and adFreePlusOne " << adFreePlusOne);
+        auto pmu = [this, m, dFree, adFree, adFreePlusOne](double ebNoDb) {
+            return GetPmu(DbToRatio(ebNoDb), m, dFree, adFree, adFreePlusOne);
+        };
+        it = tables.emplace(key, ErrorRateLookupTable(pmu, -30, 100, maxError)).first;
+    }
+    return it->second.Lookup(RatioToDb(ebNo));
+}
+
 double
 YansErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
                                           const WifiTxVector& txVector,
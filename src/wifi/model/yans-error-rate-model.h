@@ -22,6 +22,8 @@
 
 #include "error-rate-model.h"
 
+#include <optional>
+
 namespace ns3
 {
 
@@ -165,6 +167,41 @@ class YansErrorRateModel : public ErrorRateModel
                         uint32_t dfree,
                         uint32_t adFree,
                         uint32_t adFreePlusOne) const;
+    /**
+     * Return the probability of error of a coded bit.  The probability is not
+     * bounded by 1, so that it is smooth enough to be interpolated.
+     *
+     * \param ebNo the energy per bit to noise ratio (not dB)
+     * \param m the constellation size (2 for BPSK)
+     * \param dFree the free distance of the code
+     * \param adFree the number of paths at the free distance
+     * \param adFreePlusOne the number of paths at the free distance plus one (unused for BPSK)
+     *
+     * \return the probability of error of a coded bit
+     */
+    double GetPmu(double ebNo,
+                  uint32_t m,
+                  uint32_t dFree,
+                  uint32_t adFree,
+                  uint32_t adFreePlusOne) const;
+    /**
+     * Return the probability of error of a coded bit, interpolated in a table
+     * shared by all the models.
+     *
+     * \param ebNo the energy per bit to noise ratio (not dB)
+     * \param m the constellation size (2 for BPSK)
+     * \param dFree the free distance of the code
+     * \param adFree the number of paths at the free distance
+     * \param adFreePlusOne the number of paths at the free distance plus one (unused for BPSK)
+     *
+     * \return the probability of error of a coded bit, or nothing if the
+     *         energy per bit to noise ratio is outside the table
+     */
+    std::optional<double> LookupPmu(double ebNo,
+                                    uint32_t m,
+                                    uint32_t dFree,
+                                    uint32_t adFree,
+                                    uint32_t adFreePlusOne) const;
 };
 
 } // namespace ns3
@@ -24,6 +24,7 @@
 #include "wifi-utils.h"
 #include "yans-wifi-phy.h"
 
+#include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
 #include "ns3/node.h"
@@ -33,6 +34,9 @@
 #include "ns3/simulator.h"
 #include "ns3/wifi-net-device.h"
 
+#include <cmath>
+#include <limits>
+
 namespace ns3
 {
 
@@ -57,11 +61,26 @@ YansWifiChannel::GetTypeId()
                           "A pointer to the propagation delay model attached to this channel.",
                           PointerValue(),
                           MakePointerAccessor(&YansWifiChannel::m_delay),
-                          MakePointerChecker<PropagationDelayModel>());
+                          MakePointerChecker<PropagationDelayModel>())
+            .AddAttribute("ReceiverGridCellSize",
+                          "The size (in meters) of the cells of the grid used to find the PHYs "
+                          "within the range of a transmission, so that the PHYs out of range "
+                          "are skipped. The range is derived from the propagation loss model "
+                          "and the RX sensitivity of the PHYs; if the propagation loss model "
+                          "does not bound it, all the PHYs are considered. Zero disables "
+                          "the grid. The mobility models of the PHYs must notify their course "
+                          "changes (e.g., WaypointMobilityModel with LazyNotify set to false).",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&YansWifiChannel::m_gridCellSize),
+                          MakeDoubleChecker<double>(0));
     return tid;
 }
 
 YansWifiChannel::YansWifiChannel()
+    : m_gridCellSize(0),
+      m_nGridPhys(0),
+      m_minRxPowerDbm(std::numeric_limits<double>::infinity()),
+      m_minRxPowerValid(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -92,41 +111,102 @@ YansWifiChannel::Send(Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double
     NS_LOG_FUNCTION(this << sender << ppdu << txPowerDbm);
     Ptr<MobilityModel> senderMobility = sender->GetMobility();
     NS_ASSERT(senderMobility);
-    for (PhyList::const_iterator i = m_phyList.begin(); i != m_phyList.end(); i++)
+    if (m_gridCellSize > 0)
     {
-        if (sender != (*i))
+        double range = GetMaxRange(ppdu, txPowerDbm);
+        if (!std::isinf(range))
         {
-            // For now don't account for inter channel interference nor channel bonding
-            if ((*i)->GetChannelNumber() != sender->GetChannelNumber())
+            UpdateGrid();
+            // the PHYs are returned in the order of the list, so that the
+            // receptions are scheduled in the same order as without the grid
+            std::vector<uint32_t> ids;
+            m_grid.GetItemsInRange(senderMobility->GetPosition(), range, ids);
+            NS_LOG_DEBUG("range=" << range << "m, " << ids.size() << " PHYs out of "
+                                  << m_phyList.size() << " in range");
+            for (uint32_t id : ids)
             {
-                continue;
+                SendTo(sender, senderMobility, m_phyList[id], ppdu, txPowerDbm);
             }
+            return;
+        }
+    }
+    for (PhyList::const_iterator i = m_phyList.begin(); i != m_phyList.end(); i++)
+    {
+        SendTo(sender, senderMobility, *i, ppdu, txPowerDbm);
+    }
+}
 
-            Ptr<MobilityModel> receiverMobility = (*i)->GetMobility()->GetObject<MobilityModel>();
-            Time delay = m_delay->GetDelay(senderMobility, receiverMobility);
-            double rxPowerDbm = m_loss->CalcRxPower(txPowerDbm, senderMobility, receiverMobility);
-            NS_LOG_DEBUG("propagation: txPower="
-                         << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, "
-                         << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
-                         << "m, delay=" << delay);
-            Ptr<NetDevice> dstNetDevice = (*i)->GetDevice();
-            uint32_t dstNode;
-            if (!dstNetDevice)
-            {
-                dstNode = 0xffffffff;
-            }
-            else
-            {
-                dstNode = dstNetDevice->GetNode()->GetId();
-            }
+void
+YansWifiChannel::SendTo(Ptr<YansWifiPhy> sender,
+                        Ptr<MobilityModel> senderMobility,
+                        Ptr<YansWifiPhy> receiver,
+                        Ptr<const WifiPpdu> ppdu,
+                        double txPowerDbm) const
+{
+    if (sender != receiver)
+    {
+        // For now don't account for inter channel interference nor channel bonding
+        if (receiver->GetChannelNumber() != sender->GetChannelNumber())
+        {
+            return;
+        }
 
-            Simulator::ScheduleWithContext(dstNode,
-                                           delay,
-                                           &YansWifiChannel::Receive,
-                                           (*i),
-                                           ppdu,
-                                           rxPowerDbm);
+        Ptr<MobilityModel> receiverMobility = receiver->GetMobility()->GetObject<MobilityModel>();
+        Time delay = m_delay->GetDelay(senderMobility, receiverMobility);
+        double rxPowerDbm = m_loss->CalcRxPower(txPowerDbm, senderMobility, receiverMobility);
+        NS_LOG_DEBUG("propagation: txPower="
+                     << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, "
+                     << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
+                     << "m, delay=" << delay);
+        Ptr<NetDevice> dstNetDevice = receiver->GetDevice();
+        uint32_t dstNode;
+        if (!dstNetDevice)
+        {
+            dstNode = 0xffffffff;
         }
+        else
+        {
+            dstNode = dstNetDevice->GetNode()->GetId();
+        }
+
+        Simulator::ScheduleWithContext(dstNode,
+                                       delay,
+                                       &YansWifiChannel::Receive,
+                                       receiver,
+                                       ppdu,
+                                       rxPowerDbm);
+    }
+}
+
+double
+YansWifiChannel::GetMaxRange(Ptr<const WifiPpdu> ppdu, double txPowerDbm) const
+{
+    // The lowest power received by a PHY that is processed, see Receive
+    if (!m_minRxPowerValid)
+    {
+        m_minRxPowerDbm = std::numeric_limits<double>::infinity();
+        for (const auto& phy : m_phyList)
+        {
+            m_minRxPowerDbm = std::min(m_minRxPowerDbm, phy->GetRxSensitivity() - phy->GetRxGain());
+        }
+        m_minRxPowerValid = true;
+    }
+    double minRxPowerDbm = m_minRxPowerDbm + RatioToDb(ppdu->GetTransmissionChannelWidth() / 20.0);
+    // enlarge the range to be robust to rounding errors
+    return m_loss->GetMaxRange(txPowerDbm, minRxPowerDbm) * (1 + 1e-9);
+}
+
+void
+YansWifiChannel::UpdateGrid() const
+{
+    if (m_grid.GetCellSize() != m_gridCellSize)
+    {
+        m_grid.SetCellSize(m_gridCellSize);
+        m_nGridPhys = 0;
+    }
+    for (; m_nGridPhys < m_phyList.size(); m_nGridPhys++)
+    {
+        m_grid.Add(m_nGridPhys, m_phyList[m_nGridPhys]->GetMobility());
     }
 }
 
@@ -166,6 +246,14 @@ YansWifiChannel::Add(Ptr<YansWifiPhy> phy)
 {
     NS_LOG_FUNCTION(this << phy);
     m_phyList.push_back(phy);
+    m_minRxPowerValid = false;
+}
+
+void
+YansWifiChannel::NotifyRxSensitivityChanged()
+{
+    NS_LOG_FUNCTION(this);
+    m_minRxPowerValid = false;
 }
 
 int64_t
@@ -21,6 +21,7 @@
 #define YANS_WIFI_CHANNEL_H
 
 #include "ns3/channel.h"
+#include "ns3/spatial-grid.h"
 
 namespace ns3
 {
@@ -32,6 +33,7 @@ class YansWifiPhy;
 class Packet;
 class Time;
 class WifiPpdu;
+class MobilityModel;
 
 /**
  * \brief a channel to interconnect ns3::YansWifiPhy objects.
@@ -41,6 +43,14 @@ class WifiPpdu;
  * class and supports an ns3::PropagationLossModel and an
  * ns3::PropagationDelayModel.  By default, no propagation models are set;
  * it is the caller's responsibility to set them before using the channel.
+ *
+ * If the ReceiverGridCellSize attribute is set, the PHYs are indexed by a
+ * SpatialGrid, and a transmission is delivered only to the PHYs that may be
+ * within the range at which the received power is above the RX sensitivity,
+ * as bounded by the propagation loss model (see
+ * PropagationLossModel::GetMaxRange).  The signals received by the other
+ * PHYs are too weak to be processed, hence they are skipped without
+ * computing their propagation loss nor scheduling their reception.
  */
 class YansWifiChannel : public Channel
 {
@@ -64,6 +74,11 @@ class YansWifiChannel : public Channel
      */
     void Add(Ptr<YansWifiPhy> phy);
 
+    /**
+     * Notify that the RX sensitivity or the RX gain of a PHY of the list changed.
+     */
+    void NotifyRxSensitivityChanged();
+
     /**
      * \param loss the new propagation loss model.
      */
@@ -113,9 +128,44 @@ class YansWifiChannel : public Channel
      */
     static void Receive(Ptr<YansWifiPhy> receiver, Ptr<const WifiPpdu> ppdu, double txPowerDbm);
 
+    /**
+     * Schedule the reception of a PPDU by a YansWifiPhy.
+     *
+     * \param sender the PHY object from which the packet is originating
+     * \param senderMobility the mobility model of the sender
+     * \param receiver the PHY object receiving the packet
+     * \param ppdu the PPDU to send
+     * \param txPowerDbm the TX power associated to the packet, in dBm
+     */
+    void SendTo(Ptr<YansWifiPhy> sender,
+                Ptr<MobilityModel> senderMobility,
+                Ptr<YansWifiPhy> receiver,
+                Ptr<const WifiPpdu> ppdu,
+                double txPowerDbm) const;
+
+    /**
+     * Get the maximum distance at which a PPDU may be received by a PHY of
+     * the channel.
+     *
+     * \param ppdu the PPDU to send
+     * \param txPowerDbm the TX power associated to the packet, in dBm
+     * \return the maximum distance, in meters, or infinity if unknown
+     */
+    double GetMaxRange(Ptr<const WifiPpdu> ppdu, double txPowerDbm) const;
+
+    /**
+     * Add the PHYs of the list which have not been added yet to the grid.
+     */
+    void UpdateGrid() const;
+
     PhyList m_phyList;                  //!< List of YansWifiPhys connected to this YansWifiChannel
     Ptr<PropagationLossModel> m_loss;   //!< Propagation loss model
     Ptr<PropagationDelayModel> m_delay; //!< Propagation delay model
+    double m_gridCellSize;              //!< Size of the cells of the grid, 0 if disabled
+    mutable SpatialGrid m_grid;         //!< Grid of the positions of the PHYs
+    mutable std::size_t m_nGridPhys;    //!< Number of PHYs of the list added to the grid
+    mutable double m_minRxPowerDbm;     //!< Lowest RX sensitivity minus RX gain of the PHYs
+    mutable bool m_minRxPowerValid;     //!< Whether m_minRxPowerDbm is up to date
 };
 
 } // namespace ns3
@@ -86,6 +86,28 @@ YansWifiPhy::SetChannel(const Ptr<YansWifiChannel> channel)
     m_channel->Add(this);
 }
 
+void
+YansWifiPhy::SetRxSensitivity(double threshold)
+{
+    NS_LOG_FUNCTION(this << threshold);
+    WifiPhy::SetRxSensitivity(threshold);
+    if (m_channel)
+    {
+        m_channel->NotifyRxSensitivityChanged();
+    }
+}
+
+void
+YansWifiPhy::SetRxGain(double gain)
+{
+    NS_LOG_FUNCTION(this << gain);
+    WifiPhy::SetRxGain(gain);
+    if (m_channel)
+    {
+        m_channel->NotifyRxSensitivityChanged();
+    }
+}
+
 void
 YansWifiPhy::StartTx(Ptr<const WifiPpdu> ppdu)
 {
@@ -61,6 +61,8 @@ class YansWifiPhy : public WifiPhy
     Ptr<Channel> GetChannel() const override;
     uint16_t GetGuardBandwidth(uint16_t currentChannelWidth) const override;
     std::tuple<double, double, double> GetTxMaskRejectionParams() const override;
+    void SetRxSensitivity(double threshold) override;
+    void SetRxGain(double gain) override;
 
     /**
      * Set the YansWifiChannel this YansWifiPhy is to be connected to.
@@ -472,6 +472,9 @@ cpp_examples = [
     ("wifi-bianchi --validate --phyMode=OfdmRate6Mbps --nMinStas=5 --nMaxStas=10 --duration=15", "True", "False"), # TODO: run from N=5 to N=50 for 400s (TAKES_FOREVER) when issue #170 is fixed
     ("wifi-bianchi --validate --phyMode=OfdmRate54Mbps --nMinStas=5 --nMaxStas=10 --duration=5 --infra", "False", "False"), # TODO: run from N=5 to N=50 for 100s (TAKES_FOREVER) when issue #170 is fixed
     ("wifi-bianchi --validate --phyMode=OfdmRate6Mbps --nMinStas=5 --nMaxStas=10 --duration=20 --infra", "False", "False"), # TODO: run from N=5 to N=50 for 600s (TAKES_FOREVER) when issue #170 is fixed
+    ("wifi-bench-scaling --nStations=2 --nBss=2 --channelWidth=20 --maxAmpduSize=0,65535 --phy=yans,spectrum --warmup=0.5 --simulationTime=0.05", "True", "False"),
+    ("wifi-bench-scaling --nStations=4 --nBss=1 --channelWidth=80 --direction=dl,ul --ofdma=1 --phy=spectrum --warmup=0.5 --simulationTime=0.05", "True", "False"),
+    ("wifi-bench-scaling --nStations=2 --nBss=2 --channelWidth=20 --phy=yans,spectrum --yansGridCellSize=50 --interferenceFloor=-100 --spectrumGridCellSize=50 --abstraction=Eesm --warmup=0.5 --simulationTime=0.05", "True", "False"),
 ]
 
 # A list of Python examples to run in order to ensure that they remain
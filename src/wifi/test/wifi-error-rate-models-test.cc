@@ -18,11 +18,13 @@
  *          Sébastien Deronne (sebastien.deronne@gmail.com)
  */
 
+#include "ns3/boolean.h"
 #include "ns3/dsss-error-rate-model.h"
 #include "ns3/he-phy.h" //includes HT and VHT
 #include "ns3/interference-helper.h"
 #include "ns3/log.h"
 #include "ns3/nist-error-rate-model.h"
+#include "ns3/object-factory.h"
 #include "ns3/table-based-error-rate-model.h"
 #include "ns3/test.h"
 #include "ns3/wifi-phy.h"
@@ -1032,6 +1034,72 @@ TableBasedErrorRateTestCase::DoRun()
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Wifi Error Rate Models Lookup Table Test Case
+ *
+ * The success rates computed with the LookupTables attribute enabled are
+ * compared with the exact ones, for every OFDM and HE mode.
+ */
+class WifiErrorRateModelsTestCaseLookupTable : public TestCase
+{
+  public:
+    WifiErrorRateModelsTestCaseLookupTable();
+
+  private:
+    void DoRun() override;
+};
+
+WifiErrorRateModelsTestCaseLookupTable::WifiErrorRateModelsTestCaseLookupTable()
+    : TestCase("WifiErrorRateModel test case lookup tables")
+{
+}
+
+void
+WifiErrorRateModelsTestCaseLookupTable::DoRun()
+{
+    std::vector<WifiMode> modes;
+    for (const auto& rate : {6, 9, 12, 18, 24, 36, 48, 54})
+    {
+        modes.emplace_back("OfdmRate" + std::to_string(rate) + "Mbps");
+    }
+    for (uint8_t mcs = 0; mcs <= 11; mcs++)
+    {
+        modes.push_back(HePhy::GetHeMcs(mcs));
+    }
+
+    for (const auto& typeId : {"ns3::NistErrorRateModel", "ns3::YansErrorRateModel"})
+    {
+        ObjectFactory factory;
+        factory.SetTypeId(typeId);
+        Ptr<ErrorRateModel> exact = factory.Create<ErrorRateModel>();
+        factory.Set("LookupTables", BooleanValue(true));
+        Ptr<ErrorRateModel> tabulated = factory.Create<ErrorRateModel>();
+
+        for (const auto& mode : modes)
+        {
+            WifiTxVector txVector;
+            txVector.SetMode(mode);
+            for (double snr = -5; snr <= 50; snr += 0.1)
+            {
+                for (uint64_t nbits : {8, 12000})
+                {
+                    double psExact =
+                        exact->GetChunkSuccessRate(mode, txVector, DbToRatio(snr), nbits);
+                    double psTabulated =
+                        tabulated->GetChunkSuccessRate(mode, txVector, DbToRatio(snr), nbits);
+                    NS_TEST_ASSERT_MSG_EQ_TOL(psTabulated,
+                                              psExact,
+                                              1e-3,
+                                              typeId << " " << mode << " SNR " << snr << " dB");
+                }
+            }
+        }
+    }
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1050,6 +1118,7 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite()
     AddTestCase(new WifiErrorRateModelsTestCaseDsss, TestCase::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseNist, TestCase::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseMimo, TestCase::QUICK);
+    AddTestCase(new WifiErrorRateModelsTestCaseLookupTable, TestCase::QUICK);
     AddTestCase(new TableBasedErrorRateTestCase("DefaultTableBasedHtMcs0-1458bytes",
                                                 HtPhy::GetHtMcs0(),
                                                 1458),
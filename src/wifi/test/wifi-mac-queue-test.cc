@@ -20,7 +20,9 @@
 #include "ns3/fcfs-wifi-queue-scheduler.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
+#include "ns3/wifi-mac-queue-container.h"
 #include "ns3/wifi-mac-queue.h"
+#include "ns3/wifi-mpdu.h"
 
 using namespace ns3;
 
@@ -120,6 +122,134 @@ WifiMacQueueDropOldestTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the extraction of MPDUs with expired lifetime from all the
+ * container queues of a WifiMacQueueContainer.
+ *
+ * MPDUs are inserted in three container queues, including an MPDU inserted at
+ * the front of a non-empty queue.  The MPDUs with expired lifetime must be
+ * extracted from all the container queues, and only them.
+ */
+class WifiMacQueueContainerExpiryTest : public TestCase
+{
+  public:
+    /**
+     * \brief Constructor
+     */
+    WifiMacQueueContainerExpiryTest();
+
+    void DoRun() override;
+
+  private:
+    /**
+     * Insert an MPDU in the container.
+     *
+     * \param pos the position at which the MPDU is inserted
+     * \param addr1 the receiver address of the MPDU
+     * \param expiryTime the expiry time of the MPDU
+     * \return the queue ID of the MPDU
+     */
+    WifiContainerQueueId Insert(WifiMacQueueContainer::const_iterator pos,
+                                Mac48Address addr1,
+                                Time expiryTime);
+
+    /**
+     * Extract the MPDUs with expired lifetime and check their number.
+     *
+     * \param expected the expected number of MPDUs with expired lifetime
+     */
+    void CheckExpired(std::size_t expected);
+
+    WifiMacQueueContainer m_container; //!< the container
+};
+
+WifiMacQueueContainerExpiryTest::WifiMacQueueContainerExpiryTest()
+    : TestCase("Test the extraction of MPDUs with expired lifetime")
+{
+}
+
+WifiContainerQueueId
+WifiMacQueueContainerExpiryTest::Insert(WifiMacQueueContainer::const_iterator pos,
+                                        Mac48Address addr1,
+                                        Time expiryTime)
+{
+    WifiMacHeader header;
+    header.SetType(WIFI_MAC_QOSDATA);
+    header.SetAddr1(addr1);
+    header.SetQosTid(0);
+    auto it = m_container.insert(pos, Create<WifiMpdu>(Create<Packet>(100), header));
+    // as done by WifiMacQueue after the insertion
+    it->expiryTime = expiryTime;
+    it->deleter = [](Ptr<WifiMpdu>) {};
+    return WifiMacQueueContainer::GetQueueId(it->mpdu);
+}
+
+void
+WifiMacQueueContainerExpiryTest::CheckExpired(std::size_t expected)
+{
+    auto [first, last] = m_container.ExtractAllExpiredMpdus();
+    NS_TEST_EXPECT_MSG_EQ(static_cast<std::size_t>(std::distance(first, last)),
+                          expected,
+                          "Unexpected number of MPDUs with expired lifetime at "
+                              << Simulator::Now().As(Time::MS));
+    for (auto it = first; it != last; ++it)
+    {
+        NS_TEST_EXPECT_MSG_LT_OR_EQ(it->expiryTime,
+                                    Simulator::Now(),
+                                    "An MPDU whose lifetime has not expired has been extracted");
+    }
+}
+
+void
+WifiMacQueueContainerExpiryTest::DoRun()
+{
+    Mac48Address addr1 = Mac48Address::Allocate();
+    Mac48Address addr2 = Mac48Address::Allocate();
+    Mac48Address addr3 = Mac48Address::Allocate();
+
+    auto queueId1 = Insert(m_container.GetQueue({WIFI_QOSDATA_UNICAST_QUEUE, addr1, 0}).cend(),
+                           addr1,
+                           MilliSeconds(10));
+    Insert(m_container.GetQueue(queueId1).cend(), addr1, MilliSeconds(30));
+    // the first MPDU of the first container queue changes
+    Insert(m_container.GetQueue(queueId1).cbegin(), addr1, MilliSeconds(5));
+    auto queueId2 = Insert(m_container.GetQueue({WIFI_QOSDATA_UNICAST_QUEUE, addr2, 0}).cend(),
+                           addr2,
+                           MilliSeconds(20));
+    auto queueId3 = Insert(m_container.GetQueue({WIFI_QOSDATA_UNICAST_QUEUE, addr3, 0}).cend(),
+                           addr3,
+                           MilliSeconds(50));
+
+    Simulator::Schedule(MilliSeconds(1), [=]() {
+        CheckExpired(0);
+        NS_TEST_EXPECT_MSG_EQ(m_container.GetQueue(queueId1).size(), 3, "Unexpected queue size");
+    });
+    Simulator::Schedule(MilliSeconds(25), [=]() {
+        CheckExpired(3);
+        NS_TEST_EXPECT_MSG_EQ(m_container.GetQueue(queueId1).size(), 1, "Unexpected queue size");
+        NS_TEST_EXPECT_MSG_EQ(m_container.GetQueue(queueId2).size(), 0, "Unexpected queue size");
+        NS_TEST_EXPECT_MSG_EQ(m_container.GetNBytes(queueId2), 0, "Unexpected queue size");
+        NS_TEST_EXPECT_MSG_EQ(m_container.GetQueue(queueId3).size(), 1, "Unexpected queue size");
+        // remove the MPDU of the third container queue before its lifetime expires
+        m_container.erase(m_container.GetQueue(queueId3).cbegin());
+    });
+    Simulator::Schedule(MilliSeconds(60), [=]() {
+        CheckExpired(1);
+        NS_TEST_EXPECT_MSG_EQ(m_container.GetQueue(queueId1).size(), 0, "Unexpected queue size");
+        auto [first, last] = m_container.GetAllExpiredMpdus();
+        NS_TEST_EXPECT_MSG_EQ(std::distance(first, last),
+                              4,
+                              "The MPDUs with expired lifetime should be kept");
+    });
+
+    Simulator::Run();
+    m_container.clear();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -136,6 +266,7 @@ WifiMacQueueTestSuite::WifiMacQueueTestSuite()
     : TestSuite("wifi-mac-queue", UNIT)
 {
     AddTestCase(new WifiMacQueueDropOldestTest, TestCase::QUICK);
+    AddTestCase(new WifiMacQueueContainerExpiryTest, TestCase::QUICK);
 }
 
 static WifiMacQueueTestSuite g_wifiMacQueueTestSuite; ///< the test suite
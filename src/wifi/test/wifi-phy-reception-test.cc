@@ -22,6 +22,7 @@
 #include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/double.h"
+#include "ns3/effective-snr-mapping.h"
 #include "ns3/he-phy.h"
 #include "ns3/he-ppdu.h"
 #include "ns3/interference-helper.h"
@@ -4289,6 +4290,268 @@ TestUnsupportedModulationReception::CheckResults()
     NS_TEST_EXPECT_MSG_EQ(m_dropped, 0, "Dropped some packets unexpectedly");
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief PHY abstraction test
+ *
+ * With the PHY abstraction enabled, a SU PPDU is received in a single step:
+ * the PHY is in RX state from the start of the PPDU and the outcome of the
+ * reception is decided at the end of the PPDU from the effective SNR of the
+ * payload, which accounts for the interference that started after the PHY
+ * header.
+ */
+class TestPhyAbstraction : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param abstraction the PHY abstraction to test
+     */
+    TestPhyAbstraction(WifiPhyAbstraction abstraction);
+
+  private:
+    void DoSetup() override;
+    void DoTeardown() override;
+    void DoRun() override;
+
+    /**
+     * Send packet function
+     * \param rxPowerDbm the transmit power in dBm
+     */
+    void SendPacket(double rxPowerDbm);
+    /**
+     * Spectrum wifi receive success function
+     * \param psdu the PSDU
+     * \param rxSignalInfo the info on the received signal (\see RxSignalInfo)
+     * \param txVector the transmit vector
+     * \param statusPerMpdu reception status per MPDU
+     */
+    void RxSuccess(Ptr<const WifiPsdu> psdu,
+                   RxSignalInfo rxSignalInfo,
+                   WifiTxVector txVector,
+                   std::vector<bool> statusPerMpdu);
+    /**
+     * Spectrum wifi receive failure function
+     * \param psdu the PSDU
+     */
+    void RxFailure(Ptr<const WifiPsdu> psdu);
+    /**
+     * Check the PHY state
+     * \param expectedState the expected PHY state
+     */
+    void CheckPhyState(WifiPhyState expectedState);
+    /**
+     * Check the number of received packets
+     * \param expectedSuccessCount the number of successfully received packets
+     * \param expectedFailureCount the number of unsuccessfully received packets
+     */
+    void CheckRxPacketCount(uint32_t expectedSuccessCount, uint32_t expectedFailureCount);
+
+    WifiPhyAbstraction m_abstraction; ///< the PHY abstraction
+    Ptr<SpectrumWifiPhy> m_phy;       ///< Phy
+    uint32_t m_countRxSuccess;        ///< count RX success
+    uint32_t m_countRxFailure;        ///< count RX failure
+    uint64_t m_uid;                   ///< the UID to use for the PPDU
+};
+
+TestPhyAbstraction::TestPhyAbstraction(WifiPhyAbstraction abstraction)
+    : TestCase("PHY abstraction test"),
+      m_abstraction(abstraction),
+      m_countRxSuccess(0),
+      m_countRxFailure(0),
+      m_uid(0)
+{
+}
+
+void
+TestPhyAbstraction::SendPacket(double rxPowerDbm)
+{
+    WifiTxVector txVector =
+        WifiTxVector(HePhy::GetHeMcs7(), 0, WIFI_PREAMBLE_HE_SU, 800, 1, 1, 0, 20, false);
+
+    Ptr<Packet> pkt = Create<Packet>(1000);
+    WifiMacHeader hdr;
+
+    hdr.SetType(WIFI_MAC_QOSDATA);
+    hdr.SetQosTid(0);
+
+    Ptr<WifiPsdu> psdu = Create<WifiPsdu>(pkt, hdr);
+    Time txDuration = m_phy->CalculateTxDuration(psdu->GetSize(), txVector, m_phy->GetPhyBand());
+
+    Ptr<WifiPpdu> ppdu =
+        Create<HePpdu>(psdu, txVector, FREQUENCY, txDuration, WIFI_PHY_BAND_5GHZ, m_uid++);
+
+    Ptr<SpectrumValue> txPowerSpectrum =
+        WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(FREQUENCY,
+                                                                    CHANNEL_WIDTH,
+                                                                    DbmToW(rxPowerDbm),
+                                                                    GUARD_WIDTH);
+
+    Ptr<WifiSpectrumSignalParameters> txParams = Create<WifiSpectrumSignalParameters>();
+    txParams->psd = txPowerSpectrum;
+    txParams->txPhy = nullptr;
+    txParams->duration = txDuration;
+    txParams->ppdu = ppdu;
+
+    m_phy->StartRx(txParams);
+}
+
+void
+TestPhyAbstraction::RxSuccess(Ptr<const WifiPsdu> psdu,
+                              RxSignalInfo rxSignalInfo,
+                              WifiTxVector txVector,
+                              std::vector<bool> statusPerMpdu)
+{
+    NS_LOG_FUNCTION(this << *psdu << rxSignalInfo << txVector);
+    m_countRxSuccess++;
+}
+
+void
+TestPhyAbstraction::RxFailure(Ptr<const WifiPsdu> psdu)
+{
+    NS_LOG_FUNCTION(this << *psdu);
+    m_countRxFailure++;
+}
+
+void
+TestPhyAbstraction::CheckPhyState(WifiPhyState expectedState)
+{
+    PointerValue ptr;
+    m_phy->GetAttribute("State", ptr);
+    Ptr<WifiPhyStateHelper> state = DynamicCast<WifiPhyStateHelper>(ptr.Get<WifiPhyStateHelper>());
+    WifiPhyState currentState = state->GetState();
+    NS_TEST_ASSERT_MSG_EQ(currentState,
+                          expectedState,
+                          "PHY State " << currentState << " does not match expected state "
+                                       << expectedState << " at " << Simulator::Now());
+}
+
+void
+TestPhyAbstraction::CheckRxPacketCount(uint32_t expectedSuccessCount,
+                                       uint32_t expectedFailureCount)
+{
+    NS_TEST_ASSERT_MSG_EQ(m_countRxSuccess,
+                          expectedSuccessCount,
+                          "Didn't receive right number of successful packets");
+    NS_TEST_ASSERT_MSG_EQ(m_countRxFailure,
+                          expectedFailureCount,
+                          "Didn't receive right number of unsuccessful packets");
+}
+
+void
+TestPhyAbstraction::DoSetup()
+{
+    m_phy = CreateObject<SpectrumWifiPhy>();
+    m_phy->ConfigureStandard(WIFI_STANDARD_80211ax);
+    Ptr<InterferenceHelper> interferenceHelper = CreateObject<InterferenceHelper>();
+    m_phy->SetInterferenceHelper(interferenceHelper);
+    Ptr<ErrorRateModel> error = CreateObject<NistErrorRateModel>();
+    m_phy->SetErrorRateModel(error);
+    m_phy->SetOperatingChannel(WifiPhy::ChannelTuple{CHANNEL_NUMBER, 0, WIFI_PHY_BAND_5GHZ, 0});
+    m_phy->SetReceiveOkCallback(MakeCallback(&TestPhyAbstraction::RxSuccess, this));
+    m_phy->SetReceiveErrorCallback(MakeCallback(&TestPhyAbstraction::RxFailure, this));
+    m_phy->SetAbstraction(m_abstraction);
+
+    Ptr<ThresholdPreambleDetectionModel> preambleDetectionModel =
+        CreateObject<ThresholdPreambleDetectionModel>();
+    preambleDetectionModel->SetAttribute("Threshold", DoubleValue(4));
+    preambleDetectionModel->SetAttribute("MinimumRssi", DoubleValue(-82));
+    m_phy->SetPreambleDetectionModel(preambleDetectionModel);
+}
+
+void
+TestPhyAbstraction::DoTeardown()
+{
+    m_phy->Dispose();
+    m_phy = nullptr;
+}
+
+void
+TestPhyAbstraction::DoRun()
+{
+    // The effective SNR of chunks with the same SNR is that SNR, and the effective SNR of
+    // chunks with different SNRs lies in between
+    EffectiveSnrMapping::Chunks chunks{{DbToRatio(10), MicroSeconds(4)},
+                                       {DbToRatio(10), MicroSeconds(8)}};
+    NS_TEST_ASSERT_MSG_EQ_TOL(EffectiveSnrMapping::Eesm(chunks, 64),
+                              DbToRatio(10),
+                              1e-9,
+                              "Unexpected EESM effective SNR");
+    NS_TEST_ASSERT_MSG_EQ_TOL(EffectiveSnrMapping::Miesm(chunks, 64),
+                              DbToRatio(10),
+                              1e-9,
+                              "Unexpected MIESM effective SNR");
+    chunks.front().first = DbToRatio(20);
+    for (uint16_t constellationSize : {2, 4, 16, 64, 256, 1024})
+    {
+        double eesm = EffectiveSnrMapping::Eesm(chunks, constellationSize);
+        double miesm = EffectiveSnrMapping::Miesm(chunks, constellationSize);
+        NS_TEST_EXPECT_MSG_GT(eesm, DbToRatio(10), "EESM effective SNR too low");
+        NS_TEST_EXPECT_MSG_LT(eesm, DbToRatio(20), "EESM effective SNR too high");
+        NS_TEST_EXPECT_MSG_GT(miesm, DbToRatio(10), "MIESM effective SNR too low");
+        NS_TEST_EXPECT_MSG_LT(miesm, DbToRatio(20), "MIESM effective SNR too high");
+    }
+
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    int64_t streamNumber = 0;
+    m_phy->AssignStreams(streamNumber);
+
+    // CASE 1: send one packet: the PHY should be in RX state from the start of the packet until
+    // the end of the packet (152.8us) and the packet should be successfully received.
+    Simulator::Schedule(Seconds(1.0), &TestPhyAbstraction::SendPacket, this, -50);
+    Simulator::Schedule(Seconds(1.0) + NanoSeconds(1),
+                        &TestPhyAbstraction::CheckPhyState,
+                        this,
+                        WifiPhyState::RX);
+    Simulator::Schedule(Seconds(1.0) + NanoSeconds(152799),
+                        &TestPhyAbstraction::CheckPhyState,
+                        this,
+                        WifiPhyState::RX);
+    Simulator::Schedule(Seconds(1.0) + NanoSeconds(152801),
+                        &TestPhyAbstraction::CheckPhyState,
+                        this,
+                        WifiPhyState::IDLE);
+    Simulator::Schedule(Seconds(1.1), &TestPhyAbstraction::CheckRxPacketCount, this, 1, 0);
+
+    // CASE 2: send a packet followed 2us later by a packet with the same power: the first
+    // packet is still being received, but its payload is received with a SINR around 0 dB,
+    // hence it should not be successfully received.
+    Simulator::Schedule(Seconds(2.0), &TestPhyAbstraction::SendPacket, this, -50);
+    Simulator::Schedule(Seconds(2.0) + MicroSeconds(2.0),
+                        &TestPhyAbstraction::SendPacket,
+                        this,
+                        -50);
+    Simulator::Schedule(Seconds(2.0) + NanoSeconds(152799),
+                        &TestPhyAbstraction::CheckPhyState,
+                        this,
+                        WifiPhyState::RX);
+    Simulator::Schedule(Seconds(2.1), &TestPhyAbstraction::CheckRxPacketCount, this, 1, 1);
+
+    // CASE 3: send a packet followed 2us later by a packet 30 dB weaker: the first packet
+    // should be successfully received.
+    Simulator::Schedule(Seconds(3.0), &TestPhyAbstraction::SendPacket, this, -50);
+    Simulator::Schedule(Seconds(3.0) + MicroSeconds(2.0),
+                        &TestPhyAbstraction::SendPacket,
+                        this,
+                        -80);
+    Simulator::Schedule(Seconds(3.1), &TestPhyAbstraction::CheckRxPacketCount, this, 2, 1);
+
+    // CASE 4: send a packet below the minimum RSSI of the preamble detection model: the
+    // packet should not be received at all.
+    Simulator::Schedule(Seconds(4.0), &TestPhyAbstraction::SendPacket, this, -90);
+    Simulator::Schedule(Seconds(4.0) + NanoSeconds(1),
+                        &TestPhyAbstraction::CheckPhyState,
+                        this,
+                        WifiPhyState::IDLE);
+    Simulator::Schedule(Seconds(4.1), &TestPhyAbstraction::CheckRxPacketCount, this, 2, 1);
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -4310,6 +4573,8 @@ WifiPhyReceptionTestSuite::WifiPhyReceptionTestSuite()
     AddTestCase(new TestPhyHeadersReception, TestCase::QUICK);
     AddTestCase(new TestAmpduReception, TestCase::QUICK);
     AddTestCase(new TestUnsupportedModulationReception(), TestCase::QUICK);
+    AddTestCase(new TestPhyAbstraction(WIFI_PHY_ABSTRACTION_EESM), TestCase::QUICK);
+    AddTestCase(new TestPhyAbstraction(WIFI_PHY_ABSTRACTION_MIESM), TestCase::QUICK);
 }
 
 static WifiPhyReceptionTestSuite wifiPhyReceptionTestSuite; ///< the test suite
@@ -24,12 +24,16 @@
 #include "ns3/ap-wifi-mac.h"
 #include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
+#include "ns3/double.h"
 #include "ns3/error-model.h"
 #include "ns3/fcfs-wifi-queue-scheduler.h"
 #include "ns3/frame-exchange-manager.h"
+#include "ns3/ht-capabilities.h"
 #include "ns3/ht-configuration.h"
+#include "ns3/ht-phy.h"
 #include "ns3/interference-helper.h"
 #include "ns3/mgt-headers.h"
+#include "ns3/minstrel-ht-wifi-manager.h"
 #include "ns3/mobility-helper.h"
 #include "ns3/multi-model-spectrum-channel.h"
 #include "ns3/packet-socket-client.h"
@@ -55,6 +59,8 @@
 #include "ns3/yans-wifi-helper.h"
 #include "ns3/yans-wifi-phy.h"
 
+#include <cmath>
+
 using namespace ns3;
 
 // Helper function to assign streams to random variables, to control
@@ -3604,6 +3610,456 @@ HeRuMcsDataRateTestCase::DoRun()
                           "Data rate verification for RUs above 52-tone RU (included) failed");
 }
 
+//-----------------------------------------------------------------------------
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Verify the (cached) sets of RUs of a given type
+ */
+class HeRuSetsTestCase : public TestCase
+{
+  public:
+    HeRuSetsTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+HeRuSetsTestCase::HeRuSetsTestCase()
+    : TestCase("Check the sets of RUs of a given type")
+{
+}
+
+void
+HeRuSetsTestCase::DoRun()
+{
+    for (uint16_t bw : {20, 40, 80, 160})
+    {
+        for (auto ruType : {HeRu::RU_26_TONE,
+                            HeRu::RU_52_TONE,
+                            HeRu::RU_106_TONE,
+                            HeRu::RU_242_TONE,
+                            HeRu::RU_484_TONE,
+                            HeRu::RU_996_TONE})
+        {
+            if (HeRu::GetBandwidth(ruType) > bw)
+            {
+                continue;
+            }
+            const auto& rus = HeRu::GetRusOfType(bw, ruType);
+            NS_TEST_EXPECT_MSG_EQ(rus.size(),
+                                  HeRu::GetNRus(bw, ruType),
+                                  "Unexpected number of " << ruType << " RUs in " << bw << " MHz");
+            NS_TEST_EXPECT_MSG_EQ(&HeRu::GetRusOfType(bw, ruType),
+                                  &rus,
+                                  "The set of RUs should be computed only once");
+            std::size_t nSecondary80MHzRus = 0;
+            for (const auto& ru : rus)
+            {
+                NS_TEST_EXPECT_MSG_EQ(ru.GetRuType(), ruType, "Unexpected RU type");
+                nSecondary80MHzRus += (ru.GetPrimary80MHz() ? 0 : 1);
+            }
+            NS_TEST_EXPECT_MSG_EQ(nSecondary80MHzRus,
+                                  (bw == 160 ? rus.size() / 2 : 0),
+                                  "Unexpected number of RUs in the secondary 80 MHz");
+        }
+    }
+
+    NS_TEST_EXPECT_MSG_EQ(HeRu::GetRusOfType(160, HeRu::RU_2x996_TONE).size(),
+                          1,
+                          "Unexpected number of 2x996-tone RUs");
+    NS_TEST_EXPECT_MSG_EQ(HeRu::GetCentral26TonesRus(80, HeRu::RU_106_TONE).size(),
+                          5,
+                          "Unexpected number of central 26-tone RUs");
+    NS_TEST_EXPECT_MSG_EQ(HeRu::GetCentral26TonesRus(160, HeRu::RU_242_TONE).size(),
+                          2,
+                          "Unexpected number of central 26-tone RUs");
+    NS_TEST_EXPECT_MSG_EQ(&HeRu::GetCentral26TonesRus(160, HeRu::RU_242_TONE),
+                          &HeRu::GetCentral26TonesRus(160, HeRu::RU_242_TONE),
+                          "The set of central 26-tone RUs should be computed only once");
+}
+
+//-----------------------------------------------------------------------------
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the receiver grid of the YansWifiChannel
+ *
+ * Three nodes are placed at 0, 10 and 1000 meters, and the first node sends
+ * two broadcast frames.  The node at 1000 meters is beyond the range of the
+ * transmissions.  With and without the receiver grid, the node at 10 meters
+ * receives the frames; with the grid, the receptions of the node at 1000
+ * meters are not scheduled, hence the simulation executes one event less
+ * per frame.
+ */
+class YansWifiChannelGridTest : public TestCase
+{
+  public:
+    YansWifiChannelGridTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run the scenario
+     * \param cellSize the size of the cells of the receiver grid
+     * \param lowerSensitivity whether to lower the RX sensitivity of the far node
+     *        between the two frames, so that it is in range of the second frame
+     * \return the number of events executed
+     */
+    uint64_t RunOne(double cellSize, bool lowerSensitivity);
+
+    /**
+     * Callback invoked when a PHY starts receiving a packet
+     * \param node the index of the receiving node
+     * \param p the packet
+     * \param rxPowersW the received power per channel band in watts
+     */
+    void PhyRxBegin(uint32_t node, Ptr<const Packet> p, RxPowerWattPerChannelBand rxPowersW);
+
+    std::vector<uint32_t> m_rxBegin; ///< number of receptions started per node
+};
+
+YansWifiChannelGridTest::YansWifiChannelGridTest()
+    : TestCase("Test the receiver grid of the YansWifiChannel")
+{
+}
+
+void
+YansWifiChannelGridTest::PhyRxBegin(uint32_t node,
+                                    Ptr<const Packet> p,
+                                    RxPowerWattPerChannelBand rxPowersW)
+{
+    m_rxBegin[node]++;
+}
+
+uint64_t
+YansWifiChannelGridTest::RunOne(double cellSize, bool lowerSensitivity)
+{
+    m_rxBegin.assign(3, 0);
+
+    NodeContainer nodes(3);
+    MobilityHelper mobility;
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    positionAlloc->Add(Vector(10.0, 0.0, 0.0));
+    positionAlloc->Add(Vector(1000.0, 0.0, 0.0));
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(nodes);
+
+    Ptr<YansWifiChannel> channel = YansWifiChannelHelper::Default().Create();
+    channel->SetAttribute("ReceiverGridCellSize", DoubleValue(cellSize));
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211a);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("OfdmRate6Mbps"));
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    NetDeviceContainer devices = wifi.Install(phy, mac, nodes);
+    wifi.AssignStreams(devices, 100);
+
+    for (uint32_t i = 0; i < devices.GetN(); i++)
+    {
+        DynamicCast<WifiNetDevice>(devices.Get(i))
+            ->GetPhy()
+            ->TraceConnectWithoutContext(
+                "PhyRxBegin",
+                MakeCallback(&YansWifiChannelGridTest::PhyRxBegin, this, i));
+    }
+
+    Ptr<NetDevice> sender = devices.Get(0);
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        Simulator::Schedule(Seconds(1.0 + i), [=]() {
+            sender->Send(Create<Packet>(1000), sender->GetBroadcast(), 1);
+        });
+    }
+    if (lowerSensitivity)
+    {
+        // the far node receives about -121 dBm
+        Ptr<WifiPhy> farPhy = DynamicCast<WifiNetDevice>(devices.Get(2))->GetPhy();
+        Simulator::Schedule(Seconds(1.5), &WifiPhy::SetRxSensitivity, farPhy, -130);
+    }
+
+    uint64_t events = Simulator::GetEventCount();
+    Simulator::Stop(Seconds(3.0));
+    Simulator::Run();
+    events = Simulator::GetEventCount() - events;
+    Simulator::Destroy();
+    return events;
+}
+
+void
+YansWifiChannelGridTest::DoRun()
+{
+    uint64_t events = RunOne(0, false);
+    NS_TEST_EXPECT_MSG_EQ(m_rxBegin[1], 2, "The near node should receive the frames");
+    NS_TEST_EXPECT_MSG_EQ(m_rxBegin[2], 0, "The far node should not receive the frames");
+
+    uint64_t gridEvents = RunOne(100, false);
+    NS_TEST_EXPECT_MSG_EQ(m_rxBegin[1], 2, "The near node should receive the frames");
+    NS_TEST_EXPECT_MSG_EQ(m_rxBegin[2], 0, "The far node should not receive the frames");
+    NS_TEST_EXPECT_MSG_EQ(gridEvents + 2,
+                          events,
+                          "The receptions of the far node should not be scheduled");
+
+    // the range used by the grid must follow the changes of the RX sensitivity
+    events = RunOne(0, true);
+    gridEvents = RunOne(100, true);
+    NS_TEST_EXPECT_MSG_EQ(gridEvents + 1,
+                          events,
+                          "Only the first reception of the far node should not be scheduled");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the statistics of the Minstrel-HT rate manager
+ *
+ * Three HT stations (one spatial stream, 20 MHz, long guard interval) are
+ * initialized at the same time, and A-MPDU TX statuses are reported for
+ * known rates. The test checks that the first updates of the statistics of
+ * the stations are staggered over an update interval, and that the
+ * statistics of the rates of the group and the best rates selected after
+ * the updates are those expected from the reported TX statuses.
+ */
+class MinstrelHtStatsTest : public TestCase
+{
+  public:
+    MinstrelHtStatsTest();
+
+  private:
+    void DoRun() override;
+
+    /// Create and initialize the stations, then check their next update times
+    void CreateStations();
+
+    /**
+     * Report the TX status of an A-MPDU sent to a station
+     * \param index the index of the station
+     * \param mcs the MCS used to transmit the A-MPDU
+     * \param nSuccessfulMpdus the number of MPDUs acknowledged
+     * \param nFailedMpdus the number of MPDUs not acknowledged
+     */
+    void ReportAmpduTxStatus(std::size_t index,
+                             uint8_t mcs,
+                             uint16_t nSuccessfulMpdus,
+                             uint16_t nFailedMpdus);
+
+    /// Check the statistics after the first update of the first station
+    void CheckFirstUpdate();
+
+    /// Check the statistics after the second update of the first station
+    void CheckSecondUpdate();
+
+    Ptr<MinstrelHtWifiManager> m_manager;                 ///< the rate manager
+    WifiRemoteStationState m_state;                       ///< the state shared by the stations
+    std::vector<MinstrelHtWifiRemoteStation*> m_stations; ///< the stations
+    uint8_t m_groupId;                                    ///< the group supported by the stations
+};
+
+MinstrelHtStatsTest::MinstrelHtStatsTest()
+    : TestCase("Test the statistics updates of the Minstrel-HT rate manager"),
+      m_state(),
+      m_groupId(0)
+{
+}
+
+void
+MinstrelHtStatsTest::CreateStations()
+{
+    m_state.m_address = Mac48Address::Allocate();
+    m_state.m_htCapabilities = Create<HtCapabilities>();
+    m_state.m_channelWidth = 20;
+    m_state.m_guardInterval = 800;
+    m_state.m_aggregation = true;
+    for (uint8_t mcs = 0; mcs < 8; mcs++)
+    {
+        m_state.m_operationalMcsSet.push_back(HtPhy::GetHtMcs(mcs));
+    }
+
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        auto station = static_cast<MinstrelHtWifiRemoteStation*>(m_manager->DoCreateStation());
+        station->m_state = &m_state;
+        m_manager->CheckInit(station);
+        m_stations.push_back(station);
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(m_stations[0]->m_supportedGroups.size(),
+                          1,
+                          "The stations should support a single group");
+    m_groupId = m_stations[0]->m_supportedGroups[0];
+
+    // The offsets of the first updates follow the fractional parts of the multiples of the
+    // golden ratio conjugate: 0, 0.618 and 0.236 update intervals
+    const std::vector<double> offsets{0, 0.618034, 0.236068};
+    for (std::size_t i = 0; i < m_stations.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_stations[i]->m_nextStatsUpdate.GetMicroSeconds(),
+                                  50000 * (1 + offsets[i]),
+                                  1,
+                                  "Unexpected time of the first update of station " << i);
+    }
+}
+
+void
+MinstrelHtStatsTest::ReportAmpduTxStatus(std::size_t index,
+                                         uint8_t mcs,
+                                         uint16_t nSuccessfulMpdus,
+                                         uint16_t nFailedMpdus)
+{
+    MinstrelHtWifiRemoteStation* station = m_stations[index];
+    station->m_txrate = m_manager->GetIndex(m_groupId, mcs);
+    m_manager->DoReportAmpduTxStatus(station, nSuccessfulMpdus, nFailedMpdus, 20, 20, 20, 1);
+}
+
+void
+MinstrelHtStatsTest::CheckFirstUpdate()
+{
+    const MinstrelHtRateStats& stats = m_stations[0]->m_groupsTable[m_groupId].m_stats;
+
+    // 10 successes out of 20 attempts
+    NS_TEST_EXPECT_MSG_EQ_TOL(stats.prob[3], 50, 1e-9, "Unexpected probability of MCS 3");
+    NS_TEST_EXPECT_MSG_EQ_TOL(stats.ewmaProb[3], 50, 1e-9, "Unexpected EWMA of MCS 3");
+    NS_TEST_EXPECT_MSG_EQ(stats.prevNumRateAttempt[3], 20, "Unexpected attempts of MCS 3");
+    NS_TEST_EXPECT_MSG_EQ(stats.prevNumRateSuccess[3], 10, "Unexpected successes of MCS 3");
+    NS_TEST_EXPECT_MSG_EQ(stats.attemptHist[3], 20, "Unexpected attempt history of MCS 3");
+    NS_TEST_EXPECT_MSG_EQ(stats.successHist[3], 10, "Unexpected success history of MCS 3");
+    NS_TEST_EXPECT_MSG_EQ(stats.numRateAttempt[3], 0, "A new interval should have started");
+    NS_TEST_EXPECT_MSG_EQ_TOL(stats.throughput[3],
+                              50 / stats.perfectTxTime[3],
+                              1e-6,
+                              "Unexpected throughput of MCS 3");
+    // 9 successes out of 10 attempts
+    NS_TEST_EXPECT_MSG_EQ_TOL(stats.ewmaProb[5], 90, 1e-9, "Unexpected EWMA of MCS 5");
+    NS_TEST_EXPECT_MSG_EQ_TOL(stats.throughput[5],
+                              90 / stats.perfectTxTime[5],
+                              1e-6,
+                              "Unexpected throughput of MCS 5");
+    // 3 successes out of 20 attempts
+    NS_TEST_EXPECT_MSG_EQ_TOL(stats.ewmaProb[7], 15, 1e-9, "Unexpected EWMA of MCS 7");
+    // no attempts since the initialization of the station, which also updates the statistics
+    NS_TEST_EXPECT_MSG_EQ(stats.numSamplesSkipped[0], 2, "MCS 0 should have been skipped");
+    NS_TEST_EXPECT_MSG_EQ(stats.throughput[0], 0, "MCS 0 should have no throughput");
+
+    NS_TEST_EXPECT_MSG_EQ(m_stations[0]->m_maxTpRate,
+                          m_manager->GetIndex(m_groupId, 5),
+                          "MCS 5 should have the highest throughput");
+    NS_TEST_EXPECT_MSG_EQ(m_stations[0]->m_maxTpRate2,
+                          m_manager->GetIndex(m_groupId, 3),
+                          "MCS 3 should have the second highest throughput");
+    NS_TEST_EXPECT_MSG_EQ(m_stations[0]->m_maxProbRate,
+                          m_manager->GetIndex(m_groupId, 5),
+                          "MCS 5 should be the highest probability rate");
+
+    // The statistics of the second station are not updated before its staggered update time
+    const MinstrelHtRateStats& otherStats = m_stations[1]->m_groupsTable[m_groupId].m_stats;
+    NS_TEST_EXPECT_MSG_EQ(otherStats.numRateAttempt[3], 20, "Second station updated too early");
+    NS_TEST_EXPECT_MSG_EQ(otherStats.numRateAttempt[5], 10, "Second station updated too early");
+    NS_TEST_EXPECT_MSG_EQ(otherStats.attemptHist[3], 0, "Second station updated too early");
+}
+
+void
+MinstrelHtStatsTest::CheckSecondUpdate()
+{
+    const MinstrelHtRateStats& stats = m_stations[0]->m_groupsTable[m_groupId].m_stats;
+
+    // 30 successes out of 40 attempts, averaged with the previous probability of 50%
+    NS_TEST_EXPECT_MSG_EQ_TOL(stats.prob[3], 75, 1e-9, "Unexpected probability of MCS 3");
+    NS_TEST_EXPECT_MSG_EQ_TOL(stats.ewmaProb[3],
+                              (75 * 25 + 50 * 75) / 100.0,
+                              1e-9,
+                              "Unexpected EWMA of MCS 3");
+    NS_TEST_EXPECT_MSG_EQ_TOL(stats.ewmsdProb[3],
+                              std::sqrt(75 * 25 * 25 * 25 / 1e4),
+                              1e-9,
+                              "Unexpected EWMSD of MCS 3");
+    NS_TEST_EXPECT_MSG_EQ(stats.attemptHist[3], 60, "Unexpected attempt history of MCS 3");
+    NS_TEST_EXPECT_MSG_EQ(stats.successHist[3], 40, "Unexpected success history of MCS 3");
+    // MCS 5 not attempted, its statistics are kept
+    NS_TEST_EXPECT_MSG_EQ(stats.numSamplesSkipped[5], 1, "MCS 5 should have been skipped");
+    NS_TEST_EXPECT_MSG_EQ_TOL(stats.ewmaProb[5], 90, 1e-9, "Unexpected EWMA of MCS 5");
+    NS_TEST_EXPECT_MSG_EQ(m_stations[0]->m_maxTpRate,
+                          m_manager->GetIndex(m_groupId, 5),
+                          "MCS 5 should still have the highest throughput");
+
+    // The second station has been updated at its staggered update time
+    const MinstrelHtRateStats& otherStats = m_stations[1]->m_groupsTable[m_groupId].m_stats;
+    NS_TEST_EXPECT_MSG_EQ(otherStats.prevNumRateAttempt[3], 21, "Unexpected attempts of MCS 3");
+    NS_TEST_EXPECT_MSG_EQ(otherStats.prevNumRateAttempt[5], 10, "Unexpected attempts of MCS 5");
+    NS_TEST_EXPECT_MSG_EQ_TOL(otherStats.ewmaProb[5], 90, 1e-9, "Unexpected EWMA of MCS 5");
+}
+
+void
+MinstrelHtStatsTest::DoRun()
+{
+    NodeContainer nodes;
+    nodes.Create(1);
+
+    YansWifiPhyHelper phy;
+    phy.SetChannel(YansWifiChannelHelper::Default().Create());
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211n);
+    wifi.SetRemoteStationManager("ns3::MinstrelHtWifiManager",
+                                 "UpdateStatistics",
+                                 TimeValue(MilliSeconds(50)),
+                                 "EWMA",
+                                 UintegerValue(75));
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    NetDeviceContainer devices = wifi.Install(phy, mac, nodes);
+    m_manager = DynamicCast<MinstrelHtWifiManager>(
+        DynamicCast<WifiNetDevice>(devices.Get(0))->GetRemoteStationManager());
+
+    // The rate manager is initialized along with the node, at time zero
+    Simulator::Schedule(Seconds(0), &MinstrelHtStatsTest::CreateStations, this);
+
+    auto report = [this](Time at, std::size_t i, uint8_t mcs, uint16_t nSuccess, uint16_t nFailed) {
+        Simulator::Schedule(at,
+                            &MinstrelHtStatsTest::ReportAmpduTxStatus,
+                            this,
+                            i,
+                            mcs,
+                            nSuccess,
+                            nFailed);
+    };
+
+    // First interval: no update until 50 ms for the first station, 80.9 ms for the second one
+    report(MilliSeconds(10), 0, 3, 10, 10);
+    report(MilliSeconds(20), 0, 7, 3, 17);
+    report(MilliSeconds(30), 1, 3, 10, 10);
+    report(MilliSeconds(60), 0, 5, 9, 1);
+    report(MilliSeconds(60), 1, 5, 9, 1);
+    Simulator::Schedule(MilliSeconds(61), &MinstrelHtStatsTest::CheckFirstUpdate, this);
+
+    // Second interval: next update at 110 ms for the first station
+    report(MilliSeconds(70), 0, 3, 20, 0);
+    report(MilliSeconds(90), 1, 3, 1, 0);
+    report(MilliSeconds(120), 0, 3, 10, 10);
+    Simulator::Schedule(MilliSeconds(121), &MinstrelHtStatsTest::CheckSecondUpdate, this);
+
+    Simulator::Run();
+
+    for (auto station : m_stations)
+    {
+        delete station;
+    }
+    m_stations.clear();
+    m_manager = nullptr;
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -3636,6 +4092,9 @@ WifiTestSuite::WifiTestSuite()
     AddTestCase(new IdealRateManagerChannelWidthTest, TestCase::QUICK);
     AddTestCase(new IdealRateManagerMimoTest, TestCase::QUICK);
     AddTestCase(new HeRuMcsDataRateTestCase, TestCase::QUICK);
+    AddTestCase(new HeRuSetsTestCase, TestCase::QUICK);
+    AddTestCase(new YansWifiChannelGridTest, TestCase::QUICK);
+    AddTestCase(new MinstrelHtStatsTest, TestCase::QUICK);
 }
 
 static WifiTestSuite g_wifiTestSuite; ///< the test suite
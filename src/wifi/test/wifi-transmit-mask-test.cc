@@ -306,6 +306,94 @@ WifiOfdmMaskSlopesTestCase::DoRun()
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test that the transmit power spectral densities built from a cached shape are scaled
+ * by the transmit power, and that they can be modified without altering the cached shape.
+ */
+class WifiTxPsdShapeCacheTestCase : public TestCase
+{
+  public:
+    WifiTxPsdShapeCacheTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check that a PSD is equal to another PSD scaled by a given factor
+     *
+     * \param psd the PSD to check
+     * \param reference the reference PSD
+     * \param factor the factor
+     */
+    void CheckScaled(Ptr<const SpectrumValue> psd,
+                     Ptr<const SpectrumValue> reference,
+                     double factor);
+};
+
+WifiTxPsdShapeCacheTestCase::WifiTxPsdShapeCacheTestCase()
+    : TestCase("Check the cache of the shapes of the transmit power spectral densities")
+{
+}
+
+void
+WifiTxPsdShapeCacheTestCase::CheckScaled(Ptr<const SpectrumValue> psd,
+                                         Ptr<const SpectrumValue> reference,
+                                         double factor)
+{
+    NS_TEST_ASSERT_MSG_EQ(psd->GetSpectrumModel()->GetUid(),
+                          reference->GetSpectrumModel()->GetUid(),
+                          "Unexpected spectrum model");
+    auto vit = psd->ConstValuesBegin();
+    for (auto rit = reference->ConstValuesBegin(); rit != reference->ConstValuesEnd(); ++rit, ++vit)
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(*vit, *rit * factor, *rit * factor * 1e-12, "Unexpected value");
+    }
+}
+
+void
+WifiTxPsdShapeCacheTestCase::DoRun()
+{
+    Ptr<SpectrumValue> ofdm =
+        WifiSpectrumValueHelper::CreateOfdmTxPowerSpectralDensity(5180, 20, 0.1, 20);
+    CheckScaled(WifiSpectrumValueHelper::CreateOfdmTxPowerSpectralDensity(5180, 20, 0.4, 20),
+                ofdm,
+                4);
+
+    // modifying a PSD does not affect the next ones
+    Ptr<SpectrumValue> reference = ofdm->Copy();
+    *ofdm *= 0;
+    CheckScaled(WifiSpectrumValueHelper::CreateOfdmTxPowerSpectralDensity(5180, 20, 0.1, 20),
+                reference,
+                1);
+
+    Ptr<SpectrumValue> he =
+        WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(5210, 80, 0.1, 80);
+    CheckScaled(WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(5210, 80, 0.05, 80),
+                he,
+                0.5);
+
+    // the shapes differ by mask parameters and by punctured subchannels: check a subcarrier
+    // in the guard band just below the channel and one in the first 20 MHz subchannel
+    Ptr<SpectrumValue> heMask =
+        WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(5210, 80, 0.1, 80, -10);
+    NS_TEST_EXPECT_MSG_GT((*heMask)[1014], (*he)[1014], "Mask parameters not taken into account");
+    Ptr<SpectrumValue> hePunctured =
+        WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(5210,
+                                                                    80,
+                                                                    0.1,
+                                                                    80,
+                                                                    -20,
+                                                                    -28,
+                                                                    -40,
+                                                                    {true, false, false, false});
+    NS_TEST_EXPECT_MSG_LT((*hePunctured)[1152],
+                          (*he)[1152],
+                          "Punctured subchannels not taken into account");
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -329,6 +417,8 @@ WifiTransmitMaskTestSuite::WifiTransmitMaskTestSuite()
 
     NS_LOG_INFO("Creating WifiTransmitMaskTestSuite");
 
+    AddTestCase(new WifiTxPsdShapeCacheTestCase, TestCase::QUICK);
+
     WifiOfdmMaskSlopesTestCase::IndexPowerVect maskSlopes;
     double tol = 10e-2; // in dB
     double prec = 10;   // in decimals